@@ -14,6 +14,10 @@
 #include "trajectories.h"
 #include "xbee.h"
 
+#ifdef FIXED_MPC_POSITION_CONTROLLER
+#include "fixedMpc.h"
+#endif
+
 /* -------------------------------------------------------------------- */
 /*	Execution rate of this task	is vital								*/
 /* -------------------------------------------------------------------- */
@@ -113,6 +117,9 @@ void commTask(void *p) {
 			// parse it and handle the message if it is complete
 			if (stmParseChar(inChar, &stmMessage)) {
 				
+				// the states and the outputs are computed on this board, STM is not used
+				#ifndef FIXED_MPC_POSITION_CONTROLLER
+				
 				// index for iterating the rxBuffer
 				int idx = 0;
 				
@@ -172,6 +179,8 @@ void commTask(void *p) {
 					kalmanStates.aileron.acceleration_input = readFloat(stmMessage.messageBuffer, &idx);
 					kalmanStates.aileron.acceleration_error = readFloat(stmMessage.messageBuffer, &idx);
 				}
+				
+				#endif
 			}
 		}
 		
@@ -214,6 +223,11 @@ if (usartBufferGetByte(usart_buffer_2, &inChar, 0)) {
 			
 			rpiOk = 1;
 			
+			#ifdef RASPBERRY_POSITION_FUSION
+			// the position belongs to an older px4flow measurement than the last one sent
+			stmSendPosition(rpix, rpiy, stmMeasurementSequence - 1 - RASPBERRY_POSITION_DELAY);
+			#endif
+			
 			led_green_on();
 			
 			break;
@@ -467,6 +481,35 @@ if (usartBufferGetByte(usart_buffer_2, &inChar, 0))  {
 				led_yellow_toggle();
 					
 				stmSendMeasurement(elevatorSpeed, aileronSpeed, mpcElevatorOutput, mpcAileronOutput);
+				
+				#ifdef FIXED_MPC_POSITION_CONTROLLER
+				
+				/* -------------------------------------------------------------------- */
+				/*	The kalman filter of this board, the same data as sent to ARM		*/
+				/* -------------------------------------------------------------------- */
+				
+				fixedAxis_t fixedStates;
+				
+				// only this task writes the states, controllersTask reads them in a critical section
+				fixedStates = elevatorFixed;
+				fixedKalmanStep(&fixedStates, fixedFromFloat(elevatorSpeed), mpcElevatorOutput);
+				
+				portENTER_CRITICAL();
+				elevatorFixed = fixedStates;
+				portEXIT_CRITICAL();
+				
+				fixedStates = aileronFixed;
+				fixedKalmanStep(&fixedStates, fixedFromFloat(aileronSpeed), mpcAileronOutput);
+				
+				portENTER_CRITICAL();
+				aileronFixed = fixedStates;
+				portEXIT_CRITICAL();
+				
+				// the float copy for the log
+				fixedCopyStates(&elevatorFixed, &kalmanStates.elevator);
+				fixedCopyStates(&aileronFixed, &kalmanStates.aileron);
+				
+				#endif
 			}
 		}
 		
@@ -479,16 +522,42 @@ if (usartBufferGetByte(usart_buffer_2, &inChar, 0))  {
 	
 				// send message to STM to reset Kalman filter
 				stmResetKalman(main2commMessage.data.simpleSetpoint.elevator, main2commMessage.data.simpleSetpoint.aileron);
+				
+				#ifdef FIXED_MPC_POSITION_CONTROLLER
+				portENTER_CRITICAL();
+				fixedKalmanReset(&elevatorFixed, main2commMessage.data.simpleSetpoint.elevator);
+				fixedKalmanReset(&aileronFixed, main2commMessage.data.simpleSetpoint.aileron);
+				portEXIT_CRITICAL();
+				#endif
 			
 			} else if (main2commMessage.messageType == SET_SETPOINT) {
 				
 				// send message to STM to set a single-point setpoint
 				stmSendSetpoint(main2commMessage.data.simpleSetpoint.elevator, main2commMessage.data.simpleSetpoint.aileron);
+				
+				#ifdef FIXED_MPC_POSITION_CONTROLLER
+				portENTER_CRITICAL();
+				elevatorFixed.setpoint = fixedFromFloat(main2commMessage.data.simpleSetpoint.elevator);
+				aileronFixed.setpoint = fixedFromFloat(main2commMessage.data.simpleSetpoint.aileron);
+				portEXIT_CRITICAL();
+				mpcSetpoints.elevator = main2commMessage.data.simpleSetpoint.elevator;
+				mpcSetpoints.aileron = main2commMessage.data.simpleSetpoint.aileron;
+				#endif
 
 			} else if (main2commMessage.messageType == SET_TRAJECTORY) {
 				
 				// send message to STM to set a 5-point trajectory
-				stmSendTrajectory(main2commMessage.data.trajectory.elevatorTrajectory, main2commMessage.data.trajectory.aileronTrajectory);
+				stmSendTrajectory(main2commMessage.data.trajectory.elevatorTrajectory, main2commMessage.data.trajectory.aileronTrajectory, main2commMessage.data.trajectory.index);
+				
+				// the fixed-point MPC follows the setpoints only, the trajectory is followed by its current point
+				#ifdef FIXED_MPC_POSITION_CONTROLLER
+				portENTER_CRITICAL();
+				elevatorFixed.setpoint = fixedFromFloat(main2commMessage.data.trajectory.elevatorTrajectory[0]);
+				aileronFixed.setpoint = fixedFromFloat(main2commMessage.data.trajectory.aileronTrajectory[0]);
+				portEXIT_CRITICAL();
+				mpcSetpoints.elevator = main2commMessage.data.trajectory.elevatorTrajectory[0];
+				mpcSetpoints.aileron = main2commMessage.data.trajectory.aileronTrajectory[0];
+				#endif
 			}
 		}
 	}
@@ -27,6 +27,7 @@ typedef struct {
 	
 	float elevatorTrajectory[5];
 	float aileronTrajectory[5];
+	int16_t index;		// index of the first key-point in the trajectory
 } trajectorySetpoint_t;
 
 typedef union {
@@ -23,6 +23,10 @@
 // #define PID_POSITION_CONTROLLER		1
 #define MPC_POSITION_CONTROLLER		1
 
+// the kalman filter and the MPC computed on this board in fixed point (fixedMpc.c), flies without the STM
+// the tables in fixedMpcTables.c are created by "MPC matlab/xmegaFixedPoint.m" for one UAV model
+// #define FIXED_MPC_POSITION_CONTROLLER	1
+
 /* -------------------------------------------------------------------- */
 /*	Choose UAV model													*/
 /* -------------------------------------------------------------------- */
@@ -39,6 +43,13 @@
 
 	#define RASPBERRY_FORWARD	1
 	// #define RASPBERRY_DOWNWARD	1
+	
+	// uncomment to send the positions from Raspberry to the kalman filter on STM (KALMAN_POSITION_FUSION there)
+	// the position has to be in the frame of the kalman filter
+	// #define RASPBERRY_POSITION_FUSION	1
+	
+	// the age of the Raspberry position when it arrives, in the px4flow measurements (10 ms)
+	#define RASPBERRY_POSITION_DELAY	5
 
 #endif
 	
@@ -68,16 +79,16 @@
 #endif
 
 // check if only one position controller is used at the time
-#if defined(MPC_POSITION_CONTROLLER) && defined(PID_POSITION_CONTROLLER)
+#if (defined(MPC_POSITION_CONTROLLER) + defined(PID_POSITION_CONTROLLER) + defined(FIXED_MPC_POSITION_CONTROLLER)) > 1
 
-	#error PID and MPC position controllers cannot be used simultaneously
+	#error PID, MPC and fixed-point MPC position controllers cannot be used simultaneously
 
 #endif
 
 // check if the position controller is specified
-#if ! (defined(MPC_POSITION_CONTROLLER)  || defined(PID_POSITION_CONTROLLER))
+#if ! (defined(MPC_POSITION_CONTROLLER)  || defined(PID_POSITION_CONTROLLER) || defined(FIXED_MPC_POSITION_CONTROLLER))
 
-	#error No position controller is specified (PID, MPC)
+	#error No position controller is specified (PID, MPC, FIXED_MPC)
 
 #endif
 
@@ -11,6 +11,10 @@
 #include "controllers.h"
 #include "mpcHandler.h"
 
+#ifdef FIXED_MPC_POSITION_CONTROLLER
+#include "fixedMpc.h"
+#endif
+
 void controllersTask(void *p) {
 	
 	while (1) {
@@ -43,6 +47,36 @@ void controllersTask(void *p) {
 		
 		#endif
 		
+		#ifdef FIXED_MPC_POSITION_CONTROLLER
+		
+			fixedAxis_t fixedStates;
+			int16_t tempInt;
+			
+			// computed all the time as on STM, the outputs are applied only with the position controller enabled
+			// the states are updated by commTask with each px4flow measurement
+			portENTER_CRITICAL();
+			fixedStates = elevatorFixed;
+			portEXIT_CRITICAL();
+			
+			tempInt = fixedMpcStep(&fixedStates);
+			
+			// stop the realtime OS from context switching while copying the result
+			portENTER_CRITICAL();
+			controllerElevatorOutput = tempInt;
+			mpcElevatorOutput = tempInt;
+			fixedStates = aileronFixed;
+			portEXIT_CRITICAL();
+			
+			tempInt = fixedMpcStep(&fixedStates);
+			
+			// stop the realtime OS from context switching while copying the result
+			portENTER_CRITICAL();
+			controllerAileronOutput = tempInt;
+			mpcAileronOutput = tempInt;
+			portEXIT_CRITICAL();
+		
+		#endif
+		
 		// makes the 70Hz loop
 		vTaskDelay(14);
 	}
@@ -0,0 +1,175 @@
+/*
+ * fixedMpc.c
+ *
+ * Created: 17.10.2015 10:12:55
+ *  Author: Tomas Baca
+ */ 
+
+#include "fixedMpc.h"
+
+/* -------------------------------------------------------------------- */
+/*	The states of both axes												*/
+/* -------------------------------------------------------------------- */
+
+volatile fixedAxis_t elevatorFixed;
+volatile fixedAxis_t aileronFixed;
+
+/* -------------------------------------------------------------------- */
+/*	Saturating arithmetic												*/
+/* -------------------------------------------------------------------- */
+
+// saturate a wide value to int32_t
+static int32_t fixedSaturate(const int64_t value) {
+
+	if (value > INT32_MAX)
+		return INT32_MAX;
+	else if (value < INT32_MIN)
+		return INT32_MIN;
+	else
+		return (int32_t) value;
+}
+
+// a + b saturated to int32_t
+static int32_t fixedAdd(const int32_t a, const int32_t b) {
+
+	int32_t sum = (int32_t) ((uint32_t) a + (uint32_t) b);
+
+	// an overflow only happens with the same signs and changes the sign
+	if (a >= 0 && b >= 0 && sum < 0)
+		return INT32_MAX;
+	else if (a < 0 && b < 0 && sum >= 0)
+		return INT32_MIN;
+
+	return sum;
+}
+
+// a - b saturated to int32_t
+static int32_t fixedSubtract(const int32_t a, const int32_t b) {
+
+	return fixedSaturate((int64_t) a - b);
+}
+
+// value*gain*2^-shift rounded to the nearest, the product fits in 47 bits (shift >= 1)
+static int32_t fixedMultiply(const int32_t value, const int16_t gain, const int8_t shift) {
+
+	int64_t product = (int64_t) value*gain;
+
+	// the arithmetic shift rounds down, the half of the last bit makes it the nearest
+	return fixedSaturate((product + ((int64_t) 1 << (shift - 1))) >> shift);
+}
+
+/* -------------------------------------------------------------------- */
+/*	Conversions															*/
+/* -------------------------------------------------------------------- */
+
+int32_t fixedFromFloat(const float value) {
+
+	const float scaled = value*((float) ((int32_t) 1 << FIXED_STATE_SHIFT));
+
+	if (scaled >= 2147483520.0)
+		return INT32_MAX;
+	else if (scaled <= -2147483520.0)
+		return INT32_MIN;
+
+	// round to the nearest
+	return (int32_t) (scaled >= 0 ? scaled + 0.5 : scaled - 0.5);
+}
+
+float fixedToFloat(const int32_t value) {
+
+	return ((float) value)/((float) ((int32_t) 1 << FIXED_STATE_SHIFT));
+}
+
+void fixedCopyStates(volatile const fixedAxis_t * axis, volatile oneAxisStates_t * states) {
+
+	states->position = fixedToFloat(axis->states[0]);
+	states->velocity = fixedToFloat(axis->states[1]);
+	states->acceleration = fixedToFloat(axis->states[2]);
+	states->acceleration_input = fixedToFloat(axis->states[3]);
+	states->acceleration_error = fixedToFloat(axis->states[4]);
+}
+
+/* -------------------------------------------------------------------- */
+/*	Kalman filter														*/
+/* -------------------------------------------------------------------- */
+
+void fixedKalmanReset(volatile fixedAxis_t * axis, const float position) {
+
+	int i;
+
+	for (i = 0; i < FIXED_NUMBER_OF_STATES; i++)
+		axis->states[i] = 0;
+
+	axis->states[0] = fixedFromFloat(position);
+}
+
+void fixedKalmanStep(volatile fixedAxis_t * axis, const int32_t measurement, const int16_t input) {
+
+	int32_t x[FIXED_NUMBER_OF_STATES];
+	int32_t innovation;
+	int i;
+
+	// the prediction, only the nonzero elements of A and B
+	x[0] = fixedAdd(axis->states[0], fixedMultiply(axis->states[1], FIXED_DT_GAIN, FIXED_DT_SHIFT));
+	x[1] = fixedAdd(axis->states[1], fixedMultiply(axis->states[2], FIXED_DT_GAIN, FIXED_DT_SHIFT));
+	x[2] = fixedAdd(axis->states[3], axis->states[4]);
+	x[3] = fixedAdd(fixedMultiply(axis->states[3], FIXED_P0_GAIN, FIXED_P0_SHIFT), fixedMultiply(input, FIXED_P1_GAIN, FIXED_P1_SHIFT - FIXED_STATE_SHIFT));
+	x[4] = axis->states[4];
+
+	// the correction by the measured velocity
+	innovation = fixedSubtract(measurement, x[1]);
+
+	for (i = 0; i < FIXED_NUMBER_OF_STATES; i++)
+		axis->states[i] = fixedAdd(x[i], fixedMultiply(innovation, fixed_kalman_gain[i], fixed_kalman_shift[i]));
+}
+
+/* -------------------------------------------------------------------- */
+/*	MPC																	*/
+/* -------------------------------------------------------------------- */
+
+int16_t fixedMpcStep(const fixedAxis_t * axis) {
+
+	int32_t output = 0;
+	int32_t reference = 0;
+	int32_t ramp = 0;
+	int32_t offset;
+	int16_t offsetShort;
+	int i;
+
+	// state_gain*x, the position gain includes the sum of the reference gains
+	for (i = 0; i < FIXED_NUMBER_OF_STATES; i++)
+		output = fixedAdd(output, fixedMultiply(axis->states[i], fixed_state_gain[i], fixed_state_shift[i] + FIXED_STATE_SHIFT - FIXED_OUTPUT_SHIFT));
+
+	// the preshaped reference relative to the position, it moves towards the setpoint by max_speed*dt
+	const int32_t difference = fixedSubtract(axis->setpoint, axis->states[0]);
+
+	for (i = 0; i < FIXED_HORIZON_LEN; i++) {
+
+		if (difference > ramp)
+			offset = ramp;
+		else if (difference < -ramp)
+			offset = -ramp;
+		else
+			offset = difference;
+
+		// Q4.11 is enough for the offsets, the ramp ends at horizon_len*max_speed*dt
+		offsetShort = (int16_t) ((offset + ((int32_t) 1 << (FIXED_STATE_SHIFT - FIXED_OFFSET_SHIFT - 1))) >> (FIXED_STATE_SHIFT - FIXED_OFFSET_SHIFT));
+
+		// 16x16 bit products are cheap on the xMega, the tables bound the sum within int32_t
+		reference = fixedAdd(reference, (int32_t) offsetShort*(int16_t) pgm_read_word(&(fixed_reference_gain[i])));
+
+		ramp += FIXED_REFERENCE_STEP;
+	}
+
+	output = fixedAdd(output, fixedMultiply(reference, 1, FIXED_OFFSET_SHIFT + FIXED_REFERENCE_SHIFT - FIXED_OUTPUT_SHIFT));
+
+	// round to the whole output and saturate it
+	output = fixedMultiply(output, 1, FIXED_OUTPUT_SHIFT);
+
+	if (output > MPC_SATURATION)
+		return MPC_SATURATION;
+	else if (output < -MPC_SATURATION)
+		return -MPC_SATURATION;
+
+	return (int16_t) output;
+}
@@ -0,0 +1,77 @@
+/*
+ * fixedMpc.h
+ *
+ * Created: 17.10.2015 10:12:40
+ *  Author: Tomas Baca
+ */ 
+
+#ifndef FIXEDMPC_H_
+#define FIXEDMPC_H_
+
+#include "system.h"
+#include "mpcHandler.h"
+#include "fixedMpcTables.h"
+
+/* -------------------------------------------------------------------- */
+/*	The kalman filter and the MPC in fixed point (no FPU on the xMega)	*/
+/* -------------------------------------------------------------------- */
+
+// the states are int32_t with this many fractional bits (Q7.24, +-128 m)
+#define FIXED_STATE_SHIFT	24
+
+// the reference offsets from the position are int16_t with this many fractional bits (Q4.11, +-16 m)
+#define FIXED_OFFSET_SHIFT	11
+
+// the output is accumulated with this many fractional bits
+#define FIXED_OUTPUT_SHIFT	8
+
+// the states and the setpoint of one axis
+typedef struct {
+
+	int32_t states[FIXED_NUMBER_OF_STATES];	// position, velocity, acceleration, acceleration_input, acceleration_error
+	int32_t setpoint;						// the position setpoint
+} fixedAxis_t;
+
+volatile fixedAxis_t elevatorFixed;
+volatile fixedAxis_t aileronFixed;
+
+// convert a float value to the format of the states (saturated)
+int32_t fixedFromFloat(const float value);
+
+// convert a value in the format of the states to float
+float fixedToFloat(const int32_t value);
+
+// copy the states of the axis to the float states (kalmanStates in mpcHandler.h)
+void fixedCopyStates(volatile const fixedAxis_t * axis, volatile oneAxisStates_t * states);
+
+/**
+ * @brief reset the states of the axis, the filter starts at the position at rest
+ *
+ * @param axis the axis
+ * @param position the initial position [m]
+ */
+void fixedKalmanReset(volatile fixedAxis_t * axis, const float position);
+
+/**
+ * @brief one step of the kalman filter with the steady-state gain (fixedMpcTables.c)
+ *
+ * The model is the same as on STM, x = A*x + B*u, then x = x + K*(measurement - velocity).
+ *
+ * @param axis the axis
+ * @param measurement the px4flow velocity in the format of the states
+ * @param input the controller output applied since the last step
+ */
+void fixedKalmanStep(volatile fixedAxis_t * axis, const int32_t measurement, const int16_t input);
+
+/**
+ * @brief the first action of the condensed MPC towards the setpoint of the axis
+ *
+ * u = state_gain*x + reference_gain*reference, the reference is preshaped from the
+ * current position to the setpoint with ATTITUDE_MAX_SPEED as on STM. It is
+ * saturated to MPC_SATURATION.
+ *
+ * @param axis a copy of the axis, it should not change during the computation
+ */
+int16_t fixedMpcStep(const fixedAxis_t * axis);
+
+#endif /* FIXEDMPC_H_ */
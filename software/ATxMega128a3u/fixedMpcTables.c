@@ -0,0 +1,266 @@
+#include "fixedMpcTables.h"
+
+/*
+This file was created automatically with following parameters
+
+dt = [
+0.0101; 
+];
+
+max_speed = [
+1.8000; 
+];
+
+ATTITUDE_P0 = [
+0.97770000; 
+];
+
+ATTITUDE_P1 = [
+0.00004466; 
+];
+
+K = [
+0.00918606; 
+0.09048864; 
+0.03136696; 
+0.01364397; 
+0.01741179; 
+];
+
+*/
+
+const int16_t fixed_kalman_gain[FIXED_NUMBER_OF_STATES] = {
+19265, 
+23721, 
+16445, 
+28613, 
+18258, 
+};
+
+const int8_t fixed_kalman_shift[FIXED_NUMBER_OF_STATES] = {
+21, 
+18, 
+19, 
+21, 
+20, 
+};
+
+const int16_t fixed_state_gain[FIXED_NUMBER_OF_STATES] = {
+-12265, 
+-17543, 
+-22515, 
+-22044, 
+-26612, 
+};
+
+const int8_t fixed_state_shift[FIXED_NUMBER_OF_STATES] = {
+30, 
+4, 
+11, 
+6, 
+5, 
+};
+
+const int16_t fixed_reference_gain[FIXED_HORIZON_LEN] PROGMEM = {
+0, 
+0, 
+0, 
+1, 
+2, 
+4, 
+7, 
+10, 
+14, 
+18, 
+23, 
+29, 
+35, 
+41, 
+48, 
+55, 
+63, 
+71, 
+79, 
+88, 
+97, 
+107, 
+117, 
+127, 
+137, 
+148, 
+158, 
+170, 
+181, 
+192, 
+204, 
+216, 
+228, 
+241, 
+253, 
+265, 
+278, 
+291, 
+304, 
+317, 
+330, 
+343, 
+356, 
+370, 
+383, 
+397, 
+410, 
+424, 
+437, 
+451, 
+464, 
+478, 
+491, 
+505, 
+518, 
+532, 
+545, 
+559, 
+572, 
+586, 
+599, 
+613, 
+626, 
+639, 
+652, 
+665, 
+678, 
+691, 
+704, 
+717, 
+730, 
+743, 
+755, 
+768, 
+780, 
+793, 
+805, 
+817, 
+829, 
+841, 
+853, 
+865, 
+876, 
+888, 
+899, 
+911, 
+922, 
+933, 
+944, 
+955, 
+966, 
+977, 
+987, 
+998, 
+1008, 
+1018, 
+1029, 
+1039, 
+1049, 
+1058, 
+1068, 
+1078, 
+1087, 
+1097, 
+1106, 
+1115, 
+1124, 
+1133, 
+1142, 
+1151, 
+1160, 
+1168, 
+1177, 
+1185, 
+1193, 
+1201, 
+1210, 
+1218, 
+1225, 
+1233, 
+1241, 
+1249, 
+1256, 
+1264, 
+1271, 
+1279, 
+1286, 
+1293, 
+1300, 
+1307, 
+1314, 
+1321, 
+1328, 
+1335, 
+1341, 
+1348, 
+1355, 
+1361, 
+1367, 
+1374, 
+1380, 
+1386, 
+1392, 
+1399, 
+1405, 
+1411, 
+1416, 
+1422, 
+1428, 
+1434, 
+1439, 
+1445, 
+1451, 
+1456, 
+1462, 
+1467, 
+1472, 
+1478, 
+1483, 
+1488, 
+1493, 
+1498, 
+1503, 
+1508, 
+1513, 
+1518, 
+1523, 
+1527, 
+1532, 
+1537, 
+1541, 
+1546, 
+1550, 
+1555, 
+1559, 
+1564, 
+1568, 
+1572, 
+1577, 
+1581, 
+1585, 
+1589, 
+1593, 
+1597, 
+1601, 
+1605, 
+1609, 
+1613, 
+1616, 
+1620, 
+1624, 
+1628, 
+1631, 
+1635, 
+1638, 
+1642, 
+1645, 
+1649, 
+1652, 
+15050, 
+};
+
@@ -0,0 +1,43 @@
+/*
+ * fixedMpcTables.h
+ *
+ * This file was created automatically by xmegaFixedPoint.m
+ */
+
+#ifndef FIXEDMPCTABLES_H_
+#define FIXEDMPCTABLES_H_
+
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+#define FIXED_NUMBER_OF_STATES	5
+#define FIXED_HORIZON_LEN		200
+
+// a coefficient c is stored as gain = round(c*2^shift) in int16_t
+
+// the model of the kalman filter, dt, ATTITUDE_P0 and ATTITUDE_P1
+#define FIXED_DT_GAIN			21181
+#define FIXED_DT_SHIFT			21
+#define FIXED_P0_GAIN			32037
+#define FIXED_P0_SHIFT			15
+#define FIXED_P1_GAIN			23979
+#define FIXED_P1_SHIFT			29
+
+// max_speed*dt in the format of the states (Q7.24), the step of the preshaped reference
+#define FIXED_REFERENCE_STEP	305010
+
+// the shift of all reference gains, the sum of the reference term fits in int32_t
+#define FIXED_REFERENCE_SHIFT	8
+
+// the steady-state kalman gain
+const int16_t fixed_kalman_gain[FIXED_NUMBER_OF_STATES];
+const int8_t fixed_kalman_shift[FIXED_NUMBER_OF_STATES];
+
+// the condensed state gain, the position gain includes the sum of the reference gains
+const int16_t fixed_state_gain[FIXED_NUMBER_OF_STATES];
+const int8_t fixed_state_shift[FIXED_NUMBER_OF_STATES];
+
+// the condensed reference gain over the horizon
+const int16_t fixed_reference_gain[FIXED_HORIZON_LEN] PROGMEM;
+
+#endif /* FIXEDMPCTABLES_H_ */
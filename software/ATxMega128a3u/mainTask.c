@@ -137,6 +137,9 @@ void mainTask(void *p) {
 						currentSetpointIdx = 0; // reset it and go again
 				
 					int16_t futureSetpointIdx = currentSetpointIdx;
+
+					// the STM aligns the key-points with its reference using this index
+					main2commMessage.data.trajectory.index = currentSetpointIdx;
 				
 					int i;
 					for (i = 0; i < 5; i++) {
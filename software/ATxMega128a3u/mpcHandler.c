@@ -40,6 +40,12 @@ volatile mpcSetpoints_t mpcSetpoints;
 volatile int16_t mpcElevatorOutput = 0;
 volatile int16_t mpcAileronOutput = 0;
 
+/* -------------------------------------------------------------------- */
+/*	Number of the next px4flow measurement sent to STM					*/
+/* -------------------------------------------------------------------- */
+
+volatile uint16_t stmMeasurementSequence = 0;
+
 /* -------------------------------------------------------------------- */
 /*	Initialize the local copy of kalman states to ZERO					*/
 /* -------------------------------------------------------------------- */
@@ -219,7 +225,7 @@ void stmSendMeasurement(float elevSpeed, float aileSpeed, int16_t elevInput, int
 	
 	sendChar(usart_buffer_stm, 'a', &crc);		// this character initiates the transmission
 	
-	sendChar(usart_buffer_stm, 1+12, &crc);		// this will be the size of the message
+	sendChar(usart_buffer_stm, 1+14, &crc);		// this will be the size of the message
 	sendChar(usart_buffer_stm, '1', &crc);		// id of the message
 	
 	// sends the payload
@@ -228,6 +234,30 @@ void stmSendMeasurement(float elevSpeed, float aileSpeed, int16_t elevInput, int
 	sendInt16(usart_buffer_stm, elevInput, &crc);
 	sendInt16(usart_buffer_stm, aileInput, &crc);
 	
+	// the number of the measurement, the delayed positions refer to it
+	sendInt16(usart_buffer_stm, (int16_t) stmMeasurementSequence++, &crc);
+	
+	// at last send the crc, ends the transmission
+	sendChar(usart_buffer_stm, crc, &crc);
+}
+
+/* -------------------------------------------------------------------- */
+/*	Send a delayed position measurement to STM							*/
+/* -------------------------------------------------------------------- */
+void stmSendPosition(float elevatorPosition, float aileronPosition, uint16_t sequence) {
+	
+	char crc = 0;
+	
+	sendChar(usart_buffer_stm, 'a', &crc);		// this character initiates the transmission
+	
+	sendChar(usart_buffer_stm, 1 + 2*4 + 2, &crc);		// this will be the size of the message
+	sendChar(usart_buffer_stm, 'p', &crc);		// id of the message
+	
+	// sends the payload
+	sendFloat(usart_buffer_stm, elevatorPosition, &crc);
+	sendFloat(usart_buffer_stm, aileronPosition, &crc);
+	sendInt16(usart_buffer_stm, (int16_t) sequence, &crc);
+	
 	// at last send the crc, ends the transmission
 	sendChar(usart_buffer_stm, crc, &crc);
 }
@@ -255,13 +285,13 @@ void stmSendSetpoint(float elevatorSetpoint, float aileronSetpoint) {
 /* -------------------------------------------------------------------- */
 /*	Send dual setpoints to STM (start and end of horizon)				*/
 /* -------------------------------------------------------------------- */
-void stmSendTrajectory(float elevatorTrajectory[5], float aileronTrajectory[5]) {
+void stmSendTrajectory(float elevatorTrajectory[5], float aileronTrajectory[5], int16_t index) {
 	
 	char crc = 0;
 	
 	sendChar(usart_buffer_stm, 'a', &crc);		// this character initiates the transmission
 	
-	sendChar(usart_buffer_stm, 1 + 5*4 + 5*4, &crc);	// this will be the size of the message
+	sendChar(usart_buffer_stm, 1 + 5*4 + 5*4 + 2, &crc);	// this will be the size of the message
 	sendChar(usart_buffer_stm, 't', &crc);		// id of the message
 	
 	int i;
@@ -278,6 +308,9 @@ void stmSendTrajectory(float elevatorTrajectory[5], float aileronTrajectory[5])
 		sendFloat(usart_buffer_stm, aileronTrajectory[i], &crc);
 	}
 	
+	// send the index of the first point
+	sendInt16(usart_buffer_stm, index, &crc);
+	
 	// at last send the crc, ends the transmission
 	sendChar(usart_buffer_stm, crc, &crc);	
 }
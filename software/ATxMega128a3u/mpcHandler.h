@@ -34,6 +34,9 @@ typedef struct {
 volatile int16_t mpcElevatorOutput;
 volatile int16_t mpcAileronOutput;
 
+// number of the next px4flow measurement sent to STM
+volatile uint16_t stmMeasurementSequence;
+
 volatile mpcSetpoints_t mpcSetpoints;
 
 /* -------------------------------------------------------------------- */
@@ -130,6 +133,15 @@ void sendChar(UsartBuffer * usartBuffer, const char var, char * crc);
  */
 void stmSendMeasurement(float elevSpeed, float aileSpeed, int16_t elevInput, int16_t aileInput);
 
+/**
+ * @brief send a delayed position measurement to STM, it is fused at the px4flow measurement it belongs to
+ * 
+ * @param elevatorPosition elevator position [m]
+ * @param aileronPosition aileron position [m]
+ * @param sequence the number of the px4flow measurement (stmMeasurementSequence) at which the position was valid
+ */
+void stmSendPosition(float elevatorPosition, float aileronPosition, uint16_t sequence);
+
 /**
  * @brief send setpoint for the whole optimized horizon (constant setpoint)
  * @param elevatorSetpoint desired elevator position [m], + means forwards
@@ -141,8 +153,9 @@ void stmSendSetpoint(float elevatorSetpoint, float aileronSetpoint);
  * @brief send trajectory (2.2s) by means of 5 points equally distributed from the start to the end of the optimization horizon
  * @param elevatorTrajectory 5 points from the elevator trajectory
  * @param aileronTrajectory 5 points from the aileron trajectory
+ * @param index index of the first point in the trajectory, consecutive messages differ by the number of elapsed samples
  */
-void stmSendTrajectory(float elevatorTrajectory[5], float aileronTrajectory[5]);
+void stmSendTrajectory(float elevatorTrajectory[5], float aileronTrajectory[5], int16_t index);
 
 /**
  * @brief initialize the LOCAL copy of kalman states to ZERO
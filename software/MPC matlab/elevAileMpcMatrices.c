@@ -56,3013 +56,629 @@ P = [
 
 */
 
-const float A_roof_data_Attitude[ATTITUDE_A_ROOF_HEIGHT*ATTITUDE_A_ROOF_WIDTH] = {
+const float A_data_Attitude[ATTITUDE_NUMBER_OF_STATES*ATTITUDE_NUMBER_OF_STATES] = {
 1.00000000000000000000, 0.01010000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 1.00000000000000000000, 
 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.97770000000000001000, 0.00000000000000000000, 
 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.02019999999999999900, 0.00010200999999999999, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.01010000000000000000, 0.01010000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.97770000000000001000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.95589729000000001000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.03030000000000000100, 0.00020401999999999999, 0.00010200999999999999, 0.00010200999999999999, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.01997476999999999900, 0.02019999999999999900, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.95589729000000001000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.93458078043299997000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.04039999999999999800, 0.00030603000000000000, 0.00030375517700000001, 0.00030603000000000000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.02962933262899999900, 0.03030000000000000100, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.93458078043299997000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.91373962902934414000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.05049999999999999600, 0.00040803999999999998, 0.00060301143655290003, 0.00061205999999999999, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.03906859851137330100, 0.04039999999999999800, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.91373962902934414000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.89336323530198980000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.06060000000000000100, 0.00051004999999999996, 0.00099760428151777049, 0.00102009999999999990, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.04829736876456967900, 0.05050000000000000300, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.89336323530198969000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.87344123515475536000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.07069999999999999900, 0.00061205999999999999, 0.00148540770603992420, 0.00153015000000000010, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.05732033744111976500, 0.06060000000000000100, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.87344123515475525000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.85396349561080431000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.08079999999999999700, 0.00071407000000000003, 0.00206434311419523370, 0.00214221000000000030, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.06614209391618280900, 0.07069999999999999900, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.85396349561080431000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.83492010965868346000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.09089999999999999500, 0.00081607999999999995, 0.00273237826274868020, 0.00285628000000000010, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.07476712522185192900, 0.08079999999999999700, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.83492010965868335000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.81630139121329481000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.10099999999999999000, 0.00091808999999999999, 0.00348752622748938440, 0.00367236000000000040, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.08319981832940463700, 0.09089999999999999500, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.81630139121329470000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.79809787018923839000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.11110000000000000000, 0.00102009999999999990, 0.00432784439261637080, 0.00459045000000000030, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.09144446238065891100, 0.10100000000000001000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.79809787018923828000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.78030028768401827000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.12120000000000000000, 0.00112210999999999990, 0.00525143346266102560, 0.00561055000000000060, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.09950525086957021100, 0.11110000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.78030028768401827000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.76289959126866480000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.13130000000000000000, 0.00122412000000000000, 0.00625643649644368630, 0.00673265999999999970, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.10738628377517881000, 0.12120000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.76289959126866469000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.74588693038337361000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.14140000000000000000, 0.00132613000000000000, 0.00734103796257299080, 0.00795678000000000010, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.11509156964699231000, 0.13130000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.74588693038337339000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.72925365183582425000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.15150000000000000000, 0.00142814000000000010, 0.00850346281600761370, 0.00928291000000000010, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.12262502764386438000, 0.14140000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.72925365183582425000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.71299129539988537000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.16159999999999999000, 0.00153015000000000010, 0.00974197559521064460, 0.01071105000000000100, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.12999048952740622000, 0.15150000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.71299129539988537000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.69709158951246797000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.17169999999999999000, 0.00163215999999999990, 0.01105487953943744600, 0.01224120000000000100, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.13719170161094504000, 0.16159999999999999000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.69709158951246797000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.68154644706633993000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.18179999999999999000, 0.00173416999999999990, 0.01244051572570799100, 0.01387336000000000100, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.14423232666502098000, 0.17169999999999999000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.68154644706633993000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.66634796129676055000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.19189999999999999000, 0.00183618000000000000, 0.01389726222502470400, 0.01560753000000000100, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.15111594578039100000, 0.18179999999999999000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.66634796129676044000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.65148840175984279000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.20199999999999999000, 0.00193818999999999980, 0.01542353327740665300, 0.01744371000000000100, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.15784606018948830000, 0.19189999999999999000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.65148840175984279000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.63696021040059836000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.21209999999999998000, 0.00204019999999999980, 0.01701777848532048600, 0.01938190000000000100, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.16442609304726272000, 0.20199999999999999000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.63696021040059836000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.62275599770866497000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.22220000000000001000, 0.00214220999999999990, 0.01867848202509783700, 0.02142209999999999900, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.17085939117230875000, 0.21210000000000001000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.62275599770866497000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.60886853895976167000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.23230000000000001000, 0.00224421999999999990, 0.02040416187593815200, 0.02356431000000000500, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.17714922674916628000, 0.22220000000000001000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.60886853895976167000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.59529077054095902000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.24240000000000000000, 0.00234622999999999990, 0.02219336906610473700, 0.02580853000000000300, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.18329879899265988000, 0.23230000000000001000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.59529077054095902000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.58201578635789575000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.25250000000000000000, 0.00244824000000000000, 0.02404468693593060000, 0.02815476000000000100, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.18931123577512354000, 0.24240000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.58201578635789564000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.56903683432211460000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.26260000000000000000, 0.00255025000000000000, 0.02595673041725934900, 0.03060299999999999800, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.19518959521733831000, 0.25250000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.56903683432211460000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.55634731291673156000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.27270000000000000000, 0.00265226000000000000, 0.02792814532895446600, 0.03315325000000000200, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.20093686724399165000, 0.26260000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.55634731291673145000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.54394076783868828000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.28280000000000000000, 0.00275426999999999960, 0.02995760768811877800, 0.03580550999999999900, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.20655597510445065000, 0.27270000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.54394076783868839000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.53181088871588567000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.29289999999999999000, 0.00285628000000000010, 0.03204382303667373300, 0.03855978000000000200, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.21204977685962142000, 0.28280000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.53181088871588567000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.51995150589752148000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.30299999999999999000, 0.00295828999999999970, 0.03418552578295590300, 0.04141606000000000500, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.21742106683565182000, 0.29289999999999999000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.51995150589752137000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.50835658731600664000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.31309999999999999000, 0.00306030000000000020, 0.03638147855799599200, 0.04437435000000000000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.22267257704521679000, 0.30299999999999999000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.50835658731600664000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.49702023541885970000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.32319999999999999000, 0.00316230999999999980, 0.03863047158615268200, 0.04743465000000000200, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.22780697857710849000, 0.31309999999999999000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.49702023541885970000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.48593668416901914000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.33329999999999999000, 0.00326431999999999980, 0.04093132206978147800, 0.05059696000000000300, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.23282688295483897000, 0.32319999999999999000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.48593668416901914000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.47510029611205001000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.34339999999999998000, 0.00336632999999999980, 0.04328287358762535100, 0.05386127999999999700, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.23773484346494608000, 0.33329999999999999000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.47510029611205001000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.46450555950875128000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.35349999999999998000, 0.00346833999999999990, 0.04568399550662130500, 0.05722760999999999800, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.24253335645567775000, 0.34339999999999998000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.46450555950875128000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.45414708553170613000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.36359999999999998000, 0.00357034999999999990, 0.04813358240682364500, 0.06069594999999999900, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.24722486260671617000, 0.35349999999999998000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.45414708553170613000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.44401960552434910000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.37369999999999998000, 0.00367235999999999990, 0.05063055351915148700, 0.06426629999999999800, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.25181174817058638000, 0.36359999999999998000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.44401960552434910000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.43411796832115612000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.38379999999999997000, 0.00377437000000000000, 0.05317385217567439900, 0.06793866000000001200, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.25629634618638231000, 0.37369999999999998000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.43411796832115612000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.42443713762759433000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.39389999999999997000, 0.00387637999999999960, 0.05576244527215686000, 0.07171303000000001100, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.26068093766642597000, 0.38379999999999997000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.42443713762759433000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.41497218945849895000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.40399999999999997000, 0.00397839000000000010, 0.05839532274258777500, 0.07558940999999999600, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.26496775275646473000, 0.39389999999999997000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.41497218945849901000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.40571830963357447000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.41409999999999997000, 0.00408039999999999970, 0.06107149704542806600, 0.07956779999999999400, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.26915897186999554000, 0.40399999999999997000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.40571830963357447000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.39667079132874578000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.42419999999999997000, 0.00418241000000000010, 0.06379000266131501500, 0.08364820000000000600, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.27325672679729468000, 0.41409999999999997000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.39667079132874578000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.38782503268211477000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.43430000000000002000, 0.00428441999999999970, 0.06654989560196769600, 0.08783061000000000300, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.27726310178971492000, 0.42420000000000002000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.38782503268211471000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.37917653445330357000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.44440000000000002000, 0.00438643000000000020, 0.06935025293004382100, 0.09211503000000000100, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.28118013461980434000, 0.43430000000000002000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.37917653445330363000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.37072089773499495000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.45450000000000002000, 0.00448843999999999980, 0.07219017228970384100, 0.09650146000000001100, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.28500981761778277000, 0.44440000000000002000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.37072089773499495000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.36245382171550461000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.46460000000000001000, 0.00459044999999999940, 0.07506877144764342900, 0.10098989999999999000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.28875409868490609000, 0.45450000000000002000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.36245382171550450000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.35437110149124879000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.47470000000000001000, 0.00469245999999999990, 0.07798518784436099500, 0.10558034999999999000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.29241488228423274000, 0.46460000000000001000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.35437110149124879000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.34646862592799393000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.48480000000000001000, 0.00479447000000000030, 0.08093857815543173400, 0.11027281000000000000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.29599403040929440000, 0.47470000000000001000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.34646862592799393000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.33874237556979969000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.49490000000000001000, 0.00489647999999999990, 0.08392811786256561300, 0.11506727999999999000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.29949336353116707000, 0.48480000000000001000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.33874237556979969000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.33118842059459314000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.50500000000000000000, 0.00499848999999999950, 0.08695300083423040900, 0.11996376000000000000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.30291466152442204000, 0.49490000000000001000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.33118842059459314000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.32380291881533374000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.51510000000000000000, 0.00510050000000000000, 0.09001243891562706000, 0.12496225000000000000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.30625966457242748000, 0.50500000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.32380291881533374000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.31658211372575179000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.52520000000000000000, 0.00520250999999999960, 0.09310566152780858100, 0.13006275000000000000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.30953007405246236000, 0.51510000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.31658211372575179000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.30952233258966755000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.53530000000000000000, 0.00530452000000000010, 0.09623191527573846100, 0.13526526000000000000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.31272755340109243000, 0.52520000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.30952233258966749000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.30261998457291794000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.54540000000000000000, 0.00540652999999999970, 0.09939046356508948700, 0.14056978000000001000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.31585372896024805000, 0.53530000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.30261998457291789000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.29587155891694183000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.55549999999999999000, 0.00550853999999999930, 0.10258058622758801000, 0.14597631000000000000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.31891019080443456000, 0.54540000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.29587155891694183000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.28927362315309407000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.56559999999999999000, 0.00561054999999999970, 0.10580157915471278000, 0.15148485000000000000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.32189849354949568000, 0.55549999999999999000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.28927362315309407000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.28282282135678011000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.57569999999999999000, 0.00571256000000000020, 0.10905275393956268000, 0.15709540000000000000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.32482015714334189000, 0.56559999999999999000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.28282282135678005000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.27651587244052389000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.58579999999999999000, 0.00581456999999999980, 0.11233343752671045000, 0.16280796000000000000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.32767666763904540000, 0.57569999999999999000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.27651587244052395000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.27034956848510022000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.59589999999999999000, 0.00591657999999999940, 0.11564297186986479000, 0.16862252999999999000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.33046947795069465000, 0.58579999999999999000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.27034956848510017000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.26432077310788243000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.60599999999999998000, 0.00601858999999999900, 0.11898071359716682000, 0.17453911000000000000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.33320000859239418000, 0.59589999999999999000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.26432077310788249000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.25842641986757670000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.61609999999999998000, 0.00612060000000000030, 0.12234603368395001000, 0.18055769999999999000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.33586964840078387000, 0.60599999999999998000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.25842641986757675000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.25266351070452980000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.62619999999999998000, 0.00622260999999999990, 0.12573831713279790000, 0.18667829999999999000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.33847975524144630000, 0.61609999999999998000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.25266351070452975000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.24702911441581871000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.63629999999999998000, 0.00632461999999999950, 0.12915696266073651000, 0.19290090999999998000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.34103165669956204000, 0.62619999999999998000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.24702911441581871000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.24152036516434597000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.64639999999999997000, 0.00642662999999999910, 0.13260138239340208000, 0.19922552999999998000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.34352665075516187000, 0.63629999999999998000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.24152036516434597000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.23613446102118105000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.65649999999999997000, 0.00652863999999999960, 0.13607100156602919000, 0.20565215999999997000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.34596600644332176000, 0.64639999999999997000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.23613446102118105000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.23086866254040872000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.66659999999999997000, 0.00663064999999999920, 0.13956525823110677000, 0.21218079999999997000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.34835096449963565000, 0.65649999999999997000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.23086866254040872000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.22572029136575761000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.67669999999999997000, 0.00673265999999999970, 0.14308360297255307000, 0.21881144999999999000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.35068273799129379000, 0.66659999999999997000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.22572029136575758000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.22068672886830121000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.68679999999999997000, 0.00683466999999999930, 0.14662549862626514000, 0.22554410999999999000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.35296251293408798000, 0.67669999999999997000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.22068672886830121000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.21576541481453809000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.69689999999999996000, 0.00693667999999999980, 0.15019042000689944000, 0.23237877999999998000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.35519144889565785000, 0.68679999999999997000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.21576541481453812000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.21095384606417389000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.70699999999999996000, 0.00703868999999999940, 0.15377785364074559000, 0.23931545999999998000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.35737067958528462000, 0.69689999999999996000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.21095384606417389000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.20624957529694279000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.71709999999999996000, 0.00714069999999999980, 0.15738729750455693000, 0.24635414999999999000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.35950131343053277000, 0.70699999999999996000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.20624957529694282000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.20165020976782097000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.72719999999999996000, 0.00724270999999999940, 0.16101826077020534000, 0.25349484999999999000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.36158443414103192000, 0.71709999999999996000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.20165020976782100000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.19715341008999859000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.73729999999999996000, 0.00734471999999999990, 0.16467026355502976000, 0.26073755999999998000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.36362110125968694000, 0.72719999999999996000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.19715341008999859000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.19275688904499164000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.74739999999999995000, 0.00744672999999999950, 0.16834283667775263000, 0.26808228000000001000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.36561235070159592000, 0.73729999999999996000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.19275688904499164000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.18845841041928832000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.75749999999999995000, 0.00754874000000000000, 0.17203552141983872000, 0.27552900999999996000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.36755919528095027000, 0.74739999999999995000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.18845841041928829000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.18425578786693816000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.76759999999999995000, 0.00765074999999999960, 0.17574786929217634000, 0.28307775000000002000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.36946262522618512000, 0.75749999999999995000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.18425578786693822000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.18014688379750549000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.77769999999999995000, 0.00775275999999999920, 0.17947944180696079000, 0.29072850000000000000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.37132360868364123000, 0.76759999999999995000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.18014688379750549000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.17612960828882113000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.78779999999999994000, 0.00785477000000000050, 0.18322981025466556000, 0.29848125999999997000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.37314309220999597000, 0.77769999999999995000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.17612960828882110000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.17220191802398038000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.79789999999999994000, 0.00795678000000000010, 0.18699855548598648000, 0.30633602999999998000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.37492200125371306000, 0.78779999999999994000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.17220191802398038000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.16836181525204560000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.80799999999999994000, 0.00805878999999999970, 0.19078526769864901000, 0.31429280999999998000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.37666124062575534000, 0.79789999999999994000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.16836181525204563000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.16460734677192501000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.81809999999999994000, 0.00816079999999999930, 0.19458954622896915000, 0.32235159999999996000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.37836169495980099000, 0.80799999999999994000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.16460734677192501000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.16093660293891107000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.82819999999999994000, 0.00826280999999999890, 0.19841099934806314000, 0.33051239999999998000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.38002422916219736000, 0.81809999999999994000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.16093660293891107000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.15734771669337336000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.83829999999999993000, 0.00836482000000000020, 0.20224924406260131000, 0.33877520999999999000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.38164968885188039000, 0.82819999999999994000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.15734771669337336000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.15383886261111113000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.84839999999999993000, 0.00846682999999999980, 0.20610390592000533000, 0.34714002999999993000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.38323890079048351000, 0.83829999999999993000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.15383886261111115000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.15040825597488336000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.85849999999999993000, 0.00856883999999999940, 0.20997461881798923000, 0.35560685999999997000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.38479267330285571000, 0.84839999999999993000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.15040825597488336000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.14705415186664347000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.86860000000000004000, 0.00867084999999999900, 0.21386102481834801000, 0.36417569999999999000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.38631179668820198000, 0.85850000000000004000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.14705415186664345000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.14377484428001730000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.87870000000000004000, 0.00877286000000000040, 0.21776277396489890000, 0.37284655000000000000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.38779704362205514000, 0.86860000000000004000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.14377484428001730000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.14056866525257292000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.88880000000000003000, 0.00887487000000000000, 0.22167952410548164000, 0.38161940999999999000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.38924916954928335000, 0.87870000000000004000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.14056866525257294000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.13743398401744056000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.89890000000000003000, 0.00897687999999999960, 0.22561094071792939000, 0.39049427999999997000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.39066891306833429000, 0.88880000000000003000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.13743398401744056000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.13436920617385162000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.90900000000000003000, 0.00907888999999999920, 0.22955669673991963000, 0.39947115999999994000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.39205699630691049000, 0.89890000000000003000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.13436920617385165000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.13137277287617477000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.91910000000000003000, 0.00918089999999999880, 0.23351647240261936000, 0.40855005000000000000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.39341412528926634000, 0.90900000000000003000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.13137277287617471000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.12844316004103604000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.92920000000000003000, 0.00928290999999999840, 0.23748995506804099000, 0.41773094999999999000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.39474099029531573000, 0.91910000000000003000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.12844316004103606000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.12557887757212097000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.93930000000000002000, 0.00938491999999999970, 0.24147683907002371000, 0.42701385999999997000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.39603826621173022000, 0.92920000000000003000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.12557887757212097000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.12277846860226267000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.94940000000000002000, 0.00948692999999999930, 0.24547682555876210000, 0.43639877999999999000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.39730661287520852000, 0.93930000000000002000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.12277846860226264000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.12004050875243219000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.95950000000000002000, 0.00958894000000000070, 0.24948962234880173000, 0.44588570999999999000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.39854667540809141000, 0.94940000000000002000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.12004050875243219000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.11736360540725295000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.96960000000000002000, 0.00969095000000000030, 0.25351494377042350000, 0.45547464999999998000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.39975908454649101000, 0.95950000000000002000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.11736360540725296000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.11474639700667122000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.97970000000000002000, 0.00979295999999999990, 0.25755251052434303000, 0.46516559999999996000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.40094445696110426000, 0.96960000000000002000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.11474639700667122000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.11218755235342245000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.98980000000000001000, 0.00989496999999999950, 0.26160204953965022000, 0.47495855999999997000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.40210339557087160000, 0.97970000000000002000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.11218755235342244000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.10968576993594112000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 0.99990000000000001000, 0.00999697999999999910, 0.26566329383491594000, 0.48485352999999998000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.40323648984964117000, 0.98980000000000001000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.10968576993594113000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.10723977726636963000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.01000000000000000000, 0.01009898999999999900, 0.26973598238239732000, 0.49485050999999991000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.40434431612599420000, 0.99990000000000001000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.10723977726636964000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.10484833023332960000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.02010000000000000000, 0.01020100000000000000, 0.27381985997526992000, 0.50494949999999994000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.40542743787638452000, 1.01000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.10484833023332960000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.10251021246912635000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.03020000000000000000, 0.01030301000000000000, 0.27791467709782136000, 0.51515049999999996000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.40648640601174113000, 1.02010000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.10251021246912635000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.10022423473106483000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.04030000000000000000, 0.01040501999999999900, 0.28202018979853993000, 0.52545350999999996000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.40752175915767930000, 1.03020000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.10022423473106483000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.09798923429656207500, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.05040000000000000000, 0.01050703000000000100, 0.28613615956603256000, 0.53585852999999994000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.40853402392846311000, 1.04030000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.09798923429656208900, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.09580407437174876000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.06050000000000000000, 0.01060904000000000000, 0.29026235320770999000, 0.54636555999999992000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.40952371519485836000, 1.05040000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.09580407437174876000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.09366764351325876400, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.07060000000000000000, 0.01071105000000000000, 0.29439854273117810000, 0.55697459999999999000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.41049133634601309000, 1.06050000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.09366764351325876400, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.09157885506291309200, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.08070000000000000000, 0.01081305999999999900, 0.29854450522827275000, 0.56768564999999993000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.41143737954549692000, 1.07060000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.09157885506291309200, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.08953664659501012200, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.09080000000000000000, 0.01091506999999999900, 0.30270002276168234000, 0.57849870999999997000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.41236232598163236000, 1.08070000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.08953664659501013600, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.08753997937594140700, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.10090000000000000000, 0.01101707999999999900, 0.30686488225409692000, 0.58941378000000000000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.41326664611224206000, 1.09080000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.08753997937594142100, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.08558783783585792400, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.11100000000000000000, 0.01111908999999999800, 0.31103887537983038000, 0.60043086000000001000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.41415079990393894000, 1.10090000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.08558783783585791100, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.08367922905211827600, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.12110000000000000000, 0.01122109999999999900, 0.31522179845886028000, 0.61154994999999990000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.41501523706608112000, 1.11100000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.08367922905211827600, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.08181318224425604400, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.13120000000000000000, 0.01132311000000000100, 0.31941345235322766000, 0.62277104999999999000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.41586039727950758000, 1.12110000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.08181318224425604400, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.07998874828020913200, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.14130000000000000000, 0.01142512000000000000, 0.32361364236575063000, 0.63409415999999996000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.41668671042017447000, 1.13120000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.07998874828020913200, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.07820499919356047000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.15140000000000000000, 0.01152713000000000000, 0.32782217814099440000, 0.64551927999999992000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.41749459677780459000, 1.14130000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.07820499919356047000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.07646102771154407500, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.16150000000000000000, 0.01162914000000000000, 0.33203887356845030000, 0.65704640999999997000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.41828446726965962000, 1.15140000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.07646102771154407500, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.07475594679357663900, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.17160000000000000000, 0.01173114999999999900, 0.33626354668787389000, 0.66867554999999990000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.41905672364954621000, 1.16150000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.07475594679357665300, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.07308888918007988600, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.18170000000000000000, 0.01183315999999999900, 0.34049601959673431000, 0.68040670000000003000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.41981175871216131000, 1.17160000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.07308888918007988600, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.07145900695136410400, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.19180000000000000000, 0.01193516999999999800, 0.34473611835972706000, 0.69223985999999993000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.42054995649288007000, 1.18170000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.07145900695136409000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.06986547109634867700, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.20190000000000000000, 0.01203717999999999800, 0.34898367292030524000, 0.70417503000000004000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.42127169246308893000, 1.19180000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.06986547109634869100, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.06830747109090010100, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.21200000000000000000, 0.01213918999999999900, 0.35323851701418241000, 0.71621221000000002000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.42197733372116208000, 1.20190000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.06830747109090011500, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.06678421448557304900, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.22210000000000000000, 0.01224120000000000100, 0.35750048808476609000, 0.72835139999999987000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.42266723917918009000, 1.21200000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.06678421448557303500, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.06529492650254475900, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.23220000000000000000, 0.01234321000000000000, 0.36176942720047583000, 0.74059259999999993000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.42334175974548444000, 1.22210000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.06529492650254475900, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.06383884964153802000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.24230000000000000000, 0.01244522000000000000, 0.36604517897390521000, 0.75293580999999998000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.42400123850316007000, 1.23220000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.06383884964153800600, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.06241524329453170700, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.25240000000000000000, 0.01254722999999999900, 0.37032759148278716000, 0.76538103000000002000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.42464601088453968000, 1.24230000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.06241524329453171400, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.06102338336906365500, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.26250000000000000000, 0.01264923999999999900, 0.37461651619272107000, 0.77792825999999993000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.42527640484181450000, 1.25240000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.06102338336906367600, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.05966256191993355600, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.27260000000000000000, 0.01275124999999999900, 0.37891180788162332000, 0.79057749999999993000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.42589274101384189000, 1.26250000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.05966256191993353500, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.05833208678911901800, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.28270000000000000000, 0.01285325999999999800, 0.38321332456586310000, 0.80332874999999992000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.42649533288923325000, 1.27260000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.05833208678911901800, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.05703128125372166500, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.29279999999999990000, 0.01295526999999999800, 0.38752092742804434000, 0.81618200999999990000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.42708448696580342000, 1.28270000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.05703128125372166500, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.05575948368176367200, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.30289999999999990000, 0.01305727999999999900, 0.39183448074639898000, 0.82913727999999987000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.42766050290646601000, 1.29279999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.05575948368176367200, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.05451604719566034000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.31299999999999990000, 0.01315928999999999900, 0.39615385182575430000, 0.84219455999999993000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.42822367369165182000, 1.30289999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.05451604719566034000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.05330033934319711900, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.32309999999999990000, 0.01326129999999999800, 0.40047891093003996000, 0.85535384999999986000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.42877428576832799000, 1.31299999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.05330033934319711200, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.05211174177584381600, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.33319999999999990000, 0.01336331000000000000, 0.40480953121630003000, 0.86861514999999989000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.42931261919569425000, 1.32309999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.05211174177584382300, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.05094964993424250200, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.34329999999999990000, 0.01346531999999999900, 0.40914558867017659000, 0.88197845999999991000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.42983894778763032000, 1.33319999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.05094964993424250900, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.04981347274070890100, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.35339999999999990000, 0.01356732999999999900, 0.41348696204283164000, 0.89544377999999991000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.43035353925196612000, 1.34329999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.04981347274070889500, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.04870263229859108500, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.36349999999999990000, 0.01366933999999999900, 0.41783353278927648000, 0.90901110999999990000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.43085665532664730000, 1.35339999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.04870263229859108500, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.04761656359833250900, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.37359999999999990000, 0.01377135000000000000, 0.42218518500807567000, 0.92268044999999987000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.43134855191286309000, 1.36349999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.04761656359833250900, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.04655471423008969400, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.38369999999999990000, 0.01387336000000000000, 0.42654180538239556000, 0.93645179999999995000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.43182947920520620000, 1.37359999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.04655471423008969400, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.04551654410275869600, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.39379999999999990000, 0.01397536999999999900, 0.43090328312236814000, 0.95032515999999989000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.43229968181893014000, 1.38369999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.04551654410275869600, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.04450152516926717700, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.40389999999999990000, 0.01407737999999999900, 0.43526950990873925000, 0.96430052999999993000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.43275939891436799000, 1.39379999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.04450152516926717000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.04350914115799251600, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.41399999999999990000, 0.01417939000000000000, 0.43964037983777449000, 0.97837790999999985000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.43320886431857764000, 1.40389999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.04350914115799252300, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.04253888731016929000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.42409999999999990000, 0.01428140000000000000, 0.44401578936739211000, 0.99255729999999986000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.43364830664427334000, 1.41399999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.04253888731016929000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.04159027012315251500, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.43419999999999990000, 0.01438340999999999900, 0.44839563726449921000, 1.00683869999999990000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.43407794940610600000, 1.42409999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.04159027012315250800, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.04066280709940620800, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.44429999999999990000, 0.01448541999999999900, 0.45277982455350085000, 1.02122210999999980000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.43449801113434983000, 1.43419999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.04066280709940620800, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.03975602650108944800, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.45439999999999990000, 0.01458742999999999800, 0.45716825446595788000, 1.03570752999999980000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.43490870548605387000, 1.44429999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.03975602650108945500, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.03886946711011515800, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.46449999999999990000, 0.01468944000000000000, 0.46156083239136703000, 1.05029496000000000000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.43531024135371488000, 1.45439999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.03886946711011515800, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.03800267799355958700, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.47459999999999990000, 0.01479144999999999900, 0.46595746582903946000, 1.06498439999999990000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.43570282297152702000, 1.46449999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.03800267799355958700, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.03715521827430320900, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.48469999999999990000, 0.01489345999999999900, 0.47035806434105187000, 1.07977584999999990000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.43608665001926195000, 1.47459999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.03715521827430320900, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.03632665690678624900, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.49479999999999990000, 0.01499546999999999900, 0.47476253950624647000, 1.09466931000000000000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.43646191772383247000, 1.48469999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.03632665690678625600, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.03551657245776491900, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.50489999999999990000, 0.01509748000000000000, 0.47917080487525721000, 1.10966477999999990000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.43682881695859099000, 1.49479999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.03551657245776491900, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.03472455289195675700, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.51499999999999990000, 0.01519949000000000000, 0.48358277592653887000, 1.12476225999999980000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.43718753434041441000, 1.50489999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.03472455289195675700, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.03395019536246612200, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.52509999999999990000, 0.01530149999999999900, 0.48799837002337709000, 1.13996174999999990000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.43753825232462318000, 1.51499999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.03395019536246612200, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.03319310600588312700, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.53519999999999990000, 0.01540350999999999900, 0.49241750637185583000, 1.15526325000000000000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.43788114929778410000, 1.52509999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.03319310600588313400, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.03245289974195193800, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.54529999999999990000, 0.01550551999999999800, 0.49684010597976347000, 1.17066676000000000000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.43821639966844350000, 1.53519999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.03245289974195193800, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.03172920007770641000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.55539999999999990000, 0.01560753000000000000, 0.50126609161641478000, 1.18617227999999990000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.43854417395583722000, 1.54529999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.03172920007770641700, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.03102163891597356200, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.56549999999999990000, 0.01570954000000000100, 0.50569538777336864000, 1.20177980999999990000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.43886463887662203000, 1.55539999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.03102163891597355100, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.03032985636814734100, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.57559999999999990000, 0.01581155000000000100, 0.51012792062602252000, 1.21748934999999990000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.43917795742967342000, 1.56549999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.03032985636814734800, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02965350057113766400, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.58569999999999990000, 0.01591356000000000000, 0.51456361799606232000, 1.23330089999999990000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.43948428897899172000, 1.57559999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02965350057113766800, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02899222750840129600, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.59579999999999990000, 0.01601557000000000000, 0.51900240931475006000, 1.24921445999999990000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.43978378933476014000, 1.58569999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02899222750840128900, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02834570083496394000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.60589999999999990000, 0.01611757999999999900, 0.52344422558703108000, 1.26523002999999990000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44007661083259497000, 1.59579999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02834570083496394300, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02771359170634424600, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.61599999999999990000, 0.01621958999999999900, 0.52788899935644040000, 1.28134760999999990000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44036290241102816000, 1.60589999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02771359170634424600, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02709557861129276900, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.62609999999999990000, 0.01632159999999999900, 0.53233666467079177000, 1.29756720000000000000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44064280968726222000, 1.61599999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02709557861129276900, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02649134720826094200, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.63619999999999990000, 0.01642360999999999800, 0.53678715704863311000, 1.31388880000000000000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44091647503123632000, 1.62609999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02649134720826093800, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02590059016551671900, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.64629999999999990000, 0.01652561999999999800, 0.54124041344644858000, 1.33031240999999990000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44118403763803971000, 1.63619999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02590059016551672300, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02532300700482569700, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.65639999999999990000, 0.01662762999999999700, 0.54569637222659273000, 1.34683802999999980000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44144563359871147000, 1.64629999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02532300700482570000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02475830394861808600, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.66649999999999990000, 0.01672964000000000000, 0.55015497312593975000, 1.36346565999999970000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44170139596946018000, 1.65639999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02475830394861808600, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02420619377056390200, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.67659999999999990000, 0.01683165000000000000, 0.55461615722523128000, 1.38019529999999980000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44195145483934117000, 1.66649999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02420619377056390200, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02366639564948032700, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.68669999999999990000, 0.01693366000000000000, 0.55907986691910860000, 1.39702694999999990000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44219593739642388000, 1.67659999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02366639564948032700, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02313863502649691300, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.69679999999999990000, 0.01703566999999999900, 0.56354604588681267000, 1.41396060999999970000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44243496799248372000, 1.68669999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02313863502649691700, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02262264346540603800, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.70689999999999990000, 0.01713767999999999900, 0.56801463906353666000, 1.43099627999999980000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44266866820625128000, 1.69679999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02262264346540603800, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02211815851612748300, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.71699999999999990000, 0.01723968999999999800, 0.57248559261241982000, 1.44813395999999980000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44289715690525200000, 1.70689999999999990000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02211815851612748300, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02162492358121784200, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.72710000000000010000, 0.01734169999999999800, 0.57695885389716273000, 1.46537364999999990000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44312055030626474000, 1.71700000000000010000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02162492358121783900, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02114268778535668300, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.73720000000000010000, 0.01744371000000000100, 0.58143437145525612000, 1.48271534999999990000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44333896203443512000, 1.72710000000000010000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02114268778535668300, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02067120584774323100, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.74730000000000010000, 0.01754572000000000100, 0.58591209497180397000, 1.50015905999999990000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44355250318106726000, 1.73720000000000010000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02067120584774323100, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02021023795733855800, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.75740000000000010000, 0.01764773000000000000, 0.59039197525393261000, 1.51770477999999990000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44376128236012935000, 1.74730000000000010000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.02021023795733855500, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01975954965088990600, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.76750000000000010000, 0.01774974000000000000, 0.59487396420576988000, 1.53535250999999980000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44396540576349852000, 1.75740000000000010000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01975954965088990600, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01931891169367505900, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.77760000000000010000, 0.01785175000000000000, 0.59935801480398132000, 1.55310224999999980000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44416497721497250000, 1.76750000000000010000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01931891169367505900, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01888809996290610700, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.78770000000000010000, 0.01795375999999999900, 0.60384408107385246000, 1.57095400000000000000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44436009822307854000, 1.77760000000000010000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01888809996290610400, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01846689533373329800, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.79780000000000010000, 0.01805576999999999900, 0.60833211806590559000, 1.58890775999999970000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44455086803270394000, 1.78770000000000010000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01846689533373330200, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01805508356779105000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.80790000000000010000, 0.01815777999999999800, 0.61282208183303599000, 1.60696352999999980000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44473738367557469000, 1.79780000000000010000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01805508356779105000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01765245520422930800, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.81800000000000010000, 0.01825978999999999800, 0.61731392940815932000, 1.62512130999999990000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44491974001960938000, 1.80790000000000010000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01765245520422930800, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01725880545317499600, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.82810000000000010000, 0.01836179999999999800, 0.62180761878235735000, 1.64338109999999980000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44509802981717206000, 1.81800000000000010000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01725880545317499600, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01687393409156919300, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.83820000000000010000, 0.01846380999999999700, 0.62630310888351071000, 1.66174289999999970000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44527234375224911000, 1.82810000000000010000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01687393409156919000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01649764536132719600, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.84830000000000010000, 0.01856581999999999700, 0.63080035955540859000, 1.68020670999999980000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44544277048657399000, 1.83820000000000010000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01649764536132719900, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01612974786976960300, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.85840000000000010000, 0.01866783000000000000, 0.63529933153732288000, 1.69877252999999980000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44560939670472344000, 1.84830000000000010000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01612974786976960300, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01577005449227374100, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.86850000000000000000, 0.01876983999999999900, 0.63979998644404057000, 1.71744035999999990000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44577230715820804000, 1.85840000000000010000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01577005449227374100, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01541838227709603700, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.87860000000000000000, 0.01887184999999999900, 0.64430228674633849000, 1.73621019999999990000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44593158470858008000, 1.86850000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01541838227709603800, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01507455235231679500, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.88870000000000000000, 0.01897385999999999900, 0.64880619575189513000, 1.75508204999999970000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44608731036957866000, 1.87860000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01507455235231679400, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01473838983486012800, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.89880000000000000000, 0.01907586999999999800, 0.65331167758662789000, 1.77405591000000000000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44623956334833714000, 1.88870000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01473838983486013000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01440972374154275000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.90890000000000000000, 0.01917788000000000100, 0.65781869717644625000, 1.79313177999999970000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44638842108566928000, 1.89880000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01440972374154275400, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01408838690210635100, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.91900000000000000000, 0.01927989000000000100, 0.66232722022941126000, 1.81230965999999990000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44653395929545869000, 1.90890000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01408838690210634600, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01377421587418937500, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.92910000000000000000, 0.01938190000000000100, 0.66683721321829537000, 1.83158954999999990000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44667625200317002000, 1.91900000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01377421587418937500, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01346705086019495300, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.93920000000000000000, 0.01948391000000000000, 0.67134864336352740000, 1.85097144999999990000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44681537158349938000, 1.92910000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01346705086019495100, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01316673562601260500, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.94930000000000000000, 0.01958592000000000000, 0.67586147861652079000, 1.87045535999999980000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44695138879718738000, 1.93920000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01316673562601260500, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01287311742155252400, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.95940000000000000000, 0.01968792999999999900, 0.68037568764337231000, 1.89004127999999970000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44708437282701008000, 1.94930000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01287311742155252400, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01258604690305190200, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.96950000000000000000, 0.01978993999999999900, 0.68489123980892519000, 1.90972920999999980000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44721439131296770000, 1.95940000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01258604690305190200, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01230537805711384500, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.97960000000000000000, 0.01989194999999999900, 0.68940810516118622000, 1.92951914999999970000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44734151038668862000, 1.96950000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01230537805711384500, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01203096812644020700, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.98970000000000000000, 0.01999395999999999800, 0.69392625441609168000, 1.94941109999999980000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44746579470506542000, 1.97960000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01203096812644020700, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01176267753722059000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 1.99980000000000000000, 0.02009596999999999800, 0.69844565894261290000, 1.96940505999999970000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44758730748314240000, 1.98970000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01176267753722058800, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01150036982814057000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 2.00990000000000000000, 0.02019797999999999700, 0.70296629074819250000, 1.98950102999999980000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44770611052626830000, 1.99980000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01150036982814057000, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01124391158097303400, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
-1.00000000000000000000, 2.02000000000000000000, 0.02029998999999999700, 0.70748812246450787000, 2.00969900999999980000, 
-0.00000000000000000000, 1.00000000000000000000, 0.01010000000000000000, 0.44782226426153260000, 2.00990000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01124391158097303600, 1.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.01099317235271733700, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 1.00000000000000000000, 
 };
 
-const float Q_roof_diag_data_Attitude[ATTITUDE_Q_ROOF_DIAG_SIZE] = {
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
-1.1, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
+const float B_data_Attitude[ATTITUDE_NUMBER_OF_STATES] = {
+0.00000000000000000000, 
+0.00000000000000000000, 
+0.00000000000000000000, 
+0.00004466400000000000, 
+0.00000000000000000000, 
+};
+
+const int16_t weighted_rows_data_Attitude[ATTITUDE_WEIGHTED_ROWS] = {
+0, 
+5, 
+10, 
+15, 
+20, 
+25, 
+30, 
+35, 
+40, 
+45, 
+50, 
+55, 
+60, 
+65, 
+70, 
+75, 
+80, 
+85, 
+90, 
+95, 
+100, 
+105, 
+110, 
+115, 
+120, 
+125, 
+130, 
+135, 
+140, 
+145, 
+150, 
+155, 
+160, 
+165, 
+170, 
+175, 
+180, 
+185, 
+190, 
+195, 
+200, 
+205, 
+210, 
+215, 
+220, 
+225, 
+230, 
+235, 
+240, 
+245, 
+250, 
+255, 
+260, 
+265, 
+270, 
+275, 
+280, 
+285, 
+290, 
+295, 
+300, 
+305, 
+310, 
+315, 
+320, 
+325, 
+330, 
+335, 
+340, 
+345, 
+350, 
+355, 
+360, 
+365, 
+370, 
+375, 
+380, 
+385, 
+390, 
+395, 
+400, 
+405, 
+410, 
+415, 
+420, 
+425, 
+430, 
+435, 
+440, 
+445, 
+450, 
+455, 
+460, 
+465, 
+470, 
+475, 
+480, 
+485, 
+490, 
+495, 
+500, 
+505, 
+510, 
+515, 
+520, 
+525, 
+530, 
+535, 
+540, 
+545, 
+550, 
+555, 
+560, 
+565, 
+570, 
+575, 
+580, 
+585, 
+590, 
+595, 
+600, 
+605, 
+610, 
+615, 
+620, 
+625, 
+630, 
+635, 
+640, 
+645, 
+650, 
+655, 
+660, 
+665, 
+670, 
+675, 
+680, 
+685, 
+690, 
+695, 
+700, 
+705, 
+710, 
+715, 
+720, 
+725, 
+730, 
+735, 
+740, 
+745, 
+750, 
+755, 
+760, 
+765, 
+770, 
+775, 
+780, 
+785, 
+790, 
+795, 
+800, 
+805, 
+810, 
+815, 
+820, 
+825, 
+830, 
+835, 
+840, 
+845, 
+850, 
+855, 
+860, 
+865, 
+870, 
+875, 
+880, 
+885, 
+890, 
+895, 
+900, 
+905, 
+910, 
+915, 
+920, 
+925, 
+930, 
+935, 
+940, 
+945, 
+950, 
+955, 
+960, 
+965, 
+970, 
+975, 
+980, 
+985, 
+990, 
+995, 
+};
+
+const float Q_weighted_data_Attitude[ATTITUDE_WEIGHTED_ROWS] = {
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
+1.1, 
 10.0, 
-0.0, 
-0.0, 
-0.0, 
-0.0, 
 };
 
 const float B_roof_data_Attitude[ATTITUDE_B_ROOF_HEIGHT*ATTITUDE_B_ROOF_WIDTH] = {
 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00004366799280000000, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000045110640000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00004366799280000000, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00004269419656056000, 0.00004366799280000000, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000000455617464000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000089215312728000, 0.00000045110640000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00004269419656056000, 0.00004366799280000000, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00004174211597725951, 0.00004269419656056000, 0.00004366799280000000, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000001356692122553, 0.00000000455617464000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000132336451254166, 0.00000089215312728000, 0.00000045110640000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00004174211597725951, 0.00004269419656056000, 0.00004366799280000000, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00004081126679096662, 0.00004174211597725951, 0.00004269419656056000, 0.00004366799280000000, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000002693290280220, 0.00000001356692122553, 0.00000000455617464000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000174495988391198, 0.00000132336451254166, 0.00000089215312728000, 0.00000045110640000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00004081126679096662, 0.00004174211597725951, 0.00004269419656056000, 0.00004366799280000000, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00003990117554152807, 0.00004081126679096662, 0.00004174211597725951, 0.00004269419656056000, 0.00004366799280000000, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000004455699762971, 0.00000002693290280220, 0.00000001356692122553, 0.00000000455617464000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000215715367850074, 0.00000174495988391198, 0.00000132336451254166, 0.00000089215312728000, 0.00000045110640000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00003990117554152807, 0.00004081126679096662, 0.00004174211597725951, 0.00004269419656056000, 0.00004366799280000000, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00003901137932695199, 0.00003990117554152807, 0.00004081126679096662, 0.00004174211597725951, 0.00004269419656056000, 0.00004366799280000000, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000006634424978257, 0.00000004455699762971, 0.00000002693290280220, 0.00000001356692122553, 0.00000000455617464000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000256015555147017, 0.00000215715367850074, 0.00000174495988391198, 0.00000132336451254166, 0.00000089215312728000, 0.00000045110640000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00003901137932695199, 0.00003990117554152807, 0.00004081126679096662, 0.00004174211597725951, 0.00004269419656056000, 0.00004366799280000000, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00003814142556796096, 0.00003901137932695199, 0.00003990117554152807, 0.00004081126679096662, 0.00004174211597725951, 0.00004269419656056000, 0.00004366799280000000, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000009220182085242, 0.00000006634424978257, 0.00000004455699762971, 0.00000002693290280220, 0.00000001356692122553, 0.00000000455617464000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000295417048267239, 0.00000256015555147017, 0.00000215715367850074, 0.00000174495988391198, 0.00000132336451254166, 0.00000089215312728000, 0.00000045110640000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00003814142556796096, 0.00003901137932695199, 0.00003990117554152807, 0.00004081126679096662, 0.00004174211597725951, 0.00004269419656056000, 0.00004366799280000000, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00003729087177779544, 0.00003814142556796096, 0.00003901137932695199, 0.00003990117554152807, 0.00004081126679096662, 0.00004174211597725951, 0.00004269419656056000, 0.00004366799280000000, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000012203894272741, 0.00000009220182085242, 0.00000006634424978257, 0.00000004455699762971, 0.00000002693290280220, 0.00000001356692122553, 0.00000000455617464000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000333939888090879, 0.00000295417048267239, 0.00000256015555147017, 0.00000215715367850074, 0.00000174495988391198, 0.00000132336451254166, 0.00000089215312728000, 0.00000045110640000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00003729087177779543, 0.00003814142556796096, 0.00003901137932695199, 0.00003990117554152807, 0.00004081126679096662, 0.00004174211597725951, 0.00004269419656056000, 0.00004366799280000000, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00003645928533715060, 0.00003729087177779544, 0.00003814142556796096, 0.00003901137932695199, 0.00003990117554152807, 0.00004081126679096662, 0.00004174211597725951, 0.00004269419656056000, 0.00004366799280000000, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000015576687142459, 0.00000012203894272741, 0.00000009220182085242, 0.00000006634424978257, 0.00000004455699762971, 0.00000002693290280220, 0.00000001356692122553, 0.00000000455617464000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000371603668586453, 0.00000333939888090879, 0.00000295417048267239, 0.00000256015555147017, 0.00000215715367850074, 0.00000174495988391198, 0.00000132336451254166, 0.00000089215312728000, 0.00000045110640000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00003645928533715059, 0.00003729087177779543, 0.00003814142556796096, 0.00003901137932695199, 0.00003990117554152807, 0.00004081126679096662, 0.00004174211597725951, 0.00004269419656056000, 0.00004366799280000000, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00003564624327413214, 0.00003645928533715060, 0.00003729087177779544, 0.00003814142556796096, 0.00003901137932695199, 0.00003990117554152807, 0.00004081126679096662, 0.00004174211597725951, 0.00004269419656056000, 0.00004366799280000000, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000019329884195182, 0.00000015576687142459, 0.00000012203894272741, 0.00000009220182085242, 0.00000006634424978257, 0.00000004455699762971, 0.00000002693290280220, 0.00000001356692122553, 0.00000000455617464000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000408427546776975, 0.00000371603668586453, 0.00000333939888090879, 0.00000295417048267239, 0.00000256015555147017, 0.00000215715367850074, 0.00000174495988391198, 0.00000132336451254166, 0.00000089215312728000, 0.00000045110640000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00003564624327413214, 0.00003645928533715059, 0.00003729087177779543, 0.00003814142556796096, 0.00003901137932695199, 0.00003990117554152807, 0.00004081126679096662, 0.00004174211597725951, 0.00004269419656056000, 0.00004366799280000000, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00003485133204911899, 0.00003564624327413214, 0.00003645928533715060, 0.00003729087177779544, 0.00003814142556796096, 0.00003901137932695199, 0.00003990117554152807, 0.00004081126679096662, 0.00004174211597725951, 0.00004269419656056000, 0.00008833199280000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000023455002417629, 0.00000019329884195182, 0.00000015576687142459, 0.00000012203894272741, 0.00000009220182085242, 0.00000006634424978257, 0.00000004455699762971, 0.00000002693290280220, 0.00000001356692122553, 0.00000000455617464000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000444430252483848, 0.00000408427546776975, 0.00000371603668586453, 0.00000333939888090879, 0.00000295417048267239, 0.00000256015555147017, 0.00000215715367850074, 0.00000174495988391198, 0.00000132336451254166, 0.00000089215312728000, 0.00000045110640000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00003485133204911899, 0.00003564624327413214, 0.00003645928533715059, 0.00003729087177779543, 0.00003814142556796096, 0.00003901137932695199, 0.00003990117554152807, 0.00004081126679096662, 0.00004174211597725951, 0.00004269419656056000, 0.00008833199280000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00003407414734442364, 0.00003485133204911899, 0.00003564624327413214, 0.00003645928533715060, 0.00003729087177779544, 0.00003814142556796096, 0.00003901137932695199, 0.00003990117554152807, 0.00004081126679096662, 0.00004174211597725951, 0.00013102618936055999, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000027943747967716, 0.00000023455002417629, 0.00000019329884195182, 0.00000015576687142459, 0.00000012203894272741, 0.00000009220182085242, 0.00000006634424978257, 0.00000004455699762971, 0.00000002693290280220, 0.00000001356692122553, 0.00000000455617464000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000479630097853459, 0.00000444430252483848, 0.00000408427546776975, 0.00000371603668586453, 0.00000333939888090879, 0.00000295417048267239, 0.00000256015555147017, 0.00000215715367850074, 0.00000174495988391198, 0.00000132336451254166, 0.00000134325952728000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00003407414734442364, 0.00003485133204911899, 0.00003564624327413214, 0.00003645928533715059, 0.00003729087177779543, 0.00003814142556796096, 0.00003901137932695199, 0.00003990117554152807, 0.00004081126679096662, 0.00004174211597725951, 0.00013102618936055999, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00003331429385864300, 0.00003407414734442364, 0.00003485133204911899, 0.00003564624327413214, 0.00003645928533715060, 0.00003729087177779544, 0.00003814142556796096, 0.00003901137932695199, 0.00003990117554152807, 0.00004081126679096662, 0.00017276830533781952, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000032788011956036, 0.00000027943747967716, 0.00000023455002417629, 0.00000019329884195182, 0.00000015576687142459, 0.00000012203894272741, 0.00000009220182085242, 0.00000006634424978257, 0.00000004455699762971, 0.00000002693290280220, 0.00000001812309586553, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000514044986671326, 0.00000479630097853459, 0.00000444430252483848, 0.00000408427546776975, 0.00000371603668586453, 0.00000333939888090879, 0.00000295417048267239, 0.00000256015555147017, 0.00000215715367850074, 0.00000174495988391198, 0.00000266662403982166, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00003331429385864299, 0.00003407414734442364, 0.00003485133204911899, 0.00003564624327413214, 0.00003645928533715059, 0.00003729087177779543, 0.00003814142556796096, 0.00003901137932695199, 0.00003990117554152807, 0.00004081126679096662, 0.00017276830533781952, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00003257138510559525, 0.00003331429385864300, 0.00003407414734442364, 0.00003485133204911899, 0.00003564624327413214, 0.00003645928533715060, 0.00003729087177779544, 0.00003814142556796096, 0.00003901137932695199, 0.00003990117554152807, 0.00021357957212878614, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000037979866321416, 0.00000032788011956036, 0.00000027943747967716, 0.00000023455002417629, 0.00000019329884195182, 0.00000015576687142459, 0.00000012203894272741, 0.00000009220182085242, 0.00000006634424978257, 0.00000004455699762971, 0.00000004505599866773, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000547692423468556, 0.00000514044986671326, 0.00000479630097853459, 0.00000444430252483848, 0.00000408427546776975, 0.00000371603668586453, 0.00000333939888090879, 0.00000295417048267239, 0.00000256015555147017, 0.00000215715367850074, 0.00000441158392373363, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00003257138510559525, 0.00003331429385864299, 0.00003407414734442364, 0.00003485133204911899, 0.00003564624327413214, 0.00003645928533715059, 0.00003729087177779543, 0.00003814142556796096, 0.00003901137932695199, 0.00003990117554152807, 0.00021357957212878614, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00003184504321774048, 0.00003257138510559525, 0.00003331429385864300, 0.00003407414734442364, 0.00003485133204911899, 0.00003564624327413214, 0.00003645928533715060, 0.00003729087177779544, 0.00003814142556796096, 0.00003901137932695199, 0.00025348074767031422, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000043511559798449, 0.00000037979866321416, 0.00000032788011956036, 0.00000027943747967716, 0.00000023455002417629, 0.00000019329884195182, 0.00000015576687142459, 0.00000012203894272741, 0.00000009220182085242, 0.00000006634424978257, 0.00000008961299629744, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000580589522425207, 0.00000547692423468556, 0.00000514044986671326, 0.00000479630097853459, 0.00000444430252483848, 0.00000408427546776975, 0.00000371603668586453, 0.00000333939888090879, 0.00000295417048267239, 0.00000256015555147017, 0.00000656873760223437, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00003184504321774048, 0.00003257138510559525, 0.00003331429385864299, 0.00003407414734442364, 0.00003485133204911899, 0.00003564624327413214, 0.00003645928533715059, 0.00003729087177779543, 0.00003814142556796096, 0.00003901137932695199, 0.00025348074767031422, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00003113489875398487, 0.00003184504321774048, 0.00003257138510559525, 0.00003331429385864300, 0.00003407414734442364, 0.00003485133204911899, 0.00003564624327413214, 0.00003645928533715060, 0.00003729087177779544, 0.00003814142556796096, 0.00029249212699726616, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000049375513974943, 0.00000043511559798449, 0.00000037979866321416, 0.00000032788011956036, 0.00000027943747967716, 0.00000023455002417629, 0.00000019329884195182, 0.00000015576687142459, 0.00000012203894272741, 0.00000009220182085242, 0.00000015595724608000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000612753016075125, 0.00000580589522425207, 0.00000547692423468556, 0.00000514044986671326, 0.00000479630097853459, 0.00000444430252483848, 0.00000408427546776975, 0.00000371603668586453, 0.00000333939888090879, 0.00000295417048267239, 0.00000912889315370455, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00003113489875398487, 0.00003184504321774048, 0.00003257138510559525, 0.00003331429385864299, 0.00003407414734442364, 0.00003485133204911899, 0.00003564624327413214, 0.00003645928533715059, 0.00003729087177779543, 0.00003814142556796096, 0.00029249212699726616, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00003044059051177101, 0.00003113489875398487, 0.00003184504321774048, 0.00003257138510559525, 0.00003331429385864300, 0.00003407414734442364, 0.00003485133204911899, 0.00003564624327413214, 0.00003645928533715060, 0.00003729087177779544, 0.00033063355256522713, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000055564319437302, 0.00000049375513974943, 0.00000043511559798449, 0.00000037979866321416, 0.00000032788011956036, 0.00000027943747967716, 0.00000023455002417629, 0.00000019329884195182, 0.00000015576687142459, 0.00000012203894272741, 0.00000024815906693242, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000644199263816650, 0.00000612753016075125, 0.00000580589522425207, 0.00000547692423468556, 0.00000514044986671326, 0.00000479630097853459, 0.00000444430252483848, 0.00000408427546776975, 0.00000371603668586453, 0.00000333939888090879, 0.00001208306363637693, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00003044059051177101, 0.00003113489875398487, 0.00003184504321774048, 0.00003257138510559525, 0.00003331429385864299, 0.00003407414734442364, 0.00003485133204911899, 0.00003564624327413214, 0.00003645928533715059, 0.00003729087177779543, 0.00033063355256522713, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002976176534335851, 0.00003044059051177101, 0.00003113489875398487, 0.00003184504321774048, 0.00003257138510559525, 0.00003331429385864300, 0.00003407414734442364, 0.00003485133204911899, 0.00003564624327413214, 0.00003645928533715060, 0.00036792442434302252, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000062070732001850, 0.00000055564319437302, 0.00000049375513974943, 0.00000043511559798449, 0.00000037979866321416, 0.00000032788011956036, 0.00000027943747967716, 0.00000023455002417629, 0.00000019329884195182, 0.00000015576687142459, 0.00000037019800965983, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000674944260233538, 0.00000644199263816650, 0.00000612753016075125, 0.00000580589522425207, 0.00000547692423468556, 0.00000514044986671326, 0.00000479630097853459, 0.00000444430252483848, 0.00000408427546776975, 0.00000371603668586453, 0.00001542246251728573, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002976176534335851, 0.00003044059051177101, 0.00003113489875398487, 0.00003184504321774048, 0.00003257138510559525, 0.00003331429385864299, 0.00003407414734442364, 0.00003485133204911899, 0.00003564624327413214, 0.00003645928533715059, 0.00036792442434302252, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002909807797620162, 0.00002976176534335851, 0.00003044059051177101, 0.00003113489875398487, 0.00003184504321774048, 0.00003257138510559525, 0.00003331429385864300, 0.00003407414734442364, 0.00003485133204911899, 0.00003564624327413214, 0.00040438370968017316, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000068887669030209, 0.00000062070732001850, 0.00000055564319437302, 0.00000049375513974943, 0.00000043511559798449, 0.00000037979866321416, 0.00000032788011956036, 0.00000027943747967716, 0.00000023455002417629, 0.00000019329884195182, 0.00000052596488108441, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000705003643230331, 0.00000674944260233538, 0.00000644199263816650, 0.00000612753016075125, 0.00000580589522425207, 0.00000547692423468556, 0.00000514044986671326, 0.00000479630097853459, 0.00000444430252483848, 0.00000408427546776975, 0.00001913849920315026, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002909807797620162, 0.00002976176534335851, 0.00003044059051177101, 0.00003113489875398487, 0.00003184504321774048, 0.00003257138510559525, 0.00003331429385864299, 0.00003407414734442364, 0.00003485133204911899, 0.00003564624327413214, 0.00040438370968017316, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002844919083733232, 0.00002909807797620162, 0.00002976176534335851, 0.00003044059051177101, 0.00003113489875398487, 0.00003184504321774048, 0.00003257138510559525, 0.00003331429385864300, 0.00003407414734442364, 0.00003485133204911899, 0.00039536595295430532, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000076008205826835, 0.00000068887669030209, 0.00000062070732001850, 0.00000055564319437302, 0.00000049375513974943, 0.00000043511559798449, 0.00000037979866321416, 0.00000032788011956036, 0.00000027943747967716, 0.00000023455002417629, 0.00000071926372303623, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000734392701986294, 0.00000705003643230331, 0.00000674944260233538, 0.00000644199263816650, 0.00000612753016075125, 0.00000580589522425207, 0.00000547692423468556, 0.00000514044986671326, 0.00000479630097853459, 0.00000444430252483848, 0.00002322277467092001, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002844919083733232, 0.00002909807797620162, 0.00002976176534335851, 0.00003044059051177101, 0.00003113489875398487, 0.00003184504321774048, 0.00003257138510559525, 0.00003331429385864299, 0.00003407414734442364, 0.00003485133204911899, 0.00039536595295430532, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002781477388165981, 0.00002844919083733232, 0.00002909807797620162, 0.00002976176534335851, 0.00003044059051177101, 0.00003113489875398487, 0.00003184504321774048, 0.00003257138510559525, 0.00003331429385864300, 0.00003407414734442364, 0.00038654929220342441, 0.00008833199280000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000083425572116897, 0.00000076008205826835, 0.00000068887669030209, 0.00000062070732001850, 0.00000055564319437302, 0.00000049375513974943, 0.00000043511559798449, 0.00000037979866321416, 0.00000032788011956036, 0.00000027943747967716, 0.00000095381374721252, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000763126384732000, 0.00000734392701986294, 0.00000705003643230331, 0.00000674944260233538, 0.00000644199263816650, 0.00000612753016075125, 0.00000580589522425207, 0.00000547692423468556, 0.00000514044986671326, 0.00000479630097853459, 0.00002721597079575849, 0.00000045110640000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002781477388165981, 0.00002844919083733232, 0.00002909807797620162, 0.00002976176534335851, 0.00003044059051177101, 0.00003113489875398487, 0.00003184504321774048, 0.00003257138510559525, 0.00003331429385864299, 0.00003407414734442364, 0.00038654929220342435, 0.00008833199280000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002719450442409880, 0.00002781477388165981, 0.00002844919083733232, 0.00002909807797620162, 0.00002976176534335851, 0.00003044059051177101, 0.00003113489875398487, 0.00003184504321774048, 0.00003257138510559525, 0.00003331429385864300, 0.00037792924298728800, 0.00013102618936055999, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000091133148602690, 0.00000083425572116897, 0.00000076008205826835, 0.00000068887669030209, 0.00000062070732001850, 0.00000055564319437302, 0.00000049375513974943, 0.00000043511559798449, 0.00000037979866321416, 0.00000032788011956036, 0.00000122869505224968, 0.00000000455617464000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000791219306352476, 0.00000763126384732000, 0.00000734392701986294, 0.00000705003643230331, 0.00000674944260233538, 0.00000644199263816650, 0.00000612753016075125, 0.00000580589522425207, 0.00000547692423468556, 0.00000514044986671326, 0.00003112011864701308, 0.00000134325952728000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002719450442409880, 0.00002781477388165981, 0.00002844919083733232, 0.00002909807797620162, 0.00002976176534335851, 0.00003044059051177101, 0.00003113489875398487, 0.00003184504321774048, 0.00003257138510559525, 0.00003331429385864299, 0.00037792924298728794, 0.00013102618936055999, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002658806697544139, 0.00002719450442409880, 0.00002781477388165981, 0.00002844919083733232, 0.00002909807797620162, 0.00002976176534335851, 0.00003044059051177101, 0.00003113489875398487, 0.00003184504321774048, 0.00003257138510559525, 0.00036950142086867151, 0.00017276830533781952, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000099124463596850, 0.00000091133148602690, 0.00000083425572116897, 0.00000076008205826835, 0.00000068887669030209, 0.00000062070732001850, 0.00000055564319437302, 0.00000049375513974943, 0.00000043511559798449, 0.00000037979866321416, 0.00000154300825058451, 0.00000001812309586553, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000818685755820816, 0.00000791219306352476, 0.00000763126384732000, 0.00000734392701986294, 0.00000705003643230331, 0.00000674944260233538, 0.00000644199263816650, 0.00000612753016075125, 0.00000580589522425207, 0.00000547692423468556, 0.00003493720400118468, 0.00000266662403982166, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002658806697544139, 0.00002719450442409880, 0.00002781477388165981, 0.00002844919083733232, 0.00002909807797620162, 0.00002976176534335851, 0.00003044059051177101, 0.00003113489875398487, 0.00003184504321774048, 0.00003257138510559525, 0.00036950142086867135, 0.00017276830533781952, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002599515308188905, 0.00002658806697544139, 0.00002719450442409880, 0.00002781477388165981, 0.00002844919083733232, 0.00002909807797620162, 0.00002976176534335851, 0.00003044059051177101, 0.00003113489875398487, 0.00003184504321774048, 0.00036126153918330010, 0.00021357957212878614, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000107393189730640, 0.00000099124463596850, 0.00000091133148602690, 0.00000083425572116897, 0.00000076008205826835, 0.00000068887669030209, 0.00000062070732001850, 0.00000055564319437302, 0.00000049375513974943, 0.00000043511559798449, 0.00000189587401099648, 0.00000004505599866773, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000845539703466012, 0.00000818685755820816, 0.00000791219306352476, 0.00000763126384732000, 0.00000734392701986294, 0.00000705003643230331, 0.00000674944260233538, 0.00000644199263816650, 0.00000612753016075125, 0.00000580589522425207, 0.00003866916835195826, 0.00000441158392373363, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002599515308188905, 0.00002658806697544139, 0.00002719450442409880, 0.00002781477388165981, 0.00002844919083733232, 0.00002909807797620162, 0.00002976176534335851, 0.00003044059051177101, 0.00003113489875398487, 0.00003184504321774048, 0.00036126153918330004, 0.00021357957212878614, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002541546116816293, 0.00002599515308188905, 0.00002658806697544139, 0.00002719450442409880, 0.00002781477388165981, 0.00002844919083733232, 0.00002909807797620162, 0.00002976176534335851, 0.00003044059051177101, 0.00003113489875398487, 0.00035320540685951249, 0.00025348074767031422, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000115933140735647, 0.00000107393189730640, 0.00000099124463596850, 0.00000091133148602690, 0.00000083425572116897, 0.00000076008205826835, 0.00000068887669030209, 0.00000062070732001850, 0.00000055564319437302, 0.00000049375513974943, 0.00000228643261135126, 0.00000008961299629744, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000871794808078720, 0.00000845539703466012, 0.00000818685755820816, 0.00000791219306352476, 0.00000763126384732000, 0.00000734392701986294, 0.00000705003643230331, 0.00000674944260233538, 0.00000644199263816650, 0.00000612753016075125, 0.00004231790989770960, 0.00000656873760223437, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002541546116816293, 0.00002599515308188905, 0.00002658806697544139, 0.00002719450442409880, 0.00002781477388165981, 0.00002844919083733232, 0.00002909807797620162, 0.00002976176534335851, 0.00003044059051177101, 0.00003113489875398487, 0.00035320540685951249, 0.00025348074767031422, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002484869638411290, 0.00002541546116816293, 0.00002599515308188905, 0.00002658806697544139, 0.00002719450442409880, 0.00002781477388165981, 0.00002844919083733232, 0.00002909807797620162, 0.00002976176534335851, 0.00003044059051177101, 0.00034532892628654540, 0.00029249212699726616, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000124738268297242, 0.00000115933140735647, 0.00000107393189730640, 0.00000099124463596850, 0.00000091133148602690, 0.00000083425572116897, 0.00000076008205826835, 0.00000068887669030209, 0.00000062070732001850, 0.00000055564319437302, 0.00000271384350131813, 0.00000015595724608000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000897464423858564, 0.00000871794808078720, 0.00000845539703466012, 0.00000818685755820816, 0.00000791219306352476, 0.00000763126384732000, 0.00000734392701986294, 0.00000705003643230331, 0.00000674944260233538, 0.00000644199263816650, 0.00004588528450699068, 0.00000912889315370455, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002484869638411289, 0.00002541546116816293, 0.00002599515308188905, 0.00002658806697544139, 0.00002719450442409880, 0.00002781477388165981, 0.00002844919083733232, 0.00002909807797620162, 0.00002976176534335851, 0.00003044059051177101, 0.00034532892628654540, 0.00029249212699726616, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002429457045474717, 0.00002484869638411290, 0.00002541546116816293, 0.00002599515308188905, 0.00002658806697544139, 0.00002719450442409880, 0.00002781477388165981, 0.00002844919083733232, 0.00002909807797620162, 0.00002976176534335851, 0.00033762809123035544, 0.00033063355256522713, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000133802658978214, 0.00000124738268297242, 0.00000115933140735647, 0.00000107393189730640, 0.00000099124463596850, 0.00000091133148602690, 0.00000083425572116897, 0.00000076008205826835, 0.00000068887669030209, 0.00000062070732001850, 0.00000317728487483873, 0.00000024815906693242, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000922561607206518, 0.00000897464423858564, 0.00000871794808078720, 0.00000845539703466012, 0.00000818685755820816, 0.00000791219306352476, 0.00000763126384732000, 0.00000734392701986294, 0.00000705003643230331, 0.00000674944260233538, 0.00004937310666248479, 0.00001208306363637693, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002429457045474718, 0.00002484869638411289, 0.00002541546116816293, 0.00002599515308188905, 0.00002658806697544139, 0.00002719450442409880, 0.00002781477388165981, 0.00002844919083733232, 0.00002909807797620162, 0.00002976176534335851, 0.00033762809123035544, 0.00033063355256522713, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002375280153360632, 0.00002429457045474717, 0.00002484869638411290, 0.00002541546116816293, 0.00002599515308188905, 0.00002658806697544139, 0.00002719450442409880, 0.00002781477388165981, 0.00002844919083733232, 0.00002909807797620162, 0.00033009898479591845, 0.00036792442434302252, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000143120531211000, 0.00000133802658978214, 0.00000124738268297242, 0.00000115933140735647, 0.00000107393189730640, 0.00000099124463596850, 0.00000091133148602690, 0.00000083425572116897, 0.00000076008205826835, 0.00000068887669030209, 0.00000367595325212983, 0.00000037019800965983, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000947099123365813, 0.00000922561607206518, 0.00000897464423858564, 0.00000871794808078720, 0.00000845539703466012, 0.00000818685755820816, 0.00000791219306352476, 0.00000763126384732000, 0.00000734392701986294, 0.00000705003643230331, 0.00005278315038391138, 0.00001542246251728573, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002375280153360632, 0.00002429457045474718, 0.00002484869638411289, 0.00002541546116816293, 0.00002599515308188905, 0.00002658806697544139, 0.00002719450442409880, 0.00002781477388165981, 0.00002844919083733232, 0.00002909807797620162, 0.00033009898479591845, 0.00036792442434302252, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002322311405940690, 0.00002375280153360632, 0.00002429457045474717, 0.00002484869638411290, 0.00002541546116816293, 0.00002599515308188905, 0.00002658806697544139, 0.00002719450442409880, 0.00002781477388165981, 0.00002844919083733232, 0.00032273777743496951, 0.00040438370968017316, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000152686232356994, 0.00000143120531211000, 0.00000133802658978214, 0.00000124738268297242, 0.00000115933140735647, 0.00000107393189730640, 0.00000099124463596850, 0.00000091133148602690, 0.00000083425572116897, 0.00000076008205826835, 0.00000420906307100733, 0.00000052596488108441, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000971089452914755, 0.00000947099123365813, 0.00000922561607206518, 0.00000897464423858564, 0.00000871794808078720, 0.00000845539703466012, 0.00000818685755820816, 0.00000791219306352476, 0.00000763126384732000, 0.00000734392701986294, 0.00005611715013035015, 0.00001913849920315026, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002322311405940689, 0.00002375280153360632, 0.00002429457045474718, 0.00002484869638411289, 0.00002541546116816293, 0.00002599515308188905, 0.00002658806697544139, 0.00002719450442409880, 0.00002781477388165981, 0.00002844919083733232, 0.00032273777743496951, 0.00040438370968017316, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002270523861588212, 0.00002322311405940690, 0.00002375280153360632, 0.00002429457045474717, 0.00002484869638411290, 0.00002541546116816293, 0.00002599515308188905, 0.00002658806697544139, 0.00002719450442409880, 0.00002781477388165981, 0.00031554072499816968, 0.00039536595295430532, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000162494235831433, 0.00000152686232356994, 0.00000143120531211000, 0.00000133802658978214, 0.00000124738268297242, 0.00000115933140735647, 0.00000107393189730640, 0.00000099124463596850, 0.00000091133148602690, 0.00000083425572116897, 0.00000477584628732387, 0.00000071926372303623, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000994544798114756, 0.00000971089452914755, 0.00000947099123365813, 0.00000922561607206518, 0.00000897464423858564, 0.00000871794808078720, 0.00000845539703466012, 0.00000818685755820816, 0.00000791219306352476, 0.00000763126384732000, 0.00005937680168244335, 0.00002322277467092001, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002270523861588212, 0.00002322311405940689, 0.00002375280153360632, 0.00002429457045474718, 0.00002484869638411289, 0.00002541546116816293, 0.00002599515308188905, 0.00002658806697544139, 0.00002719450442409880, 0.00002781477388165981, 0.00031554072499816968, 0.00039536595295430532, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002219891179474795, 0.00002270523861588212, 0.00002322311405940690, 0.00002375280153360632, 0.00002429457045474717, 0.00002484869638411290, 0.00002541546116816293, 0.00002599515308188905, 0.00002658806697544139, 0.00002719450442409880, 0.00030850416683071051, 0.00038654929220342441, 0.00008833199280000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000172539138292392, 0.00000162494235831433, 0.00000152686232356994, 0.00000143120531211000, 0.00000133802658978214, 0.00000124738268297242, 0.00000115933140735647, 0.00000107393189730640, 0.00000099124463596850, 0.00000091133148602690, 0.00000537555198431655, 0.00000095381374721252, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001017477089116797, 0.00000994544798114756, 0.00000971089452914755, 0.00000947099123365813, 0.00000922561607206518, 0.00000897464423858564, 0.00000871794808078720, 0.00000845539703466012, 0.00000818685755820816, 0.00000791219306352476, 0.00006256376300492486, 0.00002721597079575849, 0.00000045110640000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002219891179474795, 0.00002270523861588212, 0.00002322311405940689, 0.00002375280153360632, 0.00002429457045474718, 0.00002484869638411289, 0.00002541546116816293, 0.00002599515308188905, 0.00002658806697544139, 0.00002719450442409880, 0.00030850416683071051, 0.00038654929220342435, 0.00008833199280000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002170387606172507, 0.00002219891179474795, 0.00002270523861588212, 0.00002322311405940690, 0.00002375280153360632, 0.00002429457045474717, 0.00002484869638411290, 0.00002541546116816293, 0.00002599515308188905, 0.00002658806697544139, 0.00030162452391038568, 0.00037792924298728800, 0.00013102618936055999, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000182815656892472, 0.00000172539138292392, 0.00000162494235831433, 0.00000152686232356994, 0.00000143120531211000, 0.00000133802658978214, 0.00000124738268297242, 0.00000115933140735647, 0.00000107393189730640, 0.00000099124463596850, 0.00000600744599066629, 0.00000122869505224968, 0.00000000455617464000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001039897990029493, 0.00001017477089116797, 0.00000994544798114756, 0.00000971089452914755, 0.00000947099123365813, 0.00000922561607206518, 0.00000897464423858564, 0.00000871794808078720, 0.00000845539703466012, 0.00000818685755820816, 0.00006567965508991503, 0.00003112011864701308, 0.00000134325952728000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002170387606172507, 0.00002219891179474795, 0.00002270523861588212, 0.00002322311405940689, 0.00002375280153360632, 0.00002429457045474718, 0.00002484869638411289, 0.00002541546116816293, 0.00002599515308188905, 0.00002658806697544139, 0.00030162452391038568, 0.00037792924298728794, 0.00013102618936055999, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002121987962554860, 0.00002170387606172507, 0.00002219891179474795, 0.00002270523861588212, 0.00002322311405940690, 0.00002375280153360632, 0.00002429457045474717, 0.00002484869638411290, 0.00002541546116816293, 0.00002599515308188905, 0.00029489829702718408, 0.00036950142086867151, 0.00017276830533781952, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000193318626591770, 0.00000182815656892472, 0.00000172539138292392, 0.00000162494235831433, 0.00000152686232356994, 0.00000143120531211000, 0.00000133802658978214, 0.00000124738268297242, 0.00000115933140735647, 0.00000107393189730640, 0.00000667081050707443, 0.00000154300825058451, 0.00000001812309586553, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001061818904851835, 0.00001039897990029493, 0.00001017477089116797, 0.00000994544798114756, 0.00000971089452914755, 0.00000947099123365813, 0.00000922561607206518, 0.00000897464423858564, 0.00000871794808078720, 0.00000845539703466012, 0.00006872606278140992, 0.00003493720400118468, 0.00000266662403982166, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002121987962554860, 0.00002170387606172507, 0.00002219891179474795, 0.00002270523861588212, 0.00002322311405940689, 0.00002375280153360632, 0.00002429457045474718, 0.00002484869638411289, 0.00002541546116816293, 0.00002599515308188905, 0.00029489829702718408, 0.00036950142086867135, 0.00017276830533781952, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002074667630989887, 0.00002121987962554860, 0.00002170387606172507, 0.00002219891179474795, 0.00002270523861588212, 0.00002322311405940690, 0.00002375280153360632, 0.00002429457045474717, 0.00002484869638411290, 0.00002541546116816293, 0.00028832206500347784, 0.00036126153918330010, 0.00021357957212878614, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000204042997530773, 0.00000193318626591770, 0.00000182815656892472, 0.00000172539138292392, 0.00000162494235831433, 0.00000152686232356994, 0.00000143120531211000, 0.00000133802658978214, 0.00000124738268297242, 0.00000115933140735647, 0.00000736494374116667, 0.00000189587401099648, 0.00000004505599866773, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001083250983273639, 0.00001061818904851835, 0.00001039897990029493, 0.00001017477089116797, 0.00000994544798114756, 0.00000971089452914755, 0.00000947099123365813, 0.00000922561607206518, 0.00000897464423858564, 0.00000871794808078720, 0.00007170453558138449, 0.00003866916835195826, 0.00000441158392373363, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002074667630989887, 0.00002121987962554860, 0.00002170387606172507, 0.00002219891179474795, 0.00002270523861588212, 0.00002322311405940689, 0.00002375280153360632, 0.00002429457045474718, 0.00002484869638411289, 0.00002541546116816293, 0.00028832206500347784, 0.00036126153918330004, 0.00021357957212878614, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002028402542818812, 0.00002074667630989887, 0.00002121987962554860, 0.00002170387606172507, 0.00002219891179474795, 0.00002270523861588212, 0.00002322311405940690, 0.00002375280153360632, 0.00002429457045474717, 0.00002484869638411290, 0.00028189248295390029, 0.00035320540685951249, 0.00025348074767031422, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000214983832461837, 0.00000204042997530773, 0.00000193318626591770, 0.00000182815656892472, 0.00000172539138292392, 0.00000162494235831433, 0.00000152686232356994, 0.00000143120531211000, 0.00000133802658978214, 0.00000124738268297242, 0.00000808915955053865, 0.00000228643261135126, 0.00000008961299629744, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001104205126346637, 0.00001083250983273639, 0.00001061818904851835, 0.00001039897990029493, 0.00001017477089116797, 0.00000994544798114756, 0.00000971089452914755, 0.00000947099123365813, 0.00000922561607206518, 0.00000897464423858564, 0.00007461658843791961, 0.00004231790989770960, 0.00000656873760223437, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00002028402542818812, 0.00002074667630989887, 0.00002121987962554860, 0.00002170387606172507, 0.00002219891179474795, 0.00002270523861588212, 0.00002322311405940689, 0.00002375280153360632, 0.00002429457045474718, 0.00002484869638411289, 0.00028189248295390029, 0.00035320540685951249, 0.00025348074767031422, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001983169166113953, 0.00002028402542818812, 0.00002074667630989887, 0.00002121987962554860, 0.00002170387606172507, 0.00002219891179474795, 0.00002270523861588212, 0.00002322311405940690, 0.00002375280153360632, 0.00002429457045474717, 0.00027560628058402831, 0.00034532892628654540, 0.00029249212699726616, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000226136304237938, 0.00000214983832461837, 0.00000204042997530773, 0.00000193318626591770, 0.00000182815656892472, 0.00000172539138292392, 0.00000162494235831433, 0.00000152686232356994, 0.00000143120531211000, 0.00000133802658978214, 0.00000884278709376164, 0.00000271384350131813, 0.00000015595724608000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001124691992029107, 0.00001104205126346637, 0.00001083250983273639, 0.00001061818904851835, 0.00001039897990029493, 0.00001017477089116797, 0.00000994544798114756, 0.00000971089452914755, 0.00000947099123365813, 0.00000922561607206518, 0.00007746370251575401, 0.00004588528450699068, 0.00000912889315370455, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001983169166113953, 0.00002028402542818812, 0.00002074667630989887, 0.00002121987962554860, 0.00002170387606172507, 0.00002219891179474795, 0.00002270523861588212, 0.00002322311405940689, 0.00002375280153360632, 0.00002429457045474718, 0.00027560628058402831, 0.00034532892628654540, 0.00029249212699726616, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001938944493709612, 0.00001983169166113953, 0.00002028402542818812, 0.00002074667630989887, 0.00002121987962554860, 0.00002170387606172507, 0.00002219891179474795, 0.00002270523861588212, 0.00002322311405940690, 0.00002375280153360632, 0.00026946026052700450, 0.00033762809123035544, 0.00033063355256522713, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000237495693357432, 0.00000226136304237938, 0.00000214983832461837, 0.00000204042997530773, 0.00000193318626591770, 0.00000182815656892472, 0.00000172539138292392, 0.00000162494235831433, 0.00000152686232356994, 0.00000143120531211000, 0.00000962517048917076, 0.00000317728487483873, 0.00000024815906693242, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001144722000606858, 0.00001124691992029107, 0.00001104205126346637, 0.00001083250983273639, 0.00001061818904851835, 0.00001039897990029493, 0.00001017477089116797, 0.00000994544798114756, 0.00000971089452914755, 0.00000947099123365813, 0.00008024732594965269, 0.00004937310666248479, 0.00001208306363637693, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001938944493709612, 0.00001983169166113953, 0.00002028402542818812, 0.00002074667630989887, 0.00002121987962554860, 0.00002170387606172507, 0.00002219891179474795, 0.00002270523861588212, 0.00002322311405940689, 0.00002375280153360632, 0.00026946026052700450, 0.00033762809123035544, 0.00033063355256522713, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001895706031499887, 0.00001938944493709612, 0.00001983169166113953, 0.00002028402542818812, 0.00002074667630989887, 0.00002121987962554860, 0.00002170387606172507, 0.00002219891179474795, 0.00002270523861588212, 0.00002322311405940690, 0.00026345129671725233, 0.00033009898479591845, 0.00036792442434302252, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000249057385563561, 0.00000237495693357432, 0.00000226136304237938, 0.00000214983832461837, 0.00000204042997530773, 0.00000193318626591770, 0.00000182815656892472, 0.00000172539138292392, 0.00000162494235831433, 0.00000152686232356994, 0.00001043566848126225, 0.00000367595325212983, 0.00000037019800965983, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001164305339993325, 0.00001144722000606858, 0.00001124691992029107, 0.00001104205126346637, 0.00001083250983273639, 0.00001061818904851835, 0.00001039897990029493, 0.00001017477089116797, 0.00000994544798114756, 0.00000971089452914755, 0.00008296887458097544, 0.00005278315038391138, 0.00001542246251728573, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001895706031499887, 0.00001938944493709612, 0.00001983169166113953, 0.00002028402542818812, 0.00002074667630989887, 0.00002121987962554860, 0.00002170387606172507, 0.00002219891179474795, 0.00002270523861588212, 0.00002322311405940689, 0.00026345129671725227, 0.00033009898479591845, 0.00036792442434302252, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001853431786997440, 0.00001895706031499887, 0.00001938944493709612, 0.00001983169166113953, 0.00002028402542818812, 0.00002074667630989887, 0.00002121987962554860, 0.00002170387606172507, 0.00002219891179474795, 0.00002270523861588212, 0.00025757633280045758, 0.00032273777743496951, 0.00040438370968017316, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000260816869497494, 0.00000249057385563561, 0.00000237495693357432, 0.00000226136304237938, 0.00000214983832461837, 0.00000204042997530773, 0.00000193318626591770, 0.00000182815656892472, 0.00000172539138292392, 0.00000162494235831433, 0.00001127365411453010, 0.00000420906307100733, 0.00000052596488108441, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001183451970911474, 0.00001164305339993325, 0.00001144722000606858, 0.00001124691992029107, 0.00001104205126346637, 0.00001083250983273639, 0.00001061818904851835, 0.00001039897990029493, 0.00001017477089116797, 0.00000994544798114756, 0.00008562973267781970, 0.00005611715013035015, 0.00001913849920315026, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001853431786997440, 0.00001895706031499887, 0.00001938944493709612, 0.00001983169166113953, 0.00002028402542818812, 0.00002074667630989887, 0.00002121987962554860, 0.00002170387606172507, 0.00002219891179474795, 0.00002270523861588212, 0.00025757633280045758, 0.00032273777743496951, 0.00040438370968017316, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001812100258147397, 0.00001853431786997440, 0.00001895706031499887, 0.00001938944493709612, 0.00001983169166113953, 0.00002028402542818812, 0.00002074667630989887, 0.00002121987962554860, 0.00002170387606172507, 0.00002219891179474795, 0.00025183238057900734, 0.00031554072499816968, 0.00039536595295430532, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000272769734403700, 0.00000260816869497494, 0.00000249057385563561, 0.00000237495693357432, 0.00000226136304237938, 0.00000214983832461837, 0.00000204042997530773, 0.00000193318626591770, 0.00000182815656892472, 0.00000172539138292392, 0.00001213851441457608, 0.00000477584628732387, 0.00000071926372303623, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001202171631960148, 0.00001183451970911474, 0.00001164305339993325, 0.00001144722000606858, 0.00001124691992029107, 0.00001104205126346637, 0.00001083250983273639, 0.00001061818904851835, 0.00001039897990029493, 0.00001017477089116797, 0.00008823125363910430, 0.00005937680168244335, 0.00002322277467092001, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001812100258147397, 0.00001853431786997440, 0.00001895706031499887, 0.00001938944493709612, 0.00001983169166113953, 0.00002028402542818812, 0.00002074667630989887, 0.00002121987962554860, 0.00002170387606172507, 0.00002219891179474795, 0.00025183238057900734, 0.00031554072499816968, 0.00039536595295430532, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001771690422390710, 0.00001812100258147397, 0.00001853431786997440, 0.00001895706031499887, 0.00001938944493709612, 0.00001983169166113953, 0.00002028402542818812, 0.00002074667630989887, 0.00002121987962554860, 0.00002170387606172507, 0.00024621651849209551, 0.00030850416683071051, 0.00038654929220342441, 0.00008833199280000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000284911667886497, 0.00000272769734403700, 0.00000260816869497494, 0.00000249057385563561, 0.00000237495693357432, 0.00000226136304237938, 0.00000214983832461837, 0.00000204042997530773, 0.00000193318626591770, 0.00000182815656892472, 0.00001302965007633103, 0.00000537555198431655, 0.00000095381374721252, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001220473844567437, 0.00001202171631960148, 0.00001183451970911474, 0.00001164305339993325, 0.00001144722000606858, 0.00001124691992029107, 0.00001104205126346637, 0.00001083250983273639, 0.00001061818904851835, 0.00001039897990029493, 0.00009077476068295228, 0.00006256376300492486, 0.00002721597079575849, 0.00000045110640000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001771690422390710, 0.00001812100258147397, 0.00001853431786997440, 0.00001895706031499887, 0.00001938944493709612, 0.00001983169166113953, 0.00002028402542818812, 0.00002074667630989887, 0.00002121987962554860, 0.00002170387606172507, 0.00024621651849209551, 0.00030850416683071051, 0.00038654929220342435, 0.00008833199280000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001732181725971397, 0.00001771690422390710, 0.00001812100258147397, 0.00001853431786997440, 0.00001895706031499887, 0.00001938944493709612, 0.00001983169166113953, 0.00002028402542818812, 0.00002074667630989887, 0.00002121987962554860, 0.00024072589012972179, 0.00030162452391038568, 0.00037792924298728800, 0.00013102618936055999, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000297238453716629, 0.00000284911667886497, 0.00000272769734403700, 0.00000260816869497494, 0.00000249057385563561, 0.00000237495693357432, 0.00000226136304237938, 0.00000214983832461837, 0.00000204042997530773, 0.00000193318626591770, 0.00001394647515922885, 0.00000600744599066629, 0.00000122869505224968, 0.00000000455617464000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001238367917833583, 0.00001220473844567437, 0.00001202171631960148, 0.00001183451970911474, 0.00001164305339993325, 0.00001144722000606858, 0.00001124691992029107, 0.00001104205126346637, 0.00001083250983273639, 0.00001061818904851835, 0.00009326154751972243, 0.00006567965508991503, 0.00003112011864701308, 0.00000134325952728000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001732181725971397, 0.00001771690422390710, 0.00001812100258147397, 0.00001853431786997440, 0.00001895706031499887, 0.00001938944493709612, 0.00001983169166113953, 0.00002028402542818812, 0.00002074667630989887, 0.00002121987962554860, 0.00024072589012972176, 0.00030162452391038568, 0.00037792924298728794, 0.00013102618936055999, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001693554073482235, 0.00001732181725971397, 0.00001771690422390710, 0.00001812100258147397, 0.00001853431786997440, 0.00001895706031499887, 0.00001938944493709612, 0.00001983169166113953, 0.00002028402542818812, 0.00002074667630989887, 0.00023535770277982899, 0.00029489829702718408, 0.00036950142086867151, 0.00017276830533781952, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000309745969686748, 0.00000297238453716629, 0.00000284911667886497, 0.00000272769734403700, 0.00000260816869497494, 0.00000249057385563561, 0.00000237495693357432, 0.00000226136304237938, 0.00000214983832461837, 0.00000204042997530773, 0.00001488841678917805, 0.00000667081050707443, 0.00000154300825058451, 0.00000001812309586553, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001255862953265894, 0.00001238367917833583, 0.00001220473844567437, 0.00001202171631960148, 0.00001183451970911474, 0.00001164305339993325, 0.00001144722000606858, 0.00001124691992029107, 0.00001104205126346637, 0.00001083250983273639, 0.00009569287901003263, 0.00006872606278140992, 0.00003493720400118468, 0.00000266662403982166, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001693554073482235, 0.00001732181725971397, 0.00001771690422390710, 0.00001812100258147397, 0.00001853431786997440, 0.00001895706031499887, 0.00001938944493709612, 0.00001983169166113953, 0.00002028402542818812, 0.00002074667630989887, 0.00023535770277982896, 0.00029489829702718408, 0.00036950142086867135, 0.00017276830533781952, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001655787817643581, 0.00001693554073482235, 0.00001732181725971397, 0.00001771690422390710, 0.00001812100258147397, 0.00001853431786997440, 0.00001895706031499887, 0.00001938944493709612, 0.00001983169166113953, 0.00002028402542818812, 0.00023010922600783879, 0.00028832206500347784, 0.00036126153918330010, 0.00021357957212878614, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000322430185514733, 0.00000309745969686748, 0.00000297238453716629, 0.00000284911667886497, 0.00000272769734403700, 0.00000260816869497494, 0.00000249057385563561, 0.00000237495693357432, 0.00000226136304237938, 0.00000214983832461837, 0.00001585491486717938, 0.00000736494374116667, 0.00000189587401099648, 0.00000004505599866773, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001272967849408065, 0.00001255862953265894, 0.00001238367917833583, 0.00001220473844567437, 0.00001202171631960148, 0.00001183451970911474, 0.00001164305339993325, 0.00001144722000606858, 0.00001124691992029107, 0.00001104205126346637, 0.00009806999180810891, 0.00007170453558138449, 0.00003866916835195826, 0.00000441158392373363, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001655787817643581, 0.00001693554073482235, 0.00001732181725971397, 0.00001771690422390710, 0.00001812100258147397, 0.00001853431786997440, 0.00001895706031499887, 0.00001938944493709612, 0.00001983169166113953, 0.00002028402542818812, 0.00023010922600783879, 0.00028832206500347784, 0.00036126153918330004, 0.00021357957212878614, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001618863749310130, 0.00001655787817643581, 0.00001693554073482235, 0.00001732181725971397, 0.00001771690422390710, 0.00001812100258147397, 0.00001853431786997440, 0.00001895706031499887, 0.00001938944493709612, 0.00001983169166113953, 0.00022497779026786399, 0.00028189248295390029, 0.00035320540685951249, 0.00025348074767031422, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000335287160793755, 0.00000322430185514733, 0.00000309745969686748, 0.00000297238453716629, 0.00000284911667886497, 0.00000272769734403700, 0.00000260816869497494, 0.00000249057385563561, 0.00000237495693357432, 0.00000226136304237938, 0.00001684542178444127, 0.00000808915955053865, 0.00000228643261135126, 0.00000008961299629744, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001289691306366265, 0.00001272967849408065, 0.00001255862953265894, 0.00001238367917833583, 0.00001220473844567437, 0.00001202171631960148, 0.00001183451970911474, 0.00001164305339993325, 0.00001144722000606858, 0.00001124691992029107, 0.00010039409499078809, 0.00007461658843791961, 0.00004231790989770960, 0.00000656873760223437, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001618863749310129, 0.00001655787817643581, 0.00001693554073482235, 0.00001732181725971397, 0.00001771690422390710, 0.00001812100258147397, 0.00001853431786997440, 0.00001895706031499887, 0.00001938944493709612, 0.00001983169166113953, 0.00022497779026786399, 0.00028189248295390029, 0.00035320540685951249, 0.00025348074767031422, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001582763087700514, 0.00001618863749310130, 0.00001655787817643581, 0.00001693554073482235, 0.00001732181725971397, 0.00001771690422390710, 0.00001812100258147397, 0.00001853431786997440, 0.00001895706031499887, 0.00001938944493709612, 0.00021996078554489064, 0.00027560628058402831, 0.00034532892628654540, 0.00029249212699726616, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000348313042988054, 0.00000335287160793755, 0.00000322430185514733, 0.00000309745969686748, 0.00000297238453716629, 0.00000284911667886497, 0.00000272769734403700, 0.00000260816869497494, 0.00000249057385563561, 0.00000237495693357432, 0.00001785940214384823, 0.00000884278709376164, 0.00000271384350131813, 0.00000015595724608000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001306041830234297, 0.00001289691306366265, 0.00001272967849408065, 0.00001255862953265894, 0.00001238367917833583, 0.00001220473844567437, 0.00001202171631960148, 0.00001183451970911474, 0.00001164305339993325, 0.00001144722000606858, 0.00010266637067249351, 0.00007746370251575401, 0.00004588528450699068, 0.00000912889315370455, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001582763087700514, 0.00001618863749310129, 0.00001655787817643581, 0.00001693554073482235, 0.00001732181725971397, 0.00001771690422390710, 0.00001812100258147397, 0.00001853431786997440, 0.00001895706031499887, 0.00001938944493709612, 0.00021996078554489064, 0.00027560628058402831, 0.00034532892628654540, 0.00029249212699726616, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001547467470844792, 0.00001582763087700514, 0.00001618863749310130, 0.00001655787817643581, 0.00001693554073482235, 0.00001732181725971397, 0.00001771690422390710, 0.00001812100258147397, 0.00001853431786997440, 0.00001895706031499887, 0.00021505566002723962, 0.00026946026052700450, 0.00033762809123035544, 0.00033063355256522713, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000361504065473420, 0.00000348313042988054, 0.00000335287160793755, 0.00000322430185514733, 0.00000309745969686748, 0.00000297238453716629, 0.00000284911667886497, 0.00000272769734403700, 0.00000260816869497494, 0.00000249057385563561, 0.00001889633248764042, 0.00000962517048917076, 0.00000317728487483873, 0.00000024815906693242, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001322027737420073, 0.00001306041830234297, 0.00001289691306366265, 0.00001272967849408065, 0.00001255862953265894, 0.00001238367917833583, 0.00001220473844567437, 0.00001202171631960148, 0.00001183451970911474, 0.00001164305339993325, 0.00010488797460649691, 0.00008024732594965269, 0.00004937310666248479, 0.00001208306363637693, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001547467470844792, 0.00001582763087700514, 0.00001618863749310129, 0.00001655787817643581, 0.00001693554073482235, 0.00001732181725971397, 0.00001771690422390710, 0.00001812100258147397, 0.00001853431786997440, 0.00001895706031499887, 0.00021505566002723962, 0.00026946026052700450, 0.00033762809123035544, 0.00033063355256522713, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001512958946244953, 0.00001547467470844792, 0.00001582763087700514, 0.00001618863749310130, 0.00001655787817643581, 0.00001693554073482235, 0.00001732181725971397, 0.00001771690422390710, 0.00001812100258147397, 0.00001853431786997440, 0.00021025991880863217, 0.00026345129671725233, 0.00033009898479591845, 0.00036792442434302252, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000374856545621363, 0.00000361504065473420, 0.00000348313042988054, 0.00000335287160793755, 0.00000322430185514733, 0.00000309745969686748, 0.00000297238453716629, 0.00000284911667886497, 0.00000272769734403700, 0.00000260816869497494, 0.00001995570103116604, 0.00001043566848126225, 0.00000367595325212983, 0.00000037019800965983, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001337657158875604, 0.00001322027737420073, 0.00001306041830234297, 0.00001289691306366265, 0.00001272967849408065, 0.00001255862953265894, 0.00001238367917833583, 0.00001220473844567437, 0.00001202171631960148, 0.00001183451970911474, 0.00010706003677277205, 0.00008296887458097544, 0.00005278315038391138, 0.00001542246251728573, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001512958946244953, 0.00001547467470844792, 0.00001582763087700514, 0.00001618863749310129, 0.00001655787817643581, 0.00001693554073482235, 0.00001732181725971397, 0.00001771690422390710, 0.00001812100258147397, 0.00001853431786997440, 0.00021025991880863217, 0.00026345129671725227, 0.00033009898479591845, 0.00036792442434302252, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001479219961743691, 0.00001512958946244953, 0.00001547467470844792, 0.00001582763087700514, 0.00001618863749310130, 0.00001655787817643581, 0.00001693554073482235, 0.00001732181725971397, 0.00001771690422390710, 0.00001812100258147397, 0.00020557112261919967, 0.00025757633280045758, 0.00032273777743496951, 0.00040438370968017316, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000388366882926007, 0.00000374856545621363, 0.00000361504065473420, 0.00000348313042988054, 0.00000335287160793755, 0.00000322430185514733, 0.00000309745969686748, 0.00000297238453716629, 0.00000284911667886497, 0.00000272769734403700, 0.00002103700740257104, 0.00001127365411453010, 0.00000420906307100733, 0.00000052596488108441, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001352938044232679, 0.00001337657158875604, 0.00001322027737420073, 0.00001306041830234297, 0.00001289691306366265, 0.00001272967849408065, 0.00001255862953265894, 0.00001238367917833583, 0.00001220473844567437, 0.00001202171631960148, 0.00010918366195273922, 0.00008562973267781970, 0.00005611715013035015, 0.00001913849920315026, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001479219961743691, 0.00001512958946244953, 0.00001547467470844792, 0.00001582763087700514, 0.00001618863749310129, 0.00001655787817643581, 0.00001693554073482235, 0.00001732181725971397, 0.00001771690422390710, 0.00001812100258147397, 0.00020557112261919967, 0.00025757633280045758, 0.00032273777743496951, 0.00040438370968017316, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001446233356596807, 0.00001479219961743691, 0.00001512958946244953, 0.00001547467470844792, 0.00001582763087700514, 0.00001618863749310130, 0.00001655787817643581, 0.00001693554073482235, 0.00001732181725971397, 0.00001771690422390710, 0.00020098688658479148, 0.00025183238057900734, 0.00031554072499816968, 0.00039536595295430532, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000402031557172757, 0.00000388366882926007, 0.00000374856545621363, 0.00000361504065473420, 0.00000348313042988054, 0.00000335287160793755, 0.00000322430185514733, 0.00000309745969686748, 0.00000297238453716629, 0.00000284911667886497, 0.00002213976238829370, 0.00001213851441457608, 0.00000477584628732387, 0.00000071926372303623, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001367878165846290, 0.00001352938044232679, 0.00001337657158875604, 0.00001322027737420073, 0.00001306041830234297, 0.00001289691306366265, 0.00001272967849408065, 0.00001255862953265894, 0.00001238367917833583, 0.00001220473844567437, 0.00011125993029119313, 0.00008823125363910430, 0.00005937680168244335, 0.00002322277467092001, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001446233356596807, 0.00001479219961743691, 0.00001512958946244953, 0.00001547467470844792, 0.00001582763087700514, 0.00001618863749310129, 0.00001655787817643581, 0.00001693554073482235, 0.00001732181725971397, 0.00001771690422390710, 0.00020098688658479148, 0.00025183238057900734, 0.00031554072499816968, 0.00039536595295430532, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001413982352744698, 0.00001446233356596807, 0.00001479219961743691, 0.00001512958946244953, 0.00001547467470844792, 0.00001582763087700514, 0.00001618863749310130, 0.00001655787817643581, 0.00001693554073482235, 0.00001732181725971397, 0.00019650487901395062, 0.00024621651849209551, 0.00030850416683071051, 0.00038654929220342441, 0.00008833199280000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000415847126647804, 0.00000402031557172757, 0.00000388366882926007, 0.00000374856545621363, 0.00000361504065473420, 0.00000348313042988054, 0.00000335287160793755, 0.00000322430185514733, 0.00000309745969686748, 0.00000297238453716629, 0.00002326348768423475, 0.00001302965007633103, 0.00000537555198431655, 0.00000095381374721252, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001382485122747918, 0.00001367878165846290, 0.00001352938044232679, 0.00001337657158875604, 0.00001322027737420073, 0.00001306041830234297, 0.00001289691306366265, 0.00001272967849408065, 0.00001255862953265894, 0.00001238367917833583, 0.00011328989784569953, 0.00009077476068295228, 0.00006256376300492486, 0.00002721597079575849, 0.00000045110640000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001413982352744698, 0.00001446233356596807, 0.00001479219961743691, 0.00001512958946244953, 0.00001547467470844792, 0.00001582763087700514, 0.00001618863749310129, 0.00001655787817643581, 0.00001693554073482235, 0.00001732181725971397, 0.00019650487901395062, 0.00024621651849209551, 0.00030850416683071051, 0.00038654929220342435, 0.00008833199280000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001382450546278491, 0.00001413982352744698, 0.00001446233356596807, 0.00001479219961743691, 0.00001512958946244953, 0.00001547467470844792, 0.00001582763087700514, 0.00001618863749310130, 0.00001655787817643581, 0.00001693554073482235, 0.00019212282021193955, 0.00024072589012972179, 0.00030162452391038568, 0.00037792924298728800, 0.00013102618936055999, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000429810226387558, 0.00000415847126647804, 0.00000402031557172757, 0.00000388366882926007, 0.00000374856545621363, 0.00000361504065473420, 0.00000348313042988054, 0.00000335287160793755, 0.00000322430185514733, 0.00000309745969686748, 0.00002440771565247632, 0.00001394647515922885, 0.00000600744599066629, 0.00000122869505224968, 0.00000000455617464000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001396766344510639, 0.00001382485122747918, 0.00001367878165846290, 0.00001352938044232679, 0.00001337657158875604, 0.00001322027737420073, 0.00001306041830234297, 0.00001289691306366265, 0.00001272967849408065, 0.00001255862953265894, 0.00011527459712374042, 0.00009326154751972243, 0.00006567965508991503, 0.00003112011864701308, 0.00000134325952728000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001382450546278491, 0.00001413982352744698, 0.00001446233356596807, 0.00001479219961743691, 0.00001512958946244953, 0.00001547467470844792, 0.00001582763087700514, 0.00001618863749310129, 0.00001655787817643581, 0.00001693554073482235, 0.00019212282021193955, 0.00024072589012972176, 0.00030162452391038568, 0.00037792924298728794, 0.00013102618936055999, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001351621899096481, 0.00001382450546278491, 0.00001413982352744698, 0.00001446233356596807, 0.00001479219961743691, 0.00001512958946244953, 0.00001547467470844792, 0.00001582763087700514, 0.00001618863749310130, 0.00001655787817643581, 0.00018783848132121326, 0.00023535770277982899, 0.00029489829702718408, 0.00036950142086867151, 0.00017276830533781952, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000443917566467116, 0.00000429810226387558, 0.00000415847126647804, 0.00000402031557172757, 0.00000388366882926007, 0.00000374856545621363, 0.00000361504065473420, 0.00000348313042988054, 0.00000335287160793755, 0.00000322430185514733, 0.00002557198908342610, 0.00001488841678917805, 0.00000667081050707443, 0.00000154300825058451, 0.00000001812309586553, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001410729095028052, 0.00001396766344510639, 0.00001382485122747918, 0.00001367878165846290, 0.00001352938044232679, 0.00001337657158875604, 0.00001322027737420073, 0.00001306041830234297, 0.00001289691306366265, 0.00001272967849408065, 0.00011721503760788102, 0.00009569287901003263, 0.00006872606278140992, 0.00003493720400118468, 0.00000266662403982166, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001351621899096480, 0.00001382450546278491, 0.00001413982352744698, 0.00001446233356596807, 0.00001479219961743691, 0.00001512958946244953, 0.00001547467470844792, 0.00001582763087700514, 0.00001618863749310129, 0.00001655787817643581, 0.00018783848132121326, 0.00023535770277982896, 0.00029489829702718408, 0.00036950142086867135, 0.00017276830533781952, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001321480730746629, 0.00001351621899096481, 0.00001382450546278491, 0.00001413982352744698, 0.00001446233356596807, 0.00001479219961743691, 0.00001512958946244953, 0.00001547467470844792, 0.00001582763087700514, 0.00001618863749310130, 0.00018364968318775022, 0.00023010922600783879, 0.00028832206500347784, 0.00036126153918330010, 0.00021357957212878614, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000458165930326899, 0.00000443917566467116, 0.00000429810226387558, 0.00000415847126647804, 0.00000402031557172757, 0.00000388366882926007, 0.00000374856545621363, 0.00000361504065473420, 0.00000348313042988054, 0.00000335287160793755, 0.00002675586096326570, 0.00001585491486717938, 0.00000736494374116667, 0.00000189587401099648, 0.00000004505599866773, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001424380476208927, 0.00001410729095028052, 0.00001396766344510639, 0.00001382485122747918, 0.00001367878165846290, 0.00001352938044232679, 0.00001337657158875604, 0.00001322027737420073, 0.00001306041830234297, 0.00001289691306366265, 0.00011911220626922527, 0.00009806999180810891, 0.00007170453558138449, 0.00003866916835195826, 0.00000441158392373363, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001321480730746629, 0.00001351621899096480, 0.00001382450546278491, 0.00001413982352744698, 0.00001446233356596807, 0.00001479219961743691, 0.00001512958946244953, 0.00001547467470844792, 0.00001582763087700514, 0.00001618863749310129, 0.00018364968318775022, 0.00023010922600783879, 0.00028832206500347784, 0.00036126153918330004, 0.00021357957212878614, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001292011710450979, 0.00001321480730746629, 0.00001351621899096481, 0.00001382450546278491, 0.00001413982352744698, 0.00001446233356596807, 0.00001479219961743691, 0.00001512958946244953, 0.00001547467470844792, 0.00001582763087700514, 0.00017955429525266342, 0.00022497779026786399, 0.00028189248295390029, 0.00035320540685951249, 0.00025348074767031422, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000472552173136609, 0.00000458165930326899, 0.00000443917566467116, 0.00000429810226387558, 0.00000415847126647804, 0.00000402031557172757, 0.00000388366882926007, 0.00000374856545621363, 0.00000361504065473420, 0.00000348313042988054, 0.00002795889424658487, 0.00001684542178444127, 0.00000808915955053865, 0.00000228643261135126, 0.00000008961299629744, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001437727431589467, 0.00001424380476208927, 0.00001410729095028052, 0.00001396766344510639, 0.00001382485122747918, 0.00001367878165846290, 0.00001352938044232679, 0.00001337657158875604, 0.00001322027737420073, 0.00001306041830234297, 0.00012096706806942155, 0.00010039409499078809, 0.00007461658843791961, 0.00004231790989770960, 0.00000656873760223437, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001292011710450979, 0.00001321480730746629, 0.00001351621899096480, 0.00001382450546278491, 0.00001413982352744698, 0.00001446233356596807, 0.00001479219961743691, 0.00001512958946244953, 0.00001547467470844792, 0.00001582763087700514, 0.00017955429525266342, 0.00022497779026786399, 0.00028189248295390029, 0.00035320540685951249, 0.00025348074767031422, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001263199849307923, 0.00001292011710450979, 0.00001321480730746629, 0.00001351621899096481, 0.00001382450546278491, 0.00001413982352744698, 0.00001446233356596807, 0.00001479219961743691, 0.00001512958946244953, 0.00001547467470844792, 0.00017555023446852905, 0.00021996078554489064, 0.00027560628058402831, 0.00034532892628654540, 0.00029249212699726616, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000487073220195663, 0.00000472552173136609, 0.00000458165930326899, 0.00000443917566467116, 0.00000429810226387558, 0.00000415847126647804, 0.00000402031557172757, 0.00000388366882926007, 0.00000374856545621363, 0.00000361504065473420, 0.00002918066163408603, 0.00001785940214384823, 0.00000884278709376164, 0.00000271384350131813, 0.00000015595724608000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001450776749865022, 0.00001437727431589467, 0.00001424380476208927, 0.00001410729095028052, 0.00001396766344510639, 0.00001382485122747918, 0.00001367878165846290, 0.00001352938044232679, 0.00001337657158875604, 0.00001322027737420073, 0.00012278056645147344, 0.00010266637067249351, 0.00007746370251575401, 0.00004588528450699068, 0.00000912889315370455, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001263199849307922, 0.00001292011710450979, 0.00001321480730746629, 0.00001351621899096480, 0.00001382450546278491, 0.00001413982352744698, 0.00001446233356596807, 0.00001479219961743691, 0.00001512958946244953, 0.00001547467470844792, 0.00017555023446852902, 0.00021996078554489064, 0.00027560628058402831, 0.00034532892628654540, 0.00029249212699726616, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001235030492668356, 0.00001263199849307923, 0.00001292011710450979, 0.00001321480730746629, 0.00001351621899096481, 0.00001382450546278491, 0.00001413982352744698, 0.00001446233356596807, 0.00001479219961743691, 0.00001512958946244953, 0.00017163546423988081, 0.00021505566002723962, 0.00026946026052700450, 0.00033762809123035544, 0.00033063355256522713, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000501726065369300, 0.00000487073220195663, 0.00000472552173136609, 0.00000458165930326899, 0.00000443917566467116, 0.00000429810226387558, 0.00000415847126647804, 0.00000402031557172757, 0.00000388366882926007, 0.00000374856545621363, 0.00003042074535524591, 0.00001889633248764042, 0.00000962517048917076, 0.00000317728487483873, 0.00000024815906693242, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001463535068343032, 0.00001450776749865022, 0.00001437727431589467, 0.00001424380476208927, 0.00001410729095028052, 0.00001396766344510639, 0.00001382485122747918, 0.00001367878165846290, 0.00001352938044232679, 0.00001337657158875604, 0.00012455362381960558, 0.00010488797460649691, 0.00008024732594965269, 0.00004937310666248479, 0.00001208306363637693, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001235030492668356, 0.00001263199849307922, 0.00001292011710450979, 0.00001321480730746629, 0.00001351621899096480, 0.00001382450546278491, 0.00001413982352744698, 0.00001446233356596807, 0.00001479219961743691, 0.00001512958946244953, 0.00017163546423988084, 0.00021505566002723962, 0.00026946026052700450, 0.00033762809123035544, 0.00033063355256522713, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001207489312681852, 0.00001235030492668356, 0.00001263199849307923, 0.00001292011710450979, 0.00001321480730746629, 0.00001351621899096481, 0.00001382450546278491, 0.00001413982352744698, 0.00001446233356596807, 0.00001479219961743691, 0.00016780799338733150, 0.00021025991880863217, 0.00026345129671725233, 0.00033009898479591845, 0.00036792442434302252, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000516507769559564, 0.00000501726065369300, 0.00000487073220195663, 0.00000472552173136609, 0.00000458165930326899, 0.00000443917566467116, 0.00000429810226387558, 0.00000415847126647804, 0.00000402031557172757, 0.00000388366882926007, 0.00003167873695582393, 0.00001995570103116604, 0.00001043566848126225, 0.00000367595325212983, 0.00000037019800965983, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001476008876318983, 0.00001463535068343032, 0.00001450776749865022, 0.00001437727431589467, 0.00001424380476208927, 0.00001410729095028052, 0.00001396766344510639, 0.00001382485122747918, 0.00001367878165846290, 0.00001352938044232679, 0.00012628714200842839, 0.00010706003677277205, 0.00008296887458097544, 0.00005278315038391138, 0.00001542246251728573, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001207489312681851, 0.00001235030492668356, 0.00001263199849307922, 0.00001292011710450979, 0.00001321480730746629, 0.00001351621899096480, 0.00001382450546278491, 0.00001413982352744698, 0.00001446233356596807, 0.00001479219961743691, 0.00016780799338733150, 0.00021025991880863217, 0.00026345129671725227, 0.00033009898479591845, 0.00036792442434302252, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001180562301009046, 0.00001207489312681852, 0.00001235030492668356, 0.00001263199849307923, 0.00001292011710450979, 0.00001321480730746629, 0.00001351621899096481, 0.00001382450546278491, 0.00001413982352744698, 0.00001446233356596807, 0.00016406587513479400, 0.00020557112261919967, 0.00025757633280045758, 0.00032273777743496951, 0.00040438370968017316, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000531415459210386, 0.00000516507769559564, 0.00000501726065369300, 0.00000487073220195663, 0.00000472552173136609, 0.00000458165930326899, 0.00000443917566467116, 0.00000429810226387558, 0.00000415847126647804, 0.00000402031557172757, 0.00003295423709010905, 0.00002103700740257104, 0.00001127365411453010, 0.00000420906307100733, 0.00000052596488108441, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001488204518377069, 0.00001476008876318983, 0.00001463535068343032, 0.00001450776749865022, 0.00001437727431589467, 0.00001424380476208927, 0.00001410729095028052, 0.00001396766344510639, 0.00001382485122747918, 0.00001367878165846290, 0.00012798200274164042, 0.00010918366195273922, 0.00008562973267781970, 0.00005611715013035015, 0.00001913849920315026, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001180562301009046, 0.00001207489312681851, 0.00001235030492668356, 0.00001263199849307922, 0.00001292011710450979, 0.00001321480730746629, 0.00001351621899096480, 0.00001382450546278491, 0.00001413982352744698, 0.00001446233356596807, 0.00016406587513479400, 0.00020557112261919967, 0.00025757633280045758, 0.00032273777743496951, 0.00040438370968017316, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001154235761696545, 0.00001180562301009046, 0.00001207489312681852, 0.00001235030492668356, 0.00001263199849307923, 0.00001292011710450979, 0.00001321480730746629, 0.00001351621899096481, 0.00001382450546278491, 0.00001413982352744698, 0.00016040720611928808, 0.00020098688658479148, 0.00025183238057900734, 0.00031554072499816968, 0.00039536595295430532, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000546446324845994, 0.00000531415459210386, 0.00000516507769559564, 0.00000501726065369300, 0.00000487073220195663, 0.00000472552173136609, 0.00000458165930326899, 0.00000443917566467116, 0.00000429810226387558, 0.00000415847126647804, 0.00003424685531779962, 0.00002213976238829370, 0.00001213851441457608, 0.00000477584628732387, 0.00000071926372303623, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001500128197617261, 0.00001488204518377069, 0.00001476008876318983, 0.00001463535068343032, 0.00001450776749865022, 0.00001437727431589467, 0.00001424380476208927, 0.00001410729095028052, 0.00001396766344510639, 0.00001382485122747918, 0.00012963906808050187, 0.00011125993029119313, 0.00008823125363910430, 0.00005937680168244335, 0.00002322277467092001, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001154235761696545, 0.00001180562301009046, 0.00001207489312681851, 0.00001235030492668356, 0.00001263199849307922, 0.00001292011710450979, 0.00001321480730746629, 0.00001351621899096480, 0.00001382450546278491, 0.00001413982352744698, 0.00016040720611928808, 0.00020098688658479148, 0.00025183238057900734, 0.00031554072499816968, 0.00039536595295430532, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001128496304210712, 0.00001154235761696545, 0.00001180562301009046, 0.00001207489312681852, 0.00001235030492668356, 0.00001263199849307923, 0.00001292011710450979, 0.00001321480730746629, 0.00001351621899096481, 0.00001382450546278491, 0.00015683012542282797, 0.00019650487901395062, 0.00024621651849209551, 0.00030850416683071051, 0.00038654929220342441, 0.00008833199280000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000561597619641929, 0.00000546446324845994, 0.00000531415459210386, 0.00000516507769559564, 0.00000501726065369300, 0.00000487073220195663, 0.00000472552173136609, 0.00000458165930326899, 0.00000443917566467116, 0.00000429810226387558, 0.00003555620990541269, 0.00002326348768423475, 0.00001302965007633103, 0.00000537555198431655, 0.00000095381374721252, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001511785978810396, 0.00001500128197617261, 0.00001488204518377069, 0.00001476008876318983, 0.00001463535068343032, 0.00001450776749865022, 0.00001437727431589467, 0.00001424380476208927, 0.00001410729095028052, 0.00001396766344510639, 0.00013125918086230668, 0.00011328989784569953, 0.00009077476068295228, 0.00006256376300492486, 0.00002721597079575849, 0.00000045110640000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001128496304210712, 0.00001154235761696545, 0.00001180562301009046, 0.00001207489312681851, 0.00001235030492668356, 0.00001263199849307922, 0.00001292011710450979, 0.00001321480730746629, 0.00001351621899096480, 0.00001382450546278491, 0.00015683012542282797, 0.00019650487901395062, 0.00024621651849209551, 0.00030850416683071051, 0.00038654929220342435, 0.00008833199280000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001103330836626813, 0.00001128496304210712, 0.00001154235761696545, 0.00001180562301009046, 0.00001207489312681852, 0.00001235030492668356, 0.00001263199849307923, 0.00001292011710450979, 0.00001321480730746629, 0.00001351621899096481, 0.00015333281362589892, 0.00019212282021193955, 0.00024072589012972179, 0.00030162452391038568, 0.00037792924298728800, 0.00013102618936055999, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000576866658027914, 0.00000561597619641929, 0.00000546446324845994, 0.00000531415459210386, 0.00000516507769559564, 0.00000501726065369300, 0.00000487073220195663, 0.00000472552173136609, 0.00000458165930326899, 0.00000443917566467116, 0.00003688192763212199, 0.00002440771565247632, 0.00001394647515922885, 0.00000600744599066629, 0.00000122869505224968, 0.00000000455617464000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001523183791482924, 0.00001511785978810396, 0.00001500128197617261, 0.00001488204518377069, 0.00001476008876318983, 0.00001463535068343032, 0.00001450776749865022, 0.00001437727431589467, 0.00001424380476208927, 0.00001410729095028052, 0.00013284316512907724, 0.00011527459712374042, 0.00009326154751972243, 0.00006567965508991503, 0.00003112011864701308, 0.00000134325952728000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001103330836626813, 0.00001128496304210712, 0.00001154235761696545, 0.00001180562301009046, 0.00001207489312681851, 0.00001235030492668356, 0.00001263199849307922, 0.00001292011710450979, 0.00001321480730746629, 0.00001351621899096480, 0.00015333281362589892, 0.00019212282021193955, 0.00024072589012972176, 0.00030162452391038568, 0.00037792924298728794, 0.00013102618936055999, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001078726558970035, 0.00001103330836626813, 0.00001128496304210712, 0.00001154235761696545, 0.00001180562301009046, 0.00001207489312681852, 0.00001235030492668356, 0.00001263199849307923, 0.00001292011710450979, 0.00001321480730746629, 0.00014991349188204136, 0.00018783848132121326, 0.00023535770277982899, 0.00029489829702718408, 0.00036950142086867151, 0.00017276830533781952, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000592250814321891, 0.00000576866658027914, 0.00000561597619641929, 0.00000546446324845994, 0.00000531415459210386, 0.00000516507769559564, 0.00000501726065369300, 0.00000487073220195663, 0.00000472552173136609, 0.00000458165930326899, 0.00003822364359992566, 0.00002557198908342610, 0.00001488841678917805, 0.00000667081050707443, 0.00000154300825058451, 0.00000001812309586553, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001534327432932855, 0.00001523183791482924, 0.00001511785978810396, 0.00001500128197617261, 0.00001488204518377069, 0.00001476008876318983, 0.00001463535068343032, 0.00001450776749865022, 0.00001437727431589467, 0.00001424380476208927, 0.00013439182654669880, 0.00011721503760788102, 0.00009569287901003263, 0.00006872606278140992, 0.00003493720400118468, 0.00000266662403982166, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001078726558970035, 0.00001103330836626813, 0.00001128496304210712, 0.00001154235761696545, 0.00001180562301009046, 0.00001207489312681851, 0.00001235030492668356, 0.00001263199849307922, 0.00001292011710450979, 0.00001321480730746629, 0.00014991349188204134, 0.00018783848132121326, 0.00023535770277982896, 0.00029489829702718408, 0.00036950142086867135, 0.00017276830533781952, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001054670956705003, 0.00001078726558970035, 0.00001103330836626813, 0.00001128496304210712, 0.00001154235761696545, 0.00001180562301009046, 0.00001207489312681852, 0.00001235030492668356, 0.00001263199849307923, 0.00001292011710450979, 0.00014657042101307185, 0.00018364968318775022, 0.00023010922600783879, 0.00028832206500347784, 0.00036126153918330010, 0.00021357957212878614, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000607747521394513, 0.00000592250814321891, 0.00000576866658027914, 0.00000561597619641929, 0.00000546446324845994, 0.00000531415459210386, 0.00000516507769559564, 0.00000501726065369300, 0.00000487073220195663, 0.00000472552173136609, 0.00003958100104804732, 0.00002675586096326570, 0.00001585491486717938, 0.00000736494374116667, 0.00000189587401099648, 0.00000004505599866773, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001545222571178452, 0.00001534327432932855, 0.00001523183791482924, 0.00001511785978810396, 0.00001500128197617261, 0.00001488204518377069, 0.00001476008876318983, 0.00001463535068343032, 0.00001450776749865022, 0.00001437727431589467, 0.00013590595281470742, 0.00011911220626922527, 0.00009806999180810891, 0.00007170453558138449, 0.00003866916835195826, 0.00000441158392373363, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001054670956705003, 0.00001078726558970035, 0.00001103330836626813, 0.00001128496304210712, 0.00001154235761696545, 0.00001180562301009046, 0.00001207489312681851, 0.00001235030492668356, 0.00001263199849307922, 0.00001292011710450979, 0.00014657042101307185, 0.00018364968318775022, 0.00023010922600783879, 0.00028832206500347784, 0.00036126153918330004, 0.00021357957212878614, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001031151794370482, 0.00001054670956705003, 0.00001078726558970035, 0.00001103330836626813, 0.00001128496304210712, 0.00001154235761696545, 0.00001180562301009046, 0.00001207489312681852, 0.00001235030492668356, 0.00001263199849307923, 0.00014330190062448035, 0.00017955429525266342, 0.00022497779026786399, 0.00028189248295390029, 0.00035320540685951249, 0.00025348074767031422, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000623354269363415, 0.00000607747521394513, 0.00000592250814321891, 0.00000576866658027914, 0.00000561597619641929, 0.00000546446324845994, 0.00000531415459210386, 0.00000516507769559564, 0.00000501726065369300, 0.00000487073220195663, 0.00004095365117147587, 0.00002795889424658487, 0.00001684542178444127, 0.00000808915955053865, 0.00000228643261135126, 0.00000008961299629744, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001555874747841173, 0.00001545222571178452, 0.00001534327432932855, 0.00001523183791482924, 0.00001511785978810396, 0.00001500128197617261, 0.00001488204518377069, 0.00001476008876318983, 0.00001463535068343032, 0.00001450776749865022, 0.00013738631406693945, 0.00012096706806942155, 0.00010039409499078809, 0.00007461658843791961, 0.00004231790989770960, 0.00000656873760223437, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001031151794370482, 0.00001054670956705003, 0.00001078726558970035, 0.00001103330836626813, 0.00001128496304210712, 0.00001154235761696545, 0.00001180562301009046, 0.00001207489312681851, 0.00001235030492668356, 0.00001263199849307922, 0.00014330190062448035, 0.00017955429525266342, 0.00022497779026786399, 0.00028189248295390029, 0.00035320540685951249, 0.00025348074767031422, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001008157109356020, 0.00001031151794370482, 0.00001054670956705003, 0.00001078726558970035, 0.00001103330836626813, 0.00001128496304210712, 0.00001154235761696545, 0.00001180562301009046, 0.00001207489312681852, 0.00001235030492668356, 0.00014010626824055442, 0.00017555023446852905, 0.00021996078554489064, 0.00027560628058402831, 0.00034532892628654540, 0.00029249212699726616, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000639068604316611, 0.00000623354269363415, 0.00000607747521394513, 0.00000592250814321891, 0.00000576866658027914, 0.00000561597619641929, 0.00000546446324845994, 0.00000531415459210386, 0.00000516507769559564, 0.00000501726065369300, 0.00004234125294355196, 0.00002918066163408603, 0.00001785940214384823, 0.00000884278709376164, 0.00000271384350131813, 0.00000015595724608000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001566289380964314, 0.00001555874747841173, 0.00001545222571178452, 0.00001534327432932855, 0.00001523183791482924, 0.00001511785978810396, 0.00001500128197617261, 0.00001488204518377069, 0.00001476008876318983, 0.00001463535068343032, 0.00013883366326324670, 0.00012278056645147344, 0.00010266637067249351, 0.00007746370251575401, 0.00004588528450699068, 0.00000912889315370455, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001008157109356020, 0.00001031151794370482, 0.00001054670956705003, 0.00001078726558970035, 0.00001103330836626813, 0.00001128496304210712, 0.00001154235761696545, 0.00001180562301009046, 0.00001207489312681851, 0.00001235030492668356, 0.00014010626824055442, 0.00017555023446852902, 0.00021996078554489064, 0.00027560628058402831, 0.00034532892628654540, 0.00029249212699726616, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000985675205817381, 0.00001008157109356020, 0.00001031151794370482, 0.00001054670956705003, 0.00001078726558970035, 0.00001103330836626813, 0.00001128496304210712, 0.00001154235761696545, 0.00001180562301009046, 0.00001207489312681852, 0.00013698189845879008, 0.00017163546423988081, 0.00021505566002723962, 0.00026946026052700450, 0.00033762809123035544, 0.00033063355256522713, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000654888127064351, 0.00000639068604316611, 0.00000623354269363415, 0.00000607747521394513, 0.00000592250814321891, 0.00000576866658027914, 0.00000561597619641929, 0.00000546446324845994, 0.00000531415459210386, 0.00000516507769559564, 0.00004374347294251075, 0.00003042074535524591, 0.00001889633248764042, 0.00000962517048917076, 0.00000317728487483873, 0.00000024815906693242, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001576471767768811, 0.00001566289380964314, 0.00001555874747841173, 0.00001545222571178452, 0.00001534327432932855, 0.00001523183791482924, 0.00001511785978810396, 0.00001500128197617261, 0.00001488204518377069, 0.00001476008876318983, 0.00014024873657247631, 0.00012455362381960558, 0.00010488797460649691, 0.00008024732594965269, 0.00004937310666248479, 0.00001208306363637693, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000985675205817381, 0.00001008157109356020, 0.00001031151794370482, 0.00001054670956705003, 0.00001078726558970035, 0.00001103330836626813, 0.00001128496304210712, 0.00001154235761696545, 0.00001180562301009046, 0.00001207489312681851, 0.00013698189845879008, 0.00017163546423988084, 0.00021505566002723962, 0.00026946026052700450, 0.00033762809123035544, 0.00033063355256522713, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000963694648727653, 0.00000985675205817381, 0.00001008157109356020, 0.00001031151794370482, 0.00001054670956705003, 0.00001078726558970035, 0.00001103330836626813, 0.00001128496304210712, 0.00001154235761696545, 0.00001180562301009046, 0.00013392720212315905, 0.00016780799338733150, 0.00021025991880863217, 0.00026345129671725233, 0.00033009898479591845, 0.00036792442434302252, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000670810491918816, 0.00000654888127064351, 0.00000639068604316611, 0.00000623354269363415, 0.00000607747521394513, 0.00000592250814321891, 0.00000576866658027914, 0.00000561597619641929, 0.00000546446324845994, 0.00000531415459210386, 0.00004515998518189276, 0.00003167873695582393, 0.00001995570103116604, 0.00001043566848126225, 0.00000367595325212983, 0.00000037019800965983, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001586427087347566, 0.00001576471767768811, 0.00001566289380964314, 0.00001555874747841173, 0.00001545222571178452, 0.00001534327432932855, 0.00001523183791482924, 0.00001511785978810396, 0.00001500128197617261, 0.00001488204518377069, 0.00014163225374691008, 0.00012628714200842839, 0.00010706003677277205, 0.00008296887458097544, 0.00005278315038391138, 0.00001542246251728573, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000963694648727653, 0.00000985675205817381, 0.00001008157109356020, 0.00001031151794370482, 0.00001054670956705003, 0.00001078726558970035, 0.00001103330836626813, 0.00001128496304210712, 0.00001154235761696545, 0.00001180562301009046, 0.00013392720212315905, 0.00016780799338733150, 0.00021025991880863217, 0.00026345129671725227, 0.00033009898479591845, 0.00036792442434302252, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000942204258061026, 0.00000963694648727653, 0.00000985675205817381, 0.00001008157109356020, 0.00001031151794370482, 0.00001054670956705003, 0.00001078726558970035, 0.00001103330836626813, 0.00001128496304210712, 0.00001154235761696545, 0.00013094062551581261, 0.00016406587513479400, 0.00020557112261919967, 0.00025757633280045758, 0.00032273777743496951, 0.00040438370968017316, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000686833405501026, 0.00000670810491918816, 0.00000654888127064351, 0.00000639068604316611, 0.00000623354269363415, 0.00000607747521394513, 0.00000592250814321891, 0.00000576866658027914, 0.00000561597619641929, 0.00000546446324845994, 0.00004659047094473655, 0.00003295423709010905, 0.00002103700740257104, 0.00001127365411453010, 0.00000420906307100733, 0.00000052596488108441, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001596160403299715, 0.00001586427087347566, 0.00001576471767768811, 0.00001566289380964314, 0.00001555874747841173, 0.00001545222571178452, 0.00001534327432932855, 0.00001523183791482924, 0.00001511785978810396, 0.00001500128197617261, 0.00014298491848835400, 0.00012798200274164042, 0.00010918366195273922, 0.00008562973267781970, 0.00005611715013035015, 0.00001913849920315026, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000942204258061026, 0.00000963694648727653, 0.00000985675205817381, 0.00001008157109356020, 0.00001031151794370482, 0.00001054670956705003, 0.00001078726558970035, 0.00001103330836626813, 0.00001128496304210712, 0.00001154235761696545, 0.00013094062551581261, 0.00016406587513479400, 0.00020557112261919967, 0.00025757633280045758, 0.00032273777743496951, 0.00040438370968017316, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000921193103106265, 0.00000942204258061026, 0.00000963694648727653, 0.00000985675205817381, 0.00001008157109356020, 0.00001031151794370482, 0.00001054670956705003, 0.00001078726558970035, 0.00001103330836626813, 0.00001128496304210712, 0.00012802064956680999, 0.00016040720611928808, 0.00020098688658479148, 0.00025183238057900734, 0.00031554072499816968, 0.00039536595295430532, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000702954625574353, 0.00000686833405501026, 0.00000670810491918816, 0.00000654888127064351, 0.00000639068604316611, 0.00000623354269363415, 0.00000607747521394513, 0.00000592250814321891, 0.00000576866658027914, 0.00000561597619641929, 0.00004803461862146893, 0.00003424685531779962, 0.00002213976238829370, 0.00001213851441457608, 0.00000477584628732387, 0.00000071926372303623, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001605676666306131, 0.00001596160403299715, 0.00001586427087347566, 0.00001576471767768811, 0.00001566289380964314, 0.00001555874747841173, 0.00001545222571178452, 0.00001534327432932855, 0.00001523183791482924, 0.00001511785978810396, 0.00014430741880606371, 0.00012963906808050187, 0.00011125993029119313, 0.00008823125363910430, 0.00005937680168244335, 0.00002322277467092001, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000921193103106265, 0.00000942204258061026, 0.00000963694648727653, 0.00000985675205817381, 0.00001008157109356020, 0.00001031151794370482, 0.00001054670956705003, 0.00001078726558970035, 0.00001103330836626813, 0.00001128496304210712, 0.00012802064956680997, 0.00016040720611928808, 0.00020098688658479148, 0.00025183238057900734, 0.00031554072499816968, 0.00039536595295430532, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000900650496906996, 0.00000921193103106265, 0.00000942204258061026, 0.00000963694648727653, 0.00000985675205817381, 0.00001008157109356020, 0.00001031151794370482, 0.00001054670956705003, 0.00001078726558970035, 0.00001103330836626813, 0.00012516578908147014, 0.00015683012542282797, 0.00019650487901395062, 0.00024621651849209551, 0.00030850416683071051, 0.00038654929220342441, 0.00008833199280000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000719171959904045, 0.00000702954625574353, 0.00000686833405501026, 0.00000670810491918816, 0.00000654888127064351, 0.00000639068604316611, 0.00000623354269363415, 0.00000607747521394513, 0.00000592250814321891, 0.00000576866658027914, 0.00004949212355141017, 0.00003555620990541269, 0.00002326348768423475, 0.00001302965007633103, 0.00000537555198431655, 0.00000095381374721252, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001614980716647505, 0.00001605676666306131, 0.00001596160403299715, 0.00001586427087347566, 0.00001576471767768811, 0.00001566289380964314, 0.00001555874747841173, 0.00001545222571178452, 0.00001534327432932855, 0.00001523183791482924, 0.00014560042736668849, 0.00013125918086230668, 0.00011328989784569953, 0.00009077476068295228, 0.00006256376300492486, 0.00002721597079575849, 0.00000045110640000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000900650496906996, 0.00000921193103106265, 0.00000942204258061026, 0.00000963694648727653, 0.00000985675205817381, 0.00001008157109356020, 0.00001031151794370482, 0.00001054670956705003, 0.00001078726558970035, 0.00001103330836626813, 0.00012516578908147014, 0.00015683012542282797, 0.00019650487901395062, 0.00024621651849209551, 0.00030850416683071051, 0.00038654929220342435, 0.00008833199280000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000880565990825970, 0.00000900650496906996, 0.00000921193103106265, 0.00000942204258061026, 0.00000963694648727653, 0.00000985675205817381, 0.00001008157109356020, 0.00001031151794370482, 0.00001054670956705003, 0.00001078726558970035, 0.00012237459198495334, 0.00015333281362589892, 0.00019212282021193955, 0.00024072589012972179, 0.00030162452391038568, 0.00037792924298728800, 0.00013102618936055999, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000735483265142185, 0.00000719171959904045, 0.00000702954625574353, 0.00000686833405501026, 0.00000670810491918816, 0.00000654888127064351, 0.00000639068604316611, 0.00000623354269363415, 0.00000607747521394513, 0.00000592250814321891, 0.00005096268786781373, 0.00003688192763212199, 0.00002440771565247632, 0.00001394647515922885, 0.00000600744599066629, 0.00000122869505224968, 0.00000000455617464000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001624077286666266, 0.00001614980716647505, 0.00001605676666306131, 0.00001596160403299715, 0.00001586427087347566, 0.00001576471767768811, 0.00001566289380964314, 0.00001555874747841173, 0.00001545222571178452, 0.00001534327432932855, 0.00014686460183641130, 0.00013284316512907724, 0.00011527459712374042, 0.00009326154751972243, 0.00006567965508991503, 0.00003112011864701308, 0.00000134325952728000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000880565990825970, 0.00000900650496906996, 0.00000921193103106265, 0.00000942204258061026, 0.00000963694648727653, 0.00000985675205817381, 0.00001008157109356020, 0.00001031151794370482, 0.00001054670956705003, 0.00001078726558970035, 0.00012237459198495334, 0.00015333281362589892, 0.00019212282021193955, 0.00024072589012972176, 0.00030162452391038568, 0.00037792924298728794, 0.00013102618936055999, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000860929369230551, 0.00000880565990825970, 0.00000900650496906996, 0.00000921193103106265, 0.00000942204258061026, 0.00000963694648727653, 0.00000985675205817381, 0.00001008157109356020, 0.00001031151794370482, 0.00001054670956705003, 0.00011964563858368890, 0.00014991349188204136, 0.00018783848132121326, 0.00023535770277982899, 0.00029489829702718408, 0.00036950142086867151, 0.00017276830533781952, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000751886445737514, 0.00000735483265142185, 0.00000719171959904045, 0.00000702954625574353, 0.00000686833405501026, 0.00000670810491918816, 0.00000654888127064351, 0.00000639068604316611, 0.00000623354269363415, 0.00000607747521394513, 0.00005244602034636148, 0.00003822364359992566, 0.00002557198908342610, 0.00001488841678917805, 0.00000667081050707443, 0.00000154300825058451, 0.00000001812309586553, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001632971003173608, 0.00001624077286666266, 0.00001614980716647505, 0.00001605676666306131, 0.00001596160403299715, 0.00001586427087347566, 0.00001576471767768811, 0.00001566289380964314, 0.00001555874747841173, 0.00001545222571178452, 0.00014810058521545934, 0.00013439182654669880, 0.00011721503760788102, 0.00009569287901003263, 0.00006872606278140992, 0.00003493720400118468, 0.00000266662403982166, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000860929369230551, 0.00000880565990825970, 0.00000900650496906996, 0.00000921193103106265, 0.00000942204258061026, 0.00000963694648727653, 0.00000985675205817381, 0.00001008157109356020, 0.00001031151794370482, 0.00001054670956705003, 0.00011964563858368888, 0.00014991349188204134, 0.00018783848132121326, 0.00023535770277982896, 0.00029489829702718408, 0.00036950142086867135, 0.00017276830533781952, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000841730644296709, 0.00000860929369230551, 0.00000880565990825970, 0.00000900650496906996, 0.00000921193103106265, 0.00000942204258061026, 0.00000963694648727653, 0.00000985675205817381, 0.00001008157109356020, 0.00001031151794370482, 0.00011697754084327263, 0.00014657042101307185, 0.00018364968318775022, 0.00023010922600783879, 0.00028832206500347784, 0.00036126153918330010, 0.00021357957212878614, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000768379452869568, 0.00000751886445737514, 0.00000735483265142185, 0.00000719171959904045, 0.00000702954625574353, 0.00000686833405501026, 0.00000670810491918816, 0.00000654888127064351, 0.00000639068604316611, 0.00000623354269363415, 0.00005394183625703761, 0.00003958100104804732, 0.00002675586096326570, 0.00001585491486717938, 0.00000736494374116667, 0.00000189587401099648, 0.00000004505599866773, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001641666389802836, 0.00001632971003173608, 0.00001624077286666266, 0.00001614980716647505, 0.00001605676666306131, 0.00001596160403299715, 0.00001586427087347566, 0.00001576471767768811, 0.00001566289380964314, 0.00001555874747841173, 0.00014930900616515460, 0.00013590595281470742, 0.00011911220626922527, 0.00009806999180810891, 0.00007170453558138449, 0.00003866916835195826, 0.00000441158392373363, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000841730644296709, 0.00000860929369230551, 0.00000880565990825970, 0.00000900650496906996, 0.00000921193103106265, 0.00000942204258061026, 0.00000963694648727653, 0.00000985675205817381, 0.00001008157109356020, 0.00001031151794370482, 0.00011697754084327262, 0.00014657042101307185, 0.00018364968318775022, 0.00023010922600783879, 0.00028832206500347784, 0.00036126153918330004, 0.00021357957212878614, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000822960050928893, 0.00000841730644296709, 0.00000860929369230551, 0.00000880565990825970, 0.00000900650496906996, 0.00000921193103106265, 0.00000942204258061026, 0.00000963694648727653, 0.00000985675205817381, 0.00001008157109356020, 0.00011436894168246765, 0.00014330190062448035, 0.00017955429525266342, 0.00022497779026786399, 0.00028189248295390029, 0.00035320540685951249, 0.00025348074767031422, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000784960283406576, 0.00000768379452869568, 0.00000751886445737514, 0.00000735483265142185, 0.00000719171959904045, 0.00000702954625574353, 0.00000686833405501026, 0.00000670810491918816, 0.00000654888127064351, 0.00000639068604316611, 0.00005544985721930568, 0.00004095365117147587, 0.00002795889424658487, 0.00001684542178444127, 0.00000808915955053865, 0.00000228643261135126, 0.00000008961299629744, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001650167869310233, 0.00001641666389802836, 0.00001632971003173608, 0.00001624077286666266, 0.00001614980716647505, 0.00001605676666306131, 0.00001596160403299715, 0.00001586427087347566, 0.00001576471767768811, 0.00001566289380964314, 0.00015049047932767166, 0.00013738631406693945, 0.00012096706806942155, 0.00010039409499078809, 0.00007461658843791961, 0.00004231790989770960, 0.00000656873760223437, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000822960050928893, 0.00000841730644296709, 0.00000860929369230551, 0.00000880565990825970, 0.00000900650496906996, 0.00000921193103106265, 0.00000942204258061026, 0.00000963694648727653, 0.00000985675205817381, 0.00001008157109356020, 0.00011436894168246765, 0.00014330190062448035, 0.00017955429525266342, 0.00022497779026786399, 0.00028189248295390029, 0.00035320540685951249, 0.00025348074767031422, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000804608041793178, 0.00000822960050928893, 0.00000841730644296709, 0.00000860929369230551, 0.00000880565990825970, 0.00000900650496906996, 0.00000921193103106265, 0.00000942204258061026, 0.00000963694648727653, 0.00000985675205817381, 0.00011181851428294862, 0.00014010626824055442, 0.00017555023446852905, 0.00021996078554489064, 0.00027560628058402831, 0.00034532892628654540, 0.00029249212699726616, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000801626978886610, 0.00000784960283406576, 0.00000768379452869568, 0.00000751886445737514, 0.00000735483265142185, 0.00000719171959904045, 0.00000702954625574353, 0.00000686833405501026, 0.00000670810491918816, 0.00000654888127064351, 0.00005696981106051516, 0.00004234125294355196, 0.00002918066163408603, 0.00001785940214384823, 0.00000884278709376164, 0.00000271384350131813, 0.00000015595724608000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001658479765824615, 0.00001650167869310233, 0.00001641666389802836, 0.00001632971003173608, 0.00001624077286666266, 0.00001614980716647505, 0.00001605676666306131, 0.00001596160403299715, 0.00001586427087347566, 0.00001576471767768811, 0.00015164560563866460, 0.00013883366326324670, 0.00012278056645147344, 0.00010266637067249351, 0.00007746370251575401, 0.00004588528450699068, 0.00000912889315370455, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000804608041793178, 0.00000822960050928893, 0.00000841730644296709, 0.00000860929369230551, 0.00000880565990825970, 0.00000900650496906996, 0.00000921193103106265, 0.00000942204258061026, 0.00000963694648727653, 0.00000985675205817381, 0.00011181851428294862, 0.00014010626824055442, 0.00017555023446852902, 0.00021996078554489064, 0.00027560628058402831, 0.00034532892628654540, 0.00029249212699726616, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000786665282461191, 0.00000804608041793178, 0.00000822960050928893, 0.00000841730644296709, 0.00000860929369230551, 0.00000880565990825970, 0.00000900650496906996, 0.00000921193103106265, 0.00000942204258061026, 0.00000963694648727653, 0.00010932496141443886, 0.00013698189845879008, 0.00017163546423988081, 0.00021505566002723962, 0.00026946026052700450, 0.00033762809123035544, 0.00033063355256522713, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000818377624521438, 0.00000801626978886610, 0.00000784960283406576, 0.00000768379452869568, 0.00000751886445737514, 0.00000735483265142185, 0.00000719171959904045, 0.00000702954625574353, 0.00000686833405501026, 0.00000670810491918816, 0.00005850143167746567, 0.00004374347294251075, 0.00003042074535524591, 0.00001889633248764042, 0.00000962517048917076, 0.00000317728487483873, 0.00000024815906693242, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001666606307046726, 0.00001658479765824615, 0.00001650167869310233, 0.00001641666389802836, 0.00001632971003173608, 0.00001624077286666266, 0.00001614980716647505, 0.00001605676666306131, 0.00001596160403299715, 0.00001586427087347566, 0.00015277497263292239, 0.00014024873657247631, 0.00012455362381960558, 0.00010488797460649691, 0.00008024732594965269, 0.00004937310666248479, 0.00001208306363637693, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000786665282461190, 0.00000804608041793178, 0.00000822960050928893, 0.00000841730644296709, 0.00000860929369230551, 0.00000880565990825970, 0.00000900650496906996, 0.00000921193103106265, 0.00000942204258061026, 0.00000963694648727653, 0.00010932496141443886, 0.00013698189845879008, 0.00017163546423988084, 0.00021505566002723962, 0.00026946026052700450, 0.00033762809123035544, 0.00033063355256522713, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000769122646662306, 0.00000786665282461191, 0.00000804608041793178, 0.00000822960050928893, 0.00000841730644296709, 0.00000860929369230551, 0.00000880565990825970, 0.00000900650496906996, 0.00000921193103106265, 0.00000942204258061026, 0.00010688701477489688, 0.00013392720212315905, 0.00016780799338733150, 0.00021025991880863217, 0.00026345129671725233, 0.00033009898479591845, 0.00036792442434302252, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000835210348222610, 0.00000818377624521438, 0.00000801626978886610, 0.00000784960283406576, 0.00000768379452869568, 0.00000751886445737514, 0.00000735483265142185, 0.00000719171959904045, 0.00000702954625574353, 0.00000686833405501026, 0.00006004445890105819, 0.00004515998518189276, 0.00003167873695582393, 0.00001995570103116604, 0.00001043566848126225, 0.00000367595325212983, 0.00000037019800965983, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001674551626399584, 0.00001666606307046726, 0.00001658479765824615, 0.00001650167869310233, 0.00001641666389802836, 0.00001632971003173608, 0.00001624077286666266, 0.00001614980716647505, 0.00001605676666306131, 0.00001596160403299715, 0.00015387915474320823, 0.00014163225374691008, 0.00012628714200842839, 0.00010706003677277205, 0.00008296887458097544, 0.00005278315038391138, 0.00001542246251728573, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000769122646662306, 0.00000786665282461190, 0.00000804608041793178, 0.00000822960050928893, 0.00000841730644296709, 0.00000860929369230551, 0.00000880565990825970, 0.00000900650496906996, 0.00000921193103106265, 0.00000942204258061026, 0.00010688701477489689, 0.00013392720212315905, 0.00016780799338733150, 0.00021025991880863217, 0.00026345129671725227, 0.00033009898479591845, 0.00036792442434302252, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000751971211641736, 0.00000769122646662306, 0.00000786665282461191, 0.00000804608041793178, 0.00000822960050928893, 0.00000841730644296709, 0.00000860929369230551, 0.00000880565990825970, 0.00000900650496906996, 0.00000921193103106265, 0.00010450343434541666, 0.00013094062551581261, 0.00016406587513479400, 0.00020557112261919967, 0.00025757633280045758, 0.00032273777743496951, 0.00040438370968017316, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000852123319649246, 0.00000835210348222610, 0.00000818377624521438, 0.00000801626978886610, 0.00000784960283406576, 0.00000768379452869568, 0.00000751886445737514, 0.00000735483265142185, 0.00000719171959904045, 0.00000702954625574353, 0.00006159863836396458, 0.00004659047094473655, 0.00003295423709010905, 0.00002103700740257104, 0.00001127365411453010, 0.00000420906307100733, 0.00000052596488108441, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001682319765130874, 0.00001674551626399584, 0.00001666606307046726, 0.00001658479765824615, 0.00001650167869310233, 0.00001641666389802836, 0.00001632971003173608, 0.00001624077286666266, 0.00001614980716647505, 0.00001605676666306131, 0.00015495871359243464, 0.00014298491848835400, 0.00012798200274164042, 0.00010918366195273922, 0.00008562973267781970, 0.00005611715013035015, 0.00001913849920315026, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000751971211641737, 0.00000769122646662306, 0.00000786665282461190, 0.00000804608041793178, 0.00000822960050928893, 0.00000841730644296709, 0.00000860929369230551, 0.00000880565990825970, 0.00000900650496906996, 0.00000921193103106265, 0.00010450343434541669, 0.00013094062551581261, 0.00016406587513479400, 0.00020557112261919967, 0.00025757633280045758, 0.00032273777743496951, 0.00040438370968017316, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000735202253622126, 0.00000751971211641736, 0.00000769122646662306, 0.00000786665282461191, 0.00000804608041793178, 0.00000822960050928893, 0.00000841730644296709, 0.00000860929369230551, 0.00000880565990825970, 0.00000900650496906996, 0.00010217300775951388, 0.00012802064956680999, 0.00016040720611928808, 0.00020098688658479148, 0.00025183238057900734, 0.00031554072499816968, 0.00039536595295430532, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000869114749277068, 0.00000852123319649246, 0.00000835210348222610, 0.00000818377624521438, 0.00000801626978886610, 0.00000784960283406576, 0.00000768379452869568, 0.00000751886445737514, 0.00000735483265142185, 0.00000719171959904045, 0.00006316372137124817, 0.00004803461862146893, 0.00003424685531779962, 0.00002213976238829370, 0.00001213851441457608, 0.00000477584628732387, 0.00000071926372303623, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001689914674368455, 0.00001682319765130874, 0.00001674551626399584, 0.00001666606307046726, 0.00001658479765824615, 0.00001650167869310233, 0.00001641666389802836, 0.00001632971003173608, 0.00001624077286666266, 0.00001614980716647505, 0.00015601419827932335, 0.00014430741880606371, 0.00012963906808050187, 0.00011125993029119313, 0.00008823125363910430, 0.00005937680168244335, 0.00002322277467092001, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000735202253622126, 0.00000751971211641737, 0.00000769122646662306, 0.00000786665282461190, 0.00000804608041793178, 0.00000822960050928893, 0.00000841730644296709, 0.00000860929369230551, 0.00000880565990825970, 0.00000900650496906996, 0.00010217300775951388, 0.00012802064956680997, 0.00016040720611928808, 0.00020098688658479148, 0.00025183238057900734, 0.00031554072499816968, 0.00039536595295430532, 0.00004466400000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000718807243366352, 0.00000735202253622126, 0.00000751971211641736, 0.00000769122646662306, 0.00000786665282461191, 0.00000804608041793178, 0.00000822960050928893, 0.00000841730644296709, 0.00000860929369230551, 0.00000880565990825970, 0.00009989454968647673, 0.00012516578908147014, 0.00015683012542282797, 0.00019650487901395062, 0.00024621651849209551, 0.00030850416683071051, 0.00038654929220342441, 0.00008833199280000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000886182887488189, 0.00000869114749277068, 0.00000852123319649246, 0.00000835210348222610, 0.00000818377624521438, 0.00000801626978886610, 0.00000784960283406576, 0.00000768379452869568, 0.00000751886445737514, 0.00000735483265142185, 0.00006473946477386934, 0.00004949212355141017, 0.00003555620990541269, 0.00002326348768423475, 0.00001302965007633103, 0.00000537555198431655, 0.00000095381374721252, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001697340217130038, 0.00001689914674368455, 0.00001682319765130874, 0.00001674551626399584, 0.00001666606307046726, 0.00001658479765824615, 0.00001650167869310233, 0.00001641666389802836, 0.00001632971003173608, 0.00001624077286666266, 0.00015704614565769447, 0.00014560042736668849, 0.00013125918086230668, 0.00011328989784569953, 0.00009077476068295228, 0.00006256376300492486, 0.00002721597079575849, 0.00000045110640000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000718807243366352, 0.00000735202253622126, 0.00000751971211641737, 0.00000769122646662306, 0.00000786665282461190, 0.00000804608041793178, 0.00000822960050928893, 0.00000841730644296709, 0.00000860929369230551, 0.00000880565990825970, 0.00009989454968647671, 0.00012516578908147014, 0.00015683012542282797, 0.00019650487901395062, 0.00024621651849209551, 0.00030850416683071051, 0.00038654929220342435, 0.00008833199280000000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000702777841839283, 0.00000718807243366352, 0.00000735202253622126, 0.00000751971211641736, 0.00000769122646662306, 0.00000786665282461191, 0.00000804608041793178, 0.00000822960050928893, 0.00000841730644296709, 0.00000860929369230551, 0.00009766690122846829, 0.00012237459198495334, 0.00015333281362589892, 0.00019212282021193955, 0.00024072589012972179, 0.00030162452391038568, 0.00037792924298728800, 0.00013102618936055999, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000903326023681202, 0.00000886182887488189, 0.00000869114749277068, 0.00000852123319649246, 0.00000835210348222610, 0.00000818377624521438, 0.00000801626978886610, 0.00000784960283406576, 0.00000768379452869568, 0.00000751886445737514, 0.00006632563084501205, 0.00005096268786781373, 0.00003688192763212199, 0.00002440771565247632, 0.00001394647515922885, 0.00000600744599066629, 0.00000122869505224968, 0.00000000455617464000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001704600170288039, 0.00001697340217130038, 0.00001689914674368455, 0.00001682319765130874, 0.00001674551626399584, 0.00001666606307046726, 0.00001658479765824615, 0.00001650167869310233, 0.00001641666389802836, 0.00001632971003173608, 0.00015805508060952789, 0.00014686460183641130, 0.00013284316512907724, 0.00011527459712374042, 0.00009326154751972243, 0.00006567965508991503, 0.00003112011864701308, 0.00000134325952728000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000702777841839283, 0.00000718807243366352, 0.00000735202253622126, 0.00000751971211641737, 0.00000769122646662306, 0.00000786665282461190, 0.00000804608041793178, 0.00000822960050928893, 0.00000841730644296709, 0.00000860929369230551, 0.00009766690122846829, 0.00012237459198495334, 0.00015333281362589892, 0.00019212282021193955, 0.00024072589012972176, 0.00030162452391038568, 0.00037792924298728794, 0.00013102618936055999, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000687105895966267, 0.00000702777841839283, 0.00000718807243366352, 0.00000735202253622126, 0.00000751971211641736, 0.00000769122646662306, 0.00000786665282461191, 0.00000804608041793178, 0.00000822960050928893, 0.00000841730644296709, 0.00009548892933107345, 0.00011964563858368890, 0.00014991349188204136, 0.00018783848132121326, 0.00023535770277982899, 0.00029489829702718408, 0.00036950142086867151, 0.00017276830533781952, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000920542485401112, 0.00000903326023681202, 0.00000886182887488189, 0.00000869114749277068, 0.00000852123319649246, 0.00000835210348222610, 0.00000818377624521438, 0.00000801626978886610, 0.00000784960283406576, 0.00000768379452869568, 0.00006792198715916830, 0.00005244602034636148, 0.00003822364359992566, 0.00002557198908342610, 0.00001488841678917805, 0.00000667081050707443, 0.00000154300825058451, 0.00000001812309586553, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001711698226490616, 0.00001704600170288039, 0.00001697340217130038, 0.00001689914674368455, 0.00001682319765130874, 0.00001674551626399584, 0.00001666606307046726, 0.00001658479765824615, 0.00001650167869310233, 0.00001641666389802836, 0.00015904151631193541, 0.00014810058521545934, 0.00013439182654669880, 0.00011721503760788102, 0.00009569287901003263, 0.00006872606278140992, 0.00003493720400118468, 0.00000266662403982166, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000687105895966267, 0.00000702777841839283, 0.00000718807243366352, 0.00000735202253622126, 0.00000751971211641737, 0.00000769122646662306, 0.00000786665282461190, 0.00000804608041793178, 0.00000822960050928893, 0.00000841730644296709, 0.00009548892933107345, 0.00011964563858368888, 0.00014991349188204134, 0.00018783848132121326, 0.00023535770277982896, 0.00029489829702718408, 0.00036950142086867135, 0.00017276830533781952, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000671783434486219, 0.00000687105895966267, 0.00000702777841839283, 0.00000718807243366352, 0.00000735202253622126, 0.00000751971211641736, 0.00000769122646662306, 0.00000786665282461191, 0.00000804608041793178, 0.00000822960050928893, 0.00009335952620699050, 0.00011697754084327263, 0.00014657042101307185, 0.00018364968318775022, 0.00023010922600783879, 0.00028832206500347784, 0.00036126153918330010, 0.00021357957212878614, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000937830637488667, 0.00000920542485401112, 0.00000903326023681202, 0.00000886182887488189, 0.00000869114749277068, 0.00000852123319649246, 0.00000835210348222610, 0.00000818377624521438, 0.00000801626978886610, 0.00000784960283406576, 0.00006952830647391884, 0.00005394183625703761, 0.00003958100104804732, 0.00002675586096326570, 0.00001585491486717938, 0.00000736494374116667, 0.00000189587401099648, 0.00000004505599866773, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001718637996039875, 0.00001711698226490616, 0.00001704600170288039, 0.00001697340217130038, 0.00001689914674368455, 0.00001682319765130874, 0.00001674551626399584, 0.00001666606307046726, 0.00001658479765824615, 0.00001650167869310233, 0.00016000595449817926, 0.00014930900616515460, 0.00013590595281470742, 0.00011911220626922527, 0.00009806999180810891, 0.00007170453558138449, 0.00003866916835195826, 0.00000441158392373363, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000671783434486219, 0.00000687105895966267, 0.00000702777841839283, 0.00000718807243366352, 0.00000735202253622126, 0.00000751971211641737, 0.00000769122646662306, 0.00000786665282461190, 0.00000804608041793178, 0.00000822960050928893, 0.00009335952620699051, 0.00011697754084327262, 0.00014657042101307185, 0.00018364968318775022, 0.00023010922600783879, 0.00028832206500347784, 0.00036126153918330004, 0.00021357957212878614, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000656802663897176, 0.00000671783434486219, 0.00000687105895966267, 0.00000702777841839283, 0.00000718807243366352, 0.00000735202253622126, 0.00000751971211641736, 0.00000769122646662306, 0.00000786665282461191, 0.00000804608041793178, 0.00009127760877257463, 0.00011436894168246765, 0.00014330190062448035, 0.00017955429525266342, 0.00022497779026786399, 0.00028189248295390029, 0.00035320540685951249, 0.00025348074767031422, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000955188881248669, 0.00000937830637488667, 0.00000920542485401112, 0.00000903326023681202, 0.00000886182887488189, 0.00000869114749277068, 0.00000852123319649246, 0.00000835210348222610, 0.00000818377624521438, 0.00000801626978886610, 0.00007114436661435045, 0.00005544985721930568, 0.00004095365117147587, 0.00002795889424658487, 0.00001684542178444127, 0.00000808915955053865, 0.00000228643261135126, 0.00000008961299629744, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001725423008728185, 0.00001718637996039875, 0.00001711698226490616, 0.00001704600170288039, 0.00001697340217130038, 0.00001689914674368455, 0.00001682319765130874, 0.00001674551626399584, 0.00001666606307046726, 0.00001658479765824615, 0.00016094888571286983, 0.00015049047932767166, 0.00013738631406693945, 0.00012096706806942155, 0.00010039409499078809, 0.00007461658843791961, 0.00004231790989770960, 0.00000656873760223437, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000656802663897176, 0.00000671783434486219, 0.00000687105895966267, 0.00000702777841839283, 0.00000718807243366352, 0.00000735202253622126, 0.00000751971211641737, 0.00000769122646662306, 0.00000786665282461190, 0.00000804608041793178, 0.00009127760877257463, 0.00011436894168246765, 0.00014330190062448035, 0.00017955429525266342, 0.00022497779026786399, 0.00028189248295390029, 0.00035320540685951249, 0.00025348074767031422, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000642155964492269, 0.00000656802663897176, 0.00000671783434486219, 0.00000687105895966267, 0.00000702777841839283, 0.00000718807243366352, 0.00000735202253622126, 0.00000751971211641736, 0.00000769122646662306, 0.00000786665282461191, 0.00008924211809694621, 0.00011181851428294862, 0.00014010626824055442, 0.00017555023446852905, 0.00021996078554489064, 0.00027560628058402831, 0.00034532892628654540, 0.00029249212699726616, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000972615653636824, 0.00000955188881248669, 0.00000937830637488667, 0.00000920542485401112, 0.00000903326023681202, 0.00000886182887488189, 0.00000869114749277068, 0.00000852123319649246, 0.00000835210348222610, 0.00000818377624521438, 0.00007276995036005043, 0.00005696981106051516, 0.00004234125294355196, 0.00002918066163408603, 0.00001785940214384823, 0.00000884278709376164, 0.00000271384350131813, 0.00000015595724608000, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001732056715633547, 0.00001725423008728185, 0.00001718637996039875, 0.00001711698226490616, 0.00001704600170288039, 0.00001697340217130038, 0.00001689914674368455, 0.00001682319765130874, 0.00001674551626399584, 0.00001666606307046726, 0.00016187078956147284, 0.00015164560563866460, 0.00013883366326324670, 0.00012278056645147344, 0.00010266637067249351, 0.00007746370251575401, 0.00004588528450699068, 0.00000912889315370455, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000642155964492269, 0.00000656802663897176, 0.00000671783434486219, 0.00000687105895966267, 0.00000702777841839283, 0.00000718807243366352, 0.00000735202253622126, 0.00000751971211641737, 0.00000769122646662306, 0.00000786665282461190, 0.00008924211809694621, 0.00011181851428294862, 0.00014010626824055442, 0.00017555023446852902, 0.00021996078554489064, 0.00027560628058402831, 0.00034532892628654540, 0.00029249212699726616, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000627835886484092, 0.00000642155964492269, 0.00000656802663897176, 0.00000671783434486219, 0.00000687105895966267, 0.00000702777841839283, 0.00000718807243366352, 0.00000735202253622126, 0.00000751971211641736, 0.00000769122646662306, 0.00008725201886338431, 0.00010932496141443886, 0.00013698189845879008, 0.00017163546423988081, 0.00021505566002723962, 0.00026946026052700450, 0.00033762809123035544, 0.00033063355256522713, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00000990109426464723, 0.00000972615653636824, 0.00000955188881248669, 0.00000937830637488667, 0.00000920542485401112, 0.00000903326023681202, 0.00000886182887488189, 0.00000869114749277068, 0.00000852123319649246, 0.00000835210348222610, 0.00007440484533462130, 0.00005850143167746567, 0.00004374347294251075, 0.00003042074535524591, 0.00001889633248764042, 0.00000962517048917076, 0.00000317728487483873, 0.00000024815906693242, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001738542490874919, 0.00001732056715633547, 0.00001725423008728185, 0.00001718637996039875, 0.00001711698226490616, 0.00001704600170288039, 0.00001697340217130038, 0.00001689914674368455, 0.00001682319765130874, 0.00001674551626399584, 0.00016277213495425200, 0.00015277497263292239, 0.00014024873657247631, 0.00012455362381960558, 0.00010488797460649691, 0.00008024732594965269, 0.00004937310666248479, 0.00001208306363637693, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000627835886484092, 0.00000642155964492269, 0.00000656802663897176, 0.00000671783434486219, 0.00000687105895966267, 0.00000702777841839283, 0.00000718807243366352, 0.00000735202253622126, 0.00000751971211641737, 0.00000769122646662306, 0.00008725201886338432, 0.00010932496141443886, 0.00013698189845879008, 0.00017163546423988084, 0.00021505566002723962, 0.00026946026052700450, 0.00033762809123035544, 0.00033063355256522713, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000613835146215496, 0.00000627835886484092, 0.00000642155964492269, 0.00000656802663897176, 0.00000671783434486219, 0.00000687105895966267, 0.00000702777841839283, 0.00000718807243366352, 0.00000735202253622126, 0.00000751971211641736, 0.00008530629884273083, 0.00010688701477489688, 0.00013392720212315905, 0.00016780799338733150, 0.00021025991880863217, 0.00026345129671725233, 0.00033009898479591845, 0.00036792442434302252, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001007668705622560, 0.00000990109426464723, 0.00000972615653636824, 0.00000955188881248669, 0.00000937830637488667, 0.00000920542485401112, 0.00000903326023681202, 0.00000886182887488189, 0.00000869114749277068, 0.00000852123319649246, 0.00007604884389765926, 0.00006004445890105819, 0.00004515998518189276, 0.00003167873695582393, 0.00001995570103116604, 0.00001043566848126225, 0.00000367595325212983, 0.00000037019800965983, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001744883633328408, 0.00001738542490874919, 0.00001732056715633547, 0.00001725423008728185, 0.00001718637996039875, 0.00001711698226490616, 0.00001704600170288039, 0.00001697340217130038, 0.00001689914674368455, 0.00001682319765130874, 0.00016365338034477218, 0.00015387915474320823, 0.00014163225374691008, 0.00012628714200842839, 0.00010706003677277205, 0.00008296887458097544, 0.00005278315038391138, 0.00001542246251728573, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000613835146215496, 0.00000627835886484092, 0.00000642155964492269, 0.00000656802663897176, 0.00000671783434486219, 0.00000687105895966267, 0.00000702777841839283, 0.00000718807243366352, 0.00000735202253622126, 0.00000751971211641737, 0.00008530629884273083, 0.00010688701477489689, 0.00013392720212315905, 0.00016780799338733150, 0.00021025991880863217, 0.00026345129671725227, 0.00033009898479591845, 0.00036792442434302252, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000600146622454891, 0.00000613835146215496, 0.00000627835886484092, 0.00000642155964492269, 0.00000656802663897176, 0.00000671783434486219, 0.00000687105895966267, 0.00000702777841839283, 0.00000718807243366352, 0.00000735202253622126, 0.00008340396837853794, 0.00010450343434541666, 0.00013094062551581261, 0.00016406587513479400, 0.00020557112261919967, 0.00025757633280045758, 0.00032273777743496951, 0.00040438370968017316, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001025292030319177, 0.00001007668705622560, 0.00000990109426464723, 0.00000972615653636824, 0.00000955188881248669, 0.00000937830637488667, 0.00000920542485401112, 0.00000903326023681202, 0.00000886182887488189, 0.00000869114749277068, 0.00007770174303914145, 0.00006159863836396458, 0.00004659047094473655, 0.00003295423709010905, 0.00002103700740257104, 0.00001127365411453010, 0.00000420906307100733, 0.00000052596488108441, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001751083368305185, 0.00001744883633328408, 0.00001738542490874919, 0.00001732056715633547, 0.00001725423008728185, 0.00001718637996039875, 0.00001711698226490616, 0.00001704600170288039, 0.00001697340217130038, 0.00001689914674368455, 0.00016451497396308379, 0.00015495871359243464, 0.00014298491848835400, 0.00012798200274164042, 0.00010918366195273922, 0.00008562973267781970, 0.00005611715013035015, 0.00001913849920315026, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000600146622454891, 0.00000613835146215496, 0.00000627835886484092, 0.00000642155964492269, 0.00000656802663897176, 0.00000671783434486219, 0.00000687105895966267, 0.00000702777841839283, 0.00000718807243366352, 0.00000735202253622126, 0.00008340396837853794, 0.00010450343434541669, 0.00013094062551581261, 0.00016406587513479400, 0.00020557112261919967, 0.00025757633280045758, 0.00032273777743496951, 0.00040438370968017316, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000586763352774147, 0.00000600146622454891, 0.00000613835146215496, 0.00000627835886484092, 0.00000642155964492269, 0.00000656802663897176, 0.00000671783434486219, 0.00000687105895966267, 0.00000702777841839283, 0.00000718807243366352, 0.00008154405988369654, 0.00010217300775951388, 0.00012802064956680999, 0.00016040720611928808, 0.00020098688658479148, 0.00025183238057900734, 0.00031554072499816968, 0.00039536595295430532, 0.00004466400000000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001042977972339059, 0.00001025292030319177, 0.00001007668705622560, 0.00000990109426464723, 0.00000972615653636824, 0.00000955188881248669, 0.00000937830637488667, 0.00000920542485401112, 0.00000903326023681202, 0.00000886182887488189, 0.00007936334427616860, 0.00006316372137124817, 0.00004803461862146893, 0.00003424685531779962, 0.00002213976238829370, 0.00001213851441457608, 0.00000477584628732387, 0.00000071926372303623, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001757144849191979, 0.00001751083368305185, 0.00001744883633328408, 0.00001738542490874919, 0.00001732056715633547, 0.00001725423008728185, 0.00001718637996039875, 0.00001711698226490616, 0.00001704600170288039, 0.00001697340217130038, 0.00016535735404370701, 0.00015601419827932335, 0.00014430741880606371, 0.00012963906808050187, 0.00011125993029119313, 0.00008823125363910430, 0.00005937680168244335, 0.00002322277467092001, 0.00000000000000000000, 0.00000000000000000000, 
-0.00000586763352774147, 0.00000600146622454891, 0.00000613835146215496, 0.00000627835886484092, 0.00000642155964492269, 0.00000656802663897176, 0.00000671783434486219, 0.00000687105895966267, 0.00000702777841839283, 0.00000718807243366352, 0.00008154405988369654, 0.00010217300775951388, 0.00012802064956680997, 0.00016040720611928808, 0.00020098688658479148, 0.00025183238057900734, 0.00031554072499816968, 0.00039536595295430532, 0.00004466400000000000, 0.00000000000000000000, 
-0.00000573678530007283, 0.00000586763352774147, 0.00000600146622454891, 0.00000613835146215496, 0.00000627835886484092, 0.00000642155964492269, 0.00000656802663897176, 0.00000671783434486219, 0.00000687105895966267, 0.00000702777841839283, 0.00007972562734829011, 0.00009989454968647673, 0.00012516578908147014, 0.00015683012542282797, 0.00019650487901395062, 0.00024621651849209551, 0.00030850416683071051, 0.00038654929220342441, 0.00008833199280000000, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001060725135315898, 0.00001042977972339059, 0.00001025292030319177, 0.00001007668705622560, 0.00000990109426464723, 0.00000972615653636824, 0.00000955188881248669, 0.00000937830637488667, 0.00000920542485401112, 0.00000903326023681202, 0.00008103345355201003, 0.00006473946477386934, 0.00004949212355141017, 0.00003555620990541269, 0.00002326348768423475, 0.00001302965007633103, 0.00000537555198431655, 0.00000095381374721252, 0.00000000000000000000, 0.00000000000000000000, 
-0.00001763071159054998, 0.00001757144849191979, 0.00001751083368305185, 0.00001744883633328408, 0.00001738542490874919, 0.00001732056715633547, 0.00001725423008728185, 0.00001718637996039875, 0.00001711698226490616, 0.00001704600170288039, 0.00016618094904853235, 0.00015704614565769447, 0.00014560042736668849, 0.00013125918086230668, 0.00011328989784569953, 0.00009077476068295228, 0.00006256376300492486, 0.00002721597079575849, 0.00000045110640000000, 0.00000000000000000000, 
-0.00000573678530007283, 0.00000586763352774147, 0.00000600146622454891, 0.00000613835146215496, 0.00000627835886484092, 0.00000642155964492269, 0.00000656802663897176, 0.00000671783434486219, 0.00000687105895966267, 0.00000702777841839283, 0.00007972562734829011, 0.00009989454968647671, 0.00012516578908147014, 0.00015683012542282797, 0.00019650487901395062, 0.00024621651849209551, 0.00030850416683071051, 0.00038654929220342435, 0.00008833199280000000, 0.00000000000000000000, 
-0.00000560885498788121, 0.00000573678530007283, 0.00000586763352774147, 0.00000600146622454891, 0.00000613835146215496, 0.00000627835886484092, 0.00000642155964492269, 0.00000656802663897176, 0.00000671783434486219, 0.00000687105895966267, 0.00007794774585842326, 0.00009766690122846829, 0.00012237459198495334, 0.00015333281362589892, 0.00019212282021193955, 0.00024072589012972179, 0.00030162452391038568, 0.00037792924298728800, 0.00013102618936055999, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001078532154022354, 0.00001060725135315898, 0.00001042977972339059, 0.00001025292030319177, 0.00001007668705622560, 0.00000990109426464723, 0.00000972615653636824, 0.00000955188881248669, 0.00000937830637488667, 0.00000920542485401112, 0.00008271188113740020, 0.00006632563084501205, 0.00005096268786781373, 0.00003688192763212199, 0.00002440771565247632, 0.00001394647515922885, 0.00000600744599066629, 0.00000122869505224968, 0.00000000455617464000, 0.00000000000000000000, 
-0.00001768865312208072, 0.00001763071159054998, 0.00001757144849191979, 0.00001751083368305185, 0.00001744883633328408, 0.00001738542490874919, 0.00001732056715633547, 0.00001725423008728185, 0.00001718637996039875, 0.00001711698226490616, 0.00016698617788475011, 0.00015805508060952789, 0.00014686460183641130, 0.00013284316512907724, 0.00011527459712374042, 0.00009326154751972243, 0.00006567965508991503, 0.00003112011864701308, 0.00000134325952728000, 0.00000000000000000000, 
-0.00000560885498788121, 0.00000573678530007283, 0.00000586763352774147, 0.00000600146622454891, 0.00000613835146215496, 0.00000627835886484092, 0.00000642155964492269, 0.00000656802663897176, 0.00000671783434486219, 0.00000687105895966267, 0.00007794774585842326, 0.00009766690122846829, 0.00012237459198495334, 0.00015333281362589892, 0.00019212282021193955, 0.00024072589012972176, 0.00030162452391038568, 0.00037792924298728794, 0.00013102618936055999, 0.00000000000000000000, 
-0.00000548377752165146, 0.00000560885498788121, 0.00000573678530007283, 0.00000586763352774147, 0.00000600146622454891, 0.00000613835146215496, 0.00000627835886484092, 0.00000642155964492269, 0.00000656802663897176, 0.00000671783434486219, 0.00007620951112578041, 0.00009548892933107345, 0.00011964563858368890, 0.00014991349188204136, 0.00018783848132121326, 0.00023535770277982899, 0.00029489829702718408, 0.00036950142086867151, 0.00017276830533781952, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001096397693675655, 0.00001078532154022354, 0.00001060725135315898, 0.00001042977972339059, 0.00001025292030319177, 0.00001007668705622560, 0.00000990109426464723, 0.00000972615653636824, 0.00000955188881248669, 0.00000937830637488667, 0.00008439844153403618, 0.00006792198715916830, 0.00005244602034636148, 0.00003822364359992566, 0.00002557198908342610, 0.00001488841678917805, 0.00000667081050707443, 0.00000154300825058451, 0.00000001812309586553, 0.00000000000000000000, 
-0.00001774530255745831, 0.00001768865312208072, 0.00001763071159054998, 0.00001757144849191979, 0.00001751083368305185, 0.00001744883633328408, 0.00001738542490874919, 0.00001732056715633547, 0.00001725423008728185, 0.00001718637996039875, 0.00016777345011792017, 0.00015904151631193541, 0.00014810058521545934, 0.00013439182654669880, 0.00011721503760788102, 0.00009569287901003263, 0.00006872606278140992, 0.00003493720400118468, 0.00000266662403982166, 0.00000000000000000000, 
-0.00000548377752165146, 0.00000560885498788121, 0.00000573678530007283, 0.00000586763352774147, 0.00000600146622454891, 0.00000613835146215496, 0.00000627835886484092, 0.00000642155964492269, 0.00000656802663897176, 0.00000671783434486219, 0.00007620951112578041, 0.00009548892933107345, 0.00011964563858368888, 0.00014991349188204134, 0.00018783848132121326, 0.00023535770277982896, 0.00029489829702718408, 0.00036950142086867135, 0.00017276830533781952, 0.00000000000000000000, 
-0.00000536148928291863, 0.00000548377752165146, 0.00000560885498788121, 0.00000573678530007283, 0.00000586763352774147, 0.00000600146622454891, 0.00000613835146215496, 0.00000627835886484092, 0.00000642155964492269, 0.00000656802663897176, 0.00007451003902767550, 0.00009335952620699050, 0.00011697754084327263, 0.00014657042101307185, 0.00018364968318775022, 0.00023010922600783879, 0.00028832206500347784, 0.00036126153918330010, 0.00021357957212878614, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001114320449258688, 0.00001096397693675655, 0.00001078532154022354, 0.00001060725135315898, 0.00001042977972339059, 0.00001025292030319177, 0.00001007668705622560, 0.00000990109426464723, 0.00000972615653636824, 0.00000955188881248669, 0.00008609295338022718, 0.00006952830647391884, 0.00005394183625703761, 0.00003958100104804732, 0.00002675586096326570, 0.00001585491486717938, 0.00000736494374116667, 0.00000189587401099648, 0.00000004505599866773, 0.00000000000000000000, 
-0.00001780068871042700, 0.00001774530255745831, 0.00001768865312208072, 0.00001763071159054998, 0.00001757144849191979, 0.00001751083368305185, 0.00001744883633328408, 0.00001738542490874919, 0.00001732056715633547, 0.00001725423008728185, 0.00016854316618029053, 0.00016000595449817926, 0.00014930900616515460, 0.00013590595281470742, 0.00011911220626922527, 0.00009806999180810891, 0.00007170453558138449, 0.00003866916835195826, 0.00000441158392373363, 0.00000000000000000000, 
-0.00000536148928291863, 0.00000548377752165146, 0.00000560885498788121, 0.00000573678530007283, 0.00000586763352774147, 0.00000600146622454891, 0.00000613835146215496, 0.00000627835886484092, 0.00000642155964492269, 0.00000656802663897176, 0.00007451003902767552, 0.00009335952620699051, 0.00011697754084327262, 0.00014657042101307185, 0.00018364968318775022, 0.00023010922600783879, 0.00028832206500347784, 0.00036126153918330004, 0.00021357957212878614, 0.00000000000000000000, 
-0.00000524192807190955, 0.00000536148928291863, 0.00000548377752165146, 0.00000560885498788121, 0.00000573678530007283, 0.00000586763352774147, 0.00000600146622454891, 0.00000613835146215496, 0.00000627835886484092, 0.00000642155964492269, 0.00007284846515735833, 0.00009127760877257463, 0.00011436894168246765, 0.00014330190062448035, 0.00017955429525266342, 0.00022497779026786399, 0.00028189248295390029, 0.00035320540685951249, 0.00025348074767031422, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001132299144856220, 0.00001114320449258688, 0.00001096397693675655, 0.00001078532154022354, 0.00001060725135315898, 0.00001042977972339059, 0.00001025292030319177, 0.00001007668705622560, 0.00000990109426464723, 0.00000972615653636824, 0.00008779523935864812, 0.00007114436661435045, 0.00005544985721930568, 0.00004095365117147587, 0.00002795889424658487, 0.00001684542178444127, 0.00000808915955053865, 0.00000228643261135126, 0.00000008961299629744, 0.00000000000000000000, 
-0.00001785483975218447, 0.00001780068871042700, 0.00001774530255745831, 0.00001768865312208072, 0.00001763071159054998, 0.00001757144849191979, 0.00001751083368305185, 0.00001744883633328408, 0.00001738542490874919, 0.00001732056715633547, 0.00016929571757447003, 0.00016094888571286983, 0.00015049047932767166, 0.00013738631406693945, 0.00012096706806942155, 0.00010039409499078809, 0.00007461658843791961, 0.00004231790989770960, 0.00000656873760223437, 0.00000000000000000000, 
-0.00000524192807190955, 0.00000536148928291863, 0.00000548377752165146, 0.00000560885498788121, 0.00000573678530007283, 0.00000586763352774147, 0.00000600146622454891, 0.00000613835146215496, 0.00000627835886484092, 0.00000642155964492269, 0.00007284846515735836, 0.00009127760877257463, 0.00011436894168246765, 0.00014330190062448035, 0.00017955429525266342, 0.00022497779026786399, 0.00028189248295390029, 0.00035320540685951249, 0.00025348074767031422, 0.00000000000000000000, 
-0.00000512503307590596, 0.00000524192807190955, 0.00000536148928291863, 0.00000548377752165146, 0.00000560885498788121, 0.00000573678530007283, 0.00000586763352774147, 0.00000600146622454891, 0.00000613835146215496, 0.00000627835886484092, 0.00007122394438434925, 0.00008924211809694621, 0.00011181851428294862, 0.00014010626824055442, 0.00017555023446852905, 0.00021996078554489064, 0.00027560628058402831, 0.00034532892628654540, 0.00029249212699726616, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001150332533005926, 0.00001132299144856220, 0.00001114320449258688, 0.00001096397693675655, 0.00001078532154022354, 0.00001060725135315898, 0.00001042977972339059, 0.00001025292030319177, 0.00001007668705622560, 0.00000990109426464723, 0.00008950512610615028, 0.00007276995036005043, 0.00005696981106051516, 0.00004234125294355196, 0.00002918066163408603, 0.00001785940214384823, 0.00000884278709376164, 0.00000271384350131813, 0.00000015595724608000, 0.00000000000000000000, 
-0.00001790778322571076, 0.00001785483975218447, 0.00001780068871042700, 0.00001774530255745831, 0.00001768865312208072, 0.00001763071159054998, 0.00001757144849191979, 0.00001751083368305185, 0.00001744883633328408, 0.00001738542490874919, 0.00017003148707255938, 0.00016187078956147284, 0.00015164560563866460, 0.00013883366326324670, 0.00012278056645147344, 0.00010266637067249351, 0.00007746370251575401, 0.00004588528450699068, 0.00000912889315370455, 0.00000000000000000000, 
-0.00000512503307590596, 0.00000524192807190955, 0.00000536148928291863, 0.00000548377752165146, 0.00000560885498788121, 0.00000573678530007283, 0.00000586763352774147, 0.00000600146622454891, 0.00000613835146215496, 0.00000627835886484092, 0.00007122394438434927, 0.00008924211809694621, 0.00011181851428294862, 0.00014010626824055442, 0.00017555023446852902, 0.00021996078554489064, 0.00027560628058402831, 0.00034532892628654540, 0.00029249212699726616, 0.00000000000000000000, 
-0.00000501074483831326, 0.00000512503307590596, 0.00000524192807190955, 0.00000536148928291863, 0.00000548377752165146, 0.00000560885498788121, 0.00000573678530007283, 0.00000586763352774147, 0.00000600146622454891, 0.00000613835146215496, 0.00006963565042457827, 0.00008725201886338431, 0.00010932496141443886, 0.00013698189845879008, 0.00017163546423988081, 0.00021505566002723962, 0.00026946026052700450, 0.00033762809123035544, 0.00033063355256522713, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001168419394063894, 0.00001150332533005926, 0.00001132299144856220, 0.00001114320449258688, 0.00001096397693675655, 0.00001078532154022354, 0.00001060725135315898, 0.00001042977972339059, 0.00001025292030319177, 0.00001007668705622560, 0.00009122244412558313, 0.00007440484533462130, 0.00005850143167746567, 0.00004374347294251075, 0.00003042074535524591, 0.00001889633248764042, 0.00000962517048917076, 0.00000317728487483873, 0.00000024815906693242, 0.00000000000000000000, 
-0.00001795954605977741, 0.00001790778322571076, 0.00001785483975218447, 0.00001780068871042700, 0.00001774530255745831, 0.00001768865312208072, 0.00001763071159054998, 0.00001757144849191979, 0.00001751083368305185, 0.00001744883633328408, 0.00017075084891084131, 0.00016277213495425200, 0.00015277497263292239, 0.00014024873657247631, 0.00012455362381960558, 0.00010488797460649691, 0.00008024732594965269, 0.00004937310666248479, 0.00001208306363637693, 0.00000000000000000000, 
-0.00000501074483831326, 0.00000512503307590596, 0.00000524192807190955, 0.00000536148928291863, 0.00000548377752165146, 0.00000560885498788121, 0.00000573678530007283, 0.00000586763352774147, 0.00000600146622454891, 0.00000613835146215496, 0.00006963565042457827, 0.00008725201886338432, 0.00010932496141443886, 0.00013698189845879008, 0.00017163546423988084, 0.00021505566002723962, 0.00026946026052700450, 0.00033762809123035544, 0.00033063355256522713, 0.00000000000000000000, 
-0.00000489900522841887, 0.00000501074483831326, 0.00000512503307590596, 0.00000524192807190955, 0.00000536148928291863, 0.00000548377752165146, 0.00000560885498788121, 0.00000573678530007283, 0.00000586763352774147, 0.00000600146622454891, 0.00006808277542011018, 0.00008530629884273083, 0.00010688701477489688, 0.00013392720212315905, 0.00016780799338733150, 0.00021025991880863217, 0.00026345129671725233, 0.00033009898479591845, 0.00036792442434302252, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001186558535584268, 0.00001168419394063894, 0.00001150332533005926, 0.00001132299144856220, 0.00001114320449258688, 0.00001096397693675655, 0.00001078532154022354, 0.00001060725135315898, 0.00001042977972339059, 0.00001025292030319177, 0.00009294702769958261, 0.00007604884389765926, 0.00006004445890105819, 0.00004515998518189276, 0.00003167873695582393, 0.00001995570103116604, 0.00001043566848126225, 0.00000367595325212983, 0.00000037019800965983, 0.00000000000000000000, 
-0.00001801015458264437, 0.00001795954605977741, 0.00001790778322571076, 0.00001785483975218447, 0.00001780068871042700, 0.00001774530255745831, 0.00001768865312208072, 0.00001763071159054998, 0.00001757144849191979, 0.00001751083368305185, 0.00017145416898012956, 0.00016365338034477218, 0.00015387915474320823, 0.00014163225374691008, 0.00012628714200842839, 0.00010706003677277205, 0.00008296887458097544, 0.00005278315038391138, 0.00001542246251728573, 0.00000000000000000000, 
-0.00000489900522841887, 0.00000501074483831326, 0.00000512503307590596, 0.00000524192807190955, 0.00000536148928291863, 0.00000548377752165146, 0.00000560885498788121, 0.00000573678530007283, 0.00000586763352774147, 0.00000600146622454891, 0.00006808277542011018, 0.00008530629884273083, 0.00010688701477489689, 0.00013392720212315905, 0.00016780799338733150, 0.00021025991880863217, 0.00026345129671725227, 0.00033009898479591845, 0.00036792442434302252, 0.00000000000000000000, 
-0.00000478975741182513, 0.00000489900522841887, 0.00000501074483831326, 0.00000512503307590596, 0.00000524192807190955, 0.00000536148928291863, 0.00000548377752165146, 0.00000560885498788121, 0.00000573678530007283, 0.00000586763352774147, 0.00006656452952824171, 0.00008340396837853794, 0.00010450343434541666, 0.00013094062551581261, 0.00016406587513479400, 0.00020557112261919967, 0.00025757633280045758, 0.00032273777743496951, 0.00040438370968017316, 0.00000000000000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001204748791712739, 0.00001186558535584268, 0.00001168419394063894, 0.00001150332533005926, 0.00001132299144856220, 0.00001114320449258688, 0.00001096397693675655, 0.00001078532154022354, 0.00001060725135315898, 0.00001042977972339059, 0.00009467871480628190, 0.00007770174303914145, 0.00006159863836396458, 0.00004659047094473655, 0.00003295423709010905, 0.00002103700740257104, 0.00001127365411453010, 0.00000420906307100733, 0.00000052596488108441, 0.00000000000000000000, 
-0.00001805963453545141, 0.00001801015458264437, 0.00001795954605977741, 0.00001790778322571076, 0.00001785483975218447, 0.00001780068871042700, 0.00001774530255745831, 0.00001768865312208072, 0.00001763071159054998, 0.00001757144849191979, 0.00017214180501187265, 0.00016451497396308379, 0.00015495871359243464, 0.00014298491848835400, 0.00012798200274164042, 0.00010918366195273922, 0.00008562973267781970, 0.00005611715013035015, 0.00001913849920315026, 0.00000000000000000000, 
-0.00000478975741182513, 0.00000489900522841887, 0.00000501074483831326, 0.00000512503307590596, 0.00000524192807190955, 0.00000536148928291863, 0.00000548377752165146, 0.00000560885498788121, 0.00000573678530007283, 0.00000586763352774147, 0.00006656452952824173, 0.00008340396837853794, 0.00010450343434541669, 0.00013094062551581261, 0.00016406587513479400, 0.00020557112261919967, 0.00025757633280045758, 0.00032273777743496951, 0.00040438370968017316, 0.00000000000000000000, 
-0.00000468294582154143, 0.00000478975741182513, 0.00000489900522841887, 0.00000501074483831326, 0.00000512503307590596, 0.00000524192807190955, 0.00000536148928291863, 0.00000548377752165146, 0.00000560885498788121, 0.00000573678530007283, 0.00006508014051976193, 0.00008154405988369654, 0.00010217300775951388, 0.00012802064956680999, 0.00016040720611928808, 0.00020098688658479148, 0.00025183238057900734, 0.00031554072499816968, 0.00039536595295430532, 0.00004466400000000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001222989022593546, 0.00001204748791712739, 0.00001186558535584268, 0.00001168419394063894, 0.00001150332533005926, 0.00001132299144856220, 0.00001114320449258688, 0.00001096397693675655, 0.00001078532154022354, 0.00001060725135315898, 0.00009641734703690183, 0.00007936334427616860, 0.00006316372137124817, 0.00004803461862146893, 0.00003424685531779962, 0.00002213976238829370, 0.00001213851441457608, 0.00000477584628732387, 0.00000071926372303623, 0.00000000000000000000, 
-0.00001810801108531084, 0.00001805963453545141, 0.00001801015458264437, 0.00001795954605977741, 0.00001790778322571076, 0.00001785483975218447, 0.00001780068871042700, 0.00001774530255745831, 0.00001768865312208072, 0.00001763071159054998, 0.00017281410676010789, 0.00016535735404370701, 0.00015601419827932335, 0.00014430741880606371, 0.00012963906808050187, 0.00011125993029119313, 0.00008823125363910430, 0.00005937680168244335, 0.00002322277467092001, 0.00000000000000000000, 
-0.00000468294582154143, 0.00000478975741182513, 0.00000489900522841887, 0.00000501074483831326, 0.00000512503307590596, 0.00000524192807190955, 0.00000536148928291863, 0.00000548377752165146, 0.00000560885498788121, 0.00000573678530007283, 0.00006508014051976193, 0.00008154405988369654, 0.00010217300775951388, 0.00012802064956680997, 0.00016040720611928808, 0.00020098688658479148, 0.00025183238057900734, 0.00031554072499816968, 0.00039536595295430532, 0.00004466400000000000, 
-0.00000457851612972106, 0.00000468294582154143, 0.00000478975741182513, 0.00000489900522841887, 0.00000501074483831326, 0.00000512503307590596, 0.00000524192807190955, 0.00000536148928291863, 0.00000548377752165146, 0.00000560885498788121, 0.00006362885338617124, 0.00007972562734829011, 0.00009989454968647673, 0.00012516578908147014, 0.00015683012542282797, 0.00019650487901395062, 0.00024621651849209551, 0.00030850416683071051, 0.00038654929220342441, 0.00008833199280000000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001241278113789709, 0.00001222989022593546, 0.00001204748791712739, 0.00001186558535584268, 0.00001168419394063894, 0.00001150332533005926, 0.00001132299144856220, 0.00001114320449258688, 0.00001096397693675655, 0.00001078532154022354, 0.00009816276951517891, 0.00008103345355201003, 0.00006473946477386934, 0.00004949212355141017, 0.00003555620990541269, 0.00002326348768423475, 0.00001302965007633103, 0.00000537555198431655, 0.00000095381374721252, 0.00000000000000000000, 
-0.00001815530883810841, 0.00001810801108531084, 0.00001805963453545141, 0.00001801015458264437, 0.00001795954605977741, 0.00001790778322571076, 0.00001785483975218447, 0.00001780068871042700, 0.00001774530255745831, 0.00001768865312208072, 0.00017347141617935746, 0.00016618094904853235, 0.00015704614565769447, 0.00014560042736668849, 0.00013125918086230668, 0.00011328989784569953, 0.00009077476068295228, 0.00006256376300492486, 0.00002721597079575849, 0.00000045110640000000, 
-0.00000457851612972106, 0.00000468294582154143, 0.00000478975741182513, 0.00000489900522841887, 0.00000501074483831326, 0.00000512503307590596, 0.00000524192807190955, 0.00000536148928291863, 0.00000548377752165146, 0.00000560885498788121, 0.00006362885338617124, 0.00007972562734829011, 0.00009989454968647671, 0.00012516578908147014, 0.00015683012542282797, 0.00019650487901395062, 0.00024621651849209551, 0.00030850416683071051, 0.00038654929220342435, 0.00008833199280000000, 
-0.00000447641522002828, 0.00000457851612972106, 0.00000468294582154143, 0.00000478975741182513, 0.00000489900522841887, 0.00000501074483831326, 0.00000512503307590596, 0.00000524192807190955, 0.00000536148928291863, 0.00000548377752165146, 0.00006220992995565961, 0.00007794774585842326, 0.00009766690122846829, 0.00012237459198495334, 0.00015333281362589892, 0.00019212282021193955, 0.00024072589012972179, 0.00030162452391038568, 0.00037792924298728800, 0.00013102618936055999, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001259614975716199, 0.00001241278113789709, 0.00001222989022593546, 0.00001204748791712739, 0.00001186558535584268, 0.00001168419394063894, 0.00001150332533005926, 0.00001132299144856220, 0.00001114320449258688, 0.00001096397693675655, 0.00009991483081859043, 0.00008271188113740020, 0.00006632563084501205, 0.00005096268786781373, 0.00003688192763212199, 0.00002440771565247632, 0.00001394647515922885, 0.00000600744599066629, 0.00000122869505224968, 0.00000000455617464000, 
-0.00001820155185101859, 0.00001815530883810841, 0.00001810801108531084, 0.00001805963453545141, 0.00001801015458264437, 0.00001795954605977741, 0.00001790778322571076, 0.00001785483975218447, 0.00001780068871042700, 0.00001774530255745831, 0.00017411406759855781, 0.00016698617788475011, 0.00015805508060952789, 0.00014686460183641130, 0.00013284316512907724, 0.00011527459712374042, 0.00009326154751972243, 0.00006567965508991503, 0.00003112011864701308, 0.00000134325952728000, 
-0.00000447641522002828, 0.00000457851612972106, 0.00000468294582154143, 0.00000478975741182513, 0.00000489900522841887, 0.00000501074483831326, 0.00000512503307590596, 0.00000524192807190955, 0.00000536148928291863, 0.00000548377752165146, 0.00006220992995565963, 0.00007794774585842326, 0.00009766690122846829, 0.00012237459198495334, 0.00015333281362589892, 0.00019212282021193955, 0.00024072589012972176, 0.00030162452391038568, 0.00037792924298728794, 0.00013102618936055999, 
-0.00000437659116062165, 0.00000447641522002828, 0.00000457851612972106, 0.00000468294582154143, 0.00000478975741182513, 0.00000489900522841887, 0.00000501074483831326, 0.00000512503307590596, 0.00000524192807190955, 0.00000536148928291863, 0.00006082264851764842, 0.00007620951112578041, 0.00009548892933107345, 0.00011964563858368890, 0.00014991349188204136, 0.00018783848132121326, 0.00023535770277982899, 0.00029489829702718408, 0.00036950142086867151, 0.00017276830533781952, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001277998543085728, 0.00001259614975716199, 0.00001241278113789709, 0.00001222989022593546, 0.00001204748791712739, 0.00001186558535584268, 0.00001168419394063894, 0.00001150332533005926, 0.00001132299144856220, 0.00001114320449258688, 0.00010167338290133587, 0.00008439844153403618, 0.00006792198715916830, 0.00005244602034636148, 0.00003822364359992566, 0.00002557198908342610, 0.00001488841678917805, 0.00000667081050707443, 0.00000154300825058451, 0.00000001812309586553, 
-0.00001824676364474088, 0.00001820155185101859, 0.00001815530883810841, 0.00001810801108531084, 0.00001805963453545141, 0.00001801015458264437, 0.00001795954605977741, 0.00001790778322571076, 0.00001785483975218447, 0.00001780068871042700, 0.00017474238789110997, 0.00016777345011792017, 0.00015904151631193541, 0.00014810058521545934, 0.00013439182654669880, 0.00011721503760788102, 0.00009569287901003263, 0.00006872606278140992, 0.00003493720400118468, 0.00000266662403982166, 
-0.00000437659116062165, 0.00000447641522002828, 0.00000457851612972106, 0.00000468294582154143, 0.00000478975741182513, 0.00000489900522841887, 0.00000501074483831326, 0.00000512503307590596, 0.00000524192807190955, 0.00000536148928291863, 0.00006082264851764841, 0.00007620951112578041, 0.00009548892933107345, 0.00011964563858368888, 0.00014991349188204134, 0.00018783848132121326, 0.00023535770277982896, 0.00029489829702718408, 0.00036950142086867135, 0.00017276830533781952, 
-0.00000427899317773979, 0.00000437659116062165, 0.00000447641522002828, 0.00000457851612972106, 0.00000468294582154143, 0.00000478975741182513, 0.00000489900522841887, 0.00000501074483831326, 0.00000512503307590596, 0.00000524192807190955, 0.00005946630345570486, 0.00007451003902767550, 0.00009335952620699050, 0.00011697754084327263, 0.00014657042101307185, 0.00018364968318775022, 0.00023010922600783879, 0.00028832206500347784, 0.00036126153918330010, 0.00021357957212878614, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001296427774366916, 0.00001277998543085728, 0.00001259614975716199, 0.00001241278113789709, 0.00001222989022593546, 0.00001204748791712739, 0.00001186558535584268, 0.00001168419394063894, 0.00001150332533005926, 0.00001132299144856220, 0.00010343828101903608, 0.00008609295338022718, 0.00006952830647391884, 0.00005394183625703761, 0.00003958100104804732, 0.00002675586096326570, 0.00001585491486717938, 0.00000736494374116667, 0.00000189587401099648, 0.00000004505599866773, 
-0.00001829096721546315, 0.00001824676364474088, 0.00001820155185101859, 0.00001815530883810841, 0.00001810801108531084, 0.00001805963453545141, 0.00001801015458264437, 0.00001795954605977741, 0.00001790778322571076, 0.00001785483975218447, 0.00017535669664113824, 0.00016854316618029053, 0.00016000595449817926, 0.00014930900616515460, 0.00013590595281470742, 0.00011911220626922527, 0.00009806999180810891, 0.00007170453558138449, 0.00003866916835195826, 0.00000441158392373363, 
-0.00000427899317773979, 0.00000437659116062165, 0.00000447641522002828, 0.00000457851612972106, 0.00000468294582154143, 0.00000478975741182513, 0.00000489900522841887, 0.00000501074483831326, 0.00000512503307590596, 0.00000524192807190955, 0.00005946630345570486, 0.00007451003902767552, 0.00009335952620699051, 0.00011697754084327262, 0.00014657042101307185, 0.00018364968318775022, 0.00023010922600783879, 0.00028832206500347784, 0.00036126153918330004, 0.00021357957212878614, 
-0.00000418357162987619, 0.00000427899317773979, 0.00000437659116062165, 0.00000447641522002828, 0.00000457851612972106, 0.00000468294582154143, 0.00000478975741182513, 0.00000489900522841887, 0.00000501074483831326, 0.00000512503307590596, 0.00005814020488864264, 0.00007284846515735833, 0.00009127760877257463, 0.00011436894168246765, 0.00014330190062448035, 0.00017955429525266342, 0.00022497779026786399, 0.00028189248295390029, 0.00035320540685951249, 0.00025348074767031422, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001314901651254534, 0.00001296427774366916, 0.00001277998543085728, 0.00001259614975716199, 0.00001241278113789709, 0.00001222989022593546, 0.00001204748791712739, 0.00001186558535584268, 0.00001168419394063894, 0.00001150332533005926, 0.00010520938365511157, 0.00008779523935864812, 0.00007114436661435045, 0.00005544985721930568, 0.00004095365117147587, 0.00002795889424658487, 0.00001684542178444127, 0.00000808915955053865, 0.00000228643261135126, 0.00000008961299629744, 
-0.00001833418504655833, 0.00001829096721546315, 0.00001824676364474088, 0.00001820155185101859, 0.00001815530883810841, 0.00001810801108531084, 0.00001805963453545141, 0.00001801015458264437, 0.00001795954605977741, 0.00001790778322571076, 0.00017595730630604086, 0.00016929571757447003, 0.00016094888571286983, 0.00015049047932767166, 0.00013738631406693945, 0.00012096706806942155, 0.00010039409499078809, 0.00007461658843791961, 0.00004231790989770960, 0.00000656873760223437, 
-0.00000418357162987619, 0.00000427899317773979, 0.00000437659116062165, 0.00000447641522002828, 0.00000457851612972106, 0.00000468294582154143, 0.00000478975741182513, 0.00000489900522841887, 0.00000501074483831326, 0.00000512503307590596, 0.00005814020488864264, 0.00007284846515735836, 0.00009127760877257463, 0.00011436894168246765, 0.00014330190062448035, 0.00017955429525266342, 0.00022497779026786399, 0.00028189248295390029, 0.00035320540685951249, 0.00025348074767031422, 
-0.00000409027798252995, 0.00000418357162987619, 0.00000427899317773979, 0.00000437659116062165, 0.00000447641522002828, 0.00000457851612972106, 0.00000468294582154143, 0.00000478975741182513, 0.00000489900522841887, 0.00000501074483831326, 0.00005684367831962590, 0.00007122394438434925, 0.00008924211809694621, 0.00011181851428294862, 0.00014010626824055442, 0.00017555023446852905, 0.00021996078554489064, 0.00027560628058402831, 0.00034532892628654540, 0.00029249212699726616, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001333419178151557, 0.00001314901651254534, 0.00001296427774366916, 0.00001277998543085728, 0.00001259614975716199, 0.00001241278113789709, 0.00001222989022593546, 0.00001204748791712739, 0.00001186558535584268, 0.00001168419394063894, 0.00010698655244880259, 0.00008950512610615028, 0.00007276995036005043, 0.00005696981106051516, 0.00004234125294355196, 0.00002918066163408603, 0.00001785940214384823, 0.00000884278709376164, 0.00000271384350131813, 0.00000015595724608000, 
-0.00001837643912002008, 0.00001833418504655833, 0.00001829096721546315, 0.00001824676364474088, 0.00001820155185101859, 0.00001815530883810841, 0.00001810801108531084, 0.00001805963453545141, 0.00001801015458264437, 0.00001795954605977741, 0.00017654452237541617, 0.00017003148707255938, 0.00016187078956147284, 0.00015164560563866460, 0.00013883366326324670, 0.00012278056645147344, 0.00010266637067249351, 0.00007746370251575401, 0.00004588528450699068, 0.00000912889315370455, 
-0.00000409027798252995, 0.00000418357162987619, 0.00000427899317773979, 0.00000437659116062165, 0.00000447641522002828, 0.00000457851612972106, 0.00000468294582154143, 0.00000478975741182513, 0.00000489900522841887, 0.00000501074483831326, 0.00005684367831962590, 0.00007122394438434927, 0.00008924211809694621, 0.00011181851428294862, 0.00014010626824055442, 0.00017555023446852902, 0.00021996078554489064, 0.00027560628058402831, 0.00034532892628654540, 0.00029249212699726616, 
-0.00000399906478351953, 0.00000409027798252995, 0.00000418357162987619, 0.00000427899317773979, 0.00000437659116062165, 0.00000447641522002828, 0.00000457851612972106, 0.00000468294582154143, 0.00000478975741182513, 0.00000489900522841887, 0.00005557606429309825, 0.00006963565042457827, 0.00008725201886338431, 0.00010932496141443886, 0.00013698189845879008, 0.00017163546423988081, 0.00021505566002723962, 0.00026946026052700450, 0.00033762809123035544, 0.00033063355256522713, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001351979381662778, 0.00001333419178151557, 0.00001314901651254534, 0.00001296427774366916, 0.00001277998543085728, 0.00001259614975716199, 0.00001241278113789709, 0.00001222989022593546, 0.00001204748791712739, 0.00001186558535584268, 0.00010876965212479430, 0.00009122244412558313, 0.00007440484533462130, 0.00005850143167746567, 0.00004374347294251075, 0.00003042074535524591, 0.00001889633248764042, 0.00000962517048917076, 0.00000317728487483873, 0.00000024815906693242, 
-0.00001841775092764363, 0.00001837643912002008, 0.00001833418504655833, 0.00001829096721546315, 0.00001824676364474088, 0.00001820155185101859, 0.00001815530883810841, 0.00001810801108531084, 0.00001805963453545141, 0.00001801015458264437, 0.00017711864352644438, 0.00017075084891084131, 0.00016277213495425200, 0.00015277497263292239, 0.00014024873657247631, 0.00012455362381960558, 0.00010488797460649691, 0.00008024732594965269, 0.00004937310666248479, 0.00001208306363637693, 
-0.00000399906478351953, 0.00000409027798252995, 0.00000418357162987619, 0.00000427899317773979, 0.00000437659116062165, 0.00000447641522002828, 0.00000457851612972106, 0.00000468294582154143, 0.00000478975741182513, 0.00000489900522841887, 0.00005557606429309824, 0.00006963565042457827, 0.00008725201886338432, 0.00010932496141443886, 0.00013698189845879008, 0.00017163546423988084, 0.00021505566002723962, 0.00026946026052700450, 0.00033762809123035544, 0.00033063355256522713, 
-0.00000390988563884705, 0.00000399906478351953, 0.00000409027798252995, 0.00000418357162987619, 0.00000427899317773979, 0.00000437659116062165, 0.00000447641522002828, 0.00000457851612972106, 0.00000468294582154143, 0.00000478975741182513, 0.00005433671805936216, 0.00006808277542011018, 0.00008530629884273083, 0.00010688701477489688, 0.00013392720212315905, 0.00016780799338733150, 0.00021025991880863217, 0.00026345129671725233, 0.00033009898479591845, 0.00036792442434302252, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001370581310099698, 0.00001351979381662778, 0.00001333419178151557, 0.00001314901651254534, 0.00001296427774366916, 0.00001277998543085728, 0.00001259614975716199, 0.00001241278113789709, 0.00001222989022593546, 0.00001204748791712739, 0.00011055855042441137, 0.00009294702769958261, 0.00007604884389765926, 0.00006004445890105819, 0.00004515998518189276, 0.00003167873695582393, 0.00001995570103116604, 0.00001043566848126225, 0.00000367595325212983, 0.00000037019800965983, 
-0.00001845814148195718, 0.00001841775092764363, 0.00001837643912002008, 0.00001833418504655833, 0.00001829096721546315, 0.00001824676364474088, 0.00001820155185101859, 0.00001815530883810841, 0.00001810801108531084, 0.00001805963453545141, 0.00017767996177580465, 0.00017145416898012956, 0.00016365338034477218, 0.00015387915474320823, 0.00014163225374691008, 0.00012628714200842839, 0.00010706003677277205, 0.00008296887458097544, 0.00005278315038391138, 0.00001542246251728573, 
-0.00000390988563884705, 0.00000399906478351953, 0.00000409027798252995, 0.00000418357162987619, 0.00000427899317773979, 0.00000437659116062165, 0.00000447641522002828, 0.00000457851612972106, 0.00000468294582154143, 0.00000478975741182513, 0.00005433671805936216, 0.00006808277542011018, 0.00008530629884273083, 0.00010688701477489689, 0.00013392720212315905, 0.00016780799338733150, 0.00021025991880863217, 0.00026345129671725227, 0.00033009898479591845, 0.00036792442434302252, 
-0.00000382269518910076, 0.00000390988563884705, 0.00000399906478351953, 0.00000409027798252995, 0.00000418357162987619, 0.00000427899317773979, 0.00000437659116062165, 0.00000447641522002828, 0.00000457851612972106, 0.00000468294582154143, 0.00005312500924663838, 0.00006656452952824171, 0.00008340396837853794, 0.00010450343434541666, 0.00013094062551581261, 0.00016406587513479400, 0.00020557112261919967, 0.00025757633280045758, 0.00032273777743496951, 0.00040438370968017316, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001389224032996474, 0.00001370581310099698, 0.00001351979381662778, 0.00001333419178151557, 0.00001314901651254534, 0.00001296427774366916, 0.00001277998543085728, 0.00001259614975716199, 0.00001241278113789709, 0.00001222989022593546, 0.00011235311803834700, 0.00009467871480628190, 0.00007770174303914145, 0.00006159863836396458, 0.00004659047094473655, 0.00003295423709010905, 0.00002103700740257104, 0.00001127365411453010, 0.00000420906307100733, 0.00000052596488108441, 
-0.00001849763132690953, 0.00001845814148195718, 0.00001841775092764363, 0.00001837643912002008, 0.00001833418504655833, 0.00001829096721546315, 0.00001824676364474088, 0.00001820155185101859, 0.00001815530883810841, 0.00001810801108531084, 0.00017822876262820421, 0.00017214180501187265, 0.00016451497396308379, 0.00015495871359243464, 0.00014298491848835400, 0.00012798200274164042, 0.00010918366195273922, 0.00008562973267781970, 0.00005611715013035015, 0.00001913849920315026, 
-0.00000382269518910076, 0.00000390988563884705, 0.00000399906478351953, 0.00000409027798252995, 0.00000418357162987619, 0.00000427899317773979, 0.00000437659116062165, 0.00000447641522002828, 0.00000457851612972106, 0.00000468294582154143, 0.00005312500924663838, 0.00006656452952824173, 0.00008340396837853794, 0.00010450343434541669, 0.00013094062551581261, 0.00016406587513479400, 0.00020557112261919967, 0.00025757633280045758, 0.00032273777743496951, 0.00040438370968017316, 
-0.00000373744908638381, 0.00000382269518910076, 0.00000390988563884705, 0.00000399906478351953, 0.00000409027798252995, 0.00000418357162987619, 0.00000427899317773979, 0.00000437659116062165, 0.00000447641522002828, 0.00000457851612972106, 0.00005194032154043835, 0.00006508014051976193, 0.00008154405988369654, 0.00010217300775951388, 0.00012802064956680999, 0.00016040720611928808, 0.00020098688658479148, 0.00025183238057900734, 0.00031554072499816968, 0.00044002995295430529, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001407906640636654, 0.00001389224032996474, 0.00001370581310099698, 0.00001351979381662778, 0.00001333419178151557, 0.00001314901651254534, 0.00001296427774366916, 0.00001277998543085728, 0.00001259614975716199, 0.00001241278113789709, 0.00011415322854089186, 0.00009641734703690183, 0.00007936334427616860, 0.00006316372137124817, 0.00004803461862146893, 0.00003424685531779962, 0.00002213976238829370, 0.00001213851441457608, 0.00000477584628732387, 0.00000071926372303623, 
-0.00001853624054831945, 0.00001849763132690953, 0.00001845814148195718, 0.00001841775092764363, 0.00001837643912002008, 0.00001833418504655833, 0.00001829096721546315, 0.00001824676364474088, 0.00001820155185101859, 0.00001815530883810841, 0.00017876532522159523, 0.00017281410676010789, 0.00016535735404370701, 0.00015601419827932335, 0.00014430741880606371, 0.00012963906808050187, 0.00011125993029119313, 0.00008823125363910430, 0.00005937680168244335, 0.00002322277467092001, 
-0.00000373744908638381, 0.00000382269518910076, 0.00000390988563884705, 0.00000399906478351953, 0.00000409027798252995, 0.00000418357162987619, 0.00000427899317773979, 0.00000437659116062165, 0.00000447641522002828, 0.00000457851612972106, 0.00005194032154043835, 0.00006508014051976193, 0.00008154405988369654, 0.00010217300775951388, 0.00012802064956680997, 0.00016040720611928808, 0.00020098688658479148, 0.00025183238057900734, 0.00031554072499816968, 0.00044002995295430529, 
-0.00000365410397175745, 0.00000373744908638381, 0.00000382269518910076, 0.00000390988563884705, 0.00000399906478351953, 0.00000409027798252995, 0.00000418357162987619, 0.00000427899317773979, 0.00000437659116062165, 0.00000447641522002828, 0.00005078205237008657, 0.00006362885338617124, 0.00007972562734829011, 0.00009989454968647673, 0.00012516578908147014, 0.00015683012542282797, 0.00019650487901395062, 0.00024621651849209551, 0.00030850416683071051, 0.00047488128500342437, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001426628243590456, 0.00001407906640636654, 0.00001389224032996474, 0.00001370581310099698, 0.00001351979381662778, 0.00001333419178151557, 0.00001314901651254534, 0.00001296427774366916, 0.00001277998543085728, 0.00001259614975716199, 0.00011595875832562997, 0.00009816276951517891, 0.00008103345355201003, 0.00006473946477386934, 0.00004949212355141017, 0.00003555620990541269, 0.00002326348768423475, 0.00001302965007633103, 0.00000537555198431655, 0.00000095381374721252, 
-0.00001857398878409193, 0.00001853624054831945, 0.00001849763132690953, 0.00001845814148195718, 0.00001841775092764363, 0.00001837643912002008, 0.00001833418504655833, 0.00001829096721546315, 0.00001824676364474088, 0.00001820155185101859, 0.00017928992246915367, 0.00017347141617935746, 0.00016618094904853235, 0.00015704614565769447, 0.00014560042736668849, 0.00013125918086230668, 0.00011328989784569953, 0.00009077476068295228, 0.00006256376300492486, 0.00002766707719575849, 
-0.00000365410397175745, 0.00000373744908638381, 0.00000382269518910076, 0.00000390988563884705, 0.00000399906478351953, 0.00000409027798252995, 0.00000418357162987619, 0.00000427899317773979, 0.00000437659116062165, 0.00000447641522002828, 0.00005078205237008657, 0.00006362885338617124, 0.00007972562734829011, 0.00009989454968647671, 0.00012516578908147014, 0.00015683012542282797, 0.00019650487901395062, 0.00024621651849209551, 0.00030850416683071051, 0.00047488128500342431, 
-0.00000357261745318726, 0.00000365410397175745, 0.00000373744908638381, 0.00000382269518910076, 0.00000390988563884705, 0.00000399906478351953, 0.00000409027798252995, 0.00000418357162987619, 0.00000427899317773979, 0.00000437659116062165, 0.00004964961260223364, 0.00006220992995565961, 0.00007794774585842326, 0.00009766690122846829, 0.00012237459198495334, 0.00015333281362589892, 0.00019212282021193955, 0.00024072589012972179, 0.00030162452391038568, 0.00050895543234784802, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001445387972262389, 0.00001426628243590456, 0.00001407906640636654, 0.00001389224032996474, 0.00001370581310099698, 0.00001351979381662778, 0.00001333419178151557, 0.00001314901651254534, 0.00001296427774366916, 0.00001277998543085728, 0.00011776958654256841, 0.00009991483081859043, 0.00008271188113740020, 0.00006632563084501205, 0.00005096268786781373, 0.00003688192763212199, 0.00002440771565247632, 0.00001394647515922885, 0.00000600744599066629, 0.00000123325122688968, 
-0.00001861089523420667, 0.00001857398878409193, 0.00001853624054831945, 0.00001849763132690953, 0.00001845814148195718, 0.00001841775092764363, 0.00001837643912002008, 0.00001833418504655833, 0.00001829096721546315, 0.00001824676364474088, 0.00017980282119809153, 0.00017411406759855781, 0.00016698617788475011, 0.00015805508060952789, 0.00014686460183641130, 0.00013284316512907724, 0.00011527459712374042, 0.00009326154751972243, 0.00006567965508991503, 0.00003246337817429308, 
-0.00000357261745318726, 0.00000365410397175745, 0.00000373744908638381, 0.00000382269518910076, 0.00000390988563884705, 0.00000399906478351953, 0.00000409027798252995, 0.00000418357162987619, 0.00000427899317773979, 0.00000437659116062165, 0.00004964961260223363, 0.00006220992995565963, 0.00007794774585842326, 0.00009766690122846829, 0.00012237459198495334, 0.00015333281362589892, 0.00019212282021193955, 0.00024072589012972176, 0.00030162452391038568, 0.00050895543234784791, 
-0.00000349294808398118, 0.00000357261745318726, 0.00000365410397175745, 0.00000373744908638381, 0.00000382269518910076, 0.00000390988563884705, 0.00000399906478351953, 0.00000409027798252995, 0.00000418357162987619, 0.00000427899317773979, 0.00004854242624120382, 0.00006082264851764842, 0.00007620951112578041, 0.00009548892933107345, 0.00011964563858368890, 0.00014991349188204136, 0.00018783848132121326, 0.00023535770277982899, 0.00029489829702718408, 0.00054226972620649105, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001464184976448937, 0.00001445387972262389, 0.00001426628243590456, 0.00001407906640636654, 0.00001389224032996474, 0.00001370581310099698, 0.00001351979381662778, 0.00001333419178151557, 0.00001314901651254534, 0.00001296427774366916, 0.00011958559503666915, 0.00010167338290133587, 0.00008439844153403618, 0.00006792198715916830, 0.00005244602034636148, 0.00003822364359992566, 0.00002557198908342610, 0.00001488841678917805, 0.00000667081050707443, 0.00000156113134645004, 
-0.00001864697867048386, 0.00001861089523420667, 0.00001857398878409193, 0.00001853624054831945, 0.00001849763132690953, 0.00001845814148195718, 0.00001841775092764363, 0.00001837643912002008, 0.00001833418504655833, 0.00001829096721546315, 0.00018030428228537411, 0.00017474238789110997, 0.00016777345011792017, 0.00015904151631193541, 0.00014810058521545934, 0.00013439182654669880, 0.00011721503760788102, 0.00009569287901003263, 0.00006872606278140992, 0.00003760382804100634, 
-0.00000349294808398118, 0.00000357261745318726, 0.00000365410397175745, 0.00000373744908638381, 0.00000382269518910076, 0.00000390988563884705, 0.00000399906478351953, 0.00000409027798252995, 0.00000418357162987619, 0.00000427899317773979, 0.00004854242624120383, 0.00006082264851764841, 0.00007620951112578041, 0.00009548892933107345, 0.00011964563858368888, 0.00014991349188204134, 0.00018783848132121326, 0.00023535770277982896, 0.00029489829702718408, 0.00054226972620649095, 
-0.00000341505534170840, 0.00000349294808398118, 0.00000357261745318726, 0.00000365410397175745, 0.00000373744908638381, 0.00000382269518910076, 0.00000390988563884705, 0.00000399906478351953, 0.00000409027798252995, 0.00000418357162987619, 0.00004745993013602498, 0.00005946630345570486, 0.00007451003902767550, 0.00009335952620699050, 0.00011697754084327263, 0.00014657042101307185, 0.00018364968318775022, 0.00023010922600783879, 0.00028832206500347784, 0.00057484111131208626, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001483018424906126, 0.00001464184976448937, 0.00001445387972262389, 0.00001426628243590456, 0.00001407906640636654, 0.00001389224032996474, 0.00001370581310099698, 0.00001351979381662778, 0.00001333419178151557, 0.00001314901651254534, 0.00012140666828775141, 0.00010343828101903608, 0.00008609295338022718, 0.00006952830647391884, 0.00005394183625703761, 0.00003958100104804732, 0.00002675586096326570, 0.00001585491486717938, 0.00000736494374116667, 0.00000194093000966421, 
-0.00001868225744613208, 0.00001864697867048386, 0.00001861089523420667, 0.00001857398878409193, 0.00001853624054831945, 0.00001849763132690953, 0.00001845814148195718, 0.00001841775092764363, 0.00001837643912002008, 0.00001833418504655833, 0.00018079456079041025, 0.00017535669664113824, 0.00016854316618029053, 0.00016000595449817926, 0.00014930900616515460, 0.00013590595281470742, 0.00011911220626922527, 0.00009806999180810891, 0.00007170453558138449, 0.00004308075227569190, 
-0.00000341505534170840, 0.00000349294808398118, 0.00000357261745318726, 0.00000365410397175745, 0.00000373744908638381, 0.00000382269518910076, 0.00000390988563884705, 0.00000399906478351953, 0.00000409027798252995, 0.00000418357162987619, 0.00004745993013602498, 0.00005946630345570486, 0.00007451003902767552, 0.00009335952620699051, 0.00011697754084327262, 0.00014657042101307185, 0.00018364968318775022, 0.00023010922600783879, 0.00028832206500347784, 0.00057484111131208626, 
-0.00000333889960758831, 0.00000341505534170840, 0.00000349294808398118, 0.00000357261745318726, 0.00000365410397175745, 0.00000373744908638381, 0.00000382269518910076, 0.00000390988563884705, 0.00000399906478351953, 0.00000409027798252995, 0.00004640157369399162, 0.00005814020488864264, 0.00007284846515735833, 0.00009127760877257463, 0.00011436894168246765, 0.00014330190062448035, 0.00017955429525266342, 0.00022497779026786399, 0.00028189248295390029, 0.00060668615452982670, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001501887504926720, 0.00001483018424906126, 0.00001464184976448937, 0.00001445387972262389, 0.00001426628243590456, 0.00001407906640636654, 0.00001389224032996474, 0.00001370581310099698, 0.00001351979381662778, 0.00001333419178151557, 0.00012323269335173459, 0.00010520938365511157, 0.00008779523935864812, 0.00007114436661435045, 0.00005544985721930568, 0.00004095365117147587, 0.00002795889424658487, 0.00001684542178444127, 0.00000808915955053865, 0.00000237604560764870, 
-0.00001871674950508333, 0.00001868225744613208, 0.00001864697867048386, 0.00001861089523420667, 0.00001857398878409193, 0.00001853624054831945, 0.00001849763132690953, 0.00001845814148195718, 0.00001841775092764363, 0.00001837643912002008, 0.00018127390608478410, 0.00017595730630604086, 0.00016929571757447003, 0.00016094888571286983, 0.00015049047932767166, 0.00013738631406693945, 0.00012096706806942155, 0.00010039409499078809, 0.00007461658843791961, 0.00004888664749994397, 
-0.00000333889960758831, 0.00000341505534170840, 0.00000349294808398118, 0.00000357261745318726, 0.00000365410397175745, 0.00000373744908638381, 0.00000382269518910076, 0.00000390988563884705, 0.00000399906478351953, 0.00000409027798252995, 0.00004640157369399163, 0.00005814020488864264, 0.00007284846515735836, 0.00009127760877257463, 0.00011436894168246765, 0.00014330190062448035, 0.00017955429525266342, 0.00022497779026786399, 0.00028189248295390029, 0.00060668615452982670, 
-0.00000326444214633909, 0.00000333889960758831, 0.00000341505534170840, 0.00000349294808398118, 0.00000357261745318726, 0.00000365410397175745, 0.00000373744908638381, 0.00000382269518910076, 0.00000390988563884705, 0.00000399906478351953, 0.00004536681860061561, 0.00005684367831962590, 0.00007122394438434925, 0.00008924211809694621, 0.00011181851428294862, 0.00014010626824055442, 0.00017555023446852905, 0.00021996078554489064, 0.00027560628058402831, 0.00063782105328381161, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001520791421926854, 0.00001501887504926720, 0.00001483018424906126, 0.00001464184976448937, 0.00001445387972262389, 0.00001426628243590456, 0.00001407906640636654, 0.00001389224032996474, 0.00001370581310099698, 0.00001351979381662778, 0.00012506355980319091, 0.00010698655244880259, 0.00008950512610615028, 0.00007276995036005043, 0.00005696981106051516, 0.00004234125294355196, 0.00002918066163408603, 0.00001785940214384823, 0.00000884278709376164, 0.00000286980074739813, 
-0.00001875047239111997, 0.00001871674950508333, 0.00001868225744613208, 0.00001864697867048386, 0.00001861089523420667, 0.00001857398878409193, 0.00001853624054831945, 0.00001849763132690953, 0.00001845814148195718, 0.00001841775092764363, 0.00018174256197909342, 0.00017654452237541617, 0.00017003148707255938, 0.00016187078956147284, 0.00015164560563866460, 0.00013883366326324670, 0.00012278056645147344, 0.00010266637067249351, 0.00007746370251575401, 0.00005501417766069522, 
-0.00000326444214633909, 0.00000333889960758831, 0.00000341505534170840, 0.00000349294808398118, 0.00000357261745318726, 0.00000365410397175745, 0.00000373744908638381, 0.00000382269518910076, 0.00000390988563884705, 0.00000399906478351953, 0.00004536681860061562, 0.00005684367831962590, 0.00007122394438434927, 0.00008924211809694621, 0.00011181851428294862, 0.00014010626824055442, 0.00017555023446852902, 0.00021996078554489064, 0.00027560628058402831, 0.00063782105328381161, 
-0.00000319164508647573, 0.00000326444214633909, 0.00000333889960758831, 0.00000341505534170840, 0.00000349294808398118, 0.00000357261745318726, 0.00000365410397175745, 0.00000373744908638381, 0.00000382269518910076, 0.00000390988563884705, 0.00004435513854582188, 0.00005557606429309825, 0.00006963565042457827, 0.00008725201886338431, 0.00010932496141443886, 0.00013698189845879008, 0.00017163546423988081, 0.00021505566002723962, 0.00026946026052700450, 0.00066826164379558267, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001539729399041885, 0.00001520791421926854, 0.00001501887504926720, 0.00001483018424906126, 0.00001464184976448937, 0.00001445387972262389, 0.00001426628243590456, 0.00001407906640636654, 0.00001389224032996474, 0.00001370581310099698, 0.00012689915967917977, 0.00010876965212479430, 0.00009122244412558313, 0.00007440484533462130, 0.00005850143167746567, 0.00004374347294251075, 0.00003042074535524591, 0.00001889633248764042, 0.00000962517048917076, 0.00000342544394177115, 
-0.00001878344325679800, 0.00001875047239111997, 0.00001871674950508333, 0.00001868225744613208, 0.00001864697867048386, 0.00001861089523420667, 0.00001857398878409193, 0.00001853624054831945, 0.00001849763132690953, 0.00001845814148195718, 0.00018220076684695964, 0.00017711864352644438, 0.00017075084891084131, 0.00016277213495425200, 0.00015277497263292239, 0.00014024873657247631, 0.00012455362381960558, 0.00010488797460649691, 0.00008024732594965269, 0.00006145617029886173, 
-0.00000319164508647573, 0.00000326444214633909, 0.00000333889960758831, 0.00000341505534170840, 0.00000349294808398118, 0.00000357261745318726, 0.00000365410397175745, 0.00000373744908638381, 0.00000382269518910076, 0.00000390988563884705, 0.00004435513854582189, 0.00005557606429309824, 0.00006963565042457827, 0.00008725201886338432, 0.00010932496141443886, 0.00013698189845879008, 0.00017163546423988084, 0.00021505566002723962, 0.00026946026052700450, 0.00066826164379558256, 
-0.00000312047140104732, 0.00000319164508647573, 0.00000326444214633909, 0.00000333889960758831, 0.00000341505534170840, 0.00000349294808398118, 0.00000357261745318726, 0.00000365410397175745, 0.00000373744908638381, 0.00000382269518910076, 0.00004336601895625005, 0.00005433671805936216, 0.00006808277542011018, 0.00008530629884273083, 0.00010688701477489688, 0.00013392720212315905, 0.00016780799338733150, 0.00021025991880863217, 0.00026345129671725233, 0.00069802340913894113, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001558700676731251, 0.00001539729399041885, 0.00001520791421926854, 0.00001501887504926720, 0.00001483018424906126, 0.00001464184976448937, 0.00001445387972262389, 0.00001426628243590456, 0.00001407906640636654, 0.00001389224032996474, 0.00012873938742433404, 0.00011055855042441137, 0.00009294702769958261, 0.00007604884389765926, 0.00006004445890105819, 0.00004515998518189276, 0.00003167873695582393, 0.00001995570103116604, 0.00001043566848126225, 0.00000404615126178965, 
-0.00001881567887217140, 0.00001878344325679800, 0.00001875047239111997, 0.00001871674950508333, 0.00001868225744613208, 0.00001864697867048386, 0.00001861089523420667, 0.00001857398878409193, 0.00001853624054831945, 0.00001849763132690953, 0.00018264875374627247, 0.00017767996177580465, 0.00017145416898012956, 0.00016365338034477218, 0.00015387915474320823, 0.00014163225374691008, 0.00012628714200842839, 0.00010706003677277205, 0.00008296887458097544, 0.00006820561290119711, 
-0.00000312047140104732, 0.00000319164508647573, 0.00000326444214633909, 0.00000333889960758831, 0.00000341505534170840, 0.00000349294808398118, 0.00000357261745318726, 0.00000365410397175745, 0.00000373744908638381, 0.00000382269518910076, 0.00004336601895625005, 0.00005433671805936216, 0.00006808277542011018, 0.00008530629884273083, 0.00010688701477489689, 0.00013392720212315905, 0.00016780799338733150, 0.00021025991880863217, 0.00026345129671725227, 0.00069802340913894102, 
-0.00000305088488880396, 0.00000312047140104732, 0.00000319164508647573, 0.00000326444214633909, 0.00000333889960758831, 0.00000341505534170840, 0.00000349294808398118, 0.00000357261745318726, 0.00000365410397175745, 0.00000373744908638381, 0.00004239895673352568, 0.00005312500924663838, 0.00006656452952824171, 0.00008340396837853794, 0.00010450343434541666, 0.00013094062551581261, 0.00016406587513479400, 0.00020557112261919967, 0.00025757633280045758, 0.00072712148711514277, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001577704512392144, 0.00001558700676731251, 0.00001539729399041885, 0.00001520791421926854, 0.00001501887504926720, 0.00001483018424906126, 0.00001464184976448937, 0.00001445387972262389, 0.00001426628243590456, 0.00001407906640636654, 0.00013058413983717141, 0.00011235311803834700, 0.00009467871480628190, 0.00007770174303914145, 0.00006159863836396458, 0.00004659047094473655, 0.00003295423709010905, 0.00002103700740257104, 0.00001127365411453010, 0.00000473502795209174, 
-0.00001884719563332198, 0.00001881567887217140, 0.00001878344325679800, 0.00001875047239111997, 0.00001871674950508333, 0.00001868225744613208, 0.00001864697867048386, 0.00001861089523420667, 0.00001857398878409193, 0.00001853624054831945, 0.00018308675053773057, 0.00017822876262820421, 0.00017214180501187265, 0.00016451497396308379, 0.00015495871359243464, 0.00014298491848835400, 0.00012798200274164042, 0.00010918366195273922, 0.00008562973267781970, 0.00007525564933350039, 
-0.00000305088488880396, 0.00000312047140104732, 0.00000319164508647573, 0.00000326444214633909, 0.00000333889960758831, 0.00000341505534170840, 0.00000349294808398118, 0.00000357261745318726, 0.00000365410397175745, 0.00000373744908638381, 0.00004239895673352568, 0.00005312500924663838, 0.00006656452952824173, 0.00008340396837853794, 0.00010450343434541669, 0.00013094062551581261, 0.00016406587513479400, 0.00020557112261919967, 0.00025757633280045758, 0.00072712148711514277, 
-0.00000298285015578363, 0.00000305088488880396, 0.00000312047140104732, 0.00000319164508647573, 0.00000326444214633909, 0.00000333889960758831, 0.00000341505534170840, 0.00000349294808398118, 0.00000357261745318726, 0.00000365410397175745, 0.00004145345999836806, 0.00005194032154043835, 0.00006508014051976193, 0.00008154405988369654, 0.00010217300775951388, 0.00012802064956680999, 0.00016040720611928808, 0.00020098688658479148, 0.00025183238057900734, 0.00075557067795247509, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001596740179981799, 0.00001577704512392144, 0.00001558700676731251, 0.00001539729399041885, 0.00001520791421926854, 0.00001501887504926720, 0.00001483018424906126, 0.00001464184976448937, 0.00001445387972262389, 0.00001426628243590456, 0.00013243331601760249, 0.00011415322854089186, 0.00009641734703690183, 0.00007936334427616860, 0.00006316372137124817, 0.00004803461862146893, 0.00003424685531779962, 0.00002213976238829370, 0.00001213851441457608, 0.00000549511001036010, 
-0.00001887800957069890, 0.00001884719563332198, 0.00001881567887217140, 0.00001878344325679800, 0.00001875047239111997, 0.00001871674950508333, 0.00001868225744613208, 0.00001864697867048386, 0.00001861089523420667, 0.00001857398878409193, 0.00018351498000073921, 0.00017876532522159523, 0.00017281410676010789, 0.00016535735404370701, 0.00015601419827932335, 0.00014430741880606371, 0.00012963906808050187, 0.00011125993029119313, 0.00008823125363910430, 0.00008259957635336334, 
-0.00000298285015578363, 0.00000305088488880396, 0.00000312047140104732, 0.00000319164508647573, 0.00000326444214633909, 0.00000333889960758831, 0.00000341505534170840, 0.00000349294808398118, 0.00000357261745318726, 0.00000365410397175745, 0.00004145345999836806, 0.00005194032154043835, 0.00006508014051976193, 0.00008154405988369654, 0.00010217300775951388, 0.00012802064956680997, 0.00016040720611928808, 0.00020098688658479148, 0.00025183238057900734, 0.00075557067795247509, 
-0.00000291633259730966, 0.00000298285015578363, 0.00000305088488880396, 0.00000312047140104732, 0.00000319164508647573, 0.00000326444214633909, 0.00000333889960758831, 0.00000341505534170840, 0.00000349294808398118, 0.00000357261745318726, 0.00004052904784040445, 0.00005078205237008657, 0.00006362885338617124, 0.00007972562734829011, 0.00009989454968647673, 0.00012516578908147014, 0.00015683012542282797, 0.00019650487901395062, 0.00024621651849209551, 0.00078338545183413493, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001615806969648205, 0.00001596740179981799, 0.00001577704512392144, 0.00001558700676731251, 0.00001539729399041885, 0.00001520791421926854, 0.00001501887504926720, 0.00001483018424906126, 0.00001464184976448937, 0.00001445387972262389, 0.00013428681731560995, 0.00011595875832562997, 0.00009816276951517891, 0.00008103345355201003, 0.00006473946477386934, 0.00004949212355141017, 0.00003555620990541269, 0.00002326348768423475, 0.00001302965007633103, 0.00000632936573152907, 
-0.00001890813635727232, 0.00001887800957069890, 0.00001884719563332198, 0.00001881567887217140, 0.00001878344325679800, 0.00001875047239111997, 0.00001871674950508333, 0.00001868225744613208, 0.00001864697867048386, 0.00001861089523420667, 0.00018393365994672271, 0.00017928992246915367, 0.00017347141617935746, 0.00016618094904853235, 0.00015704614565769447, 0.00014560042736668849, 0.00013125918086230668, 0.00011328989784569953, 0.00009077476068295228, 0.00009023084020068334, 
-0.00000291633259730966, 0.00000298285015578363, 0.00000305088488880396, 0.00000312047140104732, 0.00000319164508647573, 0.00000326444214633909, 0.00000333889960758831, 0.00000341505534170840, 0.00000349294808398118, 0.00000357261745318726, 0.00004052904784040445, 0.00005078205237008657, 0.00006362885338617124, 0.00007972562734829011, 0.00009989454968647671, 0.00012516578908147014, 0.00015683012542282797, 0.00019650487901395062, 0.00024621651849209551, 0.00078338545183413472, 
-0.00000285129838038965, 0.00000291633259730966, 0.00000298285015578363, 0.00000305088488880396, 0.00000312047140104732, 0.00000319164508647573, 0.00000326444214633909, 0.00000333889960758831, 0.00000341505534170840, 0.00000349294808398118, 0.00003962525007356343, 0.00004964961260223364, 0.00006220992995565961, 0.00007794774585842326, 0.00009766690122846829, 0.00012237459198495334, 0.00015333281362589892, 0.00019212282021193955, 0.00024072589012972179, 0.00081057995625823370, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001634904187369050, 0.00001615806969648205, 0.00001596740179981799, 0.00001577704512392144, 0.00001558700676731251, 0.00001539729399041885, 0.00001520791421926854, 0.00001501887504926720, 0.00001483018424906126, 0.00001464184976448937, 0.00013614454728107182, 0.00011776958654256841, 0.00009991483081859043, 0.00008271188113740020, 0.00006632563084501205, 0.00005096268786781373, 0.00003688192763212199, 0.00002440771565247632, 0.00001394647515922885, 0.00000724069721755597, 
-0.00001893759131650514, 0.00001890813635727232, 0.00001887800957069890, 0.00001884719563332198, 0.00001881567887217140, 0.00001878344325679800, 0.00001875047239111997, 0.00001871674950508333, 0.00001868225744613208, 0.00001864697867048386, 0.00018434300332991079, 0.00017980282119809153, 0.00017411406759855781, 0.00016698617788475011, 0.00015805508060952789, 0.00014686460183641130, 0.00013284316512907724, 0.00011527459712374042, 0.00009326154751972243, 0.00009814303326420811, 
-0.00000285129838038965, 0.00000291633259730966, 0.00000298285015578363, 0.00000305088488880396, 0.00000312047140104732, 0.00000319164508647573, 0.00000326444214633909, 0.00000333889960758831, 0.00000341505534170840, 0.00000349294808398118, 0.00003962525007356343, 0.00004964961260223363, 0.00006220992995565963, 0.00007794774585842326, 0.00009766690122846829, 0.00012237459198495334, 0.00015333281362589892, 0.00019212282021193955, 0.00024072589012972176, 0.00081057995625823348, 
-0.00000278771442650696, 0.00000285129838038965, 0.00000291633259730966, 0.00000298285015578363, 0.00000305088488880396, 0.00000312047140104732, 0.00000319164508647573, 0.00000326444214633909, 0.00000333889960758831, 0.00000341505534170840, 0.00003874160699692297, 0.00004854242624120382, 0.00006082264851764842, 0.00007620951112578041, 0.00009548892933107345, 0.00011964563858368890, 0.00014991349188204136, 0.00018783848132121326, 0.00023535770277982899, 0.00083716802323367508, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001654031154598720, 0.00001634904187369050, 0.00001615806969648205, 0.00001596740179981799, 0.00001577704512392144, 0.00001558700676731251, 0.00001539729399041885, 0.00001520791421926854, 0.00001501887504926720, 0.00001483018424906126, 0.00013800641161470392, 0.00011958559503666915, 0.00010167338290133587, 0.00008439844153403618, 0.00006792198715916830, 0.00005244602034636148, 0.00003822364359992566, 0.00002557198908342610, 0.00001488841678917805, 0.00000823194185352447, 
-0.00001896638943014708, 0.00001893759131650514, 0.00001890813635727232, 0.00001887800957069890, 0.00001884719563332198, 0.00001881567887217140, 0.00001878344325679800, 0.00001875047239111997, 0.00001871674950508333, 0.00001868225744613208, 0.00018474321835565378, 0.00018030428228537411, 0.00017474238789110997, 0.00016777345011792017, 0.00015904151631193541, 0.00014810058521545934, 0.00013439182654669880, 0.00011721503760788102, 0.00009569287901003263, 0.00010632989082241626, 
-0.00000278771442650696, 0.00000285129838038965, 0.00000291633259730966, 0.00000298285015578363, 0.00000305088488880396, 0.00000312047140104732, 0.00000319164508647573, 0.00000326444214633909, 0.00000333889960758831, 0.00000341505534170840, 0.00003874160699692297, 0.00004854242624120383, 0.00006082264851764841, 0.00007620951112578041, 0.00009548892933107345, 0.00011964563858368888, 0.00014991349188204134, 0.00018783848132121326, 0.00023535770277982896, 0.00083716802323367486, 
-0.00000272554839479586, 0.00000278771442650696, 0.00000285129838038965, 0.00000291633259730966, 0.00000298285015578363, 0.00000305088488880396, 0.00000312047140104732, 0.00000319164508647573, 0.00000326444214633909, 0.00000333889960758831, 0.00003787766916089159, 0.00004745993013602498, 0.00005946630345570486, 0.00007451003902767550, 0.00009335952620699050, 0.00011697754084327263, 0.00014657042101307185, 0.00018364968318775022, 0.00023010922600783879, 0.00086316317631556405, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001673187207923169, 0.00001654031154598720, 0.00001634904187369050, 0.00001615806969648205, 0.00001596740179981799, 0.00001577704512392144, 0.00001558700676731251, 0.00001539729399041885, 0.00001520791421926854, 0.00001501887504926720, 0.00013987231812009605, 0.00012140666828775141, 0.00010343828101903608, 0.00008609295338022718, 0.00006952830647391884, 0.00005394183625703761, 0.00003958100104804732, 0.00002675586096326570, 0.00001585491486717938, 0.00000930587375083087, 
-0.00001899454534585480, 0.00001896638943014708, 0.00001893759131650514, 0.00001890813635727232, 0.00001887800957069890, 0.00001884719563332198, 0.00001881567887217140, 0.00001878344325679800, 0.00001875047239111997, 0.00001871674950508333, 0.00018513450858632268, 0.00018079456079041025, 0.00017535669664113824, 0.00016854316618029053, 0.00016000595449817926, 0.00014930900616515460, 0.00013590595281470742, 0.00011911220626922527, 0.00009806999180810891, 0.00011478528785707638, 
-0.00000272554839479586, 0.00000278771442650696, 0.00000285129838038965, 0.00000291633259730966, 0.00000298285015578363, 0.00000305088488880396, 0.00000312047140104732, 0.00000319164508647573, 0.00000326444214633909, 0.00000333889960758831, 0.00003787766916089159, 0.00004745993013602498, 0.00005946630345570486, 0.00007451003902767552, 0.00009335952620699051, 0.00011697754084327262, 0.00014657042101307185, 0.00018364968318775022, 0.00023010922600783879, 0.00086316317631556405, 
-0.00000266476866559191, 0.00000272554839479586, 0.00000278771442650696, 0.00000285129838038965, 0.00000291633259730966, 0.00000298285015578363, 0.00000305088488880396, 0.00000312047140104732, 0.00000319164508647573, 0.00000326444214633909, 0.00003703299713860371, 0.00004640157369399162, 0.00005814020488864264, 0.00007284846515735833, 0.00009127760877257463, 0.00011436894168246765, 0.00014330190062448035, 0.00017955429525266342, 0.00022497779026786399, 0.00088857863748372694, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001692371698722482, 0.00001673187207923169, 0.00001654031154598720, 0.00001634904187369050, 0.00001615806969648205, 0.00001596740179981799, 0.00001577704512392144, 0.00001558700676731251, 0.00001539729399041885, 0.00001520791421926854, 0.00014174217665681790, 0.00012323269335173459, 0.00010520938365511157, 0.00008779523935864812, 0.00007114436661435045, 0.00005544985721930568, 0.00004095365117147587, 0.00002795889424658487, 0.00001684542178444127, 0.00001046520515818735, 
-0.00001902207338464223, 0.00001899454534585480, 0.00001896638943014708, 0.00001893759131650514, 0.00001890813635727232, 0.00001887800957069890, 0.00001884719563332198, 0.00001881567887217140, 0.00001878344325679800, 0.00001875047239111997, 0.00018551707304484771, 0.00018127390608478410, 0.00017595730630604086, 0.00016929571757447003, 0.00016094888571286983, 0.00015049047932767166, 0.00013738631406693945, 0.00012096706806942155, 0.00010039409499078809, 0.00012350323593786361, 
-0.00000266476866559191, 0.00000272554839479586, 0.00000278771442650696, 0.00000285129838038965, 0.00000291633259730966, 0.00000298285015578363, 0.00000305088488880396, 0.00000312047140104732, 0.00000319164508647573, 0.00000326444214633909, 0.00003703299713860371, 0.00004640157369399163, 0.00005814020488864264, 0.00007284846515735836, 0.00009127760877257463, 0.00011436894168246765, 0.00014330190062448035, 0.00017955429525266342, 0.00022497779026786399, 0.00088857863748372694, 
-0.00000260534432434921, 0.00000266476866559191, 0.00000272554839479586, 0.00000278771442650696, 0.00000285129838038965, 0.00000291633259730966, 0.00000298285015578363, 0.00000305088488880396, 0.00000312047140104732, 0.00000319164508647573, 0.00003620716130241285, 0.00004536681860061561, 0.00005684367831962590, 0.00007122394438434925, 0.00008924211809694621, 0.00011181851428294862, 0.00014010626824055442, 0.00017555023446852905, 0.00021996078554489064, 0.00091342733386783992, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001711583992840971, 0.00001692371698722482, 0.00001673187207923169, 0.00001654031154598720, 0.00001634904187369050, 0.00001615806969648205, 0.00001596740179981799, 0.00001577704512392144, 0.00001558700676731251, 0.00001539729399041885, 0.00014361589909457086, 0.00012506355980319091, 0.00010698655244880259, 0.00008950512610615028, 0.00007276995036005043, 0.00005696981106051516, 0.00004234125294355196, 0.00002918066163408603, 0.00001785940214384823, 0.00001171258784115977, 
-0.00001904898754816471, 0.00001902207338464223, 0.00001899454534585480, 0.00001896638943014708, 0.00001893759131650514, 0.00001890813635727232, 0.00001887800957069890, 0.00001884719563332198, 0.00001881567887217140, 0.00001878344325679800, 0.00018589110631594760, 0.00018174256197909342, 0.00017654452237541617, 0.00017003148707255938, 0.00016187078956147284, 0.00015164560563866460, 0.00013883366326324670, 0.00012278056645147344, 0.00010266637067249351, 0.00013247788017644926, 
-0.00000260534432434921, 0.00000266476866559191, 0.00000272554839479586, 0.00000278771442650696, 0.00000285129838038965, 0.00000291633259730966, 0.00000298285015578363, 0.00000305088488880396, 0.00000312047140104732, 0.00000319164508647573, 0.00003620716130241285, 0.00004536681860061562, 0.00005684367831962590, 0.00007122394438434927, 0.00008924211809694621, 0.00011181851428294862, 0.00014010626824055442, 0.00017555023446852902, 0.00021996078554489064, 0.00091342733386783970, 
-0.00000254724514591622, 0.00000260534432434921, 0.00000266476866559191, 0.00000272554839479586, 0.00000278771442650696, 0.00000285129838038965, 0.00000291633259730966, 0.00000298285015578363, 0.00000305088488880396, 0.00000312047140104732, 0.00003539974160536904, 0.00004435513854582188, 0.00005557606429309825, 0.00006963565042457827, 0.00008725201886338431, 0.00010932496141443886, 0.00013698189845879008, 0.00017163546423988081, 0.00021505566002723962, 0.00093772190432258717, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001730823470264617, 0.00001711583992840971, 0.00001692371698722482, 0.00001673187207923169, 0.00001654031154598720, 0.00001634904187369050, 0.00001615806969648205, 0.00001596740179981799, 0.00001577704512392144, 0.00001558700676731251, 0.00014549339926836193, 0.00012689915967917977, 0.00010876965212479430, 0.00009122244412558313, 0.00007440484533462130, 0.00005850143167746567, 0.00004374347294251075, 0.00003042074535524591, 0.00001889633248764042, 0.00001305061443094191, 
-0.00001907530152584064, 0.00001904898754816471, 0.00001902207338464223, 0.00001899454534585480, 0.00001896638943014708, 0.00001893759131650514, 0.00001890813635727232, 0.00001887800957069890, 0.00001884719563332198, 0.00001881567887217140, 0.00018625679864510197, 0.00018220076684695964, 0.00017711864352644438, 0.00017075084891084131, 0.00016277213495425200, 0.00015277497263292239, 0.00014024873657247631, 0.00012455362381960558, 0.00010488797460649691, 0.00014170349624851444, 
-0.00000254724514591622, 0.00000260534432434921, 0.00000266476866559191, 0.00000272554839479586, 0.00000278771442650696, 0.00000285129838038965, 0.00000291633259730966, 0.00000298285015578363, 0.00000305088488880396, 0.00000312047140104732, 0.00003539974160536904, 0.00004435513854582189, 0.00005557606429309824, 0.00006963565042457827, 0.00008725201886338432, 0.00010932496141443886, 0.00013698189845879008, 0.00017163546423988084, 0.00021505566002723962, 0.00093772190432258695, 
-0.00000249044157916229, 0.00000254724514591622, 0.00000260534432434921, 0.00000266476866559191, 0.00000272554839479586, 0.00000278771442650696, 0.00000285129838038965, 0.00000291633259730966, 0.00000298285015578363, 0.00000305088488880396, 0.00003461032736756931, 0.00004336601895625005, 0.00005433671805936216, 0.00006808277542011018, 0.00008530629884273083, 0.00010688701477489688, 0.00013392720212315905, 0.00016780799338733150, 0.00021025991880863217, 0.00096147470585619351, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001750089524805716, 0.00001730823470264617, 0.00001711583992840971, 0.00001692371698722482, 0.00001673187207923169, 0.00001654031154598720, 0.00001634904187369050, 0.00001615806969648205, 0.00001596740179981799, 0.00001577704512392144, 0.00014737459293467746, 0.00012873938742433404, 0.00011055855042441137, 0.00009294702769958261, 0.00007604884389765926, 0.00006004445890105819, 0.00004515998518189276, 0.00003167873695582393, 0.00001995570103116604, 0.00001448181974305190, 
-0.00001910102870181440, 0.00001907530152584064, 0.00001904898754816471, 0.00001902207338464223, 0.00001899454534585480, 0.00001896638943014708, 0.00001893759131650514, 0.00001890813635727232, 0.00001887800957069890, 0.00001884719563332198, 0.00018661433603531623, 0.00018264875374627247, 0.00017767996177580465, 0.00017145416898012956, 0.00016365338034477218, 0.00015387915474320823, 0.00014163225374691008, 0.00012628714200842839, 0.00010706003677277205, 0.00015117448748217256, 
-0.00000249044157916229, 0.00000254724514591622, 0.00000260534432434921, 0.00000266476866559191, 0.00000272554839479586, 0.00000278771442650696, 0.00000285129838038965, 0.00000291633259730966, 0.00000298285015578363, 0.00000305088488880396, 0.00003461032736756931, 0.00004336601895625005, 0.00005433671805936216, 0.00006808277542011018, 0.00008530629884273083, 0.00010688701477489689, 0.00013392720212315905, 0.00016780799338733150, 0.00021025991880863217, 0.00096147470585619330, 
-0.00000243490473194697, 0.00000249044157916229, 0.00000254724514591622, 0.00000260534432434921, 0.00000266476866559191, 0.00000272554839479586, 0.00000278771442650696, 0.00000285129838038965, 0.00000291633259730966, 0.00000298285015578363, 0.00003383851706727251, 0.00004239895673352568, 0.00005312500924663838, 0.00006656452952824171, 0.00008340396837853794, 0.00010450343434541666, 0.00013094062551581261, 0.00016406587513479400, 0.00020557112261919967, 0.00098469781991560035, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001769381563794549, 0.00001750089524805716, 0.00001730823470264617, 0.00001711583992840971, 0.00001692371698722482, 0.00001673187207923169, 0.00001654031154598720, 0.00001634904187369050, 0.00001615806969648205, 0.00001596740179981799, 0.00014925939772863415, 0.00013058413983717141, 0.00011235311803834700, 0.00009467871480628190, 0.00007770174303914145, 0.00006159863836396458, 0.00004659047094473655, 0.00003295423709010905, 0.00002103700740257104, 0.00001600868206662184, 
-0.00001912618216176394, 0.00001910102870181440, 0.00001907530152584064, 0.00001904898754816471, 0.00001902207338464223, 0.00001899454534585480, 0.00001896638943014708, 0.00001893759131650514, 0.00001890813635727232, 0.00001887800957069890, 0.00018696390034172869, 0.00018308675053773057, 0.00017822876262820421, 0.00017214180501187265, 0.00016451497396308379, 0.00015495871359243464, 0.00014298491848835400, 0.00012798200274164042, 0.00010918366195273922, 0.00016088538201132013, 
-0.00000243490473194697, 0.00000249044157916229, 0.00000254724514591622, 0.00000260534432434921, 0.00000266476866559191, 0.00000272554839479586, 0.00000278771442650696, 0.00000285129838038965, 0.00000291633259730966, 0.00000298285015578363, 0.00003383851706727251, 0.00004239895673352568, 0.00005312500924663838, 0.00006656452952824173, 0.00008340396837853794, 0.00010450343434541669, 0.00013094062551581261, 0.00016406587513479400, 0.00020557112261919967, 0.00098469781991560013, 
-0.00000238060635642456, 0.00000243490473194697, 0.00000249044157916229, 0.00000254724514591622, 0.00000260534432434921, 0.00000266476866559191, 0.00000272554839479586, 0.00000278771442650696, 0.00000285129838038965, 0.00000291633259730966, 0.00003308391813667234, 0.00004145345999836806, 0.00005194032154043835, 0.00006508014051976193, 0.00008154405988369654, 0.00010217300775951388, 0.00012802064956680999, 0.00016040720611928808, 0.00020098688658479148, 0.00100740305853148240, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001788699007777931, 0.00001769381563794549, 0.00001750089524805716, 0.00001730823470264617, 0.00001711583992840971, 0.00001692371698722482, 0.00001673187207923169, 0.00001654031154598720, 0.00001634904187369050, 0.00001615806969648205, 0.00015114773312208560, 0.00013243331601760249, 0.00011415322854089186, 0.00009641734703690183, 0.00007936334427616860, 0.00006316372137124817, 0.00004803461862146893, 0.00003424685531779962, 0.00002213976238829370, 0.00001763362442493617, 
-0.00001915077469955660, 0.00001912618216176394, 0.00001910102870181440, 0.00001907530152584064, 0.00001904898754816471, 0.00001902207338464223, 0.00001899454534585480, 0.00001896638943014708, 0.00001893759131650514, 0.00001890813635727232, 0.00018730566936410814, 0.00018351498000073921, 0.00017876532522159523, 0.00017281410676010789, 0.00016535735404370701, 0.00015601419827932335, 0.00014430741880606371, 0.00012963906808050187, 0.00011125993029119313, 0.00017083082999246765, 
-0.00000238060635642456, 0.00000243490473194697, 0.00000249044157916229, 0.00000254724514591622, 0.00000260534432434921, 0.00000266476866559191, 0.00000272554839479586, 0.00000278771442650696, 0.00000285129838038965, 0.00000291633259730966, 0.00003308391813667234, 0.00004145345999836806, 0.00005194032154043835, 0.00006508014051976193, 0.00008154405988369654, 0.00010217300775951388, 0.00012802064956680997, 0.00016040720611928808, 0.00020098688658479148, 0.00100740305853148220, 
-0.00000232751883467629, 0.00000238060635642456, 0.00000243490473194697, 0.00000249044157916229, 0.00000254724514591622, 0.00000260534432434921, 0.00000266476866559191, 0.00000272554839479586, 0.00000278771442650696, 0.00000285129838038965, 0.00003234614676222454, 0.00004052904784040445, 0.00005078205237008657, 0.00006362885338617124, 0.00007972562734829011, 0.00009989454968647673, 0.00012516578908147014, 0.00015683012542282797, 0.00019650487901395062, 0.00102960197032623040, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001808041290224483, 0.00001788699007777931, 0.00001769381563794549, 0.00001750089524805716, 0.00001730823470264617, 0.00001711583992840971, 0.00001692371698722482, 0.00001673187207923169, 0.00001654031154598720, 0.00001634904187369050, 0.00015303952038266312, 0.00013428681731560995, 0.00011595875832562997, 0.00009816276951517891, 0.00008103345355201003, 0.00006473946477386934, 0.00004949212355141017, 0.00003555620990541269, 0.00002326348768423475, 0.00001935901580786009, 
-0.00001917481882375649, 0.00001915077469955660, 0.00001912618216176394, 0.00001910102870181440, 0.00001907530152584064, 0.00001904898754816471, 0.00001902207338464223, 0.00001899454534585480, 0.00001896638943014708, 0.00001893759131650514, 0.00018763981693728851, 0.00018393365994672271, 0.00017928992246915367, 0.00017347141617935746, 0.00016618094904853235, 0.00015704614565769447, 0.00014560042736668849, 0.00013125918086230668, 0.00011328989784569953, 0.00018100560088363563, 
-0.00000232751883467629, 0.00000238060635642456, 0.00000243490473194697, 0.00000249044157916229, 0.00000254724514591622, 0.00000260534432434921, 0.00000266476866559191, 0.00000272554839479586, 0.00000278771442650696, 0.00000285129838038965, 0.00003234614676222454, 0.00004052904784040445, 0.00005078205237008657, 0.00006362885338617124, 0.00007972562734829011, 0.00009989454968647671, 0.00012516578908147014, 0.00015683012542282797, 0.00019650487901395062, 0.00102960197032623020, 
-0.00000227561516466301, 0.00000232751883467629, 0.00000238060635642456, 0.00000243490473194697, 0.00000249044157916229, 0.00000254724514591622, 0.00000260534432434921, 0.00000266476866559191, 0.00000272554839479586, 0.00000278771442650696, 0.00003162482768942693, 0.00003962525007356343, 0.00004964961260223364, 0.00006220992995565961, 0.00007794774585842326, 0.00009766690122846829, 0.00012237459198495334, 0.00015333281362589892, 0.00019212282021193955, 0.00105130584638795540, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001827407857236477, 0.00001808041290224483, 0.00001788699007777931, 0.00001769381563794549, 0.00001750089524805716, 0.00001730823470264617, 0.00001711583992840971, 0.00001692371698722482, 0.00001673187207923169, 0.00001654031154598720, 0.00015493468253372972, 0.00013614454728107182, 0.00011776958654256841, 0.00009991483081859043, 0.00008271188113740020, 0.00006632563084501205, 0.00005096268786781373, 0.00003688192763212199, 0.00002440771565247632, 0.00002118717237678482, 
-0.00001919832676398672, 0.00001917481882375649, 0.00001915077469955660, 0.00001912618216176394, 0.00001910102870181440, 0.00001907530152584064, 0.00001904898754816471, 0.00001902207338464223, 0.00001899454534585480, 0.00001896638943014708, 0.00018796651301958696, 0.00018434300332991079, 0.00017980282119809153, 0.00017411406759855781, 0.00016698617788475011, 0.00015805508060952789, 0.00014686460183641130, 0.00013284316512907724, 0.00011527459712374042, 0.00019140458078393055, 
-0.00000227561516466301, 0.00000232751883467629, 0.00000238060635642456, 0.00000243490473194697, 0.00000249044157916229, 0.00000254724514591622, 0.00000260534432434921, 0.00000266476866559191, 0.00000272554839479586, 0.00000278771442650696, 0.00003162482768942693, 0.00003962525007356343, 0.00004964961260223363, 0.00006220992995565963, 0.00007794774585842326, 0.00009766690122846829, 0.00012237459198495334, 0.00015333281362589892, 0.00019212282021193955, 0.00105130584638795520, 
-0.00000222486894649102, 0.00000227561516466301, 0.00000232751883467629, 0.00000238060635642456, 0.00000243490473194697, 0.00000249044157916229, 0.00000254724514591622, 0.00000260534432434921, 0.00000266476866559191, 0.00000272554839479586, 0.00003091959403195272, 0.00003874160699692297, 0.00004854242624120382, 0.00006082264851764842, 0.00007620951112578041, 0.00009548892933107345, 0.00011964563858368890, 0.00014991349188204136, 0.00018783848132121326, 0.00107252572601350400, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001846798167268103, 0.00001827407857236477, 0.00001808041290224483, 0.00001788699007777931, 0.00001769381563794549, 0.00001750089524805716, 0.00001730823470264617, 0.00001711583992840971, 0.00001692371698722482, 0.00001673187207923169, 0.00015683314431522754, 0.00013800641161470392, 0.00011958559503666915, 0.00010167338290133587, 0.00008439844153403618, 0.00006792198715916830, 0.00005244602034636148, 0.00003822364359992566, 0.00002557198908342610, 0.00002312035864270252, 
-0.00001922131047714981, 0.00001919832676398672, 0.00001917481882375649, 0.00001915077469955660, 0.00001912618216176394, 0.00001910102870181440, 0.00001907530152584064, 0.00001904898754816471, 0.00001902207338464223, 0.00001899454534585480, 0.00018828592377925017, 0.00018474321835565378, 0.00018030428228537411, 0.00017474238789110997, 0.00016777345011792017, 0.00015904151631193541, 0.00014810058521545934, 0.00013439182654669880, 0.00011721503760788102, 0.00020202276983244890, 
-0.00000222486894649102, 0.00000227561516466301, 0.00000232751883467629, 0.00000238060635642456, 0.00000243490473194697, 0.00000249044157916229, 0.00000254724514591622, 0.00000260534432434921, 0.00000266476866559191, 0.00000272554839479586, 0.00003091959403195272, 0.00003874160699692297, 0.00004854242624120383, 0.00006082264851764841, 0.00007620951112578041, 0.00009548892933107345, 0.00011964563858368888, 0.00014991349188204134, 0.00018783848132121326, 0.00107252572601350380, 
-0.00000217525436898427, 0.00000222486894649102, 0.00000227561516466301, 0.00000232751883467629, 0.00000238060635642456, 0.00000243490473194697, 0.00000249044157916229, 0.00000254724514591622, 0.00000260534432434921, 0.00000266476866559191, 0.00003023008708504017, 0.00003787766916089159, 0.00004745993013602498, 0.00005946630345570486, 0.00007451003902767550, 0.00009335952620699050, 0.00011697754084327263, 0.00014657042101307185, 0.00018364968318775022, 0.00109327240232340280, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001866211690850024, 0.00001846798167268103, 0.00001827407857236477, 0.00001808041290224483, 0.00001788699007777931, 0.00001769381563794549, 0.00001750089524805716, 0.00001730823470264617, 0.00001711583992840971, 0.00001692371698722482, 0.00015873483214539797, 0.00013987231812009605, 0.00012140666828775141, 0.00010343828101903608, 0.00008609295338022718, 0.00006952830647391884, 0.00005394183625703761, 0.00003958100104804732, 0.00002675586096326570, 0.00002516078861801025, 
-0.00001924378165350937, 0.00001922131047714981, 0.00001919832676398672, 0.00001917481882375649, 0.00001915077469955660, 0.00001912618216176394, 0.00001910102870181440, 0.00001907530152584064, 0.00001904898754816471, 0.00001902207338464223, 0.00018859821167897291, 0.00018513450858632268, 0.00018079456079041025, 0.00017535669664113824, 0.00016854316618029053, 0.00016000595449817926, 0.00014930900616515460, 0.00013590595281470742, 0.00011911220626922527, 0.00021285527966518526, 
-0.00000217525436898427, 0.00000222486894649102, 0.00000227561516466301, 0.00000232751883467629, 0.00000238060635642456, 0.00000243490473194697, 0.00000249044157916229, 0.00000254724514591622, 0.00000260534432434921, 0.00000266476866559191, 0.00003023008708504017, 0.00003787766916089159, 0.00004745993013602498, 0.00005946630345570486, 0.00007451003902767552, 0.00009335952620699051, 0.00011697754084327262, 0.00014657042101307185, 0.00018364968318775022, 0.00109327240232340260, 
-0.00000212674619655592, 0.00000217525436898427, 0.00000222486894649102, 0.00000227561516466301, 0.00000232751883467629, 0.00000238060635642456, 0.00000243490473194697, 0.00000249044157916229, 0.00000254724514591622, 0.00000260534432434921, 0.00002955595614304378, 0.00003703299713860371, 0.00004640157369399162, 0.00005814020488864264, 0.00007284846515735833, 0.00009127760877257463, 0.00011436894168246765, 0.00014330190062448035, 0.00017955429525266342, 0.00111355642775159100, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001885647910320069, 0.00001866211690850024, 0.00001846798167268103, 0.00001827407857236477, 0.00001808041290224483, 0.00001788699007777931, 0.00001769381563794549, 0.00001750089524805716, 0.00001730823470264617, 0.00001711583992840971, 0.00016063967408335559, 0.00014174217665681790, 0.00012323269335173459, 0.00010520938365511157, 0.00008779523935864812, 0.00007114436661435045, 0.00005544985721930568, 0.00004095365117147587, 0.00002795889424658487, 0.00002731062694262862, 
-0.00001926575172263612, 0.00001924378165350937, 0.00001922131047714981, 0.00001919832676398672, 0.00001917481882375649, 0.00001915077469955660, 0.00001912618216176394, 0.00001910102870181440, 0.00001907530152584064, 0.00001904898754816471, 0.00018890353555853185, 0.00018551707304484771, 0.00018127390608478410, 0.00017595730630604086, 0.00016929571757447003, 0.00016094888571286983, 0.00015049047932767166, 0.00013738631406693945, 0.00012096706806942155, 0.00022389733092865164, 
-0.00000212674619655592, 0.00000217525436898427, 0.00000222486894649102, 0.00000227561516466301, 0.00000232751883467629, 0.00000238060635642456, 0.00000243490473194697, 0.00000249044157916229, 0.00000254724514591622, 0.00000260534432434921, 0.00002955595614304378, 0.00003703299713860371, 0.00004640157369399163, 0.00005814020488864264, 0.00007284846515735836, 0.00009127760877257463, 0.00011436894168246765, 0.00014330190062448035, 0.00017955429525266342, 0.00111355642775159080, 
-0.00000207931975637273, 0.00000212674619655592, 0.00000217525436898427, 0.00000222486894649102, 0.00000227561516466301, 0.00000232751883467629, 0.00000238060635642456, 0.00000243490473194697, 0.00000249044157916229, 0.00000254724514591622, 0.00002889685832105390, 0.00003620716130241285, 0.00004536681860061561, 0.00005684367831962590, 0.00007122394438434925, 0.00008924211809694621, 0.00011181851428294862, 0.00014010626824055442, 0.00017555023446852905, 0.00113338811941273050, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001905106319559932, 0.00001885647910320069, 0.00001866211690850024, 0.00001846798167268103, 0.00001827407857236477, 0.00001808041290224483, 0.00001788699007777931, 0.00001769381563794549, 0.00001750089524805716, 0.00001730823470264617, 0.00016254759979249676, 0.00014361589909457086, 0.00012506355980319091, 0.00010698655244880259, 0.00008950512610615028, 0.00007276995036005043, 0.00005696981106051516, 0.00004234125294355196, 0.00002918066163408603, 0.00002957198998500800, 
-0.00001928723185922133, 0.00001926575172263612, 0.00001924378165350937, 0.00001922131047714981, 0.00001919832676398672, 0.00001917481882375649, 0.00001915077469955660, 0.00001912618216176394, 0.00001910102870181440, 0.00001907530152584064, 0.00018920205071557659, 0.00018589110631594760, 0.00018174256197909342, 0.00017654452237541617, 0.00017003148707255938, 0.00016187078956147284, 0.00015164560563866460, 0.00013883366326324670, 0.00012278056645147344, 0.00023514425084894270, 
-0.00000207931975637273, 0.00000212674619655592, 0.00000217525436898427, 0.00000222486894649102, 0.00000227561516466301, 0.00000232751883467629, 0.00000238060635642456, 0.00000243490473194697, 0.00000249044157916229, 0.00000254724514591622, 0.00002889685832105390, 0.00003620716130241285, 0.00004536681860061562, 0.00005684367831962590, 0.00007122394438434927, 0.00008924211809694621, 0.00011181851428294862, 0.00014010626824055442, 0.00017555023446852902, 0.00113338811941273030, 
-0.00000203295092580561, 0.00000207931975637273, 0.00000212674619655592, 0.00000217525436898427, 0.00000222486894649102, 0.00000227561516466301, 0.00000232751883467629, 0.00000238060635642456, 0.00000243490473194697, 0.00000249044157916229, 0.00002825245838049440, 0.00003539974160536904, 0.00004435513854582188, 0.00005557606429309825, 0.00006963565042457827, 0.00008725201886338431, 0.00010932496141443886, 0.00013698189845879008, 0.00017163546423988081, 0.00115277756434982660, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001924586423737745, 0.00001905106319559932, 0.00001885647910320069, 0.00001866211690850024, 0.00001846798167268103, 0.00001827407857236477, 0.00001808041290224483, 0.00001788699007777931, 0.00001769381563794549, 0.00001750089524805716, 0.00016445854050472407, 0.00014549339926836193, 0.00012689915967917977, 0.00010876965212479430, 0.00009122244412558313, 0.00007440484533462130, 0.00005850143167746567, 0.00004374347294251075, 0.00003042074535524591, 0.00003194694691858233, 
-0.00001930823298876070, 0.00001928723185922133, 0.00001926575172263612, 0.00001924378165350937, 0.00001922131047714981, 0.00001919832676398672, 0.00001917481882375649, 0.00001915077469955660, 0.00001912618216176394, 0.00001910102870181440, 0.00018949390898461923, 0.00018625679864510197, 0.00018220076684695964, 0.00017711864352644438, 0.00017075084891084131, 0.00016277213495425200, 0.00015277497263292239, 0.00014024873657247631, 0.00012455362381960558, 0.00024659147085501128, 
-0.00000203295092580561, 0.00000207931975637273, 0.00000212674619655592, 0.00000217525436898427, 0.00000222486894649102, 0.00000227561516466301, 0.00000232751883467629, 0.00000238060635642456, 0.00000243490473194697, 0.00000249044157916229, 0.00002825245838049440, 0.00003539974160536904, 0.00004435513854582189, 0.00005557606429309824, 0.00006963565042457827, 0.00008725201886338432, 0.00010932496141443886, 0.00013698189845879008, 0.00017163546423988084, 0.00115277756434982640, 
-0.00000198761612016015, 0.00000203295092580561, 0.00000207931975637273, 0.00000212674619655592, 0.00000217525436898427, 0.00000222486894649102, 0.00000227561516466301, 0.00000232751883467629, 0.00000238060635642456, 0.00000243490473194697, 0.00002762242855860937, 0.00003461032736756931, 0.00004336601895625005, 0.00005433671805936216, 0.00006808277542011018, 0.00008530629884273083, 0.00010688701477489688, 0.00013392720212315905, 0.00016780799338733150, 0.00117173462466482550, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001944087739056393, 0.00001924586423737745, 0.00001905106319559932, 0.00001885647910320069, 0.00001866211690850024, 0.00001846798167268103, 0.00001827407857236477, 0.00001808041290224483, 0.00001788699007777931, 0.00001769381563794549, 0.00016637242898546876, 0.00014737459293467746, 0.00012873938742433404, 0.00011055855042441137, 0.00009294702769958261, 0.00007604884389765926, 0.00006004445890105819, 0.00004515998518189276, 0.00003167873695582393, 0.00003443752077421796, 
-0.00001932876579311133, 0.00001930823298876070, 0.00001928723185922133, 0.00001926575172263612, 0.00001924378165350937, 0.00001922131047714981, 0.00001919832676398672, 0.00001917481882375649, 0.00001915077469955660, 0.00001912618216176394, 0.00018977925881426218, 0.00018661433603531623, 0.00018264875374627247, 0.00017767996177580465, 0.00017145416898012956, 0.00016365338034477218, 0.00015387915474320823, 0.00014163225374691008, 0.00012628714200842839, 0.00025823452425494456, 
-0.00000198761612016015, 0.00000203295092580561, 0.00000207931975637273, 0.00000212674619655592, 0.00000217525436898427, 0.00000222486894649102, 0.00000227561516466301, 0.00000232751883467629, 0.00000238060635642456, 0.00000243490473194697, 0.00002762242855860937, 0.00003461032736756931, 0.00004336601895625005, 0.00005433671805936216, 0.00006808277542011018, 0.00008530629884273083, 0.00010688701477489689, 0.00013392720212315905, 0.00016780799338733150, 0.00117173462466482530, 
-0.00000194329228068058, 0.00000198761612016015, 0.00000203295092580561, 0.00000207931975637273, 0.00000212674619655592, 0.00000217525436898427, 0.00000222486894649102, 0.00000227561516466301, 0.00000232751883467629, 0.00000238060635642456, 0.00002700644840175239, 0.00003383851706727251, 0.00004239895673352568, 0.00005312500924663838, 0.00006656452952824171, 0.00008340396837853794, 0.00010450343434541666, 0.00013094062551581261, 0.00016406587513479400, 0.00119026894253480000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001963609792507436, 0.00001944087739056393, 0.00001924586423737745, 0.00001905106319559932, 0.00001885647910320069, 0.00001866211690850024, 0.00001846798167268103, 0.00001827407857236477, 0.00001808041290224483, 0.00001788699007777931, 0.00016828919949949279, 0.00014925939772863415, 0.00013058413983717141, 0.00011235311803834700, 0.00009467871480628190, 0.00007770174303914145, 0.00006159863836396458, 0.00004659047094473655, 0.00003295423709010905, 0.00003704568946919290, 
-0.00001934884071592495, 0.00001932876579311133, 0.00001930823298876070, 0.00001928723185922133, 0.00001926575172263612, 0.00001924378165350937, 0.00001922131047714981, 0.00001919832676398672, 0.00001917481882375649, 0.00001915077469955660, 0.00019005824534270414, 0.00018696390034172869, 0.00018308675053773057, 0.00017822876262820421, 0.00017214180501187265, 0.00016451497396308379, 0.00015495871359243464, 0.00014298491848835400, 0.00012798200274164042, 0.00027006904396405934, 
-0.00000194329228068058, 0.00000198761612016015, 0.00000203295092580561, 0.00000207931975637273, 0.00000212674619655592, 0.00000217525436898427, 0.00000222486894649102, 0.00000227561516466301, 0.00000232751883467629, 0.00000238060635642456, 0.00002700644840175238, 0.00003383851706727251, 0.00004239895673352568, 0.00005312500924663838, 0.00006656452952824173, 0.00008340396837853794, 0.00010450343434541669, 0.00013094062551581261, 0.00016406587513479400, 0.00119026894253479970, 
-0.00000189995686282140, 0.00000194329228068058, 0.00000198761612016015, 0.00000203295092580561, 0.00000207931975637273, 0.00000212674619655592, 0.00000217525436898427, 0.00000222486894649102, 0.00000227561516466301, 0.00000232751883467629, 0.00002640420460239330, 0.00003308391813667234, 0.00004145345999836806, 0.00005194032154043835, 0.00006508014051976193, 0.00008154405988369654, 0.00010217300775951388, 0.00012802064956680999, 0.00016040720611928808, 0.00120838994511627390, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00001983152121630520, 0.00001963609792507436, 0.00001944087739056393, 0.00001924586423737745, 0.00001905106319559932, 0.00001885647910320069, 0.00001866211690850024, 0.00001846798167268103, 0.00001827407857236477, 0.00001808041290224483, 0.00017020878777745409, 0.00015114773312208560, 0.00013243331601760249, 0.00011415322854089186, 0.00009641734703690183, 0.00007936334427616860, 0.00006316372137124817, 0.00004803461862146893, 0.00003424685531779962, 0.00003977338681322991, 
-0.00001936846796795983, 0.00001934884071592495, 0.00001932876579311133, 0.00001930823298876070, 0.00001928723185922133, 0.00001926575172263612, 0.00001924378165350937, 0.00001922131047714981, 0.00001919832676398672, 0.00001917481882375649, 0.00019033101047156181, 0.00018730566936410814, 0.00018351498000073921, 0.00017876532522159523, 0.00017281410676010789, 0.00016535735404370701, 0.00015601419827932335, 0.00014430741880606371, 0.00012963906808050187, 0.00028209076028366082, 
-0.00000189995686282140, 0.00000194329228068058, 0.00000198761612016015, 0.00000203295092580561, 0.00000207931975637273, 0.00000212674619655592, 0.00000217525436898427, 0.00000222486894649102, 0.00000227561516466301, 0.00000232751883467629, 0.00002640420460239331, 0.00003308391813667234, 0.00004145345999836806, 0.00005194032154043835, 0.00006508014051976193, 0.00008154405988369654, 0.00010217300775951388, 0.00012802064956680997, 0.00016040720611928808, 0.00120838994511627370, 
-0.00000185758782478048, 0.00000189995686282140, 0.00000194329228068058, 0.00000198761612016015, 0.00000203295092580561, 0.00000207931975637273, 0.00000212674619655592, 0.00000217525436898427, 0.00000222486894649102, 0.00000227561516466301, 0.00002581539083975994, 0.00003234614676222454, 0.00004052904784040445, 0.00005078205237008657, 0.00006362885338617124, 0.00007972562734829011, 0.00009989454968647673, 0.00012516578908147014, 0.00015683012542282797, 0.00122610684934018110, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002002714274278159, 0.00001983152121630520, 0.00001963609792507436, 0.00001944087739056393, 0.00001924586423737745, 0.00001905106319559932, 0.00001885647910320069, 0.00001866211690850024, 0.00001846798167268103, 0.00001827407857236477, 0.00017213113098321688, 0.00015303952038266312, 0.00013428681731560995, 0.00011595875832562997, 0.00009816276951517891, 0.00008103345355201003, 0.00006473946477386934, 0.00004949212355141017, 0.00003555620990541269, 0.00004262250349209489, 
-0.00001938765753227432, 0.00001936846796795983, 0.00001934884071592495, 0.00001932876579311133, 0.00001930823298876070, 0.00001928723185922133, 0.00001926575172263612, 0.00001924378165350937, 0.00001922131047714981, 0.00001919832676398672, 0.00019059769293804603, 0.00018763981693728851, 0.00018393365994672271, 0.00017928992246915367, 0.00017347141617935746, 0.00016618094904853235, 0.00015704614565769447, 0.00014560042736668849, 0.00013125918086230668, 0.00029429549872933515, 
-0.00000185758782478048, 0.00000189995686282140, 0.00000194329228068058, 0.00000198761612016015, 0.00000203295092580561, 0.00000207931975637273, 0.00000212674619655592, 0.00000217525436898427, 0.00000222486894649102, 0.00000227561516466301, 0.00002581539083975994, 0.00003234614676222454, 0.00004052904784040445, 0.00005078205237008657, 0.00006362885338617124, 0.00007972562734829011, 0.00009989454968647671, 0.00012516578908147014, 0.00015683012542282797, 0.00122610684934018070, 
-0.00000181616361628788, 0.00000185758782478048, 0.00000189995686282140, 0.00000194329228068058, 0.00000198761612016015, 0.00000203295092580561, 0.00000207931975637273, 0.00000212674619655592, 0.00000217525436898427, 0.00000222486894649102, 0.00002523970762403329, 0.00003162482768942693, 0.00003962525007356343, 0.00004964961260223364, 0.00006220992995565961, 0.00007794774585842326, 0.00009766690122846829, 0.00012237459198495334, 0.00015333281362589892, 0.00124342866659989510, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002022295808385756, 0.00002002714274278159, 0.00001983152121630520, 0.00001963609792507436, 0.00001944087739056393, 0.00001924586423737745, 0.00001905106319559932, 0.00001885647910320069, 0.00001866211690850024, 0.00001846798167268103, 0.00017405616768189112, 0.00015493468253372972, 0.00013614454728107182, 0.00011776958654256841, 0.00009991483081859043, 0.00008271188113740020, 0.00006632563084501205, 0.00005096268786781373, 0.00003688192763212199, 0.00004559488802926117, 
-0.00001940641916930460, 0.00001938765753227432, 0.00001936846796795983, 0.00001934884071592495, 0.00001932876579311133, 0.00001930823298876070, 0.00001928723185922133, 0.00001926575172263612, 0.00001924378165350937, 0.00001922131047714981, 0.00019085842838552762, 0.00018796651301958696, 0.00018434300332991079, 0.00017980282119809153, 0.00017411406759855781, 0.00016698617788475011, 0.00015805508060952789, 0.00014686460183641130, 0.00013284316512907724, 0.00030667917790767099, 
-0.00000181616361628788, 0.00000185758782478048, 0.00000189995686282140, 0.00000194329228068058, 0.00000198761612016015, 0.00000203295092580561, 0.00000207931975637273, 0.00000212674619655592, 0.00000217525436898427, 0.00000222486894649102, 0.00002523970762403329, 0.00003162482768942693, 0.00003962525007356343, 0.00004964961260223363, 0.00006220992995565963, 0.00007794774585842326, 0.00009766690122846829, 0.00012237459198495334, 0.00015333281362589892, 0.00124342866659989510, 
-0.00000177566316764466, 0.00000181616361628788, 0.00000185758782478048, 0.00000189995686282140, 0.00000194329228068058, 0.00000198761612016015, 0.00000203295092580561, 0.00000207931975637273, 0.00000212674619655592, 0.00000217525436898427, 0.00002467686214401735, 0.00003091959403195272, 0.00003874160699692297, 0.00004854242624120382, 0.00006082264851764842, 0.00007620951112578041, 0.00009548892933107345, 0.00011964563858368890, 0.00014991349188204136, 0.00126036420733471720, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002041896291746754, 0.00002022295808385756, 0.00002002714274278159, 0.00001983152121630520, 0.00001963609792507436, 0.00001944087739056393, 0.00001924586423737745, 0.00001905106319559932, 0.00001885647910320069, 0.00001866211690850024, 0.00017598383780858496, 0.00015683314431522754, 0.00013800641161470392, 0.00011958559503666915, 0.00010167338290133587, 0.00008439844153403618, 0.00006792198715916830, 0.00005244602034636148, 0.00003822364359992566, 0.00004869234772612864, 
-0.00001942476242182911, 0.00001940641916930460, 0.00001938765753227432, 0.00001936846796795983, 0.00001934884071592495, 0.00001932876579311133, 0.00001930823298876070, 0.00001928723185922133, 0.00001926575172263612, 0.00001924378165350937, 0.00019111334943253035, 0.00018828592377925017, 0.00018474321835565378, 0.00018030428228537411, 0.00017474238789110997, 0.00016777345011792017, 0.00015904151631193541, 0.00014810058521545934, 0.00013439182654669880, 0.00031923780744032987, 
-0.00000177566316764466, 0.00000181616361628788, 0.00000185758782478048, 0.00000189995686282140, 0.00000194329228068058, 0.00000198761612016015, 0.00000203295092580561, 0.00000207931975637273, 0.00000212674619655592, 0.00000217525436898427, 0.00002467686214401735, 0.00003091959403195272, 0.00003874160699692297, 0.00004854242624120383, 0.00006082264851764841, 0.00007620951112578041, 0.00009548892933107345, 0.00011964563858368888, 0.00014991349188204134, 0.00126036420733471720, 
-0.00000173606587900618, 0.00000177566316764466, 0.00000181616361628788, 0.00000185758782478048, 0.00000189995686282140, 0.00000194329228068058, 0.00000198761612016015, 0.00000203295092580561, 0.00000207931975637273, 0.00000212674619655592, 0.00002412656811820576, 0.00003023008708504017, 0.00003787766916089159, 0.00004745993013602498, 0.00005946630345570486, 0.00007451003902767550, 0.00009335952620699050, 0.00011697754084327263, 0.00014657042101307185, 0.00127692208551115310, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002061515301792802, 0.00002041896291746754, 0.00002022295808385756, 0.00002002714274278159, 0.00001983152121630520, 0.00001963609792507436, 0.00001944087739056393, 0.00001924586423737745, 0.00001905106319559932, 0.00001885647910320069, 0.00017791408263785353, 0.00015873483214539797, 0.00013987231812009605, 0.00012140666828775141, 0.00010343828101903608, 0.00008609295338022718, 0.00006952830647391884, 0.00005394183625703761, 0.00003958100104804732, 0.00005191664958127597, 
-0.00001944269661982232, 0.00001942476242182911, 0.00001940641916930460, 0.00001938765753227432, 0.00001936846796795983, 0.00001934884071592495, 0.00001932876579311133, 0.00001930823298876070, 0.00001928723185922133, 0.00001926575172263612, 0.00019136258574018491, 0.00018859821167897291, 0.00018513450858632268, 0.00018079456079041025, 0.00017535669664113824, 0.00016854316618029053, 0.00016000595449817926, 0.00014930900616515460, 0.00013590595281470742, 0.00033196748593441051, 
-0.00000173606587900618, 0.00000177566316764466, 0.00000181616361628788, 0.00000185758782478048, 0.00000189995686282140, 0.00000194329228068058, 0.00000198761612016015, 0.00000203295092580561, 0.00000207931975637273, 0.00000212674619655592, 0.00002412656811820576, 0.00003023008708504017, 0.00003787766916089159, 0.00004745993013602498, 0.00005946630345570486, 0.00007451003902767552, 0.00009335952620699051, 0.00011697754084327262, 0.00014657042101307185, 0.00127692208551115310, 
-0.00000169735160990435, 0.00000173606587900618, 0.00000177566316764466, 0.00000181616361628788, 0.00000185758782478048, 0.00000189995686282140, 0.00000194329228068058, 0.00000198761612016015, 0.00000203295092580561, 0.00000207931975637273, 0.00002358854564916977, 0.00002955595614304378, 0.00003703299713860371, 0.00004640157369399162, 0.00005814020488864264, 0.00007284846515735833, 0.00009127760877257463, 0.00011436894168246765, 0.00014330190062448035, 0.00129311072300425440, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002081152425378822, 0.00002061515301792802, 0.00002041896291746754, 0.00002022295808385756, 0.00002002714274278159, 0.00001983152121630520, 0.00001963609792507436, 0.00001944087739056393, 0.00001924586423737745, 0.00001905106319559932, 0.00017984684475382939, 0.00016063967408335559, 0.00014174217665681790, 0.00012323269335173459, 0.00010520938365511157, 0.00008779523935864812, 0.00007114436661435045, 0.00005544985721930568, 0.00004095365117147587, 0.00005526952118921352, 
-0.00001946023088520028, 0.00001944269661982232, 0.00001942476242182911, 0.00001940641916930460, 0.00001938765753227432, 0.00001936846796795983, 0.00001934884071592495, 0.00001932876579311133, 0.00001930823298876070, 0.00001928723185922133, 0.00019160626407817879, 0.00018890353555853185, 0.00018551707304484771, 0.00018127390608478410, 0.00017595730630604086, 0.00016929571757447003, 0.00016094888571286983, 0.00015049047932767166, 0.00013738631406693945, 0.00034486439899807320, 
-0.00000169735160990435, 0.00000173606587900618, 0.00000177566316764466, 0.00000181616361628788, 0.00000185758782478048, 0.00000189995686282140, 0.00000194329228068058, 0.00000198761612016015, 0.00000203295092580561, 0.00000207931975637273, 0.00002358854564916977, 0.00002955595614304378, 0.00003703299713860371, 0.00004640157369399163, 0.00005814020488864264, 0.00007284846515735836, 0.00009127760877257463, 0.00011436894168246765, 0.00014330190062448035, 0.00129311072300425440, 
-0.00000165950066900348, 0.00000169735160990435, 0.00000173606587900618, 0.00000177566316764466, 0.00000181616361628788, 0.00000185758782478048, 0.00000189995686282140, 0.00000194329228068058, 0.00000198761612016015, 0.00000203295092580561, 0.00002306252108119329, 0.00002889685832105390, 0.00003620716130241285, 0.00004536681860061561, 0.00005684367831962590, 0.00007122394438434925, 0.00008924211809694621, 0.00011181851428294862, 0.00014010626824055442, 0.00130893835388125970, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002100807258572874, 0.00002081152425378822, 0.00002061515301792802, 0.00002041896291746754, 0.00002022295808385756, 0.00002002714274278159, 0.00001983152121630520, 0.00001963609792507436, 0.00001944087739056393, 0.00001924586423737745, 0.00018178206802101901, 0.00016254759979249676, 0.00014361589909457086, 0.00012506355980319091, 0.00010698655244880259, 0.00008950512610615028, 0.00007276995036005043, 0.00005696981106051516, 0.00004234125294355196, 0.00005875265161909406, 
-0.00001947737413646031, 0.00001946023088520028, 0.00001944269661982232, 0.00001942476242182911, 0.00001940641916930460, 0.00001938765753227432, 0.00001936846796795983, 0.00001934884071592495, 0.00001932876579311133, 0.00001930823298876070, 0.00019184450838923540, 0.00018920205071557659, 0.00018589110631594760, 0.00018174256197909342, 0.00017654452237541617, 0.00017003148707255938, 0.00016187078956147284, 0.00015164560563866460, 0.00013883366326324670, 0.00035792481730041612, 
-0.00000165950066900348, 0.00000169735160990435, 0.00000173606587900618, 0.00000177566316764466, 0.00000181616361628788, 0.00000185758782478048, 0.00000189995686282140, 0.00000194329228068058, 0.00000198761612016015, 0.00000203295092580561, 0.00002306252108119329, 0.00002889685832105390, 0.00003620716130241285, 0.00004536681860061562, 0.00005684367831962590, 0.00007122394438434927, 0.00008924211809694621, 0.00011181851428294862, 0.00014010626824055442, 0.00130893835388125950, 
-0.00000162249380408470, 0.00000165950066900348, 0.00000169735160990435, 0.00000173606587900618, 0.00000177566316764466, 0.00000181616361628788, 0.00000185758782478048, 0.00000189995686282140, 0.00000194329228068058, 0.00000198761612016015, 0.00002254822686108268, 0.00002825245838049440, 0.00003539974160536904, 0.00004435513854582188, 0.00005557606429309825, 0.00006963565042457827, 0.00008725201886338431, 0.00010932496141443886, 0.00013698189845879008, 0.00132441302858970760, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002120479406450699, 0.00002100807258572874, 0.00002081152425378822, 0.00002061515301792802, 0.00002041896291746754, 0.00002022295808385756, 0.00002002714274278159, 0.00001983152121630520, 0.00001963609792507436, 0.00001944087739056393, 0.00018371969755575030, 0.00016445854050472407, 0.00014549339926836193, 0.00012689915967917977, 0.00010876965212479430, 0.00009122244412558313, 0.00007440484533462130, 0.00005850143167746567, 0.00004374347294251075, 0.00006236769227382826, 
-0.00001949413509321725, 0.00001947737413646031, 0.00001946023088520028, 0.00001944269661982232, 0.00001942476242182911, 0.00001940641916930460, 0.00001938765753227432, 0.00001936846796795983, 0.00001934884071592495, 0.00001932876579311133, 0.00019207743985215548, 0.00018949390898461923, 0.00018625679864510197, 0.00018220076684695964, 0.00017711864352644438, 0.00017075084891084131, 0.00016277213495425200, 0.00015277497263292239, 0.00014024873657247631, 0.00037114509467461686, 
-0.00000162249380408470, 0.00000165950066900348, 0.00000169735160990435, 0.00000173606587900618, 0.00000177566316764466, 0.00000181616361628788, 0.00000185758782478048, 0.00000189995686282140, 0.00000194329228068058, 0.00000198761612016015, 0.00002254822686108268, 0.00002825245838049440, 0.00003539974160536904, 0.00004435513854582189, 0.00005557606429309824, 0.00006963565042457827, 0.00008725201886338432, 0.00010932496141443886, 0.00013698189845879008, 0.00132441302858970760, 
-0.00000158631219225361, 0.00000162249380408470, 0.00000165950066900348, 0.00000169735160990435, 0.00000173606587900618, 0.00000177566316764466, 0.00000181616361628788, 0.00000185758782478048, 0.00000189995686282140, 0.00000194329228068058, 0.00002204540140208053, 0.00002762242855860937, 0.00003461032736756931, 0.00004336601895625005, 0.00005433671805936216, 0.00006808277542011018, 0.00008530629884273083, 0.00010688701477489688, 0.00013392720212315905, 0.00133954261805215720, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002140168482894849, 0.00002120479406450699, 0.00002100807258572874, 0.00002081152425378822, 0.00002061515301792802, 0.00002041896291746754, 0.00002022295808385756, 0.00002002714274278159, 0.00001983152121630520, 0.00001963609792507436, 0.00018565967969825706, 0.00016637242898546876, 0.00014737459293467746, 0.00012873938742433404, 0.00011055855042441137, 0.00009294702769958261, 0.00007604884389765926, 0.00006004445890105819, 0.00004515998518189276, 0.00006611625773004187, 
-0.00001951052228063851, 0.00001949413509321725, 0.00001947737413646031, 0.00001946023088520028, 0.00001944269661982232, 0.00001942476242182911, 0.00001940641916930460, 0.00001938765753227432, 0.00001936846796795983, 0.00001934884071592495, 0.00019230517694345239, 0.00018977925881426218, 0.00018661433603531623, 0.00018264875374627247, 0.00017767996177580465, 0.00017145416898012956, 0.00016365338034477218, 0.00015387915474320823, 0.00014163225374691008, 0.00038452166626337290, 
-0.00000158631219225361, 0.00000162249380408470, 0.00000165950066900348, 0.00000169735160990435, 0.00000173606587900618, 0.00000177566316764466, 0.00000181616361628788, 0.00000185758782478048, 0.00000189995686282140, 0.00000194329228068058, 0.00002204540140208053, 0.00002762242855860937, 0.00003461032736756931, 0.00004336601895625005, 0.00005433671805936216, 0.00006808277542011018, 0.00008530629884273083, 0.00010688701477489689, 0.00013392720212315905, 0.00133954261805215700, 
-0.00000155093743036636, 0.00000158631219225361, 0.00000162249380408470, 0.00000165950066900348, 0.00000169735160990435, 0.00000173606587900618, 0.00000177566316764466, 0.00000181616361628788, 0.00000185758782478048, 0.00000189995686282140, 0.00002155378895081414, 0.00002700644840175239, 0.00003383851706727251, 0.00004239895673352568, 0.00005312500924663838, 0.00006656452952824171, 0.00008340396837853794, 0.00010450343434541666, 0.00013094062551581261, 0.00135433481766959390, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002159874110398293, 0.00002140168482894849, 0.00002120479406450699, 0.00002100807258572874, 0.00002081152425378822, 0.00002061515301792802, 0.00002041896291746754, 0.00002022295808385756, 0.00002002714274278159, 0.00001983152121630520, 0.00018760196198538590, 0.00016828919949949279, 0.00014925939772863415, 0.00013058413983717141, 0.00011235311803834700, 0.00009467871480628190, 0.00007770174303914145, 0.00006159863836396458, 0.00004659047094473655, 0.00006999992655930195, 
-0.00001952654403378027, 0.00001951052228063851, 0.00001949413509321725, 0.00001947737413646031, 0.00001946023088520028, 0.00001944269661982232, 0.00001942476242182911, 0.00001940641916930460, 0.00001938765753227432, 0.00001936846796795983, 0.00019252783549761340, 0.00019005824534270414, 0.00018696390034172869, 0.00018308675053773057, 0.00017822876262820421, 0.00017214180501187265, 0.00016451497396308379, 0.00015495871359243464, 0.00014298491848835400, 0.00039805104670569965, 
-0.00000155093743036636, 0.00000158631219225361, 0.00000162249380408470, 0.00000165950066900348, 0.00000169735160990435, 0.00000173606587900618, 0.00000177566316764466, 0.00000181616361628788, 0.00000185758782478048, 0.00000189995686282140, 0.00002155378895081414, 0.00002700644840175238, 0.00003383851706727251, 0.00004239895673352568, 0.00005312500924663838, 0.00006656452952824173, 0.00008340396837853794, 0.00010450343434541669, 0.00013094062551581261, 0.00135433481766959390, 
-0.00000151635152566919, 0.00000155093743036636, 0.00000158631219225361, 0.00000162249380408470, 0.00000165950066900348, 0.00000169735160990435, 0.00000173606587900618, 0.00000177566316764466, 0.00000181616361628788, 0.00000185758782478048, 0.00002107313945721098, 0.00002640420460239330, 0.00003308391813667234, 0.00004145345999836806, 0.00005194032154043835, 0.00006508014051976193, 0.00008154405988369654, 0.00010217300775951388, 0.00012802064956680999, 0.00136879715123556200, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002179595919872412, 0.00002159874110398293, 0.00002140168482894849, 0.00002120479406450699, 0.00002100807258572874, 0.00002081152425378822, 0.00002061515301792802, 0.00002041896291746754, 0.00002022295808385756, 0.00002002714274278159, 0.00018954649312391181, 0.00017020878777745409, 0.00015114773312208560, 0.00013243331601760249, 0.00011415322854089186, 0.00009641734703690183, 0.00007936334427616860, 0.00006316372137124817, 0.00004803461862146893, 0.00007402024213102950, 
-0.00001954220850182697, 0.00001952654403378027, 0.00001951052228063851, 0.00001949413509321725, 0.00001947737413646031, 0.00001946023088520028, 0.00001944269661982232, 0.00001942476242182911, 0.00001940641916930460, 0.00001938765753227432, 0.00019274552876601665, 0.00019033101047156181, 0.00018730566936410814, 0.00018351498000073921, 0.00017876532522159523, 0.00017281410676010789, 0.00016535735404370701, 0.00015601419827932335, 0.00014430741880606371, 0.00041172982836416253, 
-0.00000151635152566919, 0.00000155093743036636, 0.00000158631219225361, 0.00000162249380408470, 0.00000165950066900348, 0.00000169735160990435, 0.00000173606587900618, 0.00000177566316764466, 0.00000181616361628788, 0.00000185758782478048, 0.00002107313945721098, 0.00002640420460239331, 0.00003308391813667234, 0.00004145345999836806, 0.00005194032154043835, 0.00006508014051976193, 0.00008154405988369654, 0.00010217300775951388, 0.00012802064956680997, 0.00136879715123556200, 
-0.00000148253688664676, 0.00000151635152566919, 0.00000155093743036636, 0.00000158631219225361, 0.00000162249380408470, 0.00000165950066900348, 0.00000169735160990435, 0.00000173606587900618, 0.00000177566316764466, 0.00000181616361628788, 0.00002060320844731518, 0.00002581539083975994, 0.00003234614676222454, 0.00004052904784040445, 0.00005078205237008657, 0.00006362885338617124, 0.00007972562734829011, 0.00009989454968647673, 0.00012516578908147014, 0.00138293697476300900, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002199333550459257, 0.00002179595919872412, 0.00002159874110398293, 0.00002140168482894849, 0.00002120479406450699, 0.00002100807258572874, 0.00002081152425378822, 0.00002061515301792802, 0.00002041896291746754, 0.00002022295808385756, 0.00019149322296444857, 0.00017213113098321688, 0.00015303952038266312, 0.00013428681731560995, 0.00011595875832562997, 0.00009816276951517891, 0.00008103345355201003, 0.00006473946477386934, 0.00004949212355141017, 0.00007817871339750754, 
-0.00001955752365223623, 0.00001954220850182697, 0.00001952654403378027, 0.00001951052228063851, 0.00001949413509321725, 0.00001947737413646031, 0.00001946023088520028, 0.00001944269661982232, 0.00001942476242182911, 0.00001940641916930460, 0.00019295836747453446, 0.00019059769293804603, 0.00018763981693728851, 0.00018393365994672271, 0.00017928992246915367, 0.00017347141617935746, 0.00016618094904853235, 0.00015704614565769447, 0.00014560042736668849, 0.00042555467959164172, 
-0.00000148253688664676, 0.00000151635152566919, 0.00000155093743036636, 0.00000158631219225361, 0.00000162249380408470, 0.00000165950066900348, 0.00000169735160990435, 0.00000173606587900618, 0.00000177566316764466, 0.00000181616361628788, 0.00002060320844731518, 0.00002581539083975994, 0.00003234614676222454, 0.00004052904784040445, 0.00005078205237008657, 0.00006362885338617124, 0.00007972562734829011, 0.00009989454968647671, 0.00012516578908147014, 0.00138293697476300900, 
-0.00000144947631407454, 0.00000148253688664676, 0.00000151635152566919, 0.00000155093743036636, 0.00000158631219225361, 0.00000162249380408470, 0.00000165950066900348, 0.00000169735160990435, 0.00000173606587900618, 0.00000177566316764466, 0.00002014375689894005, 0.00002523970762403329, 0.00003162482768942693, 0.00003962525007356343, 0.00004964961260223364, 0.00006220992995565961, 0.00007794774585842326, 0.00009766690122846829, 0.00012237459198495334, 0.00139676148022579390, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002219086649348015, 0.00002199333550459257, 0.00002179595919872412, 0.00002159874110398293, 0.00002140168482894849, 0.00002120479406450699, 0.00002100807258572874, 0.00002081152425378822, 0.00002061515301792802, 0.00002041896291746754, 0.00019344210247594138, 0.00017405616768189112, 0.00015493468253372972, 0.00013614454728107182, 0.00011776958654256841, 0.00009991483081859043, 0.00008271188113740020, 0.00006632563084501205, 0.00005096268786781373, 0.00008247681566138314, 
-0.00001957249727479136, 0.00001955752365223623, 0.00001954220850182697, 0.00001952654403378027, 0.00001951052228063851, 0.00001949413509321725, 0.00001947737413646031, 0.00001946023088520028, 0.00001944269661982232, 0.00001942476242182911, 0.00019316645987985234, 0.00019085842838552762, 0.00018796651301958696, 0.00018434300332991079, 0.00017980282119809153, 0.00017411406759855781, 0.00016698617788475011, 0.00015805508060952789, 0.00014686460183641130, 0.00043952234303674812, 
-0.00000144947631407454, 0.00000148253688664676, 0.00000151635152566919, 0.00000155093743036636, 0.00000158631219225361, 0.00000162249380408470, 0.00000165950066900348, 0.00000169735160990435, 0.00000173606587900618, 0.00000177566316764466, 0.00002014375689894005, 0.00002523970762403329, 0.00003162482768942693, 0.00003962525007356343, 0.00004964961260223363, 0.00006220992995565963, 0.00007794774585842326, 0.00009766690122846829, 0.00012237459198495334, 0.00139676148022579390, 
-0.00000141715299227068, 0.00000144947631407454, 0.00000148253688664676, 0.00000151635152566919, 0.00000155093743036636, 0.00000158631219225361, 0.00000162249380408470, 0.00000165950066900348, 0.00000169735160990435, 0.00000173606587900618, 0.00001969455112009369, 0.00002467686214401735, 0.00003091959403195272, 0.00003874160699692297, 0.00004854242624120382, 0.00006082264851764842, 0.00007620951112578041, 0.00009548892933107345, 0.00011964563858368890, 0.00141027769921675860, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002238854871595555, 0.00002219086649348015, 0.00002199333550459257, 0.00002179595919872412, 0.00002159874110398293, 0.00002140168482894849, 0.00002120479406450699, 0.00002100807258572874, 0.00002081152425378822, 0.00002061515301792802, 0.00019539308372072792, 0.00017598383780858496, 0.00015683314431522754, 0.00013800641161470392, 0.00011958559503666915, 0.00010167338290133587, 0.00008439844153403618, 0.00006792198715916830, 0.00005244602034636148, 0.00008691599132605429, 
-0.00001958713698556351, 0.00001957249727479136, 0.00001955752365223623, 0.00001954220850182697, 0.00001952654403378027, 0.00001951052228063851, 0.00001949413509321725, 0.00001947737413646031, 0.00001946023088520028, 0.00001944269661982232, 0.00019336991182453164, 0.00019111334943253035, 0.00018828592377925017, 0.00018474321835565378, 0.00018030428228537411, 0.00017474238789110997, 0.00016777345011792017, 0.00015904151631193541, 0.00014810058521545934, 0.00045362963398702861, 
-0.00000141715299227068, 0.00000144947631407454, 0.00000148253688664676, 0.00000151635152566919, 0.00000155093743036636, 0.00000158631219225361, 0.00000162249380408470, 0.00000165950066900348, 0.00000169735160990435, 0.00000173606587900618, 0.00001969455112009369, 0.00002467686214401735, 0.00003091959403195272, 0.00003874160699692297, 0.00004854242624120383, 0.00006082264851764841, 0.00007620951112578041, 0.00009548892933107345, 0.00011964563858368888, 0.00141027769921675860, 
-0.00000138555048054304, 0.00000141715299227068, 0.00000144947631407454, 0.00000148253688664676, 0.00000151635152566919, 0.00000155093743036636, 0.00000158631219225361, 0.00000162249380408470, 0.00000165950066900348, 0.00000169735160990435, 0.00001925536263011560, 0.00002412656811820576, 0.00003023008708504017, 0.00003787766916089159, 0.00004745993013602498, 0.00005946630345570486, 0.00007451003902767550, 0.00009335952620699050, 0.00011697754084327263, 0.00142349250652422490, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002258637879950973, 0.00002238854871595555, 0.00002219086649348015, 0.00002199333550459257, 0.00002179595919872412, 0.00002159874110398293, 0.00002140168482894849, 0.00002120479406450699, 0.00002100807258572874, 0.00002081152425378822, 0.00019734611983015566, 0.00017791408263785353, 0.00015873483214539797, 0.00013987231812009605, 0.00012140666828775141, 0.00010343828101903608, 0.00008609295338022718, 0.00006952830647391884, 0.00005394183625703761, 0.00009149765062932328, 
-0.00001960145023078545, 0.00001958713698556351, 0.00001957249727479136, 0.00001955752365223623, 0.00001954220850182697, 0.00001952654403378027, 0.00001951052228063851, 0.00001949413509321725, 0.00001947737413646031, 0.00001946023088520028, 0.00019356882679084461, 0.00019136258574018491, 0.00018859821167897291, 0.00018513450858632268, 0.00018079456079041025, 0.00017535669664113824, 0.00016854316618029053, 0.00016000595449817926, 0.00014930900616515460, 0.00046787343874911787, 
-0.00000138555048054304, 0.00000141715299227068, 0.00000144947631407454, 0.00000148253688664676, 0.00000151635152566919, 0.00000155093743036636, 0.00000158631219225361, 0.00000162249380408470, 0.00000165950066900348, 0.00000169735160990435, 0.00001925536263011560, 0.00002412656811820576, 0.00003023008708504017, 0.00003787766916089159, 0.00004745993013602498, 0.00005946630345570486, 0.00007451003902767552, 0.00009335952620699051, 0.00011697754084327262, 0.00142349250652422490, 
-0.00000135465270482693, 0.00000138555048054304, 0.00000141715299227068, 0.00000144947631407454, 0.00000148253688664676, 0.00000151635152566919, 0.00000155093743036636, 0.00000158631219225361, 0.00000162249380408470, 0.00000165950066900348, 0.00001882596804346402, 0.00002358854564916977, 0.00002955595614304378, 0.00003703299713860371, 0.00004640157369399162, 0.00005814020488864264, 0.00007284846515735833, 0.00009127760877257463, 0.00011436894168246765, 0.00143641262362873460, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002278435344684067, 0.00002258637879950973, 0.00002238854871595555, 0.00002219086649348015, 0.00002199333550459257, 0.00002179595919872412, 0.00002159874110398293, 0.00002140168482894849, 0.00002120479406450699, 0.00002100807258572874, 0.00019930116498074316, 0.00017984684475382939, 0.00016063967408335559, 0.00014174217665681790, 0.00012323269335173459, 0.00010520938365511157, 0.00008779523935864812, 0.00007114436661435045, 0.00005544985721930568, 0.00009622317236068938, 
-0.00001961544429063893, 0.00001960145023078545, 0.00001958713698556351, 0.00001957249727479136, 0.00001955752365223623, 0.00001954220850182697, 0.00001952654403378027, 0.00001951052228063851, 0.00001949413509321725, 0.00001947737413646031, 0.00019376330595340877, 0.00019160626407817879, 0.00018890353555853185, 0.00018551707304484771, 0.00018127390608478410, 0.00017595730630604086, 0.00016929571757447003, 0.00016094888571286983, 0.00015049047932767166, 0.00048225071306501251, 
-0.00000135465270482693, 0.00000138555048054304, 0.00000141715299227068, 0.00000144947631407454, 0.00000148253688664676, 0.00000151635152566919, 0.00000155093743036636, 0.00000158631219225361, 0.00000162249380408470, 0.00000165950066900348, 0.00001882596804346402, 0.00002358854564916977, 0.00002955595614304378, 0.00003703299713860371, 0.00004640157369399163, 0.00005814020488864264, 0.00007284846515735836, 0.00009127760877257463, 0.00011436894168246765, 0.00143641262362873460, 
-0.00000132444394950929, 0.00000135465270482693, 0.00000138555048054304, 0.00000141715299227068, 0.00000144947631407454, 0.00000148253688664676, 0.00000151635152566919, 0.00000155093743036636, 0.00000158631219225361, 0.00000162249380408470, 0.00001840614895609477, 0.00002306252108119329, 0.00002889685832105390, 0.00003620716130241285, 0.00004536681860061561, 0.00005684367831962590, 0.00007122394438434925, 0.00008924211809694621, 0.00011181851428294862, 0.00144904462212181390, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002298246943417613, 0.00002278435344684067, 0.00002258637879950973, 0.00002238854871595555, 0.00002219086649348015, 0.00002199333550459257, 0.00002179595919872412, 0.00002159874110398293, 0.00002140168482894849, 0.00002120479406450699, 0.00020125817437087259, 0.00018178206802101901, 0.00016254759979249676, 0.00014361589909457086, 0.00012506355980319091, 0.00010698655244880259, 0.00008950512610615028, 0.00007276995036005043, 0.00005696981106051516, 0.00010109390456264599, 
-0.00001962912628295768, 0.00001961544429063893, 0.00001960145023078545, 0.00001958713698556351, 0.00001957249727479136, 0.00001955752365223623, 0.00001954220850182697, 0.00001952654403378027, 0.00001951052228063851, 0.00001949413509321725, 0.00019395344823064771, 0.00019184450838923540, 0.00018920205071557659, 0.00018589110631594760, 0.00018174256197909342, 0.00017654452237541617, 0.00017003148707255938, 0.00016187078956147284, 0.00015164560563866460, 0.00049675848056366279, 
-0.00000132444394950929, 0.00000135465270482693, 0.00000138555048054304, 0.00000141715299227068, 0.00000144947631407454, 0.00000148253688664676, 0.00000151635152566919, 0.00000155093743036636, 0.00000158631219225361, 0.00000162249380408470, 0.00001840614895609477, 0.00002306252108119329, 0.00002889685832105390, 0.00003620716130241285, 0.00004536681860061562, 0.00005684367831962590, 0.00007122394438434927, 0.00008924211809694621, 0.00011181851428294862, 0.00144904462212181390, 
-0.00000129490884943524, 0.00000132444394950929, 0.00000135465270482693, 0.00000138555048054304, 0.00000141715299227068, 0.00000144947631407454, 0.00000148253688664676, 0.00000151635152566919, 0.00000155093743036636, 0.00000158631219225361, 0.00001799569183437386, 0.00002254822686108268, 0.00002825245838049440, 0.00003539974160536904, 0.00004435513854582188, 0.00005557606429309825, 0.00006963565042457827, 0.00008725201886338431, 0.00010932496141443886, 0.00146139492704849760, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002318072360963400, 0.00002298246943417613, 0.00002278435344684067, 0.00002258637879950973, 0.00002238854871595555, 0.00002219086649348015, 0.00002199333550459257, 0.00002179595919872412, 0.00002159874110398293, 0.00002140168482894849, 0.00020321710419800214, 0.00018371969755575030, 0.00016445854050472407, 0.00014549339926836193, 0.00012689915967917977, 0.00010876965212479430, 0.00009122244412558313, 0.00007440484533462130, 0.00005850143167746567, 0.00010611116521633900, 
-0.00001964250316684773, 0.00001962912628295768, 0.00001961544429063893, 0.00001960145023078545, 0.00001958713698556351, 0.00001957249727479136, 0.00001955752365223623, 0.00001954220850182697, 0.00001952654403378027, 0.00001951052228063851, 0.00019413935033510429, 0.00019207743985215548, 0.00018949390898461923, 0.00018625679864510197, 0.00018220076684695964, 0.00017711864352644438, 0.00017075084891084131, 0.00016277213495425200, 0.00015277497263292239, 0.00051139383124709304, 
-0.00000129490884943524, 0.00000132444394950929, 0.00000135465270482693, 0.00000138555048054304, 0.00000141715299227068, 0.00000144947631407454, 0.00000148253688664676, 0.00000151635152566919, 0.00000155093743036636, 0.00000158631219225361, 0.00001799569183437386, 0.00002254822686108268, 0.00002825245838049440, 0.00003539974160536904, 0.00004435513854582189, 0.00005557606429309824, 0.00006963565042457827, 0.00008725201886338432, 0.00010932496141443886, 0.00146139492704849760, 
-0.00000126603238209283, 0.00000129490884943524, 0.00000132444394950929, 0.00000135465270482693, 0.00000138555048054304, 0.00000141715299227068, 0.00000144947631407454, 0.00000148253688664676, 0.00000151635152566919, 0.00000155093743036636, 0.00001759438790646732, 0.00002204540140208053, 0.00002762242855860937, 0.00003461032736756931, 0.00004336601895625005, 0.00005433671805936216, 0.00006808277542011018, 0.00008530629884273083, 0.00010688701477489688, 0.00147346982017531620, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002337911289161916, 0.00002318072360963400, 0.00002298246943417613, 0.00002278435344684067, 0.00002258637879950973, 0.00002238854871595555, 0.00002219086649348015, 0.00002199333550459257, 0.00002179595919872412, 0.00002159874110398293, 0.00020517791163638670, 0.00018565967969825706, 0.00016637242898546876, 0.00014737459293467746, 0.00012873938742433404, 0.00011055855042441137, 0.00009294702769958261, 0.00007604884389765926, 0.00006004445890105819, 0.00011127624291193462, 
-0.00001965558174622702, 0.00001964250316684773, 0.00001962912628295768, 0.00001961544429063893, 0.00001960145023078545, 0.00001958713698556351, 0.00001957249727479136, 0.00001955752365223623, 0.00001954220850182697, 0.00001952654403378027, 0.00019432110682263143, 0.00019230517694345239, 0.00018977925881426218, 0.00018661433603531623, 0.00018264875374627247, 0.00017767996177580465, 0.00017145416898012956, 0.00016365338034477218, 0.00015387915474320823, 0.00052615392001028271, 
-0.00000126603238209283, 0.00000129490884943524, 0.00000132444394950929, 0.00000135465270482693, 0.00000138555048054304, 0.00000141715299227068, 0.00000144947631407454, 0.00000148253688664676, 0.00000151635152566919, 0.00000155093743036636, 0.00001759438790646733, 0.00002204540140208053, 0.00002762242855860937, 0.00003461032736756931, 0.00004336601895625005, 0.00005433671805936216, 0.00006808277542011018, 0.00008530629884273083, 0.00010688701477489689, 0.00147346982017531620, 
-0.00000123779985997216, 0.00000126603238209283, 0.00000129490884943524, 0.00000132444394950929, 0.00000135465270482693, 0.00000138555048054304, 0.00000141715299227068, 0.00000144947631407454, 0.00000148253688664676, 0.00000151635152566919, 0.00001720203305615310, 0.00002155378895081414, 0.00002700644840175239, 0.00003383851706727251, 0.00004239895673352568, 0.00005312500924663838, 0.00006656452952824171, 0.00008340396837853794, 0.00010450343434541666, 0.00148527544318540640, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002357763426725605, 0.00002337911289161916, 0.00002318072360963400, 0.00002298246943417613, 0.00002278435344684067, 0.00002258637879950973, 0.00002238854871595555, 0.00002219086649348015, 0.00002199333550459257, 0.00002179595919872412, 0.00020714055481529524, 0.00018760196198538590, 0.00016828919949949279, 0.00014925939772863415, 0.00013058413983717141, 0.00011235311803834700, 0.00009467871480628190, 0.00007770174303914145, 0.00006159863836396458, 0.00011659039750403848, 
-0.00001966836867328616, 0.00001965558174622702, 0.00001964250316684773, 0.00001962912628295768, 0.00001961544429063893, 0.00001960145023078545, 0.00001958713698556351, 0.00001957249727479136, 0.00001955752365223623, 0.00001954220850182697, 0.00019449881014048677, 0.00019252783549761340, 0.00019005824534270414, 0.00018696390034172869, 0.00018308675053773057, 0.00017822876262820421, 0.00017214180501187265, 0.00016451497396308379, 0.00015495871359243464, 0.00054103596519405341, 
-0.00000123779985997216, 0.00000126603238209283, 0.00000129490884943524, 0.00000132444394950929, 0.00000135465270482693, 0.00000138555048054304, 0.00000141715299227068, 0.00000144947631407454, 0.00000148253688664676, 0.00000151635152566919, 0.00001720203305615310, 0.00002155378895081414, 0.00002700644840175238, 0.00003383851706727251, 0.00004239895673352568, 0.00005312500924663838, 0.00006656452952824173, 0.00008340396837853794, 0.00010450343434541669, 0.00148527544318540640, 
-0.00000121019692309478, 0.00000123779985997216, 0.00000126603238209283, 0.00000129490884943524, 0.00000132444394950929, 0.00000135465270482693, 0.00000138555048054304, 0.00000141715299227068, 0.00000144947631407454, 0.00000148253688664676, 0.00001681842771900088, 0.00002107313945721098, 0.00002640420460239330, 0.00003308391813667234, 0.00004145345999836806, 0.00005194032154043835, 0.00006508014051976193, 0.00008154405988369654, 0.00010217300775951388, 0.00149681780080237180, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002377628479085624, 0.00002357763426725605, 0.00002337911289161916, 0.00002318072360963400, 0.00002298246943417613, 0.00002278435344684067, 0.00002258637879950973, 0.00002238854871595555, 0.00002219086649348015, 0.00002199333550459257, 0.00020910499279771418, 0.00018954649312391181, 0.00017020878777745409, 0.00015114773312208560, 0.00013243331601760249, 0.00011415322854089186, 0.00009641734703690183, 0.00007936334427616860, 0.00006316372137124817, 0.00012205486075249843, 
-0.00001968087045187188, 0.00001966836867328616, 0.00001965558174622702, 0.00001964250316684773, 0.00001962912628295768, 0.00001961544429063893, 0.00001960145023078545, 0.00001958713698556351, 0.00001957249727479136, 0.00001955752365223623, 0.00019467255067435392, 0.00019274552876601665, 0.00019033101047156181, 0.00018730566936410814, 0.00018351498000073921, 0.00017876532522159523, 0.00017281410676010789, 0.00016535735404370701, 0.00015601419827932335, 0.00055603724717022602, 
-0.00000121019692309478, 0.00000123779985997216, 0.00000126603238209283, 0.00000129490884943524, 0.00000132444394950929, 0.00000135465270482693, 0.00000138555048054304, 0.00000141715299227068, 0.00000144947631407454, 0.00000148253688664676, 0.00001681842771900088, 0.00002107313945721098, 0.00002640420460239331, 0.00003308391813667234, 0.00004145345999836806, 0.00005194032154043835, 0.00006508014051976193, 0.00008154405988369654, 0.00010217300775951388, 0.00149681780080237180, 
-0.00000118320953170977, 0.00000121019692309478, 0.00000123779985997216, 0.00000126603238209283, 0.00000129490884943524, 0.00000132444394950929, 0.00000135465270482693, 0.00000138555048054304, 0.00000141715299227068, 0.00000144947631407454, 0.00001644337678086717, 0.00002060320844731518, 0.00002581539083975994, 0.00003234614676222454, 0.00004052904784040445, 0.00005078205237008657, 0.00006362885338617124, 0.00007972562734829011, 0.00009989454968647673, 0.00150810276384447910, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002397506158242015, 0.00002377628479085624, 0.00002357763426725605, 0.00002337911289161916, 0.00002318072360963400, 0.00002298246943417613, 0.00002278435344684067, 0.00002258637879950973, 0.00002238854871595555, 0.00002219086649348015, 0.00021107118555952514, 0.00019149322296444857, 0.00017213113098321688, 0.00015303952038266312, 0.00013428681731560995, 0.00011595875832562997, 0.00009816276951517891, 0.00008103345355201003, 0.00006473946477386934, 0.00012767083694891770, 
-0.00001969309344079514, 0.00001968087045187188, 0.00001966836867328616, 0.00001965558174622702, 0.00001964250316684773, 0.00001962912628295768, 0.00001961544429063893, 0.00001960145023078545, 0.00001958713698556351, 0.00001957249727479136, 0.00019484241679431583, 0.00019295836747453446, 0.00019059769293804603, 0.00018763981693728851, 0.00018393365994672271, 0.00017928992246915367, 0.00017347141617935746, 0.00016618094904853235, 0.00015704614565769447, 0.00057115510695833016, 
-0.00000118320953170977, 0.00000121019692309478, 0.00000123779985997216, 0.00000126603238209283, 0.00000129490884943524, 0.00000132444394950929, 0.00000135465270482693, 0.00000138555048054304, 0.00000141715299227068, 0.00000144947631407454, 0.00001644337678086717, 0.00002060320844731518, 0.00002581539083975994, 0.00003234614676222454, 0.00004052904784040445, 0.00005078205237008657, 0.00006362885338617124, 0.00007972562734829011, 0.00009989454968647671, 0.00150810276384447910, 
-0.00000115682395915264, 0.00000118320953170977, 0.00000121019692309478, 0.00000123779985997216, 0.00000126603238209283, 0.00000129490884943524, 0.00000132444394950929, 0.00000135465270482693, 0.00000138555048054304, 0.00000141715299227068, 0.00001607668947865383, 0.00002014375689894005, 0.00002523970762403329, 0.00003162482768942693, 0.00003962525007356343, 0.00004964961260223364, 0.00006220992995565961, 0.00007794774585842326, 0.00009766690122846829, 0.00151913607221074710, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002417396182617218, 0.00002397506158242015, 0.00002377628479085624, 0.00002357763426725605, 0.00002337911289161916, 0.00002318072360963400, 0.00002298246943417613, 0.00002278435344684067, 0.00002258637879950973, 0.00002238854871595555, 0.00021303909396914778, 0.00019344210247594138, 0.00017405616768189112, 0.00015493468253372972, 0.00013614454728107182, 0.00011776958654256841, 0.00009991483081859043, 0.00008271188113740020, 0.00006632563084501205, 0.00013343950352919686, 
-0.00001970504385706541, 0.00001969309344079514, 0.00001968087045187188, 0.00001966836867328616, 0.00001965558174622702, 0.00001964250316684773, 0.00001962912628295768, 0.00001961544429063893, 0.00001960145023078545, 0.00001958713698556351, 0.00019500849489980260, 0.00019316645987985234, 0.00019085842838552762, 0.00018796651301958696, 0.00018434300332991079, 0.00017980282119809153, 0.00017411406759855781, 0.00016698617788475011, 0.00015805508060952789, 0.00058638694487315936, 
-0.00000115682395915264, 0.00000118320953170977, 0.00000121019692309478, 0.00000123779985997216, 0.00000126603238209283, 0.00000129490884943524, 0.00000132444394950929, 0.00000135465270482693, 0.00000138555048054304, 0.00000141715299227068, 0.00001607668947865383, 0.00002014375689894005, 0.00002523970762403329, 0.00003162482768942693, 0.00003962525007356343, 0.00004964961260223363, 0.00006220992995565963, 0.00007794774585842326, 0.00009766690122846829, 0.00151913607221074710, 
-0.00000113102678486353, 0.00000115682395915264, 0.00000118320953170977, 0.00000121019692309478, 0.00000123779985997216, 0.00000126603238209283, 0.00000129490884943524, 0.00000132444394950929, 0.00000135465270482693, 0.00000138555048054304, 0.00001571817930327985, 0.00001969455112009369, 0.00002467686214401735, 0.00003091959403195272, 0.00003874160699692297, 0.00004854242624120382, 0.00006082264851764842, 0.00007620951112578041, 0.00009548892933107345, 0.00152992333780044740, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002437298276912854, 0.00002417396182617218, 0.00002397506158242015, 0.00002377628479085624, 0.00002357763426725605, 0.00002337911289161916, 0.00002318072360963400, 0.00002298246943417613, 0.00002278435344684067, 0.00002258637879950973, 0.00021500867976763575, 0.00019539308372072792, 0.00017598383780858496, 0.00015683314431522754, 0.00013800641161470392, 0.00011958559503666915, 0.00010167338290133587, 0.00008439844153403618, 0.00006792198715916830, 0.00013936201167241574, 
-0.00001971672777905285, 0.00001970504385706541, 0.00001969309344079514, 0.00001968087045187188, 0.00001966836867328616, 0.00001965558174622702, 0.00001964250316684773, 0.00001962912628295768, 0.00001961544429063893, 0.00001960145023078545, 0.00019517086946353702, 0.00019336991182453164, 0.00019111334943253035, 0.00018828592377925017, 0.00018474321835565378, 0.00018030428228537411, 0.00017474238789110997, 0.00016777345011792017, 0.00015904151631193541, 0.00060173021920248773, 
-0.00000113102678486354, 0.00000115682395915264, 0.00000118320953170977, 0.00000121019692309478, 0.00000123779985997216, 0.00000126603238209283, 0.00000129490884943524, 0.00000132444394950929, 0.00000135465270482693, 0.00000138555048054304, 0.00001571817930327985, 0.00001969455112009369, 0.00002467686214401735, 0.00003091959403195272, 0.00003874160699692297, 0.00004854242624120383, 0.00006082264851764841, 0.00007620951112578041, 0.00009548892933107345, 0.00152992333780044740, 
-0.00000110580488756108, 0.00000113102678486353, 0.00000115682395915264, 0.00000118320953170977, 0.00000121019692309478, 0.00000123779985997216, 0.00000126603238209283, 0.00000129490884943524, 0.00000132444394950929, 0.00000135465270482693, 0.00001536766390481671, 0.00001925536263011560, 0.00002412656811820576, 0.00003023008708504017, 0.00003787766916089159, 0.00004745993013602498, 0.00005946630345570486, 0.00007451003902767550, 0.00009335952620699050, 0.00154047004736749770, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002457212171969697, 0.00002437298276912854, 0.00002417396182617218, 0.00002397506158242015, 0.00002377628479085624, 0.00002357763426725605, 0.00002337911289161916, 0.00002318072360963400, 0.00002298246943417613, 0.00002278435344684067, 0.00021697990554921752, 0.00019734611983015566, 0.00017791408263785353, 0.00015873483214539797, 0.00013987231812009605, 0.00012140666828775141, 0.00010343828101903608, 0.00008609295338022718, 0.00006952830647391884, 0.00014543948688636090, 
-0.00001972815114957997, 0.00001971672777905285, 0.00001970504385706541, 0.00001969309344079514, 0.00001968087045187188, 0.00001966836867328616, 0.00001965558174622702, 0.00001964250316684773, 0.00001962912628295768, 0.00001961544429063893, 0.00019532962307450014, 0.00019356882679084461, 0.00019136258574018491, 0.00018859821167897291, 0.00018513450858632268, 0.00018079456079041025, 0.00017535669664113824, 0.00016854316618029053, 0.00016000595449817926, 0.00061718244491427228, 
-0.00000110580488756108, 0.00000113102678486354, 0.00000115682395915264, 0.00000118320953170977, 0.00000121019692309478, 0.00000123779985997216, 0.00000126603238209283, 0.00000129490884943524, 0.00000132444394950929, 0.00000135465270482693, 0.00001536766390481671, 0.00001925536263011560, 0.00002412656811820576, 0.00003023008708504017, 0.00003787766916089159, 0.00004745993013602498, 0.00005946630345570486, 0.00007451003902767552, 0.00009335952620699051, 0.00154047004736749770, 
-0.00000108114543856847, 0.00000110580488756108, 0.00000113102678486353, 0.00000115682395915264, 0.00000118320953170977, 0.00000121019692309478, 0.00000123779985997216, 0.00000126603238209283, 0.00000129490884943524, 0.00000132444394950929, 0.00001502496499973929, 0.00001882596804346402, 0.00002358854564916977, 0.00002955595614304378, 0.00003703299713860371, 0.00004640157369399162, 0.00005814020488864264, 0.00007284846515735833, 0.00009127760877257463, 0.00155078156531120240, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002477137604630773, 0.00002457212171969697, 0.00002437298276912854, 0.00002417396182617218, 0.00002397506158242015, 0.00002377628479085624, 0.00002357763426725605, 0.00002337911289161916, 0.00002318072360963400, 0.00002298246943417613, 0.00021895273474226991, 0.00019930116498074316, 0.00017984684475382939, 0.00016063967408335559, 0.00014174217665681790, 0.00012323269335173459, 0.00010520938365511157, 0.00008779523935864812, 0.00007114436661435045, 0.00015167302957999504, 
-0.00001973931977894433, 0.00001972815114957997, 0.00001971672777905285, 0.00001970504385706541, 0.00001969309344079514, 0.00001968087045187188, 0.00001966836867328616, 0.00001965558174622702, 0.00001964250316684773, 0.00001962912628295768, 0.00019548483647993876, 0.00019376330595340877, 0.00019160626407817879, 0.00018890353555853185, 0.00018551707304484771, 0.00018127390608478410, 0.00017595730630604086, 0.00016929571757447003, 0.00016094888571286983, 0.00063274119239268417, 
-0.00000108114543856847, 0.00000110580488756108, 0.00000113102678486354, 0.00000115682395915264, 0.00000118320953170977, 0.00000121019692309478, 0.00000123779985997216, 0.00000126603238209283, 0.00000129490884943524, 0.00000132444394950929, 0.00001502496499973930, 0.00001882596804346402, 0.00002358854564916977, 0.00002955595614304378, 0.00003703299713860371, 0.00004640157369399163, 0.00005814020488864264, 0.00007284846515735836, 0.00009127760877257463, 0.00155078156531120240, 
-0.00000105703589528839, 0.00000108114543856847, 0.00000110580488756108, 0.00000113102678486353, 0.00000115682395915264, 0.00000118320953170977, 0.00000121019692309478, 0.00000123779985997216, 0.00000126603238209283, 0.00000129490884943524, 0.00001468990828024511, 0.00001840614895609477, 0.00002306252108119329, 0.00002889685832105390, 0.00003620716130241285, 0.00004536681860061561, 0.00005684367831962590, 0.00007122394438434925, 0.00008924211809694621, 0.00156086313640476270, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002497074317607507, 0.00002477137604630773, 0.00002457212171969697, 0.00002437298276912854, 0.00002417396182617218, 0.00002397506158242015, 0.00002377628479085624, 0.00002357763426725605, 0.00002337911289161916, 0.00002318072360963400, 0.00022092713159071732, 0.00020125817437087259, 0.00018178206802101901, 0.00016254759979249676, 0.00014361589909457086, 0.00012506355980319091, 0.00010698655244880259, 0.00008950512610615028, 0.00007276995036005043, 0.00015806371562316113, 
-0.00001975023934787388, 0.00001973931977894433, 0.00001972815114957997, 0.00001971672777905285, 0.00001970504385706541, 0.00001969309344079514, 0.00001968087045187188, 0.00001966836867328616, 0.00001965558174622702, 0.00001964250316684773, 0.00019563658862643612, 0.00019395344823064771, 0.00019184450838923540, 0.00018920205071557659, 0.00018589110631594760, 0.00018174256197909342, 0.00017654452237541617, 0.00017003148707255938, 0.00016187078956147284, 0.00064840408620232728, 
-0.00000105703589528839, 0.00000108114543856847, 0.00000110580488756108, 0.00000113102678486354, 0.00000115682395915264, 0.00000118320953170977, 0.00000121019692309478, 0.00000123779985997216, 0.00000126603238209283, 0.00000129490884943524, 0.00001468990828024511, 0.00001840614895609477, 0.00002306252108119329, 0.00002889685832105390, 0.00003620716130241285, 0.00004536681860061562, 0.00005684367831962590, 0.00007122394438434927, 0.00008924211809694621, 0.00156086313640476270, 
-0.00000103346399482346, 0.00000105703589528839, 0.00000108114543856847, 0.00000110580488756108, 0.00000113102678486353, 0.00000115682395915264, 0.00000118320953170977, 0.00000121019692309478, 0.00000123779985997216, 0.00000126603238209283, 0.00001436232332559564, 0.00001799569183437386, 0.00002254822686108268, 0.00002825245838049440, 0.00003539974160536904, 0.00004435513854582188, 0.00005557606429309825, 0.00006963565042457827, 0.00008725201886338431, 0.00157071988846293620, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002517022059348860, 0.00002497074317607507, 0.00002477137604630773, 0.00002457212171969697, 0.00002437298276912854, 0.00002417396182617218, 0.00002397506158242015, 0.00002377628479085624, 0.00002357763426725605, 0.00002337911289161916, 0.00022290306113584432, 0.00020321710419800214, 0.00018371969755575030, 0.00016445854050472407, 0.00014549339926836193, 0.00012689915967917977, 0.00010876965212479430, 0.00009122244412558313, 0.00007440484533462130, 0.00016461259689380466, 
-0.00001976091541041629, 0.00001975023934787388, 0.00001973931977894433, 0.00001972815114957997, 0.00001971672777905285, 0.00001970504385706541, 0.00001969309344079514, 0.00001968087045187188, 0.00001966836867328616, 0.00001965558174622702, 0.00019578495670006664, 0.00019413935033510429, 0.00019207743985215548, 0.00018949390898461923, 0.00018625679864510197, 0.00018220076684695964, 0.00017711864352644438, 0.00017075084891084131, 0.00016277213495425200, 0.00066416880388001543, 
-0.00000103346399482346, 0.00000105703589528839, 0.00000108114543856847, 0.00000110580488756108, 0.00000113102678486354, 0.00000115682395915264, 0.00000118320953170977, 0.00000121019692309478, 0.00000123779985997216, 0.00000126603238209283, 0.00001436232332559564, 0.00001799569183437386, 0.00002254822686108268, 0.00002825245838049440, 0.00003539974160536904, 0.00004435513854582189, 0.00005557606429309824, 0.00006963565042457827, 0.00008725201886338432, 0.00157071988846293620, 
-0.00000101041774773890, 0.00000103346399482346, 0.00000105703589528839, 0.00000108114543856847, 0.00000110580488756108, 0.00000113102678486353, 0.00000115682395915264, 0.00000118320953170977, 0.00000121019692309478, 0.00000123779985997216, 0.00001404204351543486, 0.00001759438790646732, 0.00002204540140208053, 0.00002762242855860937, 0.00003461032736756931, 0.00004336601895625005, 0.00005433671805936216, 0.00006808277542011018, 0.00008530629884273083, 0.00158035683495021270, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002536980583913380, 0.00002517022059348860, 0.00002497074317607507, 0.00002477137604630773, 0.00002457212171969697, 0.00002437298276912854, 0.00002417396182617218, 0.00002397506158242015, 0.00002377628479085624, 0.00002357763426725605, 0.00022488048919851503, 0.00020517791163638670, 0.00018565967969825706, 0.00016637242898546876, 0.00014737459293467746, 0.00012873938742433404, 0.00011055855042441137, 0.00009294702769958261, 0.00007604884389765926, 0.00017132070181299285, 
-0.00001977135339676401, 0.00001976091541041629, 0.00001975023934787388, 0.00001973931977894433, 0.00001972815114957997, 0.00001971672777905285, 0.00001970504385706541, 0.00001969309344079514, 0.00001968087045187188, 0.00001966836867328616, 0.00019593001616565516, 0.00019432110682263143, 0.00019230517694345239, 0.00018977925881426218, 0.00018661433603531623, 0.00018264875374627247, 0.00017767996177580465, 0.00017145416898012956, 0.00016365338034477218, 0.00068003307475349108, 
-0.00000101041774773890, 0.00000103346399482346, 0.00000105703589528839, 0.00000108114543856847, 0.00000110580488756108, 0.00000113102678486354, 0.00000115682395915264, 0.00000118320953170977, 0.00000121019692309478, 0.00000123779985997216, 0.00001404204351543486, 0.00001759438790646733, 0.00002204540140208053, 0.00002762242855860937, 0.00003461032736756931, 0.00004336601895625005, 0.00005433671805936216, 0.00006808277542011018, 0.00008530629884273083, 0.00158035683495021270, 
-0.00000098788543196432, 0.00000101041774773890, 0.00000103346399482346, 0.00000105703589528839, 0.00000108114543856847, 0.00000110580488756108, 0.00000113102678486353, 0.00000115682395915264, 0.00000118320953170977, 0.00000121019692309478, 0.00001372890594504066, 0.00001720203305615310, 0.00002155378895081414, 0.00002700644840175239, 0.00003383851706727251, 0.00004239895673352568, 0.00005312500924663838, 0.00006656452952824171, 0.00008340396837853794, 0.00158977887753082300, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002556949650844112, 0.00002536980583913380, 0.00002517022059348860, 0.00002497074317607507, 0.00002477137604630773, 0.00002457212171969697, 0.00002437298276912854, 0.00002417396182617218, 0.00002397506158242015, 0.00002377628479085624, 0.00022685938236178816, 0.00020714055481529524, 0.00018760196198538590, 0.00016828919949949279, 0.00014925939772863415, 0.00013058413983717141, 0.00011235311803834700, 0.00009467871480628190, 0.00007770174303914145, 0.00017818903586800310, 
-0.00001978155861601618, 0.00001977135339676401, 0.00001976091541041629, 0.00001975023934787388, 0.00001973931977894433, 0.00001972815114957997, 0.00001971672777905285, 0.00001970504385706541, 0.00001969309344079514, 0.00001968087045187188, 0.00019607184080516104, 0.00019449881014048677, 0.00019252783549761340, 0.00019005824534270414, 0.00018696390034172869, 0.00018308675053773057, 0.00017822876262820421, 0.00017214180501187265, 0.00016451497396308379, 0.00069599467878648830, 
-0.00000098788543196432, 0.00000101041774773890, 0.00000103346399482346, 0.00000105703589528839, 0.00000108114543856847, 0.00000110580488756108, 0.00000113102678486354, 0.00000115682395915264, 0.00000118320953170977, 0.00000121019692309478, 0.00001372890594504066, 0.00001720203305615310, 0.00002155378895081414, 0.00002700644840175238, 0.00003383851706727251, 0.00004239895673352568, 0.00005312500924663838, 0.00006656452952824173, 0.00008340396837853794, 0.00158977887753082300, 
-0.00000096585558683151, 0.00000098788543196432, 0.00000101041774773890, 0.00000103346399482346, 0.00000105703589528839, 0.00000108114543856847, 0.00000110580488756108, 0.00000113102678486353, 0.00000115682395915264, 0.00000118320953170977, 0.00001342275134246626, 0.00001681842771900088, 0.00002107313945721098, 0.00002640420460239330, 0.00003308391813667234, 0.00004145345999836806, 0.00005194032154043835, 0.00006508014051976193, 0.00008154405988369654, 0.00159899080856188590, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002576929025046288, 0.00002556949650844112, 0.00002536980583913380, 0.00002517022059348860, 0.00002497074317607507, 0.00002477137604630773, 0.00002457212171969697, 0.00002437298276912854, 0.00002417396182617218, 0.00002397506158242015, 0.00022883970795392028, 0.00020910499279771418, 0.00018954649312391181, 0.00017020878777745409, 0.00015114773312208560, 0.00013243331601760249, 0.00011415322854089186, 0.00009641734703690183, 0.00007936334427616860, 0.00018521858212374663, 
-0.00001979153625887901, 0.00001978155861601618, 0.00001977135339676401, 0.00001976091541041629, 0.00001975023934787388, 0.00001973931977894433, 0.00001972815114957997, 0.00001971672777905285, 0.00001970504385706541, 0.00001969309344079514, 0.00019621050275520595, 0.00019467255067435392, 0.00019274552876601665, 0.00019033101047156181, 0.00018730566936410814, 0.00018351498000073921, 0.00017876532522159523, 0.00017281410676010789, 0.00016535735404370701, 0.00071205144544954965, 
-0.00000096585558683151, 0.00000098788543196432, 0.00000101041774773890, 0.00000103346399482346, 0.00000105703589528839, 0.00000108114543856847, 0.00000110580488756108, 0.00000113102678486354, 0.00000115682395915264, 0.00000118320953170977, 0.00001342275134246626, 0.00001681842771900088, 0.00002107313945721098, 0.00002640420460239331, 0.00003308391813667234, 0.00004145345999836806, 0.00005194032154043835, 0.00006508014051976193, 0.00008154405988369654, 0.00159899080856188590, 
-0.00000094431700724517, 0.00000096585558683151, 0.00000098788543196432, 0.00000101041774773890, 0.00000103346399482346, 0.00000105703589528839, 0.00000108114543856847, 0.00000110580488756108, 0.00000113102678486353, 0.00000115682395915264, 0.00001312342398752926, 0.00001644337678086717, 0.00002060320844731518, 0.00002581539083975994, 0.00003234614676222454, 0.00004052904784040445, 0.00005078205237008657, 0.00006362885338617124, 0.00007972562734829011, 0.00160799731353095570, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002596918476667756, 0.00002576929025046288, 0.00002556949650844112, 0.00002536980583913380, 0.00002517022059348860, 0.00002497074317607507, 0.00002477137604630773, 0.00002457212171969697, 0.00002437298276912854, 0.00002417396182617218, 0.00023082143403174783, 0.00021107118555952514, 0.00019149322296444857, 0.00017213113098321688, 0.00015303952038266312, 0.00013428681731560995, 0.00011595875832562997, 0.00009816276951517891, 0.00008103345355201003, 0.00019241030172278701, 
-0.00001980129140030601, 0.00001979153625887901, 0.00001978155861601618, 0.00001977135339676401, 0.00001976091541041629, 0.00001975023934787388, 0.00001973931977894433, 0.00001972815114957997, 0.00001971672777905285, 0.00001970504385706541, 0.00019634607254376485, 0.00019484241679431583, 0.00019295836747453446, 0.00019059769293804603, 0.00018763981693728851, 0.00018393365994672271, 0.00017928992246915367, 0.00017347141617935746, 0.00016618094904853235, 0.00072820125261602482, 
-0.00000094431700724517, 0.00000096585558683151, 0.00000098788543196432, 0.00000101041774773890, 0.00000103346399482346, 0.00000105703589528839, 0.00000108114543856847, 0.00000110580488756108, 0.00000113102678486354, 0.00000115682395915264, 0.00001312342398752926, 0.00001644337678086717, 0.00002060320844731518, 0.00002581539083975994, 0.00003234614676222454, 0.00004052904784040445, 0.00005078205237008657, 0.00006362885338617124, 0.00007972562734829011, 0.00160799731353095570, 
-0.00000092325873798360, 0.00000094431700724517, 0.00000096585558683151, 0.00000098788543196432, 0.00000101041774773890, 0.00000103346399482346, 0.00000105703589528839, 0.00000108114543856847, 0.00000110580488756108, 0.00000113102678486353, 0.00001283077163260736, 0.00001607668947865383, 0.00002014375689894005, 0.00002523970762403329, 0.00003162482768942693, 0.00003962525007356343, 0.00004964961260223364, 0.00006220992995565961, 0.00007794774585842326, 0.00161680297343921540, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002616917780982065, 0.00002596918476667756, 0.00002576929025046288, 0.00002556949650844112, 0.00002536980583913380, 0.00002517022059348860, 0.00002497074317607507, 0.00002477137604630773, 0.00002457212171969697, 0.00002437298276912854, 0.00023280452936443987, 0.00021303909396914778, 0.00019344210247594138, 0.00017405616768189112, 0.00015493468253372972, 0.00013614454728107182, 0.00011776958654256841, 0.00009991483081859043, 0.00008271188113740020, 0.00019976513437420889, 
-0.00001981082900207919, 0.00001980129140030601, 0.00001979153625887901, 0.00001978155861601618, 0.00001977135339676401, 0.00001976091541041629, 0.00001975023934787388, 0.00001973931977894433, 0.00001972815114957997, 0.00001971672777905285, 0.00019647861912603889, 0.00019500849489980260, 0.00019316645987985234, 0.00019085842838552762, 0.00018796651301958696, 0.00018434300332991079, 0.00017980282119809153, 0.00017411406759855781, 0.00016698617788475011, 0.00074444202548268736, 
-0.00000092325873798360, 0.00000094431700724517, 0.00000096585558683151, 0.00000098788543196432, 0.00000101041774773890, 0.00000103346399482346, 0.00000105703589528839, 0.00000108114543856847, 0.00000110580488756108, 0.00000113102678486354, 0.00001283077163260736, 0.00001607668947865383, 0.00002014375689894005, 0.00002523970762403329, 0.00003162482768942693, 0.00003962525007356343, 0.00004964961260223363, 0.00006220992995565963, 0.00007794774585842326, 0.00161680297343921540, 
-0.00000090267006812657, 0.00000092325873798360, 0.00000094431700724517, 0.00000096585558683151, 0.00000098788543196432, 0.00000101041774773890, 0.00000103346399482346, 0.00000105703589528839, 0.00000108114543856847, 0.00000110580488756108, 0.00001254464542520021, 0.00001571817930327985, 0.00001969455112009369, 0.00002467686214401735, 0.00003091959403195272, 0.00003874160699692297, 0.00004854242624120382, 0.00006082264851764842, 0.00007620951112578041, 0.00162541226713152080, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002636926718274164, 0.00002616917780982065, 0.00002596918476667756, 0.00002576929025046288, 0.00002556949650844112, 0.00002536980583913380, 0.00002517022059348860, 0.00002497074317607507, 0.00002477137604630773, 0.00002457212171969697, 0.00023478896341761287, 0.00021500867976763575, 0.00019539308372072792, 0.00017598383780858496, 0.00015683314431522754, 0.00013800641161470392, 0.00011958559503666915, 0.00010167338290133587, 0.00008439844153403618, 0.00020728399883158407, 
-0.00001982015391533282, 0.00001981082900207919, 0.00001980129140030601, 0.00001979153625887901, 0.00001978155861601618, 0.00001977135339676401, 0.00001976091541041629, 0.00001975023934787388, 0.00001973931977894433, 0.00001972815114957997, 0.00019660820991952824, 0.00019517086946353702, 0.00019336991182453164, 0.00019111334943253035, 0.00018828592377925017, 0.00018474321835565378, 0.00018030428228537411, 0.00017474238789110997, 0.00016777345011792017, 0.00076077173551442349, 
-0.00000090267006812657, 0.00000092325873798360, 0.00000094431700724517, 0.00000096585558683151, 0.00000098788543196432, 0.00000101041774773890, 0.00000103346399482346, 0.00000105703589528839, 0.00000108114543856847, 0.00000110580488756108, 0.00001254464542520021, 0.00001571817930327985, 0.00001969455112009369, 0.00002467686214401735, 0.00003091959403195272, 0.00003874160699692297, 0.00004854242624120383, 0.00006082264851764841, 0.00007620951112578041, 0.00162541226713152080, 
-0.00000088254052560735, 0.00000090267006812657, 0.00000092325873798360, 0.00000094431700724517, 0.00000096585558683151, 0.00000098788543196432, 0.00000101041774773890, 0.00000103346399482346, 0.00000105703589528839, 0.00000108114543856847, 0.00001226489983221825, 0.00001536766390481671, 0.00001925536263011560, 0.00002412656811820576, 0.00003023008708504017, 0.00003787766916089159, 0.00004745993013602498, 0.00005946630345570486, 0.00007451003902767550, 0.00163382957357448790, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002656945073728650, 0.00002636926718274164, 0.00002616917780982065, 0.00002596918476667756, 0.00002576929025046288, 0.00002556949650844112, 0.00002536980583913380, 0.00002517022059348860, 0.00002497074317607507, 0.00002477137604630773, 0.00023677470633780011, 0.00021697990554921752, 0.00019734611983015566, 0.00017791408263785353, 0.00015873483214539797, 0.00013987231812009605, 0.00012140666828775141, 0.00010343828101903608, 0.00008609295338022718, 0.00021496779336027975, 
-0.00001982927088302090, 0.00001982015391533282, 0.00001981082900207919, 0.00001980129140030601, 0.00001979153625887901, 0.00001978155861601618, 0.00001977135339676401, 0.00001976091541041629, 0.00001975023934787388, 0.00001973931977894433, 0.00019673491083832276, 0.00019532962307450014, 0.00019356882679084461, 0.00019136258574018491, 0.00018859821167897291, 0.00018513450858632268, 0.00018079456079041025, 0.00017535669664113824, 0.00016854316618029053, 0.00077718839941245184, 
-0.00000088254052560735, 0.00000090267006812657, 0.00000092325873798360, 0.00000094431700724517, 0.00000096585558683151, 0.00000098788543196432, 0.00000101041774773890, 0.00000103346399482346, 0.00000105703589528839, 0.00000108114543856847, 0.00001226489983221825, 0.00001536766390481671, 0.00001925536263011560, 0.00002412656811820576, 0.00003023008708504017, 0.00003787766916089159, 0.00004745993013602498, 0.00005946630345570486, 0.00007451003902767552, 0.00163382957357448790, 
-0.00000086285987188630, 0.00000088254052560735, 0.00000090267006812657, 0.00000092325873798360, 0.00000094431700724517, 0.00000096585558683151, 0.00000098788543196432, 0.00000101041774773890, 0.00000103346399482346, 0.00000105703589528839, 0.00001199139256595978, 0.00001502496499973929, 0.00001882596804346402, 0.00002358854564916977, 0.00002955595614304378, 0.00003703299713860371, 0.00004640157369399162, 0.00005814020488864264, 0.00007284846515735833, 0.00164205917408377710, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002676972637320502, 0.00002656945073728650, 0.00002636926718274164, 0.00002616917780982065, 0.00002596918476667756, 0.00002576929025046288, 0.00002556949650844112, 0.00002536980583913380, 0.00002517022059348860, 0.00002497074317607507, 0.00023876172893726717, 0.00021895273474226991, 0.00019930116498074316, 0.00017984684475382939, 0.00016063967408335559, 0.00014174217665681790, 0.00012323269335173459, 0.00010520938365511157, 0.00008779523935864812, 0.00022281739619434544, 
-0.00001983818454232953, 0.00001982927088302090, 0.00001982015391533282, 0.00001981082900207919, 0.00001980129140030601, 0.00001979153625887901, 0.00001978155861601618, 0.00001977135339676401, 0.00001976091541041629, 0.00001975023934787388, 0.00019685878632662819, 0.00019548483647993876, 0.00019376330595340877, 0.00019160626407817879, 0.00018890353555853185, 0.00018551707304484771, 0.00018127390608478410, 0.00017595730630604086, 0.00016929571757447003, 0.00079369007810555403, 
-0.00000086285987188630, 0.00000088254052560735, 0.00000090267006812657, 0.00000092325873798360, 0.00000094431700724517, 0.00000096585558683151, 0.00000098788543196432, 0.00000101041774773890, 0.00000103346399482346, 0.00000105703589528839, 0.00001199139256595978, 0.00001502496499973930, 0.00001882596804346402, 0.00002358854564916977, 0.00002955595614304378, 0.00003703299713860371, 0.00004640157369399163, 0.00005814020488864264, 0.00007284846515735836, 0.00164205917408377710, 
-0.00000084361809674324, 0.00000086285987188630, 0.00000088254052560735, 0.00000090267006812657, 0.00000092325873798360, 0.00000094431700724517, 0.00000096585558683151, 0.00000098788543196432, 0.00000101041774773890, 0.00000103346399482346, 0.00001172398451173888, 0.00001468990828024511, 0.00001840614895609477, 0.00002306252108119329, 0.00002889685832105390, 0.00003620716130241285, 0.00004536681860061561, 0.00005684367831962590, 0.00007122394438434925, 0.00165010525450170880, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002697009203708255, 0.00002676972637320502, 0.00002656945073728650, 0.00002636926718274164, 0.00002616917780982065, 0.00002596918476667756, 0.00002576929025046288, 0.00002556949650844112, 0.00002536980583913380, 0.00002517022059348860, 0.00024075000267916610, 0.00022092713159071732, 0.00020125817437087259, 0.00018178206802101901, 0.00016254759979249676, 0.00014361589909457086, 0.00012506355980319091, 0.00010698655244880259, 0.00008950512610615028, 0.00023083366598321156, 
-0.00001984689942703558, 0.00001983818454232953, 0.00001982927088302090, 0.00001982015391533282, 0.00001981082900207919, 0.00001980129140030601, 0.00001979153625887901, 0.00001978155861601618, 0.00001977135339676401, 0.00001976091541041629, 0.00019697989939154435, 0.00019563658862643612, 0.00019395344823064771, 0.00019184450838923540, 0.00018920205071557659, 0.00018589110631594760, 0.00018174256197909342, 0.00017654452237541617, 0.00017003148707255938, 0.00081027487576380028, 
-0.00000084361809674324, 0.00000086285987188630, 0.00000088254052560735, 0.00000090267006812657, 0.00000092325873798360, 0.00000094431700724517, 0.00000096585558683151, 0.00000098788543196432, 0.00000101041774773890, 0.00000103346399482346, 0.00001172398451173888, 0.00001468990828024511, 0.00001840614895609477, 0.00002306252108119329, 0.00002889685832105390, 0.00003620716130241285, 0.00004536681860061562, 0.00005684367831962590, 0.00007122394438434927, 0.00165010525450170880, 
-0.00000082480541318586, 0.00000084361809674324, 0.00000086285987188630, 0.00000088254052560735, 0.00000090267006812657, 0.00000092325873798360, 0.00000094431700724517, 0.00000096585558683151, 0.00000098788543196432, 0.00000101041774773890, 0.00001146253965712710, 0.00001436232332559564, 0.00001799569183437386, 0.00002254822686108268, 0.00002825245838049440, 0.00003539974160536904, 0.00004435513854582188, 0.00005557606429309825, 0.00006963565042457827, 0.00165797190732632090, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002717054572129561, 0.00002697009203708255, 0.00002676972637320502, 0.00002656945073728650, 0.00002636926718274164, 0.00002616917780982065, 0.00002596918476667756, 0.00002576929025046288, 0.00002556949650844112, 0.00002536980583913380, 0.00024273949966302071, 0.00022290306113584432, 0.00020321710419800214, 0.00018371969755575030, 0.00016445854050472407, 0.00014549339926836193, 0.00012689915967917977, 0.00010876965212479430, 0.00009122244412558313, 0.00023901744222842598, 
-0.00001985541996981269, 0.00001984689942703558, 0.00001983818454232953, 0.00001982927088302090, 0.00001982015391533282, 0.00001981082900207919, 0.00001980129140030601, 0.00001979153625887901, 0.00001978155861601618, 0.00001977135339676401, 0.00019709831163511291, 0.00019578495670006664, 0.00019413935033510429, 0.00019207743985215548, 0.00018949390898461923, 0.00018625679864510197, 0.00018220076684695964, 0.00017711864352644438, 0.00017075084891084131, 0.00082694093883426756, 
-0.00000082480541318586, 0.00000084361809674324, 0.00000086285987188630, 0.00000088254052560735, 0.00000090267006812657, 0.00000092325873798360, 0.00000094431700724517, 0.00000096585558683151, 0.00000098788543196432, 0.00000101041774773890, 0.00001146253965712710, 0.00001436232332559564, 0.00001799569183437386, 0.00002254822686108268, 0.00002825245838049440, 0.00003539974160536904, 0.00004435513854582189, 0.00005557606429309824, 0.00006963565042457827, 0.00165797190732632090, 
-0.00000080641225247182, 0.00000082480541318586, 0.00000084361809674324, 0.00000086285987188630, 0.00000088254052560735, 0.00000090267006812657, 0.00000092325873798360, 0.00000094431700724517, 0.00000096585558683151, 0.00000098788543196432, 0.00001120692502277317, 0.00001404204351543486, 0.00001759438790646732, 0.00002204540140208053, 0.00002762242855860937, 0.00003461032736756931, 0.00004336601895625005, 0.00005433671805936216, 0.00006808277542011018, 0.00166566313379294390, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002737108546299072, 0.00002717054572129561, 0.00002697009203708255, 0.00002676972637320502, 0.00002656945073728650, 0.00002636926718274164, 0.00002616917780982065, 0.00002596918476667756, 0.00002576929025046288, 0.00002556949650844112, 0.00024473019261053535, 0.00022488048919851503, 0.00020517791163638670, 0.00018565967969825706, 0.00016637242898546876, 0.00014737459293467746, 0.00012873938742433404, 0.00011055855042441137, 0.00009294702769958261, 0.00024736954571065206, 
-0.00001986375050448587, 0.00001985541996981269, 0.00001984689942703558, 0.00001983818454232953, 0.00001982927088302090, 0.00001982015391533282, 0.00001981082900207919, 0.00001980129140030601, 0.00001979153625887901, 0.00001978155861601618, 0.00019721408328564989, 0.00019593001616565516, 0.00019432110682263143, 0.00019230517694345239, 0.00018977925881426218, 0.00018661433603531623, 0.00018264875374627247, 0.00017767996177580465, 0.00017145416898012956, 0.00084368645509826329, 
-0.00000080641225247182, 0.00000082480541318586, 0.00000084361809674324, 0.00000086285987188630, 0.00000088254052560735, 0.00000090267006812657, 0.00000092325873798360, 0.00000094431700724517, 0.00000096585558683151, 0.00000098788543196432, 0.00001120692502277317, 0.00001404204351543486, 0.00001759438790646733, 0.00002204540140208053, 0.00002762242855860937, 0.00003461032736756931, 0.00004336601895625005, 0.00005433671805936216, 0.00006808277542011018, 0.00166566313379294390, 
-0.00000078842925924170, 0.00000080641225247182, 0.00000082480541318586, 0.00000084361809674324, 0.00000086285987188630, 0.00000088254052560735, 0.00000090267006812657, 0.00000092325873798360, 0.00000094431700724517, 0.00000096585558683151, 0.00001095701059476532, 0.00001372890594504066, 0.00001720203305615310, 0.00002155378895081414, 0.00002700644840175239, 0.00003383851706727251, 0.00004239895673352568, 0.00005312500924663838, 0.00006656452952824171, 0.00167318284590936110, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002757170934308603, 0.00002737108546299072, 0.00002717054572129561, 0.00002697009203708255, 0.00002676972637320502, 0.00002656945073728650, 0.00002636926718274164, 0.00002616917780982065, 0.00002596918476667756, 0.00002576929025046288, 0.00024672205485172039, 0.00022685938236178816, 0.00020714055481529524, 0.00018760196198538590, 0.00016828919949949279, 0.00014925939772863415, 0.00013058413983717141, 0.00011235311803834700, 0.00009467871480628190, 0.00025589077890714456, 
-0.00001987189526823583, 0.00001986375050448587, 0.00001985541996981269, 0.00001984689942703558, 0.00001983818454232953, 0.00001982927088302090, 0.00001982015391533282, 0.00001981082900207919, 0.00001980129140030601, 0.00001979153625887901, 0.00019732727322837991, 0.00019607184080516104, 0.00019449881014048677, 0.00019252783549761340, 0.00019005824534270414, 0.00018696390034172869, 0.00018308675053773057, 0.00017822876262820421, 0.00017214180501187265, 0.00086050965274957203, 
-0.00000078842925924170, 0.00000080641225247182, 0.00000082480541318586, 0.00000084361809674324, 0.00000086285987188630, 0.00000088254052560735, 0.00000090267006812657, 0.00000092325873798360, 0.00000094431700724517, 0.00000096585558683151, 0.00001095701059476533, 0.00001372890594504066, 0.00001720203305615310, 0.00002155378895081414, 0.00002700644840175238, 0.00003383851706727251, 0.00004239895673352568, 0.00005312500924663838, 0.00006656452952824173, 0.00167318284590936110, 
-0.00000077084728676061, 0.00000078842925924170, 0.00000080641225247182, 0.00000082480541318586, 0.00000084361809674324, 0.00000086285987188630, 0.00000088254052560735, 0.00000090267006812657, 0.00000092325873798360, 0.00000094431700724517, 0.00001071266925850206, 0.00001342275134246626, 0.00001681842771900088, 0.00002107313945721098, 0.00002640420460239330, 0.00003308391813667234, 0.00004145345999836806, 0.00005194032154043835, 0.00006508014051976193, 0.00168053486844558260, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002777241548529521, 0.00002757170934308603, 0.00002737108546299072, 0.00002717054572129561, 0.00002697009203708255, 0.00002676972637320502, 0.00002656945073728650, 0.00002636926718274164, 0.00002616917780982065, 0.00002596918476667756, 0.00024871506031132705, 0.00022883970795392028, 0.00020910499279771418, 0.00018954649312391181, 0.00017020878777745409, 0.00015114773312208560, 0.00013243331601760249, 0.00011415322854089186, 0.00009641734703690183, 0.00026458192639991523, 
-0.00001987985840375417, 0.00001987189526823583, 0.00001986375050448587, 0.00001985541996981269, 0.00001984689942703558, 0.00001983818454232953, 0.00001982927088302090, 0.00001982015391533282, 0.00001981082900207919, 0.00001980129140030601, 0.00019743793903538701, 0.00019621050275520595, 0.00019467255067435392, 0.00019274552876601665, 0.00019033101047156181, 0.00018730566936410814, 0.00018351498000073921, 0.00017876532522159523, 0.00017281410676010789, 0.00087740879949325663, 
-0.00000077084728676061, 0.00000078842925924170, 0.00000080641225247182, 0.00000082480541318586, 0.00000084361809674324, 0.00000086285987188630, 0.00000088254052560735, 0.00000090267006812657, 0.00000092325873798360, 0.00000094431700724517, 0.00001071266925850206, 0.00001342275134246626, 0.00001681842771900088, 0.00002107313945721098, 0.00002640420460239331, 0.00003308391813667234, 0.00004145345999836806, 0.00005194032154043835, 0.00006508014051976193, 0.00168053486844558220, 
-0.00000075365739226585, 0.00000077084728676061, 0.00000078842925924170, 0.00000080641225247182, 0.00000082480541318586, 0.00000084361809674324, 0.00000086285987188630, 0.00000088254052560735, 0.00000090267006812657, 0.00000092325873798360, 0.00001047377673403746, 0.00001312342398752926, 0.00001644337678086717, 0.00002060320844731518, 0.00002581539083975994, 0.00003234614676222454, 0.00004052904784040445, 0.00005078205237008657, 0.00006362885338617124, 0.00168772294087924580, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002797320205517312, 0.00002777241548529521, 0.00002757170934308603, 0.00002737108546299072, 0.00002717054572129561, 0.00002697009203708255, 0.00002676972637320502, 0.00002656945073728650, 0.00002636926718274164, 0.00002616917780982065, 0.00025070918349558445, 0.00023082143403174783, 0.00021107118555952514, 0.00019149322296444857, 0.00017213113098321688, 0.00015303952038266312, 0.00013428681731560995, 0.00011595875832562997, 0.00009816276951517891, 0.00027344375527479714, 
-0.00001988764396135045, 0.00001987985840375417, 0.00001987189526823583, 0.00001986375050448587, 0.00001985541996981269, 0.00001984689942703558, 0.00001983818454232953, 0.00001982927088302090, 0.00001982015391533282, 0.00001981082900207919, 0.00019754613699489790, 0.00019634607254376485, 0.00019484241679431583, 0.00019295836747453446, 0.00019059769293804603, 0.00018763981693728851, 0.00018393365994672271, 0.00017928992246915367, 0.00017347141617935746, 0.00089438220166455711, 
-0.00000075365739226585, 0.00000077084728676061, 0.00000078842925924170, 0.00000080641225247182, 0.00000082480541318586, 0.00000084361809674324, 0.00000086285987188630, 0.00000088254052560735, 0.00000090267006812657, 0.00000092325873798360, 0.00001047377673403746, 0.00001312342398752926, 0.00001644337678086717, 0.00002060320844731518, 0.00002581539083975994, 0.00003234614676222454, 0.00004052904784040445, 0.00005078205237008657, 0.00006362885338617124, 0.00168772294087924580, 
-0.00000073685083241832, 0.00000075365739226585, 0.00000077084728676061, 0.00000078842925924170, 0.00000080641225247182, 0.00000082480541318586, 0.00000084361809674324, 0.00000086285987188630, 0.00000088254052560735, 0.00000090267006812657, 0.00001024021151286843, 0.00001283077163260736, 0.00001607668947865383, 0.00002014375689894005, 0.00002523970762403329, 0.00003162482768942693, 0.00003962525007356343, 0.00004964961260223364, 0.00006220992995565961, 0.00169475071929763870, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002817406725918277, 0.00002797320205517312, 0.00002777241548529521, 0.00002757170934308603, 0.00002737108546299072, 0.00002717054572129561, 0.00002697009203708255, 0.00002676972637320502, 0.00002656945073728650, 0.00002636926718274164, 0.00025270439947923292, 0.00023280452936443987, 0.00021303909396914778, 0.00019344210247594138, 0.00017405616768189112, 0.00015493468253372972, 0.00013614454728107182, 0.00011776958654256841, 0.00009991483081859043, 0.00028247701551160919, 
-0.00001989525590101234, 0.00001988764396135045, 0.00001987985840375417, 0.00001987189526823583, 0.00001986375050448587, 0.00001985541996981269, 0.00001984689942703558, 0.00001983818454232953, 0.00001982927088302090, 0.00001982015391533282, 0.00019765192213991168, 0.00019647861912603889, 0.00019500849489980260, 0.00019316645987985234, 0.00019085842838552762, 0.00018796651301958696, 0.00018434300332991079, 0.00017980282119809153, 0.00017411406759855781, 0.00091142820336743752, 
-0.00000073685083241832, 0.00000075365739226585, 0.00000077084728676061, 0.00000078842925924170, 0.00000080641225247182, 0.00000082480541318586, 0.00000084361809674324, 0.00000086285987188630, 0.00000088254052560735, 0.00000090267006812657, 0.00001024021151286843, 0.00001283077163260736, 0.00001607668947865383, 0.00002014375689894005, 0.00002523970762403329, 0.00003162482768942693, 0.00003962525007356343, 0.00004964961260223363, 0.00006220992995565963, 0.00169475071929763870, 
-0.00000072041905885539, 0.00000073685083241832, 0.00000075365739226585, 0.00000077084728676061, 0.00000078842925924170, 0.00000080641225247182, 0.00000082480541318586, 0.00000084361809674324, 0.00000086285987188630, 0.00000088254052560735, 0.00001001185479613146, 0.00001254464542520021, 0.00001571817930327985, 0.00001969455112009369, 0.00002467686214401735, 0.00003091959403195272, 0.00003874160699692297, 0.00004854242624120382, 0.00006082264851764842, 0.00170162177825730120, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002837500934378299, 0.00002817406725918277, 0.00002797320205517312, 0.00002777241548529521, 0.00002757170934308603, 0.00002737108546299072, 0.00002717054572129561, 0.00002697009203708255, 0.00002676972637320502, 0.00002656945073728650, 0.00025470068389284601, 0.00023478896341761287, 0.00021500867976763575, 0.00019539308372072792, 0.00017598383780858496, 0.00015683314431522754, 0.00013800641161470392, 0.00011958559503666915, 0.00010167338290133587, 0.00029168244036562030, 
-0.00001990269809441977, 0.00001989525590101234, 0.00001988764396135045, 0.00001987985840375417, 0.00001987189526823583, 0.00001986375050448587, 0.00001985541996981269, 0.00001984689942703558, 0.00001983818454232953, 0.00001982927088302090, 0.00019775534827619167, 0.00019660820991952824, 0.00019517086946353702, 0.00019336991182453164, 0.00019111334943253035, 0.00018828592377925017, 0.00018474321835565378, 0.00018030428228537411, 0.00017474238789110997, 0.00092854518563234361, 
-0.00000072041905885539, 0.00000073685083241832, 0.00000075365739226585, 0.00000077084728676061, 0.00000078842925924170, 0.00000080641225247182, 0.00000082480541318586, 0.00000084361809674324, 0.00000086285987188630, 0.00000088254052560735, 0.00001001185479613146, 0.00001254464542520021, 0.00001571817930327985, 0.00001969455112009369, 0.00002467686214401735, 0.00003091959403195272, 0.00003874160699692297, 0.00004854242624120383, 0.00006082264851764841, 0.00170162177825730120, 
-0.00000070435371384291, 0.00000072041905885539, 0.00000073685083241832, 0.00000075365739226585, 0.00000077084728676061, 0.00000078842925924170, 0.00000080641225247182, 0.00000082480541318586, 0.00000084361809674324, 0.00000086285987188630, 0.00000978859043417773, 0.00001226489983221825, 0.00001536766390481671, 0.00001925536263011560, 0.00002412656811820576, 0.00003023008708504017, 0.00003787766916089159, 0.00004745993013602498, 0.00005946630345570486, 0.00170833961260216380, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002857602659453663, 0.00002837500934378299, 0.00002817406725918277, 0.00002797320205517312, 0.00002777241548529521, 0.00002757170934308603, 0.00002737108546299072, 0.00002717054572129561, 0.00002697009203708255, 0.00002676972637320502, 0.00025669801291043555, 0.00023677470633780011, 0.00021697990554921752, 0.00019734611983015566, 0.00017791408263785353, 0.00015873483214539797, 0.00013987231812009605, 0.00012140666828775141, 0.00010343828101903608, 0.00030106074674050696, 
-0.00001990997432691420, 0.00001990269809441977, 0.00001989525590101234, 0.00001988764396135045, 0.00001987985840375417, 0.00001987189526823583, 0.00001986375050448587, 0.00001985541996981269, 0.00001984689942703558, 0.00001983818454232953, 0.00019785646800963259, 0.00019673491083832276, 0.00019532962307450014, 0.00019356882679084461, 0.00019136258574018491, 0.00018859821167897291, 0.00018513450858632268, 0.00018079456079041025, 0.00017535669664113824, 0.00094573156559274235, 
-0.00000070435371384291, 0.00000072041905885539, 0.00000073685083241832, 0.00000075365739226585, 0.00000077084728676061, 0.00000078842925924170, 0.00000080641225247182, 0.00000082480541318586, 0.00000084361809674324, 0.00000086285987188630, 0.00000978859043417773, 0.00001226489983221825, 0.00001536766390481671, 0.00001925536263011560, 0.00002412656811820576, 0.00003023008708504017, 0.00003787766916089159, 0.00004745993013602498, 0.00005946630345570486, 0.00170833961260216380, 
-0.00000068864662602422, 0.00000070435371384291, 0.00000072041905885539, 0.00000073685083241832, 0.00000075365739226585, 0.00000077084728676061, 0.00000078842925924170, 0.00000080641225247182, 0.00000082480541318586, 0.00000084361809674324, 0.00000957030486749557, 0.00001199139256595978, 0.00001502496499973929, 0.00001882596804346402, 0.00002358854564916977, 0.00002955595614304378, 0.00003703299713860371, 0.00004640157369399162, 0.00005814020488864264, 0.00171490763924113540, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002877711733523846, 0.00002857602659453663, 0.00002837500934378299, 0.00002817406725918277, 0.00002797320205517312, 0.00002777241548529521, 0.00002757170934308603, 0.00002737108546299072, 0.00002717054572129561, 0.00002697009203708255, 0.00025869636323733284, 0.00023876172893726717, 0.00021895273474226991, 0.00019930116498074316, 0.00017984684475382939, 0.00016063967408335559, 0.00014174217665681790, 0.00012323269335173459, 0.00010520938365511157, 0.00031061263555299363, 
-0.00001991708829942402, 0.00001990997432691420, 0.00001990269809441977, 0.00001989525590101234, 0.00001988764396135045, 0.00001987985840375417, 0.00001987189526823583, 0.00001986375050448587, 0.00001985541996981269, 0.00001984689942703558, 0.00019795533277301776, 0.00019685878632662819, 0.00019548483647993876, 0.00019376330595340877, 0.00019160626407817879, 0.00018890353555853185, 0.00018551707304484771, 0.00018127390608478410, 0.00017595730630604086, 0.00096298579568002422, 
-0.00000068864662602422, 0.00000070435371384291, 0.00000072041905885539, 0.00000073685083241832, 0.00000075365739226585, 0.00000077084728676061, 0.00000078842925924170, 0.00000080641225247182, 0.00000082480541318586, 0.00000084361809674324, 0.00000957030486749557, 0.00001199139256595978, 0.00001502496499973930, 0.00001882596804346402, 0.00002358854564916977, 0.00002955595614304378, 0.00003703299713860371, 0.00004640157369399163, 0.00005814020488864264, 0.00171490763924113540, 
-0.00000067328980626388, 0.00000068864662602422, 0.00000070435371384291, 0.00000072041905885539, 0.00000073685083241832, 0.00000075365739226585, 0.00000077084728676061, 0.00000078842925924170, 0.00000080641225247182, 0.00000082480541318586, 0.00000935688706895042, 0.00001172398451173888, 0.00001468990828024511, 0.00001840614895609477, 0.00002306252108119329, 0.00002889685832105390, 0.00003620716130241285, 0.00004536681860061561, 0.00005684367831962590, 0.00172132919888605820, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002897827992706264, 0.00002877711733523846, 0.00002857602659453663, 0.00002837500934378299, 0.00002817406725918277, 0.00002797320205517312, 0.00002777241548529521, 0.00002757170934308603, 0.00002737108546299072, 0.00002717054572129561, 0.00026069571209834028, 0.00024075000267916610, 0.00022092713159071732, 0.00020125817437087259, 0.00018178206802101901, 0.00016254759979249676, 0.00014361589909457086, 0.00012506355980319091, 0.00010698655244880259, 0.00032033879208936191, 
-0.00001992404363034686, 0.00001991708829942402, 0.00001990997432691420, 0.00001990269809441977, 0.00001989525590101234, 0.00001988764396135045, 0.00001987985840375417, 0.00001987189526823583, 0.00001986375050448587, 0.00001985541996981269, 0.00019805199285217949, 0.00019697989939154435, 0.00019563658862643612, 0.00019395344823064771, 0.00019184450838923540, 0.00018920205071557659, 0.00018589110631594760, 0.00018174256197909342, 0.00017654452237541617, 0.00098030636283635950, 
-0.00000067328980626388, 0.00000068864662602422, 0.00000070435371384291, 0.00000072041905885539, 0.00000073685083241832, 0.00000075365739226585, 0.00000077084728676061, 0.00000078842925924170, 0.00000080641225247182, 0.00000082480541318586, 0.00000935688706895042, 0.00001172398451173888, 0.00001468990828024511, 0.00001840614895609477, 0.00002306252108119329, 0.00002889685832105390, 0.00003620716130241285, 0.00004536681860061562, 0.00005684367831962590, 0.00172132919888605820, 
-0.00000065827544358419, 0.00000067328980626388, 0.00000068864662602422, 0.00000070435371384291, 0.00000072041905885539, 0.00000073685083241832, 0.00000075365739226585, 0.00000077084728676061, 0.00000078842925924170, 0.00000080641225247182, 0.00000914822848731282, 0.00001146253965712710, 0.00001436232332559564, 0.00001799569183437386, 0.00002254822686108268, 0.00002825245838049440, 0.00003539974160536904, 0.00004435513854582188, 0.00005557606429309825, 0.00172760755775089900, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002917951276772915, 0.00002897827992706264, 0.00002877711733523846, 0.00002857602659453663, 0.00002837500934378299, 0.00002817406725918277, 0.00002797320205517312, 0.00002777241548529521, 0.00002757170934308603, 0.00002737108546299072, 0.00026269603722614727, 0.00024273949966302071, 0.00022290306113584432, 0.00020321710419800214, 0.00018371969755575030, 0.00016445854050472407, 0.00014549339926836193, 0.00012689915967917977, 0.00010876965212479430, 0.00033023988635400914, 
-0.00001993084385739013, 0.00001992404363034686, 0.00001991708829942402, 0.00001990997432691420, 0.00001990269809441977, 0.00001989525590101234, 0.00001988764396135045, 0.00001987985840375417, 0.00001987189526823583, 0.00001986375050448587, 0.00019814649741157589, 0.00019709831163511291, 0.00019578495670006664, 0.00019413935033510429, 0.00019207743985215548, 0.00018949390898461923, 0.00018625679864510197, 0.00018220076684695964, 0.00017711864352644438, 0.00099769178774510893, 
-0.00000065827544358419, 0.00000067328980626388, 0.00000068864662602422, 0.00000070435371384291, 0.00000072041905885539, 0.00000073685083241832, 0.00000075365739226585, 0.00000077084728676061, 0.00000078842925924170, 0.00000080641225247182, 0.00000914822848731282, 0.00001146253965712710, 0.00001436232332559564, 0.00001799569183437386, 0.00002254822686108268, 0.00002825245838049440, 0.00003539974160536904, 0.00004435513854582189, 0.00005557606429309824, 0.00172760755775089900, 
-0.00000064359590119227, 0.00000065827544358419, 0.00000067328980626388, 0.00000068864662602422, 0.00000070435371384291, 0.00000072041905885539, 0.00000073685083241832, 0.00000075365739226585, 0.00000077084728676061, 0.00000078842925924170, 0.00000894422299204575, 0.00001120692502277317, 0.00001404204351543486, 0.00001759438790646732, 0.00002204540140208053, 0.00002762242855860937, 0.00003461032736756931, 0.00004336601895625005, 0.00005433671805936216, 0.00173374590921305370, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002938081429068880, 0.00002917951276772915, 0.00002897827992706264, 0.00002877711733523846, 0.00002857602659453663, 0.00002837500934378299, 0.00002817406725918277, 0.00002797320205517312, 0.00002777241548529521, 0.00002757170934308603, 0.00026469731685000423, 0.00024473019261053535, 0.00022488048919851503, 0.00020517791163638670, 0.00018565967969825706, 0.00016637242898546876, 0.00014737459293467746, 0.00012873938742433404, 0.00011055855042441137, 0.00034031657341023467, 
-0.00001993749243937033, 0.00001993084385739013, 0.00001992404363034686, 0.00001991708829942402, 0.00001990997432691420, 0.00001990269809441977, 0.00001989525590101234, 0.00001988764396135045, 0.00001987985840375417, 0.00001987189526823583, 0.00019823889451929777, 0.00019721408328564989, 0.00019593001616565516, 0.00019432110682263143, 0.00019230517694345239, 0.00018977925881426218, 0.00018661433603531623, 0.00018264875374627247, 0.00017767996177580465, 0.00101514062407839300, 
-0.00000064359590119227, 0.00000065827544358419, 0.00000067328980626388, 0.00000068864662602422, 0.00000070435371384291, 0.00000072041905885539, 0.00000073685083241832, 0.00000075365739226585, 0.00000077084728676061, 0.00000078842925924170, 0.00000894422299204575, 0.00001120692502277317, 0.00001404204351543486, 0.00001759438790646733, 0.00002204540140208053, 0.00002762242855860937, 0.00003461032736756931, 0.00004336601895625005, 0.00005433671805936216, 0.00173374590921305370, 
-0.00000062924371259568, 0.00000064359590119227, 0.00000065827544358419, 0.00000067328980626388, 0.00000068864662602422, 0.00000070435371384291, 0.00000072041905885539, 0.00000073685083241832, 0.00000075365739226585, 0.00000077084728676061, 0.00000874476681932313, 0.00001095701059476532, 0.00001372890594504066, 0.00001720203305615310, 0.00002155378895081414, 0.00002700644840175239, 0.00003383851706727251, 0.00004239895673352568, 0.00005312500924663838, 0.00173974737543760290, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002958218296432642, 0.00002938081429068880, 0.00002917951276772915, 0.00002897827992706264, 0.00002877711733523846, 0.00002857602659453663, 0.00002837500934378299, 0.00002817406725918277, 0.00002797320205517312, 0.00002777241548529521, 0.00026669952968464913, 0.00024672205485172039, 0.00022685938236178816, 0.00020714055481529524, 0.00018760196198538590, 0.00016828919949949279, 0.00014925939772863415, 0.00013058413983717141, 0.00011235311803834700, 0.00035056949371342649, 
-0.00001994399275797237, 0.00001993749243937033, 0.00001993084385739013, 0.00001992404363034686, 0.00001991708829942402, 0.00001990997432691420, 0.00001990269809441977, 0.00001989525590101234, 0.00001988764396135045, 0.00001987985840375417, 0.00019832923117151744, 0.00019732727322837991, 0.00019607184080516104, 0.00019449881014048677, 0.00019252783549761340, 0.00019005824534270414, 0.00018696390034172869, 0.00018308675053773057, 0.00017822876262820421, 0.00103265145776144520, 
-0.00000062924371259568, 0.00000064359590119227, 0.00000065827544358419, 0.00000067328980626388, 0.00000068864662602422, 0.00000070435371384291, 0.00000072041905885539, 0.00000073685083241832, 0.00000075365739226585, 0.00000077084728676061, 0.00000874476681932313, 0.00001095701059476533, 0.00001372890594504066, 0.00001720203305615310, 0.00002155378895081414, 0.00002700644840175238, 0.00003383851706727251, 0.00004239895673352568, 0.00005312500924663838, 0.00173974737543760290, 
-0.00000061521157780479, 0.00000062924371259568, 0.00000064359590119227, 0.00000065827544358419, 0.00000067328980626388, 0.00000068864662602422, 0.00000070435371384291, 0.00000072041905885539, 0.00000073685083241832, 0.00000075365739226585, 0.00000854975851925222, 0.00001071266925850206, 0.00001342275134246626, 0.00001681842771900088, 0.00002107313945721098, 0.00002640420460239330, 0.00003308391813667234, 0.00004145345999836806, 0.00005194032154043835, 0.00174561500896534410, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002978361729118194, 0.00002958218296432642, 0.00002938081429068880, 0.00002917951276772915, 0.00002897827992706264, 0.00002877711733523846, 0.00002857602659453663, 0.00002837500934378299, 0.00002817406725918277, 0.00002797320205517312, 0.00026870265491948144, 0.00024871506031132705, 0.00022883970795392028, 0.00020910499279771418, 0.00018954649312391181, 0.00017020878777745409, 0.00015114773312208560, 0.00013243331601760249, 0.00011415322854089186, 0.00036099927343681700, 
-0.00001995034811946959, 0.00001994399275797237, 0.00001993749243937033, 0.00001993084385739013, 0.00001992404363034686, 0.00001991708829942402, 0.00001990997432691420, 0.00001990269809441977, 0.00001989525590101234, 0.00001988764396135045, 0.00019841755331639259, 0.00019743793903538701, 0.00019621050275520595, 0.00019467255067435392, 0.00019274552876601665, 0.00019033101047156181, 0.00018730566936410814, 0.00018351498000073921, 0.00017876532522159523, 0.00105022290625336480, 
-0.00000061521157780479, 0.00000062924371259568, 0.00000064359590119227, 0.00000065827544358419, 0.00000067328980626388, 0.00000068864662602422, 0.00000070435371384291, 0.00000072041905885539, 0.00000073685083241832, 0.00000075365739226585, 0.00000854975851925222, 0.00001071266925850206, 0.00001342275134246626, 0.00001681842771900088, 0.00002107313945721098, 0.00002640420460239331, 0.00003308391813667234, 0.00004145345999836806, 0.00005194032154043835, 0.00174561500896534410, 
-0.00000060149235961975, 0.00000061521157780479, 0.00000062924371259568, 0.00000064359590119227, 0.00000065827544358419, 0.00000067328980626388, 0.00000068864662602422, 0.00000070435371384291, 0.00000072041905885539, 0.00000073685083241832, 0.00000835909890427289, 0.00001047377673403746, 0.00001312342398752926, 0.00001644337678086717, 0.00002060320844731518, 0.00002581539083975994, 0.00003234614676222454, 0.00004052904784040445, 0.00005078205237008657, 0.00175135179426541710, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00002998511580718859, 0.00002978361729118194, 0.00002958218296432642, 0.00002938081429068880, 0.00002917951276772915, 0.00002897827992706264, 0.00002877711733523846, 0.00002857602659453663, 0.00002837500934378299, 0.00002817406725918277, 0.00027070667220797706, 0.00025070918349558445, 0.00023082143403174783, 0.00021107118555952514, 0.00019149322296444857, 0.00017213113098321688, 0.00015303952038266312, 0.00013428681731560995, 0.00011595875832562997, 0.00037160652478997593, 
-0.00001995656175640541, 0.00001995034811946959, 0.00001994399275797237, 0.00001993749243937033, 0.00001993084385739013, 0.00001992404363034686, 0.00001991708829942402, 0.00001990997432691420, 0.00001990269809441977, 0.00001989525590101234, 0.00019850390587743702, 0.00019754613699489790, 0.00019634607254376485, 0.00019484241679431583, 0.00019295836747453446, 0.00019059769293804603, 0.00018763981693728851, 0.00018393365994672271, 0.00017928992246915367, 0.00106785361784391460, 
-0.00000060149235961975, 0.00000061521157780479, 0.00000062924371259568, 0.00000064359590119227, 0.00000065827544358419, 0.00000067328980626388, 0.00000068864662602422, 0.00000070435371384291, 0.00000072041905885539, 0.00000073685083241832, 0.00000835909890427290, 0.00001047377673403746, 0.00001312342398752926, 0.00001644337678086717, 0.00002060320844731518, 0.00002581539083975994, 0.00003234614676222454, 0.00004052904784040445, 0.00005078205237008657, 0.00175135179426541710, 
-0.00000058807908000023, 0.00000060149235961975, 0.00000061521157780479, 0.00000062924371259568, 0.00000064359590119227, 0.00000065827544358419, 0.00000067328980626388, 0.00000068864662602422, 0.00000070435371384291, 0.00000072041905885539, 0.00000817269099870761, 0.00001024021151286843, 0.00001283077163260736, 0.00001607668947865383, 0.00002014375689894005, 0.00002523970762403329, 0.00003162482768942693, 0.00003962525007356343, 0.00004964961260223364, 0.00175696064925329820, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00003018667708092828, 0.00002998511580718859, 0.00002978361729118194, 0.00002958218296432642, 0.00002938081429068880, 0.00002917951276772915, 0.00002897827992706264, 0.00002877711733523846, 0.00002857602659453663, 0.00002837500934378299, 0.00027271156165733915, 0.00025270439947923292, 0.00023280452936443987, 0.00021303909396914778, 0.00019344210247594138, 0.00017405616768189112, 0.00015493468253372972, 0.00013614454728107182, 0.00011776958654256841, 0.00038239184633019944, 
-0.00001996263682923758, 0.00001995656175640541, 0.00001995034811946959, 0.00001994399275797237, 0.00001993749243937033, 0.00001993084385739013, 0.00001992404363034686, 0.00001991708829942402, 0.00001990997432691420, 0.00001990269809441977, 0.00019858833277637018, 0.00019765192213991168, 0.00019647861912603889, 0.00019500849489980260, 0.00019316645987985234, 0.00019085842838552762, 0.00018796651301958696, 0.00018434300332991079, 0.00017980282119809153, 0.00108554227096599540, 
-0.00000058807908000023, 0.00000060149235961975, 0.00000061521157780479, 0.00000062924371259568, 0.00000064359590119227, 0.00000065827544358419, 0.00000067328980626388, 0.00000068864662602422, 0.00000070435371384291, 0.00000072041905885539, 0.00000817269099870761, 0.00001024021151286843, 0.00001283077163260736, 0.00001607668947865383, 0.00002014375689894005, 0.00002523970762403329, 0.00003162482768942693, 0.00003962525007356343, 0.00004964961260223363, 0.00175696064925329820, 
-0.00000057496491651622, 0.00000058807908000023, 0.00000060149235961975, 0.00000061521157780479, 0.00000062924371259568, 0.00000064359590119227, 0.00000065827544358419, 0.00000067328980626388, 0.00000068864662602422, 0.00000070435371384291, 0.00000799043998943643, 0.00001001185479613146, 0.00001254464542520021, 0.00001571817930327985, 0.00001969455112009369, 0.00002467686214401735, 0.00003091959403195272, 0.00003874160699692297, 0.00004854242624120382, 0.00176244442677495000, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00003038829971290358, 0.00003018667708092828, 0.00002998511580718859, 0.00002978361729118194, 0.00002958218296432642, 0.00002938081429068880, 0.00002917951276772915, 0.00002897827992706264, 0.00002877711733523846, 0.00002857602659453663, 0.00027471730381838045, 0.00025470068389284601, 0.00023478896341761287, 0.00021500867976763575, 0.00019539308372072792, 0.00017598383780858496, 0.00015683314431522754, 0.00013800641161470392, 0.00011958559503666915, 0.00039335582326695598, 
-0.00001996857642794558, 0.00001996263682923758, 0.00001995656175640541, 0.00001995034811946959, 0.00001994399275797237, 0.00001993749243937033, 0.00001993084385739013, 0.00001992404363034686, 0.00001991708829942402, 0.00001990997432691420, 0.00019867087695545708, 0.00019775534827619167, 0.00019660820991952824, 0.00019517086946353702, 0.00019336991182453164, 0.00019111334943253035, 0.00018828592377925017, 0.00018474321835565378, 0.00018030428228537411, 0.00110328757352345340, 
-0.00000057496491651622, 0.00000058807908000023, 0.00000060149235961975, 0.00000061521157780479, 0.00000062924371259568, 0.00000064359590119227, 0.00000065827544358419, 0.00000067328980626388, 0.00000068864662602422, 0.00000070435371384291, 0.00000799043998943643, 0.00001001185479613146, 0.00001254464542520021, 0.00001571817930327985, 0.00001969455112009369, 0.00002467686214401735, 0.00003091959403195272, 0.00003874160699692297, 0.00004854242624120383, 0.00176244442677495000, 
-0.00000056214319887791, 0.00000057496491651622, 0.00000058807908000023, 0.00000060149235961975, 0.00000061521157780479, 0.00000062924371259568, 0.00000064359590119227, 0.00000065827544358419, 0.00000067328980626388, 0.00000068864662602422, 0.00000781225317767200, 0.00000978859043417773, 0.00001226489983221825, 0.00001536766390481671, 0.00001925536263011560, 0.00002412656811820576, 0.00003023008708504017, 0.00003787766916089159, 0.00004745993013602498, 0.00176780591605786860, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00003058998233482583, 0.00003038829971290358, 0.00003018667708092828, 0.00002998511580718859, 0.00002978361729118194, 0.00002958218296432642, 0.00002938081429068880, 0.00002917951276772915, 0.00002897827992706264, 0.00002877711733523846, 0.00027672387967563061, 0.00025669801291043555, 0.00023677470633780011, 0.00021697990554921752, 0.00019734611983015566, 0.00017791408263785353, 0.00015873483214539797, 0.00013987231812009605, 0.00012140666828775141, 0.00040449902775954293, 
-0.00001997438357360239, 0.00001996857642794558, 0.00001996263682923758, 0.00001995656175640541, 0.00001995034811946959, 0.00001994399275797237, 0.00001993749243937033, 0.00001993084385739013, 0.00001992404363034686, 0.00001991708829942402, 0.00019875158039935043, 0.00019785646800963259, 0.00019673491083832276, 0.00019532962307450014, 0.00019356882679084461, 0.00019136258574018491, 0.00018859821167897291, 0.00018513450858632268, 0.00018079456079041025, 0.00112108826223388060, 
-0.00000056214319887791, 0.00000057496491651622, 0.00000058807908000023, 0.00000060149235961975, 0.00000061521157780479, 0.00000062924371259568, 0.00000064359590119227, 0.00000065827544358419, 0.00000067328980626388, 0.00000068864662602422, 0.00000781225317767200, 0.00000978859043417773, 0.00001226489983221825, 0.00001536766390481671, 0.00001925536263011560, 0.00002412656811820576, 0.00003023008708504017, 0.00003787766916089159, 0.00004745993013602498, 0.00176780591605786860, 
-0.00000054960740554293, 0.00000056214319887791, 0.00000057496491651622, 0.00000058807908000023, 0.00000060149235961975, 0.00000061521157780479, 0.00000062924371259568, 0.00000064359590119227, 0.00000065827544358419, 0.00000067328980626388, 0.00000763803993180991, 0.00000957030486749557, 0.00001199139256595978, 0.00001502496499973929, 0.00001882596804346402, 0.00002358854564916977, 0.00002955595614304378, 0.00003703299713860371, 0.00004640157369399162, 0.00177304784412977780, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00003079172360891922, 0.00003058998233482583, 0.00003038829971290358, 0.00003018667708092828, 0.00002998511580718859, 0.00002978361729118194, 0.00002958218296432642, 0.00002938081429068880, 0.00002917951276772915, 0.00002897827992706264, 0.00027873127063766408, 0.00025869636323733284, 0.00023876172893726717, 0.00021895273474226991, 0.00019930116498074316, 0.00017984684475382939, 0.00016063967408335559, 0.00014174217665681790, 0.00012323269335173459, 0.00041582201920810509, 
-0.00001998006121991106, 0.00001997438357360239, 0.00001996857642794558, 0.00001996263682923758, 0.00001995656175640541, 0.00001995034811946959, 0.00001994399275797237, 0.00001993749243937033, 0.00001993084385739013, 0.00001992404363034686, 0.00019883048415644493, 0.00019795533277301776, 0.00019685878632662819, 0.00019548483647993876, 0.00019376330595340877, 0.00019160626407817879, 0.00018890353555853185, 0.00018551707304484771, 0.00018127390608478410, 0.00113894310198606510, 
-0.00000054960740554293, 0.00000056214319887791, 0.00000057496491651622, 0.00000058807908000023, 0.00000060149235961975, 0.00000061521157780479, 0.00000062924371259568, 0.00000064359590119227, 0.00000065827544358419, 0.00000067328980626388, 0.00000763803993180991, 0.00000957030486749557, 0.00001199139256595978, 0.00001502496499973930, 0.00001882596804346402, 0.00002358854564916977, 0.00002955595614304378, 0.00003703299713860371, 0.00004640157369399163, 0.00177304784412977780, 
-0.00000053735116039933, 0.00000054960740554293, 0.00000056214319887791, 0.00000057496491651622, 0.00000058807908000023, 0.00000060149235961975, 0.00000061521157780479, 0.00000062924371259568, 0.00000064359590119227, 0.00000065827544358419, 0.00000746771164133055, 0.00000935688706895042, 0.00001172398451173888, 0.00001468990828024511, 0.00001840614895609477, 0.00002306252108119329, 0.00002889685832105390, 0.00003620716130241285, 0.00004536681860061561, 0.00177817287720568390, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00003099352222724032, 0.00003079172360891922, 0.00003058998233482583, 0.00003038829971290358, 0.00003018667708092828, 0.00002998511580718859, 0.00002978361729118194, 0.00002958218296432642, 0.00002938081429068880, 0.00002917951276772915, 0.00028073945852764414, 0.00026069571209834028, 0.00024075000267916610, 0.00022092713159071732, 0.00020125817437087259, 0.00018178206802101901, 0.00016254759979249676, 0.00014361589909457086, 0.00012506355980319091, 0.00042732534453816438, 
-0.00001998561225470704, 0.00001998006121991106, 0.00001997438357360239, 0.00001996857642794558, 0.00001996263682923758, 0.00001995656175640541, 0.00001995034811946959, 0.00001994399275797237, 0.00001993749243937033, 0.00001993084385739013, 0.00019890762835975625, 0.00019805199285217949, 0.00019697989939154435, 0.00019563658862643612, 0.00019395344823064771, 0.00019184450838923540, 0.00018920205071557659, 0.00018589110631594760, 0.00018174256197909342, 0.00115685088521177590, 
-0.00000053735116039933, 0.00000054960740554293, 0.00000056214319887791, 0.00000057496491651622, 0.00000058807908000023, 0.00000060149235961975, 0.00000061521157780479, 0.00000062924371259568, 0.00000064359590119227, 0.00000065827544358419, 0.00000746771164133055, 0.00000935688706895042, 0.00001172398451173888, 0.00001468990828024511, 0.00001840614895609477, 0.00002306252108119329, 0.00002889685832105390, 0.00003620716130241285, 0.00004536681860061562, 0.00177817287720568390, 
-0.00000052536822952242, 0.00000053735116039933, 0.00000054960740554293, 0.00000056214319887791, 0.00000057496491651622, 0.00000058807908000023, 0.00000060149235961975, 0.00000061521157780479, 0.00000062924371259568, 0.00000064359590119227, 0.00000730118167172888, 0.00000914822848731282, 0.00001146253965712710, 0.00001436232332559564, 0.00001799569183437386, 0.00002254822686108268, 0.00002825245838049440, 0.00003539974160536904, 0.00004435513854582188, 0.00178318362204399710, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00003119537691101286, 0.00003099352222724032, 0.00003079172360891922, 0.00003058998233482583, 0.00003038829971290358, 0.00003018667708092828, 0.00002998511580718859, 0.00002978361729118194, 0.00002958218296432642, 0.00002938081429068880, 0.00028274842557407770, 0.00026269603722614727, 0.00024273949966302071, 0.00022290306113584432, 0.00020321710419800214, 0.00018371969755575030, 0.00016445854050472407, 0.00014549339926836193, 0.00012689915967917977, 0.00043900953847880318, 
-0.00001999103950142707, 0.00001998561225470704, 0.00001998006121991106, 0.00001997438357360239, 0.00001996857642794558, 0.00001996263682923758, 0.00001995656175640541, 0.00001995034811946959, 0.00001994399275797237, 0.00001993749243937033, 0.00019898305224733365, 0.00019814649741157589, 0.00019709831163511291, 0.00019578495670006664, 0.00019413935033510429, 0.00019207743985215548, 0.00018949390898461923, 0.00018625679864510197, 0.00018220076684695964, 0.00117481043127155310, 
-0.00000052536822952242, 0.00000053735116039933, 0.00000054960740554293, 0.00000056214319887791, 0.00000057496491651622, 0.00000058807908000023, 0.00000060149235961975, 0.00000061521157780479, 0.00000062924371259568, 0.00000064359590119227, 0.00000730118167172888, 0.00000914822848731282, 0.00001146253965712710, 0.00001436232332559564, 0.00001799569183437386, 0.00002254822686108268, 0.00002825245838049440, 0.00003539974160536904, 0.00004435513854582189, 0.00178318362204399710, 
-0.00000051365251800407, 0.00000052536822952242, 0.00000053735116039933, 0.00000054960740554293, 0.00000056214319887791, 0.00000057496491651622, 0.00000058807908000023, 0.00000060149235961975, 0.00000061521157780479, 0.00000062924371259568, 0.00000713836532044933, 0.00000894422299204575, 0.00001120692502277317, 0.00001404204351543486, 0.00001759438790646732, 0.00002204540140208053, 0.00002762242855860937, 0.00003461032736756931, 0.00004336601895625005, 0.00178808262727241600, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 0.00003139728640997727, 0.00003119537691101286, 0.00003099352222724032, 0.00003079172360891922, 0.00003058998233482583, 0.00003038829971290358, 0.00003018667708092828, 0.00002998511580718859, 0.00002978361729118194, 0.00002958218296432642, 0.00028475815440177573, 0.00026469731685000423, 0.00024473019261053535, 0.00022488048919851503, 0.00020517791163638670, 0.00018565967969825706, 0.00016637242898546876, 0.00014737459293467746, 0.00012873938742433404, 0.00045087512383464588, 
-0.00001999634572054525, 0.00001999103950142707, 0.00001998561225470704, 0.00001998006121991106, 0.00001997438357360239, 0.00001996857642794558, 0.00001996263682923758, 0.00001995656175640541, 0.00001995034811946959, 0.00001994399275797237, 0.00019905679418221812, 0.00019823889451929777, 0.00019721408328564989, 0.00019593001616565516, 0.00019432110682263143, 0.00019230517694345239, 0.00018977925881426218, 0.00018661433603531623, 0.00018264875374627247, 0.00119282058585419770, 
-0.00000051365251800407, 0.00000052536822952242, 0.00000053735116039933, 0.00000054960740554293, 0.00000056214319887791, 0.00000057496491651622, 0.00000058807908000023, 0.00000060149235961975, 0.00000061521157780479, 0.00000062924371259568, 0.00000713836532044933, 0.00000894422299204575, 0.00001120692502277317, 0.00001404204351543486, 0.00001759438790646733, 0.00002204540140208053, 0.00002762242855860937, 0.00003461032736756931, 0.00004336601895625005, 0.00178808262727241600, 
-0.00000050219806685258, 0.00000051365251800407, 0.00000052536822952242, 0.00000053735116039933, 0.00000054960740554293, 0.00000056214319887791, 0.00000057496491651622, 0.00000058807908000023, 0.00000060149235961975, 0.00000061521157780479, 0.00000697917977380331, 0.00000874476681932313, 0.00001095701059476532, 0.00001372890594504066, 0.00001720203305615310, 0.00002155378895081414, 0.00002700644840175239, 0.00003383851706727251, 0.00004239895673352568, 0.00179287238468424130, 
-0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 0.00000000000000000000, 
 };
 
 const float H_inv_data_Attitude[ATTITUDE_H_INV_HEIGHT*ATTITUDE_H_INV_WIDTH] = {
@@ -3088,3 +704,57 @@ const float H_inv_data_Attitude[ATTITUDE_H_INV_HEIGHT*ATTITUDE_H_INV_WIDTH] = {
 -1078.13529691947930000000, -1072.91355139717530000000, -1067.68349089210140000000, -1062.44492576447990000000, -1057.19766208955840000000, -1051.94150159960690000000, -1046.67624163709910000000, -1041.40167511901790000000, -1036.11759051217250000000, -1030.82377181947850000000, -1001.47728710088100000000, -947.29123489073811000000, -891.71068596323607000000, -834.44312377172037000000, -775.19113525774208000000, -713.68634742069730000000, -649.73541496003622000000, -583.27965581030355000000, -514.47060024797599000000, 10938.16592069067500000000, 
 };
 
+const int16_t B_roof_q15_data_Attitude[ATTITUDE_B_ROOF_WIDTH*ATTITUDE_B_ROOF_HEIGHT] __attribute__ ((aligned (4))) = {
+0, 0, 0, 5, 14, 28, 47, 69, 96, 127, 163, 202, 245, 292, 342, 396, 454, 515, 580, 648, 719, 793, 871, 951, 1034, 1121, 1210, 1302, 1396, 1494, 1593, 1696, 1801, 1908, 2018, 2129, 2244, 2360, 2479, 2599, 2722, 2847, 2973, 3102, 3233, 3365, 3499, 3635, 3773, 3912, 4053, 4196, 4340, 4486, 4633, 4782, 4932, 5083, 5236, 5390, 5546, 5703, 5861, 6020, 6181, 6343, 6505, 6669, 6835, 7001, 7168, 7336, 7505, 7676, 7847, 8019, 8192, 8366, 8541, 8716, 8893, 9070, 9248, 9427, 9607, 9787, 9969, 10150, 10333, 10516, 10700, 10885, 11070, 11256, 11442, 11629, 11817, 12005, 12194, 12383, 12573, 12763, 12954, 13146, 13338, 13530, 13723, 13916, 14110, 14304, 14498, 14693, 14889, 15084, 15281, 15477, 15674, 15871, 16069, 16267, 16465, 16664, 16863, 17062, 17262, 17462, 17662, 17863, 18063, 18264, 18466, 18667, 18869, 19071, 19274, 19476, 19679, 19882, 20085, 20289, 20493, 20697, 20901, 21105, 21310, 21514, 21719, 21925, 22130, 22335, 22541, 22747, 22953, 23159, 23365, 23572, 23778, 23985, 24192, 24399, 24606, 24814, 25021, 25229, 25436, 25644, 25852, 26060, 26268, 26477, 26685, 26893, 27102, 27311, 27520, 27729, 27938, 28147, 28356, 28565, 28775, 28984, 29194, 29403, 29613, 29823, 30033, 30242, 30452, 30663, 30873, 31083, 31293, 31504, 31714, 31924, 32135, 32346, 32556, 32767, 
+0, 0, 0, 0, 5, 14, 28, 47, 70, 97, 128, 164, 203, 246, 294, 344, 399, 457, 519, 584, 652, 724, 798, 876, 957, 1041, 1128, 1218, 1310, 1405, 1503, 1604, 1707, 1812, 1920, 2031, 2143, 2258, 2375, 2495, 2616, 2740, 2865, 2993, 3122, 3254, 3387, 3522, 3659, 3797, 3937, 4079, 4223, 4368, 4515, 4663, 4812, 4964, 5116, 5270, 5425, 5582, 5740, 5899, 6059, 6221, 6384, 6548, 6713, 6879, 7046, 7214, 7384, 7554, 7725, 7898, 8071, 8245, 8420, 8596, 8773, 8951, 9129, 9308, 9488, 9669, 9851, 10033, 10216, 10400, 10584, 10769, 10955, 11142, 11329, 11516, 11705, 11893, 12083, 12273, 12463, 12654, 12846, 13038, 13231, 13424, 13617, 13811, 14006, 14201, 14396, 14592, 14788, 14985, 15182, 15380, 15577, 15776, 15974, 16173, 16372, 16572, 16772, 16972, 17173, 17374, 17575, 17776, 17978, 18180, 18383, 18585, 18788, 18991, 19195, 19398, 19602, 19806, 20011, 20215, 20420, 20625, 20831, 21036, 21242, 21448, 21654, 21860, 22066, 22273, 22480, 22687, 22894, 23101, 23309, 23516, 23724, 23932, 24140, 24349, 24557, 24765, 24974, 25183, 25392, 25601, 25810, 26019, 26229, 26438, 26648, 26858, 27068, 27278, 27488, 27698, 27908, 28118, 28329, 28539, 28750, 28961, 29172, 29382, 29593, 29805, 30016, 30227, 30438, 30650, 30861, 31073, 31284, 31496, 31707, 31919, 32131, 32343, 32555, 32767, 
+0, 0, 0, 0, 0, 5, 14, 28, 47, 70, 97, 129, 165, 204, 248, 295, 347, 402, 460, 522, 587, 656, 728, 804, 882, 963, 1048, 1135, 1226, 1319, 1415, 1513, 1614, 1718, 1824, 1933, 2044, 2157, 2273, 2391, 2511, 2633, 2757, 2884, 3012, 3142, 3275, 3409, 3545, 3682, 3822, 3963, 4106, 4250, 4396, 4544, 4693, 4844, 4996, 5149, 5304, 5461, 5618, 5777, 5937, 6099, 6261, 6425, 6590, 6756, 6924, 7092, 7261, 7432, 7603, 7776, 7949, 8123, 8299, 8475, 8652, 8830, 9009, 9188, 9369, 9550, 9732, 9915, 10098, 10283, 10468, 10653, 10840, 11027, 11214, 11402, 11591, 11781, 11971, 12162, 12353, 12545, 12737, 12930, 13123, 13317, 13511, 13706, 13901, 14097, 14293, 14490, 14687, 14885, 15083, 15281, 15480, 15679, 15878, 16078, 16278, 16479, 16680, 16881, 17083, 17285, 17487, 17689, 17892, 18095, 18299, 18502, 18706, 18911, 19115, 19320, 19525, 19730, 19935, 20141, 20347, 20553, 20760, 20966, 21173, 21380, 21587, 21795, 22002, 22210, 22418, 22626, 22835, 23043, 23252, 23461, 23670, 23879, 24088, 24298, 24507, 24717, 24927, 25137, 25347, 25557, 25768, 25978, 26189, 26400, 26610, 26821, 27033, 27244, 27455, 27667, 27878, 28090, 28302, 28513, 28725, 28937, 29149, 29362, 29574, 29786, 29999, 30211, 30424, 30636, 30849, 31062, 31275, 31488, 31701, 31914, 32127, 32340, 32554, 32767, 
+0, 0, 0, 0, 0, 0, 5, 14, 29, 47, 71, 98, 130, 166, 206, 250, 297, 349, 404, 463, 525, 591, 661, 733, 809, 888, 970, 1055, 1143, 1234, 1327, 1424, 1523, 1625, 1729, 1836, 1945, 2057, 2171, 2288, 2406, 2527, 2650, 2775, 2903, 3032, 3163, 3296, 3431, 3568, 3707, 3847, 3989, 4133, 4278, 4425, 4574, 4724, 4876, 5029, 5183, 5339, 5496, 5655, 5815, 5976, 6139, 6302, 6467, 6633, 6801, 6969, 7138, 7309, 7480, 7653, 7827, 8001, 8177, 8353, 8531, 8709, 8888, 9068, 9249, 9430, 9613, 9796, 9980, 10165, 10350, 10536, 10723, 10911, 11099, 11288, 11477, 11667, 11858, 12049, 12241, 12434, 12627, 12820, 13014, 13209, 13404, 13600, 13796, 13993, 14190, 14387, 14585, 14783, 14982, 15181, 15381, 15581, 15782, 15982, 16183, 16385, 16587, 16789, 16992, 17195, 17398, 17601, 17805, 18009, 18214, 18419, 18624, 18829, 19034, 19240, 19446, 19653, 19859, 20066, 20273, 20480, 20688, 20896, 21104, 21312, 21520, 21729, 21938, 22147, 22356, 22565, 22775, 22984, 23194, 23404, 23614, 23825, 24035, 24246, 24457, 24668, 24879, 25090, 25302, 25513, 25725, 25936, 26148, 26360, 26573, 26785, 26997, 27210, 27422, 27635, 27848, 28061, 28274, 28487, 28700, 28914, 29127, 29340, 29554, 29768, 29981, 30195, 30409, 30623, 30837, 31051, 31266, 31480, 31694, 31909, 32123, 32338, 32552, 32767, 
+0, 0, 0, 0, 0, 0, 0, 5, 15, 29, 48, 71, 99, 131, 167, 207, 251, 299, 351, 407, 466, 529, 595, 665, 738, 814, 894, 976, 1062, 1150, 1242, 1336, 1433, 1533, 1636, 1741, 1848, 1958, 2071, 2186, 2303, 2422, 2544, 2668, 2794, 2922, 3052, 3184, 3318, 3454, 3591, 3731, 3872, 4015, 4160, 4306, 4454, 4604, 4755, 4908, 5062, 5217, 5374, 5533, 5692, 5853, 6016, 6179, 6344, 6510, 6677, 6845, 7015, 7186, 7357, 7530, 7704, 7878, 8054, 8231, 8408, 8587, 8766, 8947, 9128, 9310, 9493, 9676, 9861, 10046, 10232, 10418, 10606, 10794, 10983, 11172, 11362, 11553, 11744, 11936, 12129, 12322, 12516, 12710, 12905, 13100, 13296, 13493, 13690, 13887, 14085, 14283, 14482, 14681, 14881, 15081, 15282, 15483, 15684, 15886, 16088, 16290, 16493, 16696, 16900, 17104, 17308, 17513, 17717, 17923, 18128, 18334, 18540, 18746, 18953, 19160, 19367, 19575, 19782, 19990, 20198, 20407, 20616, 20824, 21034, 21243, 21452, 21662, 21872, 22082, 22293, 22503, 22714, 22925, 23136, 23347, 23559, 23770, 23982, 24194, 24406, 24618, 24830, 25043, 25256, 25468, 25681, 25894, 26108, 26321, 26534, 26748, 26962, 27175, 27389, 27603, 27817, 28032, 28246, 28460, 28675, 28889, 29104, 29319, 29534, 29749, 29964, 30179, 30394, 30610, 30825, 31041, 31256, 31472, 31687, 31903, 32119, 32335, 32551, 32767, 
+0, 0, 0, 0, 0, 0, 0, 0, 5, 15, 29, 48, 72, 99, 132, 168, 208, 253, 301, 354, 410, 469, 532, 599, 669, 743, 820, 900, 983, 1069, 1158, 1250, 1345, 1443, 1543, 1646, 1752, 1860, 1971, 2085, 2200, 2318, 2438, 2561, 2686, 2812, 2941, 3072, 3205, 3340, 3477, 3615, 3756, 3898, 4042, 4188, 4335, 4484, 4635, 4787, 4940, 5095, 5252, 5410, 5569, 5730, 5892, 6056, 6220, 6386, 6553, 6721, 6891, 7062, 7233, 7406, 7580, 7755, 7931, 8107, 8285, 8464, 8644, 8824, 9006, 9188, 9371, 9556, 9740, 9926, 10112, 10300, 10487, 10676, 10865, 11055, 11246, 11438, 11630, 11822, 12015, 12209, 12404, 12599, 12794, 12991, 13187, 13384, 13582, 13780, 13979, 14178, 14378, 14578, 14779, 14980, 15181, 15383, 15585, 15788, 15991, 16195, 16398, 16603, 16807, 17012, 17217, 17423, 17629, 17835, 18042, 18248, 18456, 18663, 18871, 19079, 19287, 19496, 19705, 19914, 20123, 20333, 20542, 20752, 20963, 21173, 21384, 21595, 21806, 22017, 22229, 22441, 22653, 22865, 23077, 23289, 23502, 23715, 23928, 24141, 24354, 24568, 24781, 24995, 25209, 25423, 25637, 25852, 26066, 26281, 26496, 26710, 26925, 27140, 27356, 27571, 27786, 28002, 28218, 28433, 28649, 28865, 29081, 29297, 29514, 29730, 29946, 30163, 30379, 30596, 30813, 31030, 31247, 31464, 31681, 31898, 32115, 32332, 32550, 32767, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 15, 29, 48, 72, 100, 132, 169, 210, 255, 303, 356, 412, 472, 536, 603, 674, 748, 825, 906, 989, 1076, 1166, 1258, 1354, 1452, 1554, 1657, 1764, 1873, 1984, 2098, 2215, 2334, 2455, 2578, 2703, 2831, 2961, 3093, 3226, 3362, 3500, 3639, 3781, 3924, 4069, 4216, 4364, 4514, 4665, 4819, 4973, 5129, 5287, 5446, 5607, 5768, 5932, 6096, 6262, 6429, 6597, 6766, 6937, 7109, 7282, 7455, 7630, 7806, 7984, 8162, 8341, 8521, 8701, 8883, 9066, 9250, 9434, 9619, 9805, 9992, 10180, 10368, 10558, 10747, 10938, 11129, 11321, 11514, 11707, 11901, 12096, 12291, 12487, 12683, 12880, 13077, 13275, 13474, 13673, 13872, 14072, 14273, 14474, 14675, 14877, 15080, 15283, 15486, 15689, 15893, 16098, 16303, 16508, 16713, 16919, 17126, 17332, 17539, 17747, 17954, 18162, 18370, 18579, 18788, 18997, 19206, 19416, 19626, 19836, 20047, 20257, 20468, 20680, 20891, 21103, 21315, 21527, 21739, 21952, 22164, 22377, 22590, 22804, 23017, 23231, 23445, 23659, 23873, 24088, 24302, 24517, 24732, 24947, 25162, 25378, 25593, 25809, 26024, 26240, 26456, 26673, 26889, 27105, 27322, 27538, 27755, 27972, 28189, 28406, 28623, 28841, 29058, 29275, 29493, 29711, 29929, 30146, 30364, 30582, 30800, 31019, 31237, 31455, 31674, 31892, 32111, 32329, 32548, 32767, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 15, 29, 49, 72, 101, 133, 170, 211, 256, 305, 358, 415, 475, 540, 607, 678, 753, 831, 912, 996, 1083, 1174, 1267, 1363, 1462, 1564, 1669, 1776, 1885, 1998, 2113, 2230, 2349, 2471, 2595, 2722, 2850, 2981, 3113, 3248, 3385, 3523, 3664, 3806, 3950, 4096, 4244, 4393, 4544, 4697, 4851, 5007, 5164, 5323, 5483, 5644, 5807, 5971, 6137, 6304, 6472, 6641, 6812, 6984, 7156, 7330, 7506, 7682, 7859, 8037, 8216, 8397, 8578, 8760, 8943, 9127, 9312, 9497, 9684, 9871, 10059, 10248, 10438, 10629, 10820, 11012, 11204, 11397, 11591, 11786, 11981, 12177, 12373, 12571, 12768, 12966, 13165, 13365, 13564, 13765, 13966, 14167, 14369, 14571, 14774, 14977, 15181, 15385, 15590, 15795, 16000, 16206, 16412, 16619, 16826, 17033, 17241, 17449, 17657, 17866, 18075, 18284, 18494, 18704, 18914, 19125, 19335, 19546, 19758, 19969, 20181, 20394, 20606, 20819, 21031, 21245, 21458, 21671, 21885, 22099, 22313, 22528, 22742, 22957, 23172, 23387, 23603, 23818, 24034, 24250, 24466, 24682, 24898, 25115, 25331, 25548, 25765, 25982, 26199, 26417, 26634, 26852, 27070, 27287, 27505, 27724, 27942, 28160, 28378, 28597, 28816, 29034, 29253, 29472, 29691, 29910, 30130, 30349, 30568, 30788, 31008, 31227, 31447, 31667, 31887, 32107, 32327, 32547, 32767, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 15, 30, 49, 73, 101, 134, 171, 213, 258, 307, 361, 418, 479, 543, 611, 683, 758, 836, 918, 1003, 1091, 1182, 1275, 1372, 1472, 1575, 1680, 1788, 1898, 2011, 2127, 2245, 2365, 2488, 2613, 2740, 2869, 3001, 3135, 3270, 3408, 3547, 3689, 3832, 3977, 4124, 4273, 4423, 4575, 4729, 4884, 5041, 5199, 5359, 5520, 5682, 5846, 6012, 6179, 6347, 6516, 6686, 6858, 7031, 7205, 7380, 7556, 7734, 7912, 8092, 8272, 8453, 8636, 8819, 9004, 9189, 9375, 9562, 9750, 9938, 10128, 10318, 10509, 10700, 10893, 11086, 11280, 11475, 11670, 11866, 12062, 12259, 12457, 12656, 12855, 13054, 13254, 13455, 13656, 13858, 14060, 14263, 14466, 14670, 14874, 15079, 15284, 15489, 15695, 15902, 16109, 16316, 16523, 16731, 16940, 17148, 17357, 17567, 17777, 17987, 18197, 18408, 18619, 18830, 19042, 19254, 19466, 19679, 19892, 20105, 20318, 20531, 20745, 20959, 21174, 21388, 21603, 21818, 22033, 22249, 22464, 22680, 22896, 23112, 23329, 23545, 23762, 23979, 24196, 24414, 24631, 24849, 25067, 25285, 25503, 25721, 25939, 26158, 26377, 26595, 26814, 27033, 27253, 27472, 27691, 27911, 28131, 28351, 28570, 28791, 29011, 29231, 29451, 29672, 29892, 30113, 30334, 30554, 30775, 30996, 31217, 31438, 31660, 31881, 32102, 32324, 32545, 32767, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 15, 30, 49, 73, 102, 135, 173, 214, 260, 310, 363, 421, 482, 547, 615, 688, 763, 842, 924, 1009, 1098, 1190, 1284, 1382, 1482, 1585, 1691, 1800, 1911, 2025, 2141, 2260, 2381, 2505, 2631, 2759, 2889, 3021, 3156, 3292, 3431, 3571, 3714, 3858, 4004, 4152, 4302, 4453, 4606, 4761, 4917, 5075, 5234, 5395, 5557, 5721, 5886, 6053, 6221, 6390, 6560, 6732, 6905, 7079, 7254, 7430, 7608, 7786, 7966, 8147, 8328, 8511, 8695, 8879, 9065, 9251, 9439, 9627, 9816, 10006, 10196, 10388, 10580, 10773, 10967, 11162, 11357, 11553, 11749, 11946, 12144, 12343, 12542, 12742, 12942, 13143, 13345, 13547, 13749, 13952, 14156, 14360, 14565, 14770, 14975, 15181, 15388, 15595, 15802, 16010, 16218, 16427, 16636, 16845, 17055, 17265, 17476, 17686, 17898, 18109, 18321, 18533, 18746, 18959, 19172, 19385, 19599, 19813, 20027, 20241, 20456, 20671, 20887, 21102, 21318, 21534, 21750, 21967, 22183, 22400, 22617, 22835, 23052, 23270, 23488, 23706, 23924, 24143, 24361, 24580, 24799, 25018, 25237, 25457, 25676, 25896, 26116, 26336, 26556, 26777, 26997, 27218, 27438, 27659, 27880, 28101, 28322, 28544, 28765, 28987, 29208, 29430, 29652, 29874, 30096, 30318, 30540, 30762, 30985, 31207, 31430, 31653, 31875, 32098, 32321, 32544, 32767, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 5, 10, 18, 29, 43, 61, 83, 110, 141, 178, 218, 263, 312, 366, 423, 484, 550, 619, 691, 768, 847, 931, 1018, 1108, 1201, 1297, 1397, 1499, 1605, 1713, 1824, 1938, 2055, 2174, 2296, 2421, 2548, 2677, 2809, 2943, 3079, 3217, 3358, 3501, 3645, 3792, 3941, 4091, 4244, 4398, 4555, 4713, 4872, 5034, 5197, 5361, 5527, 5695, 5864, 6035, 6207, 6381, 6555, 6732, 6909, 7088, 7268, 7450, 7632, 7816, 8001, 8187, 8374, 8562, 8751, 8941, 9132, 9324, 9518, 9712, 9907, 10103, 10299, 10497, 10695, 10895, 11095, 11296, 11497, 11700, 11903, 12106, 12311, 12516, 12722, 12928, 13136, 13343, 13552, 13761, 13970, 14180, 14391, 14602, 14814, 15026, 15239, 15452, 15666, 15880, 16095, 16310, 16526, 16742, 16958, 17175, 17393, 17610, 17828, 18047, 18266, 18485, 18704, 18924, 19144, 19365, 19586, 19807, 20029, 20250, 20472, 20695, 20918, 21141, 21364, 21587, 21811, 22035, 22259, 22484, 22709, 22934, 23159, 23384, 23610, 23836, 24062, 24288, 24514, 24741, 24968, 25195, 25422, 25649, 25877, 26105, 26332, 26561, 26789, 27017, 27246, 27474, 27703, 27932, 28161, 28390, 28620, 28849, 29079, 29308, 29538, 29768, 29998, 30228, 30459, 30689, 30920, 31150, 31381, 31612, 31842, 32073, 32305, 32536, 32767, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 6, 11, 19, 31, 46, 65, 89, 118, 152, 191, 235, 283, 336, 393, 455, 521, 591, 665, 744, 826, 912, 1001, 1095, 1192, 1292, 1396, 1503, 1613, 1726, 1843, 1963, 2085, 2211, 2339, 2470, 2604, 2741, 2880, 3021, 3166, 3312, 3461, 3612, 3766, 3922, 4079, 4239, 4402, 4566, 4732, 4900, 5070, 5241, 5415, 5590, 5767, 5946, 6127, 6309, 6492, 6677, 6864, 7052, 7242, 7433, 7625, 7819, 8014, 8210, 8408, 8607, 8807, 9008, 9211, 9414, 9619, 9824, 10031, 10239, 10448, 10657, 10868, 11080, 11292, 11506, 11720, 11936, 12152, 12369, 12586, 12805, 13024, 13244, 13465, 13686, 13908, 14131, 14355, 14579, 14804, 15029, 15255, 15482, 15709, 15937, 16165, 16394, 16623, 16853, 17084, 17315, 17546, 17778, 18011, 18244, 18477, 18711, 18945, 19179, 19414, 19650, 19886, 20122, 20358, 20595, 20833, 21070, 21308, 21546, 21785, 22024, 22263, 22503, 22743, 22983, 23223, 23464, 23705, 23946, 24188, 24430, 24672, 24914, 25156, 25399, 25642, 25885, 26129, 26372, 26616, 26860, 27104, 27349, 27593, 27838, 28083, 28328, 28573, 28819, 29065, 29310, 29556, 29803, 30049, 30295, 30542, 30789, 31035, 31282, 31530, 31777, 32024, 32272, 32519, 32767, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 6, 12, 21, 33, 50, 70, 96, 128, 165, 207, 254, 306, 363, 425, 492, 564, 639, 720, 804, 893, 986, 1083, 1184, 1289, 1397, 1509, 1625, 1745, 1867, 1993, 2123, 2255, 2391, 2530, 2672, 2817, 2964, 3115, 3268, 3424, 3582, 3743, 3907, 4073, 4241, 4412, 4585, 4761, 4938, 5118, 5300, 5483, 5669, 5857, 6046, 6238, 6431, 6627, 6823, 7022, 7222, 7424, 7628, 7833, 8039, 8247, 8457, 8668, 8880, 9094, 9309, 9526, 9743, 9962, 10182, 10404, 10626, 10850, 11074, 11300, 11527, 11755, 11984, 12214, 12445, 12677, 12909, 13143, 13378, 13613, 13849, 14087, 14324, 14563, 14803, 15043, 15284, 15526, 15768, 16011, 16255, 16500, 16745, 16991, 17237, 17484, 17732, 17980, 18228, 18478, 18728, 18978, 19229, 19480, 19732, 19984, 20237, 20491, 20744, 20998, 21253, 21508, 21764, 22019, 22276, 22532, 22789, 23047, 23304, 23563, 23821, 24080, 24339, 24598, 24858, 25118, 25378, 25639, 25900, 26161, 26423, 26684, 26947, 27209, 27471, 27734, 27997, 28260, 28524, 28788, 29052, 29316, 29580, 29845, 30109, 30374, 30639, 30905, 31170, 31436, 31702, 31968, 32234, 32500, 32767, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3, 7, 13, 23, 36, 54, 77, 105, 139, 179, 225, 276, 333, 395, 463, 536, 613, 696, 783, 875, 972, 1073, 1179, 1288, 1402, 1521, 1643, 1769, 1899, 2032, 2169, 2310, 2455, 2602, 2753, 2908, 3065, 3226, 3390, 3556, 3726, 3899, 4074, 4252, 4433, 4616, 4802, 4990, 5181, 5374, 5570, 5767, 5967, 6169, 6374, 6580, 6789, 6999, 7211, 7426, 7642, 7860, 8080, 8301, 8524, 8749, 8975, 9203, 9433, 9664, 9897, 10131, 10366, 10603, 10841, 11081, 11322, 11564, 11807, 12052, 12298, 12544, 12793, 13042, 13292, 13543, 13795, 14049, 14303, 14558, 14815, 15072, 15330, 15589, 15849, 16109, 16371, 16633, 16896, 17160, 17425, 17690, 17956, 18223, 18490, 18758, 19027, 19297, 19567, 19837, 20109, 20381, 20653, 20926, 21200, 21474, 21748, 22024, 22299, 22575, 22852, 23129, 23407, 23685, 23963, 24242, 24521, 24801, 25081, 25361, 25642, 25924, 26205, 26487, 26770, 27052, 27335, 27619, 27902, 28186, 28470, 28755, 29040, 29325, 29610, 29896, 30182, 30468, 30755, 31042, 31329, 31616, 31903, 32191, 32479, 32767, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3, 7, 14, 25, 40, 59, 84, 115, 152, 196, 246, 303, 365, 433, 507, 587, 672, 763, 858, 959, 1065, 1176, 1292, 1412, 1537, 1667, 1800, 1939, 2081, 2227, 2378, 2532, 2690, 2852, 3018, 3187, 3360, 3536, 3715, 3898, 4084, 4273, 4465, 4660, 4858, 5059, 5263, 5469, 5678, 5890, 6104, 6321, 6540, 6762, 6986, 7212, 7441, 7671, 7904, 8139, 8376, 8615, 8855, 9098, 9343, 9589, 9837, 10087, 10339, 10592, 10847, 11104, 11362, 11621, 11882, 12145, 12409, 12674, 12941, 13209, 13478, 13749, 14021, 14294, 14568, 14844, 15120, 15398, 15677, 15956, 16237, 16519, 16802, 17086, 17371, 17656, 17943, 18230, 18519, 18808, 19098, 19389, 19680, 19973, 20266, 20560, 20854, 21150, 21446, 21742, 22040, 22338, 22636, 22936, 23235, 23536, 23837, 24138, 24440, 24743, 25046, 25350, 25654, 25959, 26264, 26570, 26876, 27182, 27489, 27797, 28105, 28413, 28722, 29031, 29340, 29650, 29960, 30271, 30582, 30893, 31204, 31516, 31828, 32141, 32454, 32767, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3, 8, 16, 28, 44, 65, 93, 127, 168, 217, 272, 335, 404, 479, 561, 649, 743, 843, 949, 1060, 1177, 1300, 1428, 1561, 1699, 1842, 1990, 2142, 2300, 2461, 2628, 2798, 2973, 3152, 3335, 3522, 3713, 3907, 4106, 4308, 4513, 4722, 4934, 5150, 5369, 5591, 5816, 6044, 6275, 6509, 6746, 6986, 7228, 7473, 7720, 7970, 8223, 8478, 8735, 8994, 9256, 9520, 9786, 10055, 10325, 10597, 10872, 11148, 11426, 11706, 11988, 12271, 12556, 12843, 13132, 13422, 13714, 14007, 14302, 14598, 14895, 15195, 15495, 15797, 16100, 16404, 16710, 17017, 17325, 17634, 17944, 18256, 18568, 18882, 19197, 19512, 19829, 20147, 20466, 20785, 21106, 21427, 21749, 22072, 22396, 22721, 23047, 23373, 23700, 24028, 24357, 24686, 25016, 25347, 25678, 26010, 26343, 26676, 27010, 27344, 27679, 28015, 28351, 28688, 29025, 29363, 29701, 30040, 30379, 30719, 31059, 31400, 31741, 32083, 32425, 32767, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 4, 9, 18, 31, 49, 73, 104, 142, 188, 242, 304, 373, 450, 534, 626, 724, 829, 941, 1059, 1183, 1314, 1451, 1593, 1742, 1896, 2055, 2220, 2391, 2566, 2747, 2932, 3123, 3318, 3517, 3722, 3930, 4143, 4360, 4582, 4807, 5036, 5270, 5506, 5747, 5991, 6239, 6490, 6745, 7003, 7264, 7528, 7795, 8066, 8339, 8615, 8894, 9176, 9460, 9747, 10037, 10329, 10624, 10921, 11220, 11522, 11826, 12132, 12440, 12750, 13063, 13377, 13694, 14012, 14332, 14654, 14978, 15303, 15631, 15960, 16290, 16622, 16956, 17291, 17628, 17966, 18306, 18647, 18989, 19333, 19678, 20025, 20372, 20721, 21071, 21422, 21774, 22128, 22482, 22838, 23195, 23552, 23911, 24271, 24631, 24993, 25355, 25719, 26083, 26448, 26814, 27180, 27548, 27916, 28285, 28655, 29025, 29397, 29769, 30141, 30514, 30888, 31263, 31638, 32014, 32390, 32767, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 4, 10, 20, 35, 55, 82, 117, 160, 212, 273, 343, 422, 508, 603, 706, 817, 936, 1062, 1195, 1336, 1483, 1638, 1799, 1966, 2140, 2320, 2507, 2699, 2897, 3101, 3310, 3525, 3745, 3971, 4201, 4437, 4677, 4923, 5172, 5427, 5686, 5949, 6216, 6488, 6764, 7043, 7327, 7614, 7906, 8200, 8499, 8800, 9106, 9414, 9726, 10041, 10359, 10680, 11004, 11331, 11661, 11993, 12329, 12667, 13007, 13350, 13696, 14044, 14394, 14747, 15102, 15459, 15818, 16180, 16543, 16909, 17276, 17646, 18017, 18390, 18765, 19142, 19520, 19900, 20282, 20666, 21051, 21437, 21825, 22215, 22606, 22998, 23392, 23787, 24184, 24581, 24980, 25381, 25782, 26185, 26588, 26993, 27399, 27806, 28215, 28624, 29034, 29445, 29857, 30270, 30684, 31099, 31515, 31931, 32349, 32767, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 5, 11, 23, 40, 63, 94, 134, 183, 243, 313, 393, 483, 582, 691, 809, 936, 1071, 1216, 1368, 1529, 1698, 1875, 2059, 2251, 2450, 2656, 2869, 3090, 3316, 3550, 3789, 4035, 4288, 4546, 4810, 5079, 5354, 5635, 5921, 6212, 6509, 6810, 7116, 7427, 7743, 8063, 8388, 8717, 9050, 9387, 9729, 10074, 10424, 10777, 11134, 11494, 11858, 12226, 12597, 12971, 13349, 13729, 14113, 14500, 14890, 15283, 15678, 16077, 16478, 16881, 17288, 17696, 18108, 18522, 18938, 19356, 19777, 20200, 20625, 21052, 21481, 21913, 22346, 22781, 23218, 23657, 24098, 24540, 24985, 25431, 25878, 26327, 26778, 27230, 27684, 28140, 28596, 29055, 29514, 29975, 30437, 30901, 31365, 31831, 32299, 32767, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3, 7, 11, 18, 27, 38, 52, 69, 90, 113, 141, 173, 209, 249, 294, 344, 399, 460, 526, 598, 676, 761, 851, 948, 1052, 1163, 1282, 1407, 1540, 1680, 1829, 1985, 2149, 2322, 2503, 2692, 2891, 3098, 3314, 3539, 3773, 4017, 4270, 4533, 4805, 5087, 5379, 5682, 5994, 6317, 6650, 6993, 7347, 7712, 8087, 8473, 8870, 9278, 9698, 10128, 10570, 11023, 11487, 11963, 12451, 12950, 13461, 13983, 14518, 15064, 15623, 16193, 16776, 17370, 17977, 18597, 19228, 19872, 20529, 21198, 21879, 22574, 23280, 24000, 24732, 25477, 26235, 27006, 27790, 28587, 29397, 30220, 31056, 31905, 32767, 
+};
+
+const float B_roof_scale_data_Attitude[ATTITUDE_B_ROOF_WIDTH] = {
+9.58198382823489080235e-10, 9.52036405866049999195e-10, 9.45876101786563342630e-10, 9.39717508741087779800e-10, 9.33560665755968835395e-10, 9.27405612747690707248e-10, 9.21252390543176932930e-10, 9.15101040900558206590e-10, 9.08951606530409827595e-10, 9.02804131117478633294e-10, 8.69039443347806441503e-09, 8.07816757255788622688e-09, 7.46880070224724118357e-09, 6.86301734057176531852e-09, 6.26172404054038217272e-09, 5.66605669418186133571e-09, 5.07743855053769856996e-09, 4.49765291099818284483e-09, 3.92893421504361253611e-09, 1.37600367392390483597e-08, 
+};
+
+const int16_t H_inv_q15_data_Attitude[ATTITUDE_H_INV_HEIGHT*ATTITUDE_H_INV_WIDTH] __attribute__ ((aligned (4))) = {
+32767, -490, -485, -480, -475, -470, -465, -461, -456, -451, -4729, -4128, -3585, -3091, -2642, -2234, -1864, -1531, -1234, -3230, 
+-490, 32767, -480, -475, -471, -466, -461, -456, -451, -447, -4686, -4092, -3555, -3067, -2622, -2218, -1852, -1522, -1227, -3214, 
+-485, -480, 32767, -471, -466, -461, -457, -452, -447, -443, -4643, -4056, -3525, -3042, -2603, -2202, -1839, -1512, -1220, -3198, 
+-480, -476, -471, 32767, -462, -457, -452, -448, -443, -438, -4600, -4021, -3496, -3018, -2583, -2186, -1827, -1502, -1212, -3183, 
+-476, -471, -466, -462, 32767, -452, -448, -443, -439, -434, -4557, -3985, -3466, -2994, -2563, -2171, -1814, -1493, -1205, -3167, 
+-471, -466, -462, -457, -453, 32767, -443, -439, -434, -430, -4514, -3949, -3436, -2969, -2543, -2155, -1802, -1483, -1198, -3151, 
+-466, -462, -457, -453, -448, -444, 32767, -435, -430, -426, -4471, -3913, -3407, -2945, -2523, -2139, -1789, -1474, -1191, -3135, 
+-461, -457, -452, -448, -444, -439, -435, 32767, -426, -422, -4429, -3877, -3377, -2921, -2504, -2123, -1777, -1464, -1183, -3120, 
+-457, -452, -448, -444, -439, -435, -430, -426, 32767, -418, -4386, -3842, -3347, -2896, -2484, -2107, -1764, -1454, -1176, -3104, 
+-452, -448, -443, -439, -435, -430, -426, -422, -418, 32767, -4344, -3806, -3318, -2872, -2464, -2091, -1752, -1445, -1169, -3088, 
+-427, -423, -419, -415, -411, -407, -403, -399, -395, -391, 32767, -3611, -3156, -2738, -2355, -2004, -1683, -1391, -1128, -3000, 
+-381, -378, -374, -371, -367, -364, -361, -357, -354, -351, -3697, 32767, -2864, -2497, -2159, -1846, -1558, -1294, -1054, -2838, 
+-337, -334, -332, -329, -326, -323, -320, -317, -314, -311, -3293, -2919, 32767, -2258, -1963, -1687, -1432, -1195, -979, -2671, 
+-296, -293, -291, -288, -286, -283, -281, -279, -276, -274, -2903, -2586, -2294, 32767, -1768, -1529, -1305, -1096, -903, -2500, 
+-256, -254, -252, -250, -248, -246, -244, -242, -240, -238, -2529, -2265, -2020, -1791, 32767, -1371, -1178, -996, -825, -2322, 
+-219, -217, -215, -214, -212, -211, -209, -207, -206, -204, -2175, -1957, -1755, -1565, -1386, 32767, -1050, -894, -746, -2138, 
+-184, -183, -181, -180, -179, -178, -176, -175, -174, -173, -1842, -1666, -1502, -1348, -1201, -1059, 32767, -792, -666, -1946, 
+-152, -151, -150, -149, -148, -147, -146, -145, -144, -143, -1534, -1393, -1263, -1140, -1022, -908, -797, 32767, -585, -1747, 
+-123, -123, -122, -121, -120, -120, -119, -118, -117, -117, -1251, -1142, -1040, -944, -852, -762, -674, -588, 32767, -1541, 
+-32, -32, -32, -32, -32, -31, -31, -31, -31, -31, -332, -307, -284, -261, -240, -218, -197, -176, -154, 32767, 
+};
+
+const float H_inv_scale_data_Attitude[ATTITUDE_H_INV_WIDTH] = {
+3.34051783890618665396e+01, 3.34148549801088776690e+01, 3.34243813512603225035e+01, 3.34337591570894119286e+01, 3.34429900487938240872e+01, 3.34520756740402021023e+01, 3.34610176767960965094e+01, 3.34698176971501126786e+01, 3.34784773711211016689e+01, 3.34869983304573537453e+01, 3.01287873026286989742e+00, 3.08396838523362726292e+00, 3.14378917191383822072e+00, 3.19381250446053588377e+00, 3.23539782976556411498e+00, 3.26977189037001325644e+00, 3.29801496223168655320e+00, 3.32105565274807901233e+00, 3.33967498666924234030e+00, 3.33816520300627916917e-01, 
+};
+
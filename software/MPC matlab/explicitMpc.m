@@ -0,0 +1,212 @@
+% This script creates ANSI C code with the tables of the explicit
+% (piecewise-affine) MPC for the STM (MPC_EXPLICIT in config.h). It should be
+% run after "main.m" which initializes the matrices.
+%
+% The input-constrained QP min 0.5*u'*H*u + c'*u, |u| <= saturation, is solved
+% in closed-loop simulations from random initial conditions and setpoints. Each
+% active set reached this way is a region with the law u = gain*c + offset. The
+% regions are indexed by a binary tree over the planes of their borders.
+
+% the most frequent active sets kept in the tables
+max_regions = 64;
+
+% max depth of the binary tree
+max_depth = 12;
+
+% the sampling simulations
+n_runs = 200;
+run_len = 300;
+
+% the QP is solved until the convergence
+qp_iterations = 2000;
+
+% the box constraints are on the inputs only with move blocking
+if parameterization ~= 1
+    error('the constrained MPC needs the move blocking (parameterization = 1 in main.m)');
+end
+
+% the same as in config.h
+single_step_len = 10;
+
+H_qp = 2*inv(H_inv);
+H_scaling = 1./sum(abs(H_qp), 2);
+
+%% Sample the space of the linear term c
+
+samples = zeros(n_variables, n_runs*run_len);
+sample_sets = zeros(n_runs*run_len, n_variables);
+n_samples = 0;
+
+for run=1:n_runs
+
+    x_sample = [10*(rand - 0.5); 2*(rand - 0.5); 0; 0; 0];
+    setpoint = 10*(rand - 0.5);
+    u_warm = zeros(n_variables, 1);
+
+    for i=1:run_len
+
+        % the input preshaper towards the setpoint
+        reference = x_sample(1);
+        for j=2:horizon_len
+            diference = reference(j-1) - setpoint;
+
+            if (diference > max_speed*dt)
+                diference = max_speed*dt;
+            elseif (diference < -max_speed*dt)
+                diference = -max_speed*dt;
+            end
+
+            reference(j) = reference(j-1) - diference;
+        end
+
+        my_ref = zeros(n_states*horizon_len, 1);
+        my_ref(1:n_states:n_states*horizon_len, 1) = reference;
+
+        X_0 = A_roof*x_sample - my_ref;
+        c = (X_0'*Q_roof*B_roof)';
+
+        u_warm(1:single_step_len) = u_warm(2:single_step_len+1);
+        u_warm = projectedGradient(H_qp, H_scaling, c, u_warm, saturation, qp_iterations, 0);
+
+        n_samples = n_samples + 1;
+        samples(:, n_samples) = c;
+        sample_sets(n_samples, :) = (u_warm' >= saturation - 1e-3) - (u_warm' <= -saturation + 1e-3);
+
+        x_sample = A*x_sample + B*u_warm(1);
+    end
+end
+
+%% The regions, the most frequent active sets
+
+[sets, ~, labels] = unique(sample_sets, 'rows');
+counts = accumarray(labels, 1);
+[~, order] = sort(counts, 'descend');
+order = order(1:min(max_regions, length(order)));
+
+n_regions = length(order);
+
+% relabel the samples, 0 for the active sets which are not kept
+region_of_set = zeros(size(sets, 1), 1);
+region_of_set(order) = 1:n_regions;
+sample_regions = region_of_set(labels);
+
+fprintf('%d samples, %d active sets, %d regions cover %2.1f%% of the samples\n', n_samples, size(sets, 1), n_regions, 100*sum(sample_regions > 0)/n_samples);
+
+%% The affine law and the borders of each region
+
+gain = zeros(n_variables, n_variables, n_regions);
+offset = zeros(n_variables, n_regions);
+active = zeros(n_variables, n_regions);
+
+% the planes a*c <= b of the borders, one row [a, b]
+facets = [];
+facet_regions = [];
+
+for r=1:n_regions
+
+    active(:, r) = sets(order(r), :)';
+
+    F = find(active(:, r) == 0);
+    A_set = find(active(:, r) ~= 0);
+
+    offset(A_set, r) = active(A_set, r)*saturation;
+
+    % the free inputs minimize the cost with the active ones at their limits
+    gain(F, F, r) = -inv(H_qp(F, F));
+    offset(F, r) = -H_qp(F, F)\(H_qp(F, A_set)*offset(A_set, r));
+
+    % the free inputs within the limits
+    for i=F'
+        facets = [facets; gain(i, :, r), saturation - offset(i, r); -gain(i, :, r), saturation + offset(i, r)];
+        facet_regions = [facet_regions; r; r];
+    end
+
+    % the gradient pushes the active inputs against their limits
+    for i=A_set'
+        a = H_qp(i, :)*gain(:, :, r);
+        a(i) = a(i) + 1;
+        facets = [facets; active(i, r)*a, -active(i, r)*H_qp(i, :)*offset(:, r)];
+        facet_regions = [facet_regions; r];
+    end
+end
+
+% normalize the planes
+facets = facets./repmat(sqrt(sum(facets(:, 1:n_variables).^2, 2)), 1, n_variables + 1);
+
+%% The binary tree
+
+known = find(sample_regions > 0);
+[node_plane, node_child, leaf_start, leaf_regions] = explicitTree(samples(:, known), sample_regions(known), counts(order), facets, facet_regions, max_depth);
+
+fprintf('%d nodes, %d leaves, %d candidates in the leaves\n', size(node_plane, 1), length(leaf_start) - 1, length(leaf_regions));
+
+%% Print the C code
+
+fid = fopen('elevAileExplicitMpc.h', 'w');
+
+fprintf(fid, '/*\n * elevAileExplicitMpc.h\n *\n * This file was created automatically by explicitMpc.m\n */\n\n');
+fprintf(fid, '#ifndef ELEVAILEEXPLICITMPC_H_\n#define ELEVAILEEXPLICITMPC_H_\n\n');
+fprintf(fid, '#include "mpc/mpc.h"\n\n');
+fprintf(fid, '#define ATTITUDE_EXPLICIT_REGIONS\t\t%d\n', n_regions);
+fprintf(fid, '#define ATTITUDE_EXPLICIT_NODES\t\t\t%d\n', size(node_plane, 1));
+fprintf(fid, '#define ATTITUDE_EXPLICIT_LEAVES\t\t%d\n', length(leaf_start) - 1);
+fprintf(fid, '#define ATTITUDE_EXPLICIT_CANDIDATES\t%d\n\n', length(leaf_regions));
+fprintf(fid, 'extern const explicitMpc_t explicit_mpc_Attitude;\n\n');
+fprintf(fid, '#endif /* ELEVAILEEXPLICITMPC_H_ */\n');
+
+fclose(fid);
+
+fid = fopen('elevAileExplicitMpc.c', 'w');
+
+fprintf(fid, '#include "CMatrixLib.h"\n');
+fprintf(fid, '#include "elevAileExplicitMpc.h"\n');
+fprintf(fid, '#include "elevAileMpcMatrices.h"\n\n');
+
+fprintf(fid, '/*\n');
+fprintf(fid, 'This file was created automatically with following parameters\n\n');
+
+printMatrixM(fid, 'saturation', '%d', saturation);
+printMatrixM(fid, 'max_regions', '%d', max_regions);
+printMatrixM(fid, 'n_runs', '%d', n_runs);
+printMatrixM(fid, 'run_len', '%d', run_len);
+
+fprintf(fid, '*/\n\n');
+
+% the gains are printed row by row for each region
+gain_rows = zeros(n_regions*n_variables, n_variables);
+for r=1:n_regions
+    gain_rows((r-1)*n_variables+1:r*n_variables, :) = gain(:, :, r);
+end
+
+printMatrixC(fid, 'const float explicit_gain_data_Attitude[ATTITUDE_EXPLICIT_REGIONS*ATTITUDE_REDUCED_HORIZON_LEN*ATTITUDE_REDUCED_HORIZON_LEN]', '%15.20e', gain_rows);
+
+printMatrixC(fid, 'const float explicit_offset_data_Attitude[ATTITUDE_EXPLICIT_REGIONS*ATTITUDE_REDUCED_HORIZON_LEN]', '%15.20e', offset');
+
+printMatrixC(fid, 'const int8_t explicit_active_data_Attitude[ATTITUDE_EXPLICIT_REGIONS*ATTITUDE_REDUCED_HORIZON_LEN]', '%d', active');
+
+% the tree is never empty in C, a dummy node when there is only a leaf
+if (isempty(node_plane))
+    printMatrixC(fid, 'const float explicit_node_plane_data_Attitude[1]', '%d', 0);
+    printMatrixC(fid, 'const int16_t explicit_node_child_data_Attitude[1]', '%d', 0);
+else
+    printMatrixC(fid, 'const float explicit_node_plane_data_Attitude[ATTITUDE_EXPLICIT_NODES*(ATTITUDE_REDUCED_HORIZON_LEN+1)]', '%15.20e', node_plane);
+    printMatrixC(fid, 'const int16_t explicit_node_child_data_Attitude[ATTITUDE_EXPLICIT_NODES*2]', '%d', node_child);
+end
+
+printMatrixC(fid, 'const int16_t explicit_leaf_start_data_Attitude[ATTITUDE_EXPLICIT_LEAVES+1]', '%d', leaf_start');
+
+printMatrixC(fid, 'const int16_t explicit_leaf_regions_data_Attitude[ATTITUDE_EXPLICIT_CANDIDATES]', '%d', leaf_regions');
+
+fprintf(fid, 'const explicitMpc_t explicit_mpc_Attitude = {\n');
+fprintf(fid, '\tATTITUDE_EXPLICIT_REGIONS,\n');
+fprintf(fid, '\tATTITUDE_EXPLICIT_NODES,\n');
+fprintf(fid, '\texplicit_gain_data_Attitude,\n');
+fprintf(fid, '\texplicit_offset_data_Attitude,\n');
+fprintf(fid, '\texplicit_active_data_Attitude,\n');
+fprintf(fid, '\texplicit_node_plane_data_Attitude,\n');
+fprintf(fid, '\texplicit_node_child_data_Attitude,\n');
+fprintf(fid, '\texplicit_leaf_start_data_Attitude,\n');
+fprintf(fid, '\texplicit_leaf_regions_data_Attitude\n');
+fprintf(fid, '};\n');
+
+fclose(fid);
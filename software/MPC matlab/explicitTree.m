@@ -0,0 +1,83 @@
+function [ node_plane, node_child, leaf_start, leaf_regions ] = explicitTree(samples, sample_regions, region_counts, facets, facet_regions, max_depth)
+% Builds the binary tree of the explicit MPC. Each node splits the samples of
+% the linear term by one of the borders of the regions present in it, the one
+% leaving the least regions on the worse side. A leaf lists its candidate
+% regions, the most frequent first. The regions, nodes and leaves are indexed
+% from 0 as in C, a child -(leaf+1) is a leaf.
+
+    n_variables = size(samples, 1);
+
+    node_plane = zeros(0, n_variables + 1);
+    node_child = zeros(0, 2);
+    leaf_start = 0;
+    leaf_regions = [];
+
+    % the nodes to be processed: its samples, depth, parent node and side in it
+    stack_samples = {1:size(samples, 2)};
+    stack_info = [0, 0, 0];
+
+    while ~isempty(stack_samples)
+
+        idx = stack_samples{end};
+        depth = stack_info(end, 1);
+        parent = stack_info(end, 2);
+        side = stack_info(end, 3);
+
+        stack_samples(end) = [];
+        stack_info(end, :) = [];
+
+        regions = unique(sample_regions(idx));
+
+        best = 0;
+        best_score = length(regions);
+
+        if (length(regions) > 1 && depth < max_depth)
+
+            % try the borders of all regions in this node
+            for f=find(ismember(facet_regions, regions))'
+
+                left = (facets(f, 1:n_variables)*samples(:, idx) <= facets(f, end));
+
+                if (all(left) || ~any(left))
+                    continue;
+                end
+
+                score = max(length(unique(sample_regions(idx(left)))), length(unique(sample_regions(idx(~left)))));
+
+                if (score < best_score)
+                    best_score = score;
+                    best = f;
+                    best_left = left;
+                end
+            end
+        end
+
+        if (best == 0)
+
+            % a leaf, the most frequent regions are tried first
+            [~, o] = sort(region_counts(regions), 'descend');
+            leaf_regions = [leaf_regions; regions(o) - 1];
+            leaf_start = [leaf_start; length(leaf_regions)];
+
+            child = -(length(leaf_start) - 1);
+
+        else
+
+            node_plane = [node_plane; facets(best, :)];
+            node_child = [node_child; 0, 0];
+
+            child = size(node_plane, 1) - 1;
+
+            stack_samples{end+1} = idx(~best_left);
+            stack_info(end+1, :) = [depth + 1, child + 1, 2];
+
+            stack_samples{end+1} = idx(best_left);
+            stack_info(end+1, :) = [depth + 1, child + 1, 1];
+        end
+
+        if (parent > 0)
+            node_child(parent, side) = child;
+        end
+    end
+
+end
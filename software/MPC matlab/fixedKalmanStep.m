@@ -0,0 +1,20 @@
+function [ states ] = fixedKalmanStep(states, measurement, input, tables)
+% One step of the fixed-point kalman filter, bit-exact with fixedKalmanStep()
+% in fixedMpc.c on the xMega. The states and the measurement are integers in
+% Q7.24, the input is the integer controller output.
+
+    x = zeros(5, 1);
+
+    % the prediction, only the nonzero elements of A and B
+    x(1) = fixedSaturate(states(1) + fixedMultiply(states(2), tables.dt_gain, tables.dt_shift));
+    x(2) = fixedSaturate(states(2) + fixedMultiply(states(3), tables.dt_gain, tables.dt_shift));
+    x(3) = fixedSaturate(states(4) + states(5));
+    x(4) = fixedSaturate(fixedMultiply(states(4), tables.p0_gain, tables.p0_shift) + fixedMultiply(input, tables.p1_gain, tables.p1_shift - tables.state_shift));
+    x(5) = states(5);
+
+    % the correction by the measured velocity
+    innovation = fixedSaturate(measurement - x(2));
+
+    states = fixedSaturate(x + fixedMultiply(innovation, tables.kalman_gain, tables.kalman_shift));
+
+end
@@ -0,0 +1,33 @@
+function [ output ] = fixedMpcStep(states, setpoint, tables, saturation)
+% The first action of the fixed-point condensed MPC, bit-exact with
+% fixedMpcStep() in fixedMpc.c on the xMega. The states and the setpoint are
+% integers in Q7.24.
+
+    output_shift = tables.state_shift - tables.output_shift;
+
+    % state_gain*x, the position gain includes the sum of the reference gains
+    output = 0;
+    for i=1:5
+        output = fixedSaturate(output + fixedMultiply(states(i), tables.state_gain(i), tables.state_gain_shift(i) + output_shift));
+    end
+
+    % the preshaped reference relative to the position
+    difference = fixedSaturate(setpoint - states(1));
+
+    ramp = (0:length(tables.reference_gain)-1)'*tables.reference_step;
+    offset = min(max(difference, -ramp), ramp);
+
+    offset_short = floor((offset + 2^(tables.state_shift - tables.offset_shift - 1))/2^(tables.state_shift - tables.offset_shift));
+
+    % the sum is bounded by the tables, it is saturated at each step on the xMega
+    reference = 0;
+    for i=1:length(offset_short)
+        reference = fixedSaturate(reference + offset_short(i)*tables.reference_gain(i));
+    end
+
+    output = fixedSaturate(output + fixedMultiply(reference, 1, tables.offset_shift + tables.reference_shift - tables.output_shift));
+
+    output = fixedMultiply(output, 1, tables.output_shift);
+    output = min(max(output, -saturation), saturation);
+
+end
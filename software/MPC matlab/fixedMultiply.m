@@ -0,0 +1,8 @@
+function [ result ] = fixedMultiply(value, gain, shift)
+% value*gain*2^-shift rounded to the nearest and saturated to int32, the same
+% as fixedMultiply() in fixedMpc.c on the xMega. The values are integers in
+% doubles, the products fit in 47 bits and are exact.
+
+    result = fixedSaturate(floor((value.*gain + 2.^(shift - 1))./2.^shift));
+
+end
@@ -0,0 +1,6 @@
+function [ value ] = fixedSaturate(value)
+% Saturates integers (in doubles) to int32, the same as on the xMega
+
+    value = min(max(value, -2^31), 2^31 - 1);
+
+end
@@ -0,0 +1,34 @@
+function [ U ] = laguerreBasis(horizon_len, n_functions, pole)
+% The inputs over the horizon as a sum of discrete Laguerre functions,
+% u(k) = U(k, :)*eta. The functions follow L(k+1) = A_l*L(k) from
+% L(0) = sqrt(1 - pole^2)*[1; -pole; pole^2; ...].
+%
+% The coefficients are transformed so that the first one is the first input,
+% U(1, :) = [1, 0, ..., 0], the STM takes the first decision variable as the
+% action the same way as with move blocking.
+
+    beta = 1 - pole^2;
+
+    A_l = pole*eye(n_functions);
+    for i=2:n_functions
+        for j=1:i-1
+            A_l(i, j) = ((-pole)^(i-j-1))*beta;
+        end
+    end
+
+    L = sqrt(beta)*((-pole).^(0:n_functions-1))';
+
+    U = zeros(horizon_len, n_functions);
+
+    for k=1:horizon_len
+        U(k, :) = L';
+        L = A_l*L;
+    end
+
+    % eta = first_input\eta_new, the first row of first_input is U(1, :)
+    first_input = eye(n_functions);
+    first_input(1, :) = U(1, :);
+
+    U = U/first_input;
+
+end
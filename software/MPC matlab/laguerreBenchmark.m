@@ -0,0 +1,82 @@
+% This script compares the Laguerre functions with the move blocking as the
+% parameterization of the inputs (parameterization in main.m). It should be
+% run after "main.m" which initializes the matrices and the reference.
+%
+% Each parameterization is simulated in the closed loop without noise (the
+% unconstrained MPC saturated on the xMega) and the tracking error is printed
+% together with the size of the tables on the STM and the multiply-accumulates
+% of the MPC step which depend on the number of the variables (MPC_FULL_VECTOR,
+% MPC_QUANTIZED). The condensed MPC costs the same for all of them. The cycles
+% are measured on the board in mpcBenchmark (MPC_BENCHMARK in config.h).
+
+% the tested numbers of the Laguerre functions
+laguerre_sizes = [4, 6, 8];
+
+% simulation length
+bench_len = 2500;
+
+% the tracking error is measured after the initial transient
+settle_len = 300;
+
+weighted_rows = find(diag(Q_roof) ~= 0);
+
+bases = {moveBlocking(horizon_len)};
+names = {'move blocking'};
+
+for n=laguerre_sizes
+    bases{end+1} = laguerreBasis(horizon_len, n, laguerre_pole);
+    names{end+1} = sprintf('Laguerre, pole %1.2f', laguerre_pole);
+end
+
+fprintf('%-24s %9s %12s %12s %12s %12s\n', 'parameterization', 'variables', 'rms error', 'float bytes', 'int16 bytes', 'MAC/step');
+
+for b=1:length(bases)
+
+    U_bench = bases{b};
+    n_bench = size(U_bench, 2);
+
+    B_bench = B_roof_steps*U_bench;
+    H_bench = B_bench'*Q_roof*B_bench + P*(U_bench'*U_bench);
+    H_inv_bench = (0.5*H_bench)^(-1);
+
+    % the condensed first action, u = state_gain*x + reference_gain*reference
+    first_row = -0.5*H_inv_bench(1, :)*B_bench'*Q_roof;
+    state_gain = first_row*A_roof;
+    reference_gain = -first_row(1:n_states:end);
+
+    x_bench = zeros(n_states, bench_len);
+    x_bench(:, 1) = [3; 0; 0; 0; 0];
+
+    for i=2:bench_len
+
+        % the input preshaper, the same as in main.m
+        reference = x_bench(1, i-1);
+        for j=2:horizon_len
+            diference = reference(j-1) - x_ref(j+i-1);
+
+            if (diference > max_speed*dt)
+                diference = max_speed*dt;
+            elseif (diference < -max_speed*dt)
+                diference = -max_speed*dt;
+            end
+
+            reference(j) = reference(j-1) - diference;
+        end
+
+        u_bench = state_gain*x_bench(:, i-1) + reference_gain*reference';
+        u_bench = min(max(u_bench, -saturation), saturation);
+
+        x_bench(:, i) = A*x_bench(:, i-1) + B*u_bench;
+    end
+
+    tracking_error = x_bench(1, settle_len:bench_len) - x_ref(settle_len:bench_len)';
+
+    % B_roof (weighted rows) and H_inv, the int16 copies with their scales
+    float_bytes = 4*(length(weighted_rows)*n_bench + n_bench*n_bench);
+    int16_bytes = 2*(length(weighted_rows)*n_bench + n_bench*n_bench) + 4*2*n_bench;
+
+    % the free response by recurrence, c = B_roof'*error and the first row of H_inv
+    macs = horizon_len*n_states*n_states + length(weighted_rows)*n_bench + n_bench;
+
+    fprintf('%-24s %9d %12.4f %12d %12d %12d\n', names{b}, n_bench, sqrt(mean(tracking_error.^2)), float_bytes, int16_bytes, macs);
+end
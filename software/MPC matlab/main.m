@@ -57,23 +57,23 @@ u_size = size(B, 2);
 % prediction horizon length
 horizon_len = 200;
 
-%% U matrix
-
-n_variables = 20;
-
-U = zeros(horizon_len, n_variables);
-
-U(1:10, 1:10) = eye(10);
-U(11:20, 11) = 1;
-U(21:30, 12) = 1;
-U(31:40, 13) = 1;
-U(41:50, 14) = 1;
-U(51:60, 15) = 1;
-U(61:70, 16) = 1;
-U(71:80, 17) = 1;
-U(81:90, 18) = 1;
-U(91:100, 19) = 1;
-U(101:200, 20) = 1;
+%% U matrix, the inputs over the horizon from the decision variables
+
+% 1 = move blocking, 20 variables
+% 2 = discrete Laguerre functions, n_laguerre variables
+parameterization = 1;
+
+% number of the Laguerre functions and their pole
+n_laguerre = 6;
+laguerre_pole = 0.95;
+
+if parameterization == 1
+    U = moveBlocking(horizon_len);
+else
+    U = laguerreBasis(horizon_len, n_laguerre, laguerre_pole);
+end
+
+n_variables = size(U, 2);
  
 %% A_roof matrix
 % n = prediction horizon length
@@ -106,6 +106,9 @@ for i=1:horizon_len
     end
 end
 
+% the prediction for single steps, used by laguerreBenchmark.m
+B_roof_steps = B_roof;
+
 B_roof = B_roof*U;
 
 %% Q_roof matrix
@@ -172,20 +175,12 @@ Q_roof(end-n_states+1:end, end-n_states+1:end) = S;
 %           0,   P,   ...,  0;
 %           ..., ..., P,    0;
 %           0,   ..., ...,  P];
+% on the inputs over the horizon, P_roof = P*U'*U for the decision variables
 
 P = 0.0000018;
 
-P_roof = zeros(n_variables, n_variables);
-
-for i=1:n_variables
-    P_roof(i, i) = P;
-end
-
-for i=11:19
-    P_roof(i, i) = 10*P; 
-end
-
-P_roof(20, 20) = 100*P;
+% P*(block length) on the diagonal with move blocking
+P_roof = P*(U'*U);
 
 %% H matrix
 % the main matrix of the quadratic form
@@ -0,0 +1,19 @@
+function [ U ] = moveBlocking(horizon_len)
+% The move-blocking matrix, 10 single steps, blocks of 10 samples and the
+% last block of 100 samples (20 variables)
+
+    U = zeros(horizon_len, 20);
+
+    U(1:10, 1:10) = eye(10);
+    U(11:20, 11) = 1;
+    U(21:30, 12) = 1;
+    U(31:40, 13) = 1;
+    U(41:50, 14) = 1;
+    U(51:60, 15) = 1;
+    U(61:70, 16) = 1;
+    U(71:80, 17) = 1;
+    U(81:90, 18) = 1;
+    U(91:100, 19) = 1;
+    U(101:200, 20) = 1;
+
+end
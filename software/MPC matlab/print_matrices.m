@@ -18,24 +18,65 @@ printMatrixM(fid, 'A', '%1.8f', A);
 printMatrixM(fid, 'B', '%1.8f', B);
 printMatrixM(fid, 'horizon_len', '%d', horizon_len);
 printMatrixM(fid, 'n_variables', '%d', n_variables);
+printMatrixM(fid, 'parameterization', '%d', parameterization);
+if parameterization == 2
+    printMatrixM(fid, 'laguerre_pole', '%1.4f', laguerre_pole);
+end
 printMatrixM(fid, 'Q', '%1.3f', Q);
 printMatrixM(fid, 'S', '%1.3f', S);
 printMatrixM(fid, 'P', '%1.10f', P);
 
 fprintf(fid, '*/\n\n');
 
-%% Print A_roof
+% should match ATTITUDE_REDUCED_HORIZON_LEN and ATTITUDE_SINGLE_STEP_LEN in elevAileMpcMatrices.h
+fprintf('ATTITUDE_REDUCED_HORIZON_LEN = %d\n', n_variables);
+if parameterization == 1
+    fprintf('ATTITUDE_SINGLE_STEP_LEN = 10\n');
+else
+    fprintf('ATTITUDE_SINGLE_STEP_LEN = 0, ATTITUDE_LAGUERRE_FUNCTIONS\n');
+end
 
-printMatrixC(fid, 'const float A_roof_data_Attitude[ATTITUDE_A_ROOF_HEIGHT*ATTITUDE_A_ROOF_WIDTH]', '%15.20f', A_roof);
+%% Print A, A_roof*x is computed by recurrence on the STM
 
-%% Print Q_roof_diag
+printMatrixC(fid, 'const float A_data_Attitude[ATTITUDE_NUMBER_OF_STATES*ATTITUDE_NUMBER_OF_STATES]', '%15.20f', A);
 
-printMatrixC(fid, 'const float Q_roof_diag_data_Attitude[ATTITUDE_Q_ROOF_DIAG_SIZE]', '%3.1f', diag(Q_roof));
+%% Print B, the prediction over the latency of the pipeline on the STM (MPC_LATENCY_COMPENSATION)
 
-%% Print B_roof
+printMatrixC(fid, 'const float B_data_Attitude[ATTITUDE_NUMBER_OF_STATES]', '%15.20f', B);
 
-printMatrixC(fid, 'const float B_roof_data_Attitude[ATTITUDE_B_ROOF_HEIGHT*ATTITUDE_B_ROOF_WIDTH]', '%15.20f', B_roof);
+%% Print the rows of the prediction with a nonzero weight (indexed from 0)
+
+weighted_rows = find(diag(Q_roof) ~= 0);
+
+% should match ATTITUDE_WEIGHTED_ROWS in elevAileMpcMatrices.h
+fprintf('ATTITUDE_WEIGHTED_ROWS = %d\n', length(weighted_rows));
+
+printMatrixC(fid, 'const int16_t weighted_rows_data_Attitude[ATTITUDE_WEIGHTED_ROWS]', '%d', weighted_rows - 1);
+
+%% Print Q_roof_diag of the weighted rows
+
+Q_roof_diag = diag(Q_roof);
+
+printMatrixC(fid, 'const float Q_weighted_data_Attitude[ATTITUDE_WEIGHTED_ROWS]', '%3.1f', Q_roof_diag(weighted_rows));
+
+%% Print the weighted rows of B_roof
+
+printMatrixC(fid, 'const float B_roof_data_Attitude[ATTITUDE_B_ROOF_HEIGHT*ATTITUDE_B_ROOF_WIDTH]', '%15.20f', B_roof(weighted_rows, :));
 
 %% Print H_inv
 
-printMatrixC(fid, 'const float H_inv_data_Attitude[ATTITUDE_H_INV_HEIGHT*ATTITUDE_H_INV_WIDTH]', '%15.20f', H_inv);
\ No newline at end of file
+printMatrixC(fid, 'const float H_inv_data_Attitude[ATTITUDE_H_INV_HEIGHT*ATTITUDE_H_INV_WIDTH]', '%15.20f', H_inv);
+
+%% Print B_roof and H_inv quantized to int16 with a scale for each column (MPC_QUANTIZED)
+
+[B_roof_q15, B_roof_scale] = quantizeColumns(B_roof(weighted_rows, :));
+[H_inv_q15, H_inv_scale] = quantizeColumns(H_inv);
+
+% B_roof is printed transposed, its columns are multiplied as pairs of int16
+printMatrixC(fid, 'const int16_t B_roof_q15_data_Attitude[ATTITUDE_B_ROOF_WIDTH*ATTITUDE_B_ROOF_HEIGHT] __attribute__ ((aligned (4)))', '%d', B_roof_q15');
+
+printMatrixC(fid, 'const float B_roof_scale_data_Attitude[ATTITUDE_B_ROOF_WIDTH]', '%15.20e', B_roof_scale);
+
+printMatrixC(fid, 'const int16_t H_inv_q15_data_Attitude[ATTITUDE_H_INV_HEIGHT*ATTITUDE_H_INV_WIDTH] __attribute__ ((aligned (4)))', '%d', H_inv_q15);
+
+printMatrixC(fid, 'const float H_inv_scale_data_Attitude[ATTITUDE_H_INV_WIDTH]', '%15.20e', H_inv_scale);
@@ -0,0 +1,25 @@
+function [ u, converged_at ] = projectedGradient(H, H_scaling, c, u, limit, iterations, tolerance)
+% Accelerated projected gradient for min 0.5*u'*H*u + c'*u, |u| <= limit,
+% the same as calculateMPCConstrained() in mpc.c
+
+    y = u;
+    t = 1;
+    converged_at = 0;
+
+    for k=1:iterations
+
+        previous = u;
+
+        u = y - H_scaling.*(H*y + c);
+        u = min(max(u, -limit), limit);
+
+        if (max(abs(u - previous)) > tolerance)
+            converged_at = k;
+        end
+
+        t_next = (1 + sqrt(1 + 4*t*t))/2;
+        y = u + ((t - 1)/t_next)*(u - previous);
+        t = t_next;
+    end
+
+end
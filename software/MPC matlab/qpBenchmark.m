@@ -0,0 +1,89 @@
+% This script benchmarks the input-constrained QP solved on the board
+% (calculateMPCConstrained() in mpc.c, MPC_CONSTRAINED in config.h). It should
+% be run after "main.m" which initializes the matrices and the reference.
+%
+% The same accelerated projected gradient is simulated in the closed loop and
+% compared with a solution iterated until the convergence. The cycles per step
+% are measured on the board in mpcBenchmark (MPC_BENCHMARK in config.h).
+
+% the box constraints are on the inputs only with move blocking
+if parameterization ~= 1
+    error('the constrained MPC needs the move blocking (parameterization = 1 in main.m)');
+end
+
+% the same as in config.h
+qp_iterations = 20;
+qp_tolerance = 1.0;
+single_step_len = 10;
+
+% iterations of the reference solution
+reference_iterations = 2000;
+
+% simulation length
+bench_len = 1500;
+
+% hessian of the QP and the scaled gradient steps
+H_qp = 2*inv(H_inv);
+H_scaling = 1./sum(abs(H_qp), 2);
+
+x_bench = zeros(n_states, bench_len);
+x_bench(:, 1) = [3; 0; 0; 0; 0];
+
+u_warm = zeros(n_variables, 1);
+converged_at = zeros(1, bench_len);
+first_action_error = zeros(1, bench_len);
+saturated = zeros(1, bench_len);
+
+for i=2:bench_len
+
+    % the input preshaper, the same as in main.m
+    reference = x_bench(1, i-1);
+    for j=2:horizon_len
+        diference = reference(j-1) - x_ref(j+i-1);
+
+        if (diference > max_speed*dt)
+            diference = max_speed*dt;
+        elseif (diference < -max_speed*dt)
+            diference = -max_speed*dt;
+        end
+
+        reference(j) = reference(j-1) - diference;
+    end
+
+    my_ref = zeros(n_states*horizon_len, 1);
+    my_ref(1:n_states:n_states*horizon_len, 1) = reference;
+
+    % the linear part of the quadratic function
+    X_0 = A_roof*x_bench(:, i-1) - my_ref;
+    c = (X_0'*Q_roof*B_roof)';
+
+    % warm start from the shifted previous solution
+    u_warm(1:single_step_len) = u_warm(2:single_step_len+1);
+
+    [u_warm, converged_at(i)] = projectedGradient(H_qp, H_scaling, c, u_warm, saturation, qp_iterations, qp_tolerance);
+
+    % the reference solution from the same warm start
+    u_ref = projectedGradient(H_qp, H_scaling, c, u_warm, saturation, reference_iterations, 0);
+
+    first_action_error(i) = abs(u_warm(1) - u_ref(1));
+    saturated(i) = any(abs(u_ref) >= saturation);
+
+    x_bench(:, i) = A*x_bench(:, i-1) + B*u_warm(1);
+end
+
+fprintf('QP with %d iterations, %d steps (%d with an active constraint)\n', qp_iterations, bench_len-1, sum(saturated));
+fprintf('iterations to the convergence: mean %2.1f, max %d, cut off %d times\n', mean(converged_at(2:end)), max(converged_at), sum(converged_at >= qp_iterations));
+fprintf('error of the first action: mean %2.3f, max %2.3f\n', mean(first_action_error(2:end)), max(first_action_error));
+
+% multiply-accumulates per step (the linear term over the weighted rows + the iterations)
+weighted_rows = sum(diag(Q_roof) ~= 0);
+fprintf('multiply-accumulates per step: %d\n', weighted_rows*(n_states + n_variables) + qp_iterations*n_variables*(n_variables + 1));
+
+figure(3);
+subplot(2, 1, 1);
+plot(converged_at);
+ylabel('Iterations to the convergence');
+subplot(2, 1, 2);
+plot(first_action_error);
+ylabel('Error of the first action');
+xlabel('Step');
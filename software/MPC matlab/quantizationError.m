@@ -0,0 +1,89 @@
+% This script reports the error of the MPC with the int16 tables on the STM
+% (MPC_QUANTIZED in config.h) against the float MPC. It should be run after
+% "main.m" which initializes the matrices and simulates the estimates.
+%
+% The states are taken from "recorded_states" (n_states x N) and
+% "recorded_setpoints" (1 x N) when they are in the workspace (e.g. loaded
+% from a flight log), from the estimates of "main.m" otherwise. The first
+% action is computed the same way as calculateMPCFull() in mpc.c and compared
+% with the float one together with its worst-case bound.
+
+if (exist('recorded_states', 'var'))
+    states = recorded_states;
+    setpoints = recorded_setpoints;
+else
+    states = estimate;
+    setpoints = x_ref(1:size(estimate, 2));
+end
+
+n_records = size(states, 2);
+
+% the same tables as in elevAileMpcMatrices.c
+weighted_rows = find(diag(Q_roof) ~= 0);
+Q_weighted = diag(Q_roof);
+Q_weighted = Q_weighted(weighted_rows);
+B_weighted = B_roof(weighted_rows, :);
+
+[B_roof_q15, B_roof_scale] = quantizeColumns(B_weighted);
+[H_inv_q15, H_inv_scale] = quantizeColumns(H_inv);
+
+u_float = zeros(1, n_records);
+u_quantized = zeros(1, n_records);
+u_bound = zeros(1, n_records);
+
+for i=1:n_records
+
+    % the input preshaper towards the setpoint, the same as in main.m
+    reference = states(1, i);
+    for j=2:horizon_len
+        diference = reference(j-1) - setpoints(i);
+
+        if (diference > max_speed*dt)
+            diference = max_speed*dt;
+        elseif (diference < -max_speed*dt)
+            diference = -max_speed*dt;
+        end
+
+        reference(j) = reference(j-1) - diference;
+    end
+
+    my_ref = zeros(n_states*horizon_len, 1);
+    my_ref(1:n_states:n_states*horizon_len, 1) = reference;
+
+    X_0 = A_roof*states(:, i) - my_ref;
+    weighted_error = Q_weighted.*X_0(weighted_rows);
+
+    % the float MPC
+    c = B_weighted'*weighted_error;
+    u_float(i) = -0.5*H_inv(1, :)*c;
+
+    % the int16 MPC, the vectors are quantized with one scale each
+    [error_q15, error_scale] = quantizeColumns(weighted_error);
+    c_quantized = error_scale*B_roof_scale'.*(B_roof_q15'*error_q15);
+
+    [scaled_q15, scaled_scale] = quantizeColumns(H_inv_scale'.*c_quantized);
+    u_quantized(i) = -0.5*scaled_scale*(H_inv_q15(1, :)*scaled_q15);
+
+    % the rounding errors are at most half of the scales
+    c_bound = (sum(abs(weighted_error))*B_roof_scale/2 + error_scale*sum(abs(B_weighted), 1)/2 + length(weighted_error)*error_scale*B_roof_scale/4)';
+    u_bound(i) = 0.5*(abs(H_inv(1, :))*c_bound + (H_inv_scale/2)*(abs(c) + c_bound) + sum(abs(H_inv_q15(1, :)))*scaled_scale/2);
+end
+
+u_error = abs(u_quantized - u_float);
+
+fprintf('%d states, error of the first action: mean %2.4f, max %2.4f (bound %2.4f)\n', n_records, mean(u_error), max(u_error), max(u_bound));
+fprintf('relative to the saturation: max %2.6f\n', max(u_error)/saturation);
+
+if (any(u_error > u_bound))
+    fprintf('the error exceeds the bound in %d states\n', sum(u_error > u_bound));
+end
+
+figure(4);
+subplot(2, 1, 1);
+plot(u_float);
+ylabel('First action (float)');
+subplot(2, 1, 2);
+plot(1:n_records, u_error, 'b', 1:n_records, u_bound, 'r');
+ylabel('Quantization error');
+legend('error', 'bound');
+xlabel('Record');
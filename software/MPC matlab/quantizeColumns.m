@@ -0,0 +1,10 @@
+function [ quantized, scale ] = quantizeColumns(inMatrix)
+% Quantizes a matrix to int16, each column with its own scale,
+% inMatrix(:, j) ~ scale(j)*quantized(:, j)
+
+    scale = max(abs(inMatrix), [], 1)/32767;
+    scale(scale == 0) = 1;
+
+    quantized = round(inMatrix./repmat(scale, size(inMatrix, 1), 1));
+
+end
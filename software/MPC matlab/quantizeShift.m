@@ -0,0 +1,11 @@
+function [ gain, shift ] = quantizeShift(value, max_shift)
+% Quantizes each value to int16 with its own shift, value ~ gain*2^-shift.
+% The shift is the largest one (1 to max_shift) keeping the gain in int16.
+
+    shift = min(max_shift, floor(log2(32767./abs(value))));
+    shift(value == 0) = max_shift;
+    shift = max(shift, 1);
+
+    gain = round(value.*2.^shift);
+
+end
@@ -0,0 +1,135 @@
+% This script creates ANSI C code with the tables of the fixed-point kalman
+% filter and MPC on the xMega (FIXED_MPC_POSITION_CONTROLLER in its config.h).
+% It should be run after "main.m" which initializes the matrices.
+%
+% The kalman filter runs with the steady-state gain of the model on the STM,
+% the MPC is the condensed first action u = state_gain*x + reference_gain*reference.
+% Each coefficient is stored as int16 with its own shift, the reference gains
+% share one shift chosen such that the sum over the horizon fits in int32.
+% The formats of the values are in fixedMpc.h, "xmegaFixedPointError.m"
+% reports the error against the float kalman filter and MPC.
+
+% the same as on the STM (elevatorKalman.c, ATTITUDE_MAX_SPEED)
+R_xmega = diag([1, 1, 1, 1, 0.04]);
+Q_xmega = 120;
+C_xmega = [0, 1, 0, 0, 0];
+max_speed_xmega = 1.8;
+
+% the formats in fixedMpc.h
+fixed_tables.state_shift = 24;
+fixed_tables.offset_shift = 11;
+fixed_tables.output_shift = 8;
+
+%% The steady-state kalman gain
+
+covariance = eye(n_states);
+K_xmega = zeros(n_states, 1);
+
+for i=1:100000
+
+    covariance = A*covariance*A' + R_xmega;
+    K_next = covariance*C_xmega'/(C_xmega*covariance*C_xmega' + Q_xmega);
+    covariance = (eye(n_states) - K_next*C_xmega)*covariance;
+
+    if (max(abs(K_next - K_xmega)) < 1e-15)
+        break;
+    end
+
+    K_xmega = K_next;
+end
+
+K_xmega = K_next;
+
+%% The condensed MPC
+
+first_row = -0.5*H_inv(1, :)*B_roof'*Q_roof;
+state_gain_xmega = first_row*A_roof;
+reference_gain_xmega = -first_row(1:n_states:end)';
+
+% the reference is relative to the position on the xMega
+position_gain_xmega = state_gain_xmega(1) + sum(reference_gain_xmega);
+
+%% Quantize
+
+[fixed_tables.dt_gain, fixed_tables.dt_shift] = quantizeShift(dt, 30);
+[fixed_tables.p0_gain, fixed_tables.p0_shift] = quantizeShift(A(4, 4), 30);
+[fixed_tables.p1_gain, fixed_tables.p1_shift] = quantizeShift(B(4), 30);
+
+% the input is an integer, it is multiplied to Q7.24 directly
+if (fixed_tables.p1_shift <= fixed_tables.state_shift)
+    error('the input gain needs a shift over the state shift');
+end
+
+[fixed_tables.kalman_gain, fixed_tables.kalman_shift] = quantizeShift(K_xmega, 30);
+
+% the shift goes with the state shift to the output, the product has at most 47 bits
+[fixed_tables.state_gain, fixed_tables.state_gain_shift] = quantizeShift([position_gain_xmega, state_gain_xmega(2:end)]', 30);
+
+fixed_tables.reference_step = round(max_speed_xmega*dt*2^fixed_tables.state_shift);
+
+% the largest reference offset at the end of the horizon
+max_offset = round(horizon_len*max_speed_xmega*dt*2^fixed_tables.offset_shift);
+
+fixed_tables.reference_shift = floor(log2(32767/max(abs(reference_gain_xmega))));
+
+while (sum(abs(round(reference_gain_xmega*2^fixed_tables.reference_shift)))*max_offset > 2^31 - 1)
+    fixed_tables.reference_shift = fixed_tables.reference_shift - 1;
+end
+
+fixed_tables.reference_gain = round(reference_gain_xmega*2^fixed_tables.reference_shift);
+
+%% Print the C code
+
+fid = fopen('fixedMpcTables.h', 'w');
+
+fprintf(fid, '/*\n * fixedMpcTables.h\n *\n * This file was created automatically by xmegaFixedPoint.m\n */\n\n');
+fprintf(fid, '#ifndef FIXEDMPCTABLES_H_\n#define FIXEDMPCTABLES_H_\n\n');
+fprintf(fid, '#include <stdint.h>\n#include <avr/pgmspace.h>\n\n');
+fprintf(fid, '#define FIXED_NUMBER_OF_STATES\t%d\n', n_states);
+fprintf(fid, '#define FIXED_HORIZON_LEN\t\t%d\n\n', horizon_len);
+fprintf(fid, '// a coefficient c is stored as gain = round(c*2^shift) in int16_t\n\n');
+fprintf(fid, '// the model of the kalman filter, dt, ATTITUDE_P0 and ATTITUDE_P1\n');
+fprintf(fid, '#define FIXED_DT_GAIN\t\t\t%d\n', fixed_tables.dt_gain);
+fprintf(fid, '#define FIXED_DT_SHIFT\t\t\t%d\n', fixed_tables.dt_shift);
+fprintf(fid, '#define FIXED_P0_GAIN\t\t\t%d\n', fixed_tables.p0_gain);
+fprintf(fid, '#define FIXED_P0_SHIFT\t\t\t%d\n', fixed_tables.p0_shift);
+fprintf(fid, '#define FIXED_P1_GAIN\t\t\t%d\n', fixed_tables.p1_gain);
+fprintf(fid, '#define FIXED_P1_SHIFT\t\t\t%d\n\n', fixed_tables.p1_shift);
+fprintf(fid, '// max_speed*dt in the format of the states (Q7.24), the step of the preshaped reference\n');
+fprintf(fid, '#define FIXED_REFERENCE_STEP\t%d\n\n', fixed_tables.reference_step);
+fprintf(fid, '// the shift of all reference gains, the sum of the reference term fits in int32_t\n');
+fprintf(fid, '#define FIXED_REFERENCE_SHIFT\t%d\n\n', fixed_tables.reference_shift);
+fprintf(fid, '// the steady-state kalman gain\n');
+fprintf(fid, 'const int16_t fixed_kalman_gain[FIXED_NUMBER_OF_STATES];\n');
+fprintf(fid, 'const int8_t fixed_kalman_shift[FIXED_NUMBER_OF_STATES];\n\n');
+fprintf(fid, '// the condensed state gain, the position gain includes the sum of the reference gains\n');
+fprintf(fid, 'const int16_t fixed_state_gain[FIXED_NUMBER_OF_STATES];\n');
+fprintf(fid, 'const int8_t fixed_state_shift[FIXED_NUMBER_OF_STATES];\n\n');
+fprintf(fid, '// the condensed reference gain over the horizon\n');
+fprintf(fid, 'const int16_t fixed_reference_gain[FIXED_HORIZON_LEN] PROGMEM;\n\n');
+fprintf(fid, '#endif /* FIXEDMPCTABLES_H_ */\n');
+
+fclose(fid);
+
+fid = fopen('fixedMpcTables.c', 'w');
+
+fprintf(fid, '#include "fixedMpcTables.h"\n\n');
+
+fprintf(fid, '/*\n');
+fprintf(fid, 'This file was created automatically with following parameters\n\n');
+
+printMatrixM(fid, 'dt', '%1.4f', dt);
+printMatrixM(fid, 'max_speed', '%1.4f', max_speed_xmega);
+printMatrixM(fid, 'ATTITUDE_P0', '%1.8f', A(4, 4));
+printMatrixM(fid, 'ATTITUDE_P1', '%1.8f', B(4));
+printMatrixM(fid, 'K', '%1.8f', K_xmega);
+
+fprintf(fid, '*/\n\n');
+
+printMatrixC(fid, 'const int16_t fixed_kalman_gain[FIXED_NUMBER_OF_STATES]', '%d', fixed_tables.kalman_gain);
+printMatrixC(fid, 'const int8_t fixed_kalman_shift[FIXED_NUMBER_OF_STATES]', '%d', fixed_tables.kalman_shift);
+printMatrixC(fid, 'const int16_t fixed_state_gain[FIXED_NUMBER_OF_STATES]', '%d', fixed_tables.state_gain);
+printMatrixC(fid, 'const int8_t fixed_state_shift[FIXED_NUMBER_OF_STATES]', '%d', fixed_tables.state_gain_shift);
+printMatrixC(fid, 'const int16_t fixed_reference_gain[FIXED_HORIZON_LEN] PROGMEM', '%d', fixed_tables.reference_gain);
+
+fclose(fid);
@@ -0,0 +1,100 @@
+% This script reports the error of the fixed-point kalman filter and MPC on
+% the xMega against the float ones. It should be run after "xmegaFixedPoint.m"
+% which creates the tables.
+%
+% The plant of "main.m" follows x_ref in the closed loop with the float
+% kalman filter (the steady-state gain) and the float condensed MPC. The
+% fixed-point ones get the same measurements and inputs, thus their error
+% does not feed back. Then the loop is closed by the fixed-point MPC and
+% the tracking errors are compared. fixedKalmanStep.m and fixedMpcStep.m are
+% bit-exact with fixedMpc.c, the integer inputs and results are saved to
+% "xmegaFixedPointVectors.txt" to be replayed through fixedMpc.c on the PC.
+
+% simulation length
+fixed_len = 2500;
+
+% the tracking error is measured after the initial transient
+settle_len = 300;
+
+% the preshaped reference from the position towards the setpoint
+ramp = (0:horizon_len-1)'*max_speed_xmega*dt;
+
+to_fixed = @(value) round(value*2^fixed_tables.state_shift);
+
+%% The float and fixed-point kalman filter and MPC on the same data
+
+x_float = zeros(n_states, fixed_len);
+x_float(:, 1) = [3; 0; 0; 0; 0];
+estimate_float = x_float;
+estimate_fixed = to_fixed(x_float);
+
+u_float = zeros(1, fixed_len);
+u_fixed = zeros(1, fixed_len);
+
+vectors = zeros(fixed_len, 3 + n_states + 1);
+
+for i=2:fixed_len
+
+    measurement = createMeasurement(x_float(:, i-1), measurement_covariance);
+    measurement_fixed = to_fixed(measurement(2));
+
+    % the kalman filters with the input applied in the last step
+    estimate_float(:, i) = A*estimate_float(:, i-1) + B*u_float(i-1);
+    estimate_float(:, i) = estimate_float(:, i) + K_xmega*(measurement(2) - estimate_float(2, i));
+
+    estimate_fixed(:, i) = fixedKalmanStep(estimate_fixed(:, i-1), measurement_fixed, u_float(i-1), fixed_tables);
+
+    % the MPC towards the setpoint
+    setpoint = x_ref(i);
+    reference = estimate_float(1, i) + min(max(setpoint - estimate_float(1, i), -ramp), ramp);
+
+    u_float(i) = state_gain_xmega*estimate_float(:, i) + reference_gain_xmega'*reference;
+    u_float(i) = round(min(max(u_float(i), -saturation), saturation));
+
+    u_fixed(i) = fixedMpcStep(estimate_fixed(:, i), to_fixed(setpoint), fixed_tables, saturation);
+
+    vectors(i, :) = [measurement_fixed, u_float(i-1), to_fixed(setpoint), estimate_fixed(:, i)', u_fixed(i)];
+
+    x_float(:, i) = A*x_float(:, i-1) + B*u_float(i);
+end
+
+state_error = abs(estimate_fixed/2^fixed_tables.state_shift - estimate_float);
+u_error = abs(u_fixed - u_float);
+
+fprintf('the states, max error: %s\n', sprintf('%1.2e ', max(state_error, [], 2)));
+fprintf('the output, max error %d, mean error %2.4f, %2.1f%% of the steps differ\n', max(u_error), mean(u_error), 100*mean(u_error > 0));
+
+% the measurement, the input and the setpoint, then the states and the output after the step
+dlmwrite('xmegaFixedPointVectors.txt', vectors(2:end, :), 'delimiter', ' ', 'precision', '%d');
+
+%% The loop closed by the fixed-point MPC
+
+x_fixed = zeros(n_states, fixed_len);
+x_fixed(:, 1) = x_float(:, 1);
+estimate_closed = to_fixed(x_fixed);
+u_closed = zeros(1, fixed_len);
+
+for i=2:fixed_len
+
+    measurement = createMeasurement(x_fixed(:, i-1), measurement_covariance);
+
+    estimate_closed(:, i) = fixedKalmanStep(estimate_closed(:, i-1), to_fixed(measurement(2)), u_closed(i-1), fixed_tables);
+    u_closed(i) = fixedMpcStep(estimate_closed(:, i), to_fixed(x_ref(i)), fixed_tables, saturation);
+
+    x_fixed(:, i) = A*x_fixed(:, i-1) + B*u_closed(i);
+end
+
+tracking_float = x_float(1, settle_len:fixed_len) - x_ref(settle_len:fixed_len)';
+tracking_fixed = x_fixed(1, settle_len:fixed_len) - x_ref(settle_len:fixed_len)';
+
+fprintf('rms tracking error: float %2.4f, fixed point %2.4f\n', sqrt(mean(tracking_float.^2)), sqrt(mean(tracking_fixed.^2)));
+
+figure(5);
+subplot(2, 1, 1);
+plot(1:fixed_len, x_float(1, :), 'b', 1:fixed_len, x_fixed(1, :), 'r', 1:fixed_len, x_ref(1:fixed_len), 'k--');
+ylabel('Position');
+legend('float', 'fixed point', 'reference');
+subplot(2, 1, 2);
+plot(1:fixed_len, u_float, 'b', 1:fixed_len, u_closed, 'r');
+ylabel('Output');
+xlabel('Step');
@@ -9,6 +9,7 @@
 #include "mpcTask.h"
 #include "uart_driver.h"
 #include <stdlib.h>
+#include <string.h>
 #include "kalman/aileron/aileronKalman.h"
 #include "kalman/elevator/elevatorKalman.h"
 #include "config.h"
@@ -44,131 +45,221 @@ char readChar(char * message, int * indexFrom) {
 	return tempChar;
 }
 
-void sendFloat(const float var, char * crc) {
+// an outgoing message built in a frame of the uart driver
+typedef struct {
+	char * buffer;			// from usart4FrameAlloc(), NULL when no frame was free
+	uint16_t length;
+} xmegaFrame_t;
 
-	char * ukazatel = (char*) &var;
+// 'a', a place for the size and the id of the message
+static void frameBegin(xmegaFrame_t * frame, const char id) {
 
-	usart4PutChar(*(ukazatel));
-	*crc += *(ukazatel);
+	frame->buffer = usart4FrameAlloc();
+	frame->length = 0;
 
-	usart4PutChar(*(ukazatel+1));
-	*crc += *(ukazatel+1);
+	if (frame->buffer == NULL)
+		return;
 
-	usart4PutChar(*(ukazatel+2));
-	*crc += *(ukazatel+2);
-
-	usart4PutChar(*(ukazatel+3));
-	*crc += *(ukazatel+3);
+	frame->buffer[frame->length++] = 'a';	// this character initiates the transmission
+	frame->length++;						// the size is known at frameEnd()
+	frame->buffer[frame->length++] = id;
 }
 
-void sendInt16(const int16_t var, char * crc) {
+// the bytes of the variable as they are in the memory, the xMega is little-endian too
+static void framePut(xmegaFrame_t * frame, const void * var, const uint16_t size) {
+
+	// the crc has to fit behind
+	if (frame->buffer == NULL || frame->length + size >= UART_TX_FRAME_SIZE)
+		return;
 
-	char * ukazatel = (char*) &var;
+	memcpy(frame->buffer + frame->length, var, size);
+	frame->length += size;
+}
 
-	usart4PutChar(*(ukazatel));
-	*crc += *(ukazatel);
+static void framePutFloat(xmegaFrame_t * frame, const float var) {
 
-	usart4PutChar(*(ukazatel+1));
-	*crc += *(ukazatel+1);
+	framePut(frame, &var, sizeof(float));
 }
 
-void sendChar(const char var, char * crc) {
+static void framePutInt16(xmegaFrame_t * frame, const int16_t var) {
 
-	usart4PutChar(var);
-	*crc += var;
+	framePut(frame, &var, sizeof(int16_t));
 }
 
-void commTask(void *p) {
+// fill in the size and the crc and send the frame in one call, it is sent whole or not at all
+static portBASE_TYPE frameEnd(xmegaFrame_t * frame) {
 
-	char crcOut = 0;
+	char crc = 0;
+	int i;
 
-	// message from mpcTask
-	mpc2commMessage_t mpcMessage;
+	if (frame->buffer == NULL)
+		return pdFAIL;
 
-	// message from kalmanTask
-	kalman2commMessage_t kalmanMessage;
+	// the size of the message counts the id and the payload
+	frame->buffer[1] = frame->length - 2;
 
-	float tempFloat;
-	int16_t tempInt;
+	for (i = 0; i < frame->length; i++)
+		crc += frame->buffer[i];
 
-	/* -------------------------------------------------------------------- */
-	/*	Needed for receiving from xMega										*/
-	/* -------------------------------------------------------------------- */
-	char payloadSize = 0;
-	char messageBuffer[XMEGA_BUFFER_SIZE];
-	char inChar;
+	frame->buffer[frame->length++] = crc;
+
+	return usart4FrameSend(frame->buffer, frame->length);
+}
+
+// the state of the receiver of the messages from the xMega
+typedef struct {
+
+	char buffer[XMEGA_BUFFER_SIZE];
+	char payloadSize;
 	int bytesReceived;
-	char messageReceived = 0;
-	char receivingMessage = 0;
-	int receiverState = 0;
-	char crcIn = 0;
+	char receivingMessage;
+	int state;
+	char crc;
+} xmegaReceiver_t;
 
-	while (1) {
+// returns 1 when the char completes a message with the correct crc, it is in the buffer
+static char receiveChar(xmegaReceiver_t * receiver, const char inChar) {
 
-		/* -------------------------------------------------------------------- */
-		/*	Receive char from usart												*/
-		/* -------------------------------------------------------------------- */
-		if (xQueueReceive(usartRxQueue, &inChar, 0)) {
+	if (receiver->receivingMessage) {
 
-			if (receivingMessage) {
+		// expecting to receive the payload size
+		if (receiver->state == 0) {
 
-				// expecting to receive the payload size
-				if (receiverState == 0) {
+			// check the message length
+			if (inChar >= 0 && inChar < XMEGA_BUFFER_SIZE) {
 
-					// check the message length
-					if (inChar >= 0 && inChar < XMEGA_BUFFER_SIZE) {
+				receiver->payloadSize = inChar;
+				receiver->state = 1;
+				receiver->crc += inChar;
 
-						payloadSize = inChar;
-						receiverState = 1;
-						crcIn += inChar;
+			// the receiving message is over the buffer size
+			} else {
+
+				receiver->receivingMessage = 0;
+				receiver->state = 0;
+			}
 
-					// the receiving message is over the buffer size
-					} else {
+		// expecting to receive the payload
+		} else if (receiver->state == 1) {
 
-						receivingMessage = 0;
-						receiverState = 0;
-					}
+			// put the char in the buffer
+			receiver->buffer[receiver->bytesReceived++] = inChar;
+			// add crc
+			receiver->crc += inChar;
 
-				// expecting to receive the payload
-				} else if (receiverState == 1) {
+			// if the message should end, change state
+			if (receiver->bytesReceived >= receiver->payloadSize)
+				receiver->state = 2;
 
-					// put the char in the buffer
-					messageBuffer[bytesReceived++] = inChar;
-					// add crc
-					crcIn += inChar;
+		// expecting to receive the crc
+		} else if (receiver->state == 2) {
 
-					// if the message should end, change state
-					if (bytesReceived >= payloadSize)
-						receiverState = 2;
+			receiver->receivingMessage = 0;
+			receiver->state = 0;
 
-				// expecting to receive the crc
-				} else if (receiverState == 2) {
+			if (receiver->crc == inChar)
+				return 1;
+		}
 
-					if (crcIn == inChar) {
+	} else {
 
-						messageReceived = 1;
-						receivingMessage = 0;
-						} else {
+		// this character precedes every message
+		if (inChar == 'a') {
 
-						receivingMessage = 0;
-						receiverState = 0;
-					}
-				}
+			receiver->crc = inChar;
 
-			} else {
+			receiver->receivingMessage = 1;
+			receiver->state = 0;
+			receiver->bytesReceived = 0;
+		}
+	}
 
-				// this character precedes every message
-				if (inChar == 'a') {
+	return 0;
+}
 
-					crcIn = inChar;
+// the latency of the stages of the pipeline, the output frame is in the uart queue
+static void measurePipeline(const pipelineTrace_t * trace) {
 
-					receivingMessage = 1;
-					receiverState = 0;
-					bytesReceived = 0;
-				}
+	const uint32_t now = cycleCounterGet();
+
+	pipelineLatency.kalmanWait = trace->kalmanStart - trace->decoded;
+	pipelineLatency.kalman = trace->estimated - trace->kalmanStart;
+	pipelineLatency.mpcWait = trace->mpcStart - trace->estimated;
+	pipelineLatency.mpc = trace->computed - trace->mpcStart;
+	pipelineLatency.txWait = now - trace->computed;
+	pipelineLatency.total = now - trace->decoded;
+
+	if (pipelineLatency.total > pipelineLatency.maxTotal)
+		pipelineLatency.maxTotal = pipelineLatency.total;
+
+	pipelineLatency.frames++;
+}
+
+void commTask(void *p) {
+
+	xmegaFrame_t frame;
+
+	// message from mpcTask
+	mpc2commMessage_t mpcMessage;
+
+	// message from kalmanTask
+	kalman2commMessage_t kalmanMessage;
+
+	float tempFloat;
+	int16_t tempInt;
+
+	/* -------------------------------------------------------------------- */
+	/*	Needed for receiving from xMega										*/
+	/* -------------------------------------------------------------------- */
+	xmegaReceiver_t receiver;
+	char messageReceived = 0;
+	char rxPending = 0;
+
+	receiver.receivingMessage = 0;
+	receiver.state = 0;
+
+#ifdef UART_DMA
+	const char * rxSpan;
+	uint16_t rxLength, i;
+#else
+	char inChar;
+#endif
+
+	while (1) {
+
+		// sleep until chars, the outputs of mpcTask or the states of kalmanTask come
+		// the bytes after a received message are parsed first
+		if (!rxPending)
+			xSemaphoreTake(commEvent, PIPELINE_WAIT);
+
+		/* -------------------------------------------------------------------- */
+		/*	Receive chars from usart											*/
+		/* -------------------------------------------------------------------- */
+#ifdef UART_DMA
+		// the received spans until a message is complete, the rest after the message is processed
+		while (!messageReceived && (rxLength = usart4RxSpan(&rxSpan)) > 0) {
+
+			for (i = 0; i < rxLength && !messageReceived; i++)
+				messageReceived = receiveChar(&receiver, rxSpan[i]);
+
+			// the DMA wrote over the bytes, the message they belong to is dropped
+			if (usart4RxConsume(i) == pdFAIL) {
+
+				messageReceived = 0;
+				receiver.receivingMessage = 0;
+				receiver.state = 0;
 			}
 		}
 
+		rxPending = messageReceived;
+#else
+		// all the queued chars until a message is complete, the rest after the message is processed
+		while (!messageReceived && xQueueReceive(usartRxQueue, &inChar, 0))
+			messageReceived = receiveChar(&receiver, inChar);
+
+		rxPending = messageReceived;
+#endif
+
 		/* -------------------------------------------------------------------- */
 		/*	If there is a message from uart										*/
 		/* -------------------------------------------------------------------- */
@@ -177,13 +268,13 @@ void commTask(void *p) {
 			int idx = 0;
 
 			//  read the message ID
-			char messageId = readChar(messageBuffer, &idx);
+			char messageId = readChar(receiver.buffer, &idx);
 
 			if (messageId == '1') {
 
 				comm2kalmanMessage_t mes;
 
-				tempFloat = readFloat(messageBuffer, &idx);
+				tempFloat = readFloat(receiver.buffer, &idx);
 				if (tempFloat > KALMAN_MEASURED_VELOCITY_SATURATION)
 					mes.elevatorSpeed = KALMAN_MEASURED_VELOCITY_SATURATION;
 				else if (tempFloat < -KALMAN_MEASURED_VELOCITY_SATURATION)
@@ -191,7 +282,7 @@ void commTask(void *p) {
 				else
 					mes.elevatorSpeed = tempFloat;
 
-				tempFloat = readFloat(messageBuffer, &idx);
+				tempFloat = readFloat(receiver.buffer, &idx);
 				if (tempFloat > KALMAN_MEASURED_VELOCITY_SATURATION)
 					mes.aileronSpeed = KALMAN_MEASURED_VELOCITY_SATURATION;
 				else if (tempFloat < -KALMAN_MEASURED_VELOCITY_SATURATION)
@@ -199,7 +290,7 @@ void commTask(void *p) {
 				else
 					mes.aileronSpeed = tempFloat;
 
-				tempInt = readInt16(messageBuffer, &idx);
+				tempInt = readInt16(receiver.buffer, &idx);
 				if (tempInt > KALMAN_INPUT_SATURATION)
 					mes.elevatorInput = (float) KALMAN_INPUT_SATURATION;
 				else if (tempInt < -KALMAN_INPUT_SATURATION)
@@ -207,7 +298,7 @@ void commTask(void *p) {
 				else
 					mes.elevatorInput = (float) tempInt;
 
-				tempInt = readInt16(messageBuffer, &idx);
+				tempInt = readInt16(receiver.buffer, &idx);
 				if (tempInt > KALMAN_INPUT_SATURATION)
 					mes.aileronInput = (float) KALMAN_INPUT_SATURATION;
 				else if (tempInt < -KALMAN_INPUT_SATURATION)
@@ -215,7 +306,28 @@ void commTask(void *p) {
 				else
 					mes.aileronInput = (float) tempInt;
 
+				mes.sequence = (uint16_t) readInt16(receiver.buffer, &idx);
+
+				// the start of the pipeline latency (MPC_LATENCY_COMPENSATION)
+				mes.timestamp = cycleCounterGet();
+
 				xQueueSend(comm2kalmanQueue, &mes, 0);
+				xSemaphoreGive(kalmanEvent);
+
+			} else if (messageId == 'p') {
+
+				position2kalmanMessage_t mes;
+
+				mes.elevatorPosition = readFloat(receiver.buffer, &idx);
+				mes.aileronPosition = readFloat(receiver.buffer, &idx);
+				mes.sequence = (uint16_t) readInt16(receiver.buffer, &idx);
+
+				// positions out of the arena are not fused
+				if (fabs(mes.elevatorPosition) < 200 && fabs(mes.aileronPosition) < 200) {
+
+					xQueueSend(position2kalmanQueue, &mes, 0);
+					xSemaphoreGive(kalmanEvent);
+				}
 
 			} else if (messageId == '2') {
 
@@ -223,31 +335,33 @@ void commTask(void *p) {
 
 				mes.elevatorPosition = 0;
 
-				tempFloat = readFloat(messageBuffer, &idx);
+				tempFloat = readFloat(receiver.buffer, &idx);
 				if (fabs(tempFloat) < 5)
 					mes.elevatorPosition = tempFloat;
 
 				mes.aileronPosition = 0;
 
-				tempFloat = readFloat(messageBuffer, &idx);
+				tempFloat = readFloat(receiver.buffer, &idx);
 				if (fabs(tempFloat) < 5)
 					mes.aileronPosition = tempFloat;
 
 				xQueueSend(resetKalmanQueue, &mes, 0);
+				xSemaphoreGive(kalmanEvent);
 
 			} else if (messageId == '3') {
 
 				resetKalmanMessage_t mes;
 
-				tempFloat = readFloat(messageBuffer, &idx);
+				tempFloat = readFloat(receiver.buffer, &idx);
 				if (fabs(tempFloat) < 200)
 					mes.elevatorPosition = tempFloat;
 
-				tempFloat = readFloat(messageBuffer, &idx);
+				tempFloat = readFloat(receiver.buffer, &idx);
 				if (fabs(tempFloat) < 200)
 					mes.aileronPosition = tempFloat;
 
 				xQueueSend(setKalmanQueue, &mes, 0);
+				xSemaphoreGive(kalmanEvent);
 
 			} else if (messageId == 's') {
 
@@ -255,11 +369,11 @@ void commTask(void *p) {
 
 				comm2mpcMessage.messageType = SETPOINT;
 
-				tempFloat = readFloat(messageBuffer, &idx);
+				tempFloat = readFloat(receiver.buffer, &idx);
 				if (fabs(tempFloat) < 25)
 					comm2mpcMessage.elevatorReference[0] = tempFloat;
 
-				tempFloat = readFloat(messageBuffer, &idx);
+				tempFloat = readFloat(receiver.buffer, &idx);
 				if (fabs(tempFloat) < 25)
 					comm2mpcMessage.aileronReference[0] = tempFloat;
 
@@ -275,7 +389,7 @@ void commTask(void *p) {
 				int i;
 				for (i = 0; i < 5; i++) {
 
-					tempFloat = readFloat(messageBuffer, &idx);
+					tempFloat = readFloat(receiver.buffer, &idx);
 					if (fabs(tempFloat) < 25)
 						comm2mpcMessage.elevatorReference[i] = tempFloat;
 				}
@@ -283,11 +397,14 @@ void commTask(void *p) {
 				// receive the aileron trajectory key-point
 				for (i = 0; i < 5; i++) {
 
-					tempFloat = readFloat(messageBuffer, &idx);
+					tempFloat = readFloat(receiver.buffer, &idx);
 					if (fabs(tempFloat) < 25)
 						comm2mpcMessage.aileronReference[i] = tempFloat;
 				}
 
+				// receive the index of the first key-point
+				comm2mpcMessage.trajectoryIndex = readInt16(receiver.buffer, &idx);
+
 				xQueueSend(comm2mpcQueue, &comm2mpcMessage, 0);
 
 			}
@@ -304,19 +421,17 @@ void commTask(void *p) {
 			/*	Send message to xMega												*/
 			/* -------------------------------------------------------------------- */
 
-			// clear the crc
-			crcOut = 0;
-			sendChar('a', &crcOut);			// this character initiates the transmission
-			sendChar(1 + 4 + 2*4, &crcOut);			// this will be the size of the message
+			frameBegin(&frame, '1');
+
+			framePutInt16(&frame, (int16_t) mpcMessage.elevatorOutput);
+			framePutInt16(&frame, (int16_t) mpcMessage.aileronOutput);
 
-			sendChar('1', &crcOut);			// id of the message
-			sendInt16((int16_t) mpcMessage.elevatorOutput, &crcOut);
-			sendInt16((int16_t) mpcMessage.aileronOutput, &crcOut);
+			framePutFloat(&frame, mpcMessage.elevatorSetpoint);
+			framePutFloat(&frame, mpcMessage.aileronSetpoint);
 
-			sendFloat(mpcMessage.elevatorSetpoint, &crcOut);
-			sendFloat(mpcMessage.aileronSetpoint, &crcOut);
+			frameEnd(&frame);
 
-			sendChar(crcOut, &crcOut);
+			measurePipeline(&mpcMessage.trace);
 		}
 
 		/* -------------------------------------------------------------------- */
@@ -324,33 +439,24 @@ void commTask(void *p) {
 		/* -------------------------------------------------------------------- */
 		if (xQueueReceive(kalman2commQueue, &kalmanMessage, 0)) {
 
+			int i;
+
 			/* -------------------------------------------------------------------- */
 			/*	Send message to xMega												*/
 			/* -------------------------------------------------------------------- */
 
-			// clear the crc
-			crcOut = 0;
-			sendChar('a', &crcOut);			// this character initiates the transmission
-			sendChar(1 + 2*5*4 + 2*4, &crcOut);		// this will be the size of the message
-
-			sendChar('2', &crcOut);			// id of the message
+			frameBegin(&frame, '2');
 
-			sendFloat(kalmanMessage.elevatorData[0], &crcOut);
-			sendFloat(kalmanMessage.elevatorData[1], &crcOut);
-			sendFloat(kalmanMessage.elevatorData[2], &crcOut);
-			sendFloat(kalmanMessage.elevatorData[3], &crcOut);
-			sendFloat(kalmanMessage.elevatorData[4], &crcOut);
+			for (i = 0; i < 5; i++)
+				framePutFloat(&frame, kalmanMessage.elevatorData[i]);
 
-			sendFloat(kalmanMessage.aileronData[0], &crcOut);
-			sendFloat(kalmanMessage.aileronData[1], &crcOut);
-			sendFloat(kalmanMessage.aileronData[2], &crcOut);
-			sendFloat(kalmanMessage.aileronData[3], &crcOut);
-			sendFloat(kalmanMessage.aileronData[4], &crcOut);
+			for (i = 0; i < 5; i++)
+				framePutFloat(&frame, kalmanMessage.aileronData[i]);
 
-			sendFloat(kalmanMessage.elevatorPositionCovariance, &crcOut);
-			sendFloat(kalmanMessage.aileronPositionCovariance, &crcOut);
+			framePutFloat(&frame, kalmanMessage.elevatorPositionCovariance);
+			framePutFloat(&frame, kalmanMessage.aileronPositionCovariance);
 
-			sendChar(crcOut, &crcOut);
+			frameEnd(&frame);
 		}
 	}
 }
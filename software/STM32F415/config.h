@@ -12,6 +12,169 @@
 // #define TRICOPTER		1
 #define PRASE			1
 
+// uncomment to compute the MPC using the whole prediction matrices (debug)
+// the condensed first-action gains are used otherwise
+// #define MPC_FULL_VECTOR	1
+
+// uncomment to measure the cycles of the batched and sequential MPC in mpcBenchmark
+// and calculateMPC() with the tables in flash (with and without the ART accelerator) and placed in the arena
+// #define MPC_BENCHMARK	1
+
+// calculateMPC() calls averaged by the placement benchmark
+#define MPC_BENCHMARK_STEPS	100
+
+// uncomment to solve the MPC as a QP with box constraints on the inputs (projected gradient)
+// the unconstrained solution is saturated on the xMega otherwise
+// #define MPC_CONSTRAINED	1
+
+// uncomment to evaluate the explicit (piecewise-affine) constrained MPC
+// the tables in mpc/elevator_and_aileron/elevAileExplicitMpc.c/.h are created by "MPC matlab/explicitMpc.m"
+// regenerate them with the matrices, test/explicitTest checks them against the QP
+// unknown regions fall back to the QP (MPC_CONSTRAINED) or to the saturated unconstrained MPC
+// #define MPC_EXPLICIT	1
+
+// uncomment to multiply with int16 copies of B_roof and H_inv (per-column scales, SMLALD)
+// used by MPC_FULL_VECTOR, MPC_CONSTRAINED and MPC_EXPLICIT, the condensed gains stay float
+// "MPC matlab/quantizationError.m" reports the error against the float MPC, test/quantizedTest checks that bound
+// with MPC_FULL_VECTOR calculateMPCBatch() does not batch, each error vector has its own scale and the axes are stepped one by one
+// #define MPC_QUANTIZED	1
+
+// input limit of the constrained MPC, should match MPC_SATURATION on the xMega
+#define MPC_INPUT_SATURATION	1200
+
+// fixed number of the QP iterations, gives the worst-case time of the MPC step
+#define MPC_QP_ITERATIONS		20
+
+// the QP counts as converged when no input changes more than this (statistics only)
+#define MPC_QP_TOLERANCE		1.0
+
+// uncomment to bound the MPC step (MPC_FULL_VECTOR, MPC_CONSTRAINED, MPC_EXPLICIT) by MPC_CYCLE_BUDGET
+// the condensed MPC is a fixed product of about 205 multiply-adds, it cannot be combined with this
+// the prediction rows, the products with B_roof and the QP iterations are processed in chunks until the budget runs out,
+// a cut-off prediction falls back to the condensed MPC, a cut-off QP returns its last iterate
+// how often it happens is counted in mpcDeadline (mpcTask.h)
+// #define MPC_DEADLINE	1
+
+// cycles for the MPC of all axes, the control period is 10.1 ms (about 1.7M cycles at 168 MHz)
+#define MPC_CYCLE_BUDGET		800000
+
+// weighted rows of the prediction between two checks of the cycle budget
+#define MPC_DEADLINE_CHUNK		20
+
+// uncomment to predict the kalman states over the latency of the pipeline before the MPC (A/B flights)
+// the latency from the px4flow message to the applied output is estimated online (mpcLatency in mpcTask.h),
+// initial_cond is propagated by the model with the outputs already sent to the xMega
+// the estimate starts when the px4flow message arrives on the STM, the '1' message carries no xMega time,
+// the px4flow frame and its way through the xMega are not included and the output part is the constant below
+// #define MPC_LATENCY_COMPENSATION	1
+
+// seconds from sending the MPC output to its effect, the UART to the xMega and its PPM frame (not measured)
+#define MPC_LATENCY_OUTPUT		0.004
+
+// weight of a new sample in the running average of the MPC step duration
+#define MPC_LATENCY_FILTER		0.05
+
+// the longest latency compensated, in samples of the MPC
+#define MPC_LATENCY_MAX_STEPS	4
+
+// uncomment to run the kalman filter through the general matrix functions (debug)
+// the single px4flow measurement is fused by kalmanIterationScalar() on the packed covariance otherwise
+// #define KALMAN_FULL_MATRICES	1
+
+// uncomment to measure the cycles of the kalman step of both axes in kalmanBenchmark
+// #define KALMAN_BENCHMARK	1
+
+// uncomment to freeze the kalman gain once it converged, the covariance is not propagated any more
+// the full filter starts again after a reset of the covariance (resetKalmanQueue, setKalmanQueue)
+// #define KALMAN_STEADY_STATE	1
+
+// the gain is steady when no element changes more than this (relative to the largest one) per step
+#define KALMAN_STEADY_TOLERANCE		1e-6
+
+// number of consecutive steady steps before the gain is frozen
+#define KALMAN_STEADY_STEPS			100
+
+// uncomment to fuse the delayed positions from the xMega (message 'p') at the px4flow step they belong to
+// the last KALMAN_HISTORY_LENGTH steps are kept and computed again after the position
+// #define KALMAN_POSITION_FUSION	1
+
+// px4flow steps in the history (100 Hz), older positions are dropped
+#define KALMAN_HISTORY_LENGTH		32
+
+// variance of the position measurement, the same units as KALMAN_Q
+#define KALMAN_POSITION_Q			10
+
+// uncomment to predict the states for mpcTask on a timer (TIM2) instead of sending them after the px4flow step
+// the px4flow corrections are applied when they arrive, the mpc runs on every KALMAN_PREDICTION_DIVIDER-th tick
+// the ticks interpolate linearly along the one-period prediction A*x + B*u, there is no model at DT/KALMAN_PREDICTION_DIVIDER
+// the states are exact at the px4flow steps only, in between they are an approximation for the mpc and the statistics
+// #define KALMAN_PREDICTION_TIMER	1
+
+// timer ticks per px4flow period (DT_ELEVATOR)
+#define KALMAN_PREDICTION_DIVIDER	4
+
+// uncomment to identify ATTITUDE_P0 and ATTITUDE_P1 of both axes on-board (recursive least squares)
+// the estimates and their deviations are in elevatorModelEstimate and aileronModelEstimate (kalmanTask.h),
+// system_A and system_B of the kalman are refreshed with them once they are confident
+// #define KALMAN_IDENTIFICATION	1
+
+// forgetting factor of the least squares per px4flow step, 0.999 remembers about 10 s
+#define KALMAN_IDENTIFICATION_FORGETTING	0.999
+
+// weight of a new sample in each of the three low-pass stages of the velocity and the input
+#define KALMAN_IDENTIFICATION_FILTER		0.1
+
+// the covariance of the estimate does not grow over this trace without excitation (hovering)
+#define KALMAN_IDENTIFICATION_MAX_TRACE		10.0
+
+// px4flow steps between two refreshes of the kalman model, the first one after KALMAN_IDENTIFICATION_MIN_SAMPLES
+#define KALMAN_IDENTIFICATION_PERIOD		100
+#define KALMAN_IDENTIFICATION_MIN_SAMPLES	1000
+
+// the kalman model is refreshed when the deviations are below these (P1 relative to itself)
+#define KALMAN_IDENTIFICATION_P0_DEVIATION	0.003
+#define KALMAN_IDENTIFICATION_P1_DEVIATION	0.1
+
+// uncomment to run the tasks as before, at one priority and polling their queues without blocking
+// the tasks block on their events otherwise, compare pipelineLatency (system.h) of both
+// #define PIPELINE_POLLING	1
+
+// consecutive calls of the idle hook closer than this (cycles) are counted as idle time
+#define PIPELINE_IDLE_GAP	500
+
+// uncomment to move the uart to the xMega by DMA, a circular RX buffer read by spans (idle line events)
+// and whole frames sent from a pool, the uart interrupts per byte otherwise
+// #define UART_DMA	1
+
+// bytes of the circular RX buffer, about 22 ms of the link at 115200 baud
+#define UART_DMA_RX_SIZE		256
+
+// frames in the TX pool
+#define UART_DMA_TX_FRAMES		4
+
+// the longest frame sent to the xMega, the 'a', the size, the message and the crc
+#define UART_TX_FRAME_SIZE		64
+
+// uncomment to place the arena (the matrices and the workspaces of the handlers) in the 64 kB CCM
+// zero wait states and no contention with the DMA, the DMA cannot reach it (the uart buffers stay in SRAM)
+// the arena is used from CCMDATARAM_BASE without a linker section, the CoIDE linker script (arm-gcc-link.ld,
+// outside the repo) must not place anything in the CCM, check the .map file when the script or the toolchain changes
+// #define ARENA_IN_CCM	1
+
+// uncomment to copy the MPC tables (A, B, Q_weighted, B_roof and H_inv, the int16 ones with MPC_QUANTIZED) from flash
+// to the arena at boot, they are read from flash behind the ART accelerator otherwise (flashAcceleratorInit())
+// the condensed MPC does not read them in the step
+// #define MPC_TABLES_IN_ARENA	1
+
+// bytes of the arena, the handlers take about 14 kB and the MPC tables about 21 kB more, see arenaHighWater() and arenaFailures()
+#if defined(ARENA_IN_CCM)
+#define ARENA_SIZE				(64*1024)
+#elif defined(MPC_TABLES_IN_ARENA)
+#define ARENA_SIZE				(40*1024)
+#else
+#define ARENA_SIZE				(16*1024)
+#endif
+
 #define KALMAN_INPUT_SATURATION				1200
 #define KALMAN_MEASURED_VELOCITY_SATURATION 3.0
 
@@ -10,6 +10,12 @@
 
 kalmanHandler_t aileronKalmanHandler;
 
+// upper triangle of the covariance for kalmanIterationScalar()
+float aileronCovariancePacked[NUMBER_OF_STATES_AILERON*(NUMBER_OF_STATES_AILERON+1)/2];
+
+// the kalman gain for KALMAN_STEADY_STATE
+float aileronSteadyGain[NUMBER_OF_STATES_AILERON];
+
 kalmanHandler_t * initializeAileronKalman() {
 
 	/* -------------------------------------------------------------------- */
@@ -72,8 +78,14 @@ kalmanHandler_t * initializeAileronKalman() {
 	/* -------------------------------------------------------------------- */
 	/* Aileron kalman covariance matrix										*/
 	/* -------------------------------------------------------------------- */
+#ifdef KALMAN_FULL_MATRICES
 	aileronKalmanHandler.covariance = matrix_float_alloc(NUMBER_OF_STATES_AILERON, NUMBER_OF_STATES_AILERON);
-	matrix_float_set_identity(aileronKalmanHandler.covariance);
+#endif
+	aileronKalmanHandler.covariance_packed = aileronCovariancePacked;
+	aileronKalmanHandler.steady_gain = aileronSteadyGain;
+
+	// the temporaries of the kalman step, in the CCM with ARENA_IN_CCM
+	aileronKalmanHandler.workspace = (float *) arenaAlloc(KALMAN_WORKSPACE_SIZE(NUMBER_OF_STATES_AILERON, NUMBER_OF_INPUTS_AILERON)*sizeof(float));
 
 	/* -------------------------------------------------------------------- */
 	/* Process noise matrix	(R)												*/
@@ -85,5 +97,7 @@ kalmanHandler_t * initializeAileronKalman() {
 	aileronKalmanHandler.number_of_inputs = NUMBER_OF_INPUTS_AILERON;
 	aileronKalmanHandler.number_of_states = NUMBER_OF_STATES_AILERON;
 
+	kalmanResetCovariance(&aileronKalmanHandler);
+
 	return &aileronKalmanHandler;
 }
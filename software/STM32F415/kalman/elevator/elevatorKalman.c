@@ -10,6 +10,12 @@
 
 kalmanHandler_t elevatorKalmanHandler;
 
+// upper triangle of the covariance for kalmanIterationScalar()
+float elevatorCovariancePacked[NUMBER_OF_STATES_ELEVATOR*(NUMBER_OF_STATES_ELEVATOR+1)/2];
+
+// the kalman gain for KALMAN_STEADY_STATE
+float elevatorSteadyGain[NUMBER_OF_STATES_ELEVATOR];
+
 kalmanHandler_t * initializeElevatorKalman() {
 
 	/* -------------------------------------------------------------------- */
@@ -72,8 +78,14 @@ kalmanHandler_t * initializeElevatorKalman() {
 	/* -------------------------------------------------------------------- */
 	/* elevator kalman covariance matrix									*/
 	/* -------------------------------------------------------------------- */
+#ifdef KALMAN_FULL_MATRICES
 	elevatorKalmanHandler.covariance = matrix_float_alloc(NUMBER_OF_STATES_ELEVATOR, NUMBER_OF_STATES_ELEVATOR);
-	matrix_float_set_identity(elevatorKalmanHandler.covariance);
+#endif
+	elevatorKalmanHandler.covariance_packed = elevatorCovariancePacked;
+	elevatorKalmanHandler.steady_gain = elevatorSteadyGain;
+
+	// the temporaries of the kalman step, in the CCM with ARENA_IN_CCM
+	elevatorKalmanHandler.workspace = (float *) arenaAlloc(KALMAN_WORKSPACE_SIZE(NUMBER_OF_STATES_ELEVATOR, NUMBER_OF_INPUTS_ELEVATOR)*sizeof(float));
 
 	/* -------------------------------------------------------------------- */
 	/* Process noise matrix	(R)												*/
@@ -85,5 +97,7 @@ kalmanHandler_t * initializeElevatorKalman() {
 	elevatorKalmanHandler.number_of_inputs = NUMBER_OF_INPUTS_ELEVATOR;
 	elevatorKalmanHandler.number_of_states = NUMBER_OF_STATES_ELEVATOR;
 
+	kalmanResetCovariance(&elevatorKalmanHandler);
+
 	return &elevatorKalmanHandler;
 }
@@ -7,6 +7,8 @@
 #include "kalman.h"
 #include "system.h"
 #include "CMatrixLib.h"
+#include "config.h"
+#include <math.h>
 
 void kalmanIteration(kalmanHandler_t * handler) {
 
@@ -16,10 +18,13 @@ void kalmanIteration(kalmanHandler_t * handler) {
 
 	kalmanHandler_t handler_local;
 
+	// the temporaries are taken from the workspace of the handler one after another
+	float * workspace = handler->workspace;
+
 	// copy of the states vector
 	vector_float handler_local_states;
-	float handler_local_states_data[handler->number_of_states];
-	handler_local_states.data = (float *) &handler_local_states_data;
+	handler_local_states.data = workspace;
+	workspace += handler->number_of_states;
 	handler_local_states.length = handler->number_of_states;
 
 	handler_local.states = &handler_local_states;
@@ -29,8 +34,8 @@ void kalmanIteration(kalmanHandler_t * handler) {
 	matrix_float handler_local_covariance;
 	handler_local_covariance.height = handler->covariance->height;
 	handler_local_covariance.width = handler->covariance->width;
-	float handler_local_covariance_data[handler->number_of_states*handler->number_of_states];
-	handler_local_covariance.data = (float *) &handler_local_covariance_data;
+	handler_local_covariance.data = workspace;
+	workspace += handler->number_of_states*handler->number_of_states;
 
 	handler_local.covariance = &handler_local_covariance;
 	matrix_float_copy(handler_local.covariance, handler->covariance);
@@ -41,43 +46,43 @@ void kalmanIteration(kalmanHandler_t * handler) {
 
 	// temp vector
 	vector_float temp_vector_n;
-	float temp_vector_data[handler->number_of_states];
-	temp_vector_n.data = (float *) &temp_vector_data;
+	temp_vector_n.data = workspace;
+	workspace += handler->number_of_states;
 	temp_vector_n.length = handler->number_of_states;
 	temp_vector_n.orientation = 0;
 
 	// temp vector2
 	vector_float temp_vector2_u;
-	float temp_vector2_data[handler->number_of_inputs];
-	temp_vector2_u.data = (float *) &temp_vector2_data;
+	temp_vector2_u.data = workspace;
+	workspace += handler->number_of_inputs;
 	temp_vector2_u.length = handler->number_of_inputs;
 	temp_vector2_u.orientation = 0;
 
 	// temp matrix
 	matrix_float temp_matrix_n_n;
-	float temp_matrix_data[handler->number_of_states*handler->number_of_states];
-	temp_matrix_n_n.data = (float *) &temp_matrix_data;
+	temp_matrix_n_n.data = workspace;
+	workspace += handler->number_of_states*handler->number_of_states;
 	temp_matrix_n_n.height = handler->number_of_states;
 	temp_matrix_n_n.width = handler->number_of_states;
 
 	// temp matrix2
 	matrix_float temp_matrix2_n_n;
-	float temp_matrix2_data[handler->number_of_states*handler->number_of_states];
-	temp_matrix2_n_n.data = (float *) &temp_matrix2_data;
+	temp_matrix2_n_n.data = workspace;
+	workspace += handler->number_of_states*handler->number_of_states;
 	temp_matrix2_n_n.height = handler->number_of_states;
 	temp_matrix2_n_n.width = handler->number_of_states;
 
 	// temp matrix3 for computing the kalman gain
 	matrix_float temp_matrix3_u_n;
-	float temp_matrix3_data[handler->number_of_inputs*handler->number_of_states];
-	temp_matrix3_u_n.data = (float *) &temp_matrix3_data;
+	temp_matrix3_u_n.data = workspace;
+	workspace += handler->number_of_inputs*handler->number_of_states;
 	temp_matrix3_u_n.height = handler->number_of_inputs;
 	temp_matrix3_u_n.width = handler->number_of_states;
 
 	// temp matrix4
 	matrix_float temp_matrix4_u_u;
-	float temp_matrix4_data[handler->number_of_inputs*handler->number_of_inputs];
-	temp_matrix4_u_u.data = (float *) &temp_matrix4_data;
+	temp_matrix4_u_u.data = workspace;
+	workspace += handler->number_of_inputs*handler->number_of_inputs;
 	temp_matrix4_u_u.height = handler->number_of_inputs;
 	temp_matrix4_u_u.width = handler->number_of_inputs;
 
@@ -137,8 +142,7 @@ void kalmanIteration(kalmanHandler_t * handler) {
 
 	// matrix for the kalman gain
 	matrix_float K;
-	float kalman_gain_data[handler->number_of_inputs*handler->number_of_states];
-	K.data = (float *) &kalman_gain_data;
+	K.data = workspace;
 	K.height = handler->number_of_states;
 	K.width = handler->number_of_inputs;
 
@@ -192,10 +196,276 @@ void kalmanIteration(kalmanHandler_t * handler) {
 	/*	Copy output to the handler											*/
 	/* -------------------------------------------------------------------- */
 
-	portENTER_CRITICAL();
-
 	vector_float_copy(handler->states, handler_local.states);
 	matrix_float_copy(handler->covariance, &temp_matrix2_n_n);
+}
+
+void kalmanIterationScalar(kalmanHandler_t * handler) {
+
+	const int n = handler->number_of_states;
+
+	float * A = handler->system_A->data;
+	float * B = handler->system_B->data;
+	float * R = handler->R_matrix->data;
+	float * C = handler->C_matrix->data;
+	float * P = handler->covariance_packed;
+
+	// the temporaries in the workspace of the handler
+	float * states = handler->workspace;
+	float * full = states + n;
+	float * AP = full + n*n;
+	float * PC = AP + n*n;
+
+	float innovation, inverse, sum;
+	int i, j, k, p;
+
+	/* -------------------------------------------------------------------- */
+	/*	prediction step														*/
+	/* -------------------------------------------------------------------- */
+
+	// states = A*states + B*input
+	for (i = 0; i < n; i++) {
+
+		states[i] = 0;
+
+		for (j = 0; j < n; j++)
+			states[i] += A[i*n + j]*handler->states->data[j];
+
+		for (j = 0; j < handler->number_of_inputs; j++)
+			states[i] += B[i*handler->number_of_inputs + j]*handler->input->data[j];
+	}
+
+	// unpack the symmetric covariance
+	for (i = 0, p = 0; i < n; i++)
+		for (j = i; j < n; j++, p++)
+			full[i*n + j] = full[j*n + i] = P[p];
+
+	// AP = A*covariance
+	for (i = 0; i < n; i++)
+		for (j = 0; j < n; j++) {
+
+			sum = 0;
+
+			for (k = 0; k < n; k++)
+				sum += A[i*n + k]*full[k*n + j];
+
+			AP[i*n + j] = sum;
+		}
+
+	// covariance = AP*A' + R, only the upper triangle
+	for (i = 0, p = 0; i < n; i++)
+		for (j = i; j < n; j++, p++) {
+
+			sum = R[i*n + j];
+
+			for (k = 0; k < n; k++)
+				sum += AP[i*n + k]*A[j*n + k];
+
+			P[p] = sum;
+		}
+
+	/* -------------------------------------------------------------------- */
+	/*	Correction step														*/
+	/* -------------------------------------------------------------------- */
+
+	// PC = covariance*C', each element of the triangle is used for both halves
+	for (i = 0; i < n; i++)
+		PC[i] = 0;
+
+	for (i = 0, p = 0; i < n; i++) {
+
+		PC[i] += P[p]*C[i];
+		p++;
+
+		for (j = i+1; j < n; j++, p++) {
+
+			PC[i] += P[p]*C[j];
+			PC[j] += P[p]*C[i];
+		}
+	}
+
+	// s = C*covariance*C' + Q, innovation = measurement - C*states
+	inverse = handler->Q_matrix->data[0];
+	innovation = handler->measurement->data[0];
+
+	for (i = 0; i < n; i++) {
+
+		inverse += C[i]*PC[i];
+		innovation -= C[i]*states[i];
+	}
+
+	inverse = 1/inverse;
+
+#ifdef KALMAN_STEADY_STATE
+	kalmanTrackGain(handler, PC, inverse);
+#endif
+
+	// states += K*innovation, K = PC/s
+	for (i = 0; i < n; i++)
+		states[i] += PC[i]*(inverse*innovation);
+
+	// covariance = covariance - K*C*covariance = covariance - PC*PC'/s
+	for (i = 0, p = 0; i < n; i++) {
+
+		float scaled = PC[i]*inverse;
+
+		for (j = i; j < n; j++, p++)
+			P[p] -= scaled*PC[j];
+	}
+
+	/* -------------------------------------------------------------------- */
+	/*	Copy output to the handler											*/
+	/* -------------------------------------------------------------------- */
+
+	for (i = 0; i < n; i++)
+		handler->states->data[i] = states[i];
+}
+
+void kalmanTrackGain(kalmanHandler_t * handler, const float * PC, const float inverse) {
+
+	const int n = handler->number_of_states;
+
+	float gain, largest = 0, change = 0;
+	int i;
+
+	for (i = 0; i < n; i++) {
+
+		gain = PC[i]*inverse;
+
+		if (fabsf(gain) > largest)
+			largest = fabsf(gain);
+
+		if (fabsf(gain - handler->steady_gain[i]) > change)
+			change = fabsf(gain - handler->steady_gain[i]);
+
+		handler->steady_gain[i] = gain;
+	}
+
+	if (change <= KALMAN_STEADY_TOLERANCE*largest)
+		handler->steady_steps++;
+	else
+		handler->steady_steps = 0;
+
+	if (handler->steady_steps >= KALMAN_STEADY_STEPS)
+		handler->steady_state = 1;
+}
+
+void kalmanIterationSteady(kalmanHandler_t * handler) {
+
+	const int n = handler->number_of_states;
+
+	float * A = handler->system_A->data;
+	float * B = handler->system_B->data;
+	float * C = handler->C_matrix->data;
+	float * K = handler->steady_gain;
+
+	float * states = handler->workspace;
+	float innovation = handler->measurement->data[0];
+	int i, j;
+
+	// states = A*states + B*input
+	for (i = 0; i < n; i++) {
+
+		states[i] = 0;
+
+		for (j = 0; j < n; j++)
+			states[i] += A[i*n + j]*handler->states->data[j];
+
+		for (j = 0; j < handler->number_of_inputs; j++)
+			states[i] += B[i*handler->number_of_inputs + j]*handler->input->data[j];
+	}
+
+	// states += K*(measurement - C*states)
+	for (i = 0; i < n; i++)
+		innovation -= C[i]*states[i];
+
+	for (i = 0; i < n; i++)
+		handler->states->data[i] = states[i] + K[i]*innovation;
+}
+
+void kalmanCorrectState(kalmanHandler_t * handler, const int state, const float measurement, const float variance) {
+
+	const int n = handler->number_of_states;
+
+	float * P = handler->covariance_packed;
+	float * states = handler->states->data;
+
+	float * column = handler->workspace;
+	float inverse, innovation;
+	int i, j, p;
+
+	// covariance*C' is the column of the state
+	for (i = 0; i < n; i++)
+		column[i] = P[kalmanPackedIndex(n, i, state)];
+
+	inverse = 1/(column[state] + variance);
+	innovation = measurement - states[state];
+
+	// states += K*innovation, K = column/s
+	for (i = 0; i < n; i++)
+		states[i] += column[i]*(inverse*innovation);
+
+	// covariance = covariance - column*column'/s
+	for (i = 0, p = 0; i < n; i++) {
+
+		float scaled = column[i]*inverse;
+
+		for (j = i; j < n; j++, p++)
+			P[p] -= scaled*column[j];
+	}
+
+	handler->steady_state = 0;
+	handler->steady_steps = 0;
+}
+
+void kalmanPredictStates(const kalmanHandler_t * handler, const float * states, float * predicted) {
+
+	const int n = handler->number_of_states;
+	const int m = handler->number_of_inputs;
+
+	float * A = handler->system_A->data;
+	float * B = handler->system_B->data;
+	int i, j;
+
+	for (i = 0; i < n; i++) {
+
+		predicted[i] = 0;
+
+		for (j = 0; j < n; j++)
+			predicted[i] += A[i*n + j]*states[j];
+
+		for (j = 0; j < m; j++)
+			predicted[i] += B[i*m + j]*handler->input->data[j];
+	}
+}
+
+void kalmanResetCovariance(kalmanHandler_t * handler) {
+
+	const int n = handler->number_of_states;
+	int i, j;
+
+	handler->steady_state = 0;
+	handler->steady_steps = 0;
+
+	// the full matrix exists only for kalmanIteration()
+	if (handler->covariance != 0)
+		matrix_float_set_identity(handler->covariance);
+
+	for (i = 0; i < n; i++)
+		for (j = i; j < n; j++)
+			handler->covariance_packed[kalmanPackedIndex(n, i, j)] = (i == j) ? 1 : 0;
+}
+
+void kalmanSetCovariance(kalmanHandler_t * handler, const int i, const int j, const float value) {
+
+	if (handler->covariance != 0) {
+
+		matrix_float_set(handler->covariance, i, j, value);
+		matrix_float_set(handler->covariance, j, i, value);
+	}
+
+	handler->steady_state = 0;
+	handler->steady_steps = 0;
 
-	portEXIT_CRITICAL();
+	handler->covariance_packed[kalmanPackedIndex(handler->number_of_states, i-1, j-1)] = value;
 }
@@ -11,7 +11,8 @@
 
 typedef struct {
 
-	matrix_float * covariance;	// covariance matrix of kalman system
+	matrix_float * covariance;	// covariance matrix of kalman system, with KALMAN_FULL_MATRICES only (0 otherwise)
+	float * covariance_packed;	// upper triangle of the covariance row by row, used by kalmanIterationScalar()
 	vector_float * states;		// states of kalman system
 	vector_float * input;		// the input to the system
 	matrix_float * system_A;	// main system matrix
@@ -22,9 +23,54 @@ typedef struct {
 	matrix_float * C_matrix;	// transfere from measurements to states
 	int number_of_states;
 	int number_of_inputs;
+	float * steady_gain;		// the last kalman gain (number_of_states), constant in the steady state (KALMAN_STEADY_STATE)
+	int steady_steps;			// consecutive steps with the gain within KALMAN_STEADY_TOLERANCE
+	int steady_state;			// 1 when the gain is frozen, reset with the covariance
+	int sparse_kernel;			// the matrices match the pattern of kalmanIterationSparse(), set by kalmanMatchesSparsity()
+	float * workspace;			// the temporaries of the kalman steps, KALMAN_WORKSPACE_SIZE
 
 } kalmanHandler_t;
 
+// floats of the workspace for n states and u inputs (or measurements)
+// kalmanIteration() takes 3*n*n + 2*n + u + 2*u*n + u*u of them, kalmanIterationSparsePair() 2*(3*n*n + 2*n) of the first handler
+#define KALMAN_WORKSPACE_SIZE(n, u) (2*(3*(n)*(n) + 2*(n)) + (u) + 2*(u)*(n) + (u)*(u))
+
+// index of the element (i, j) (from 0) of the packed upper triangle of a symmetric n x n matrix
+#define kalmanPackedIndex(n, i, j) (((i) <= (j)) ? ((i)*(2*(n) - (i) - 1)/2 + (j)) : ((j)*(2*(n) - (j) - 1)/2 + (i)))
+
+// the general kalman step, any measurement vector
 void kalmanIteration(kalmanHandler_t * kalmanHandler);
 
+/**
+ * @brief the kalman step for a single measurement (C_matrix is 1 x number_of_states)
+ *
+ * Works with covariance_packed in place, the gain needs a single division and
+ * the covariance is corrected by the symmetric rank-1 downdate P -= (P*C')*(P*C')'/s.
+ */
+void kalmanIterationScalar(kalmanHandler_t * kalmanHandler);
+
+// K = PC*inverse of the last step, freezes the gain after KALMAN_STEADY_STEPS steady steps
+void kalmanTrackGain(kalmanHandler_t * kalmanHandler, const float * PC, const float inverse);
+
+// the state update with the frozen gain, the covariance stays as it was
+void kalmanIterationSteady(kalmanHandler_t * kalmanHandler);
+
+/**
+ * @brief fuse a direct measurement of a single state (from 0), the correction step only
+ *
+ * Works with covariance_packed like kalmanIterationScalar(), the gain is not
+ * steady afterwards.
+ */
+void kalmanCorrectState(kalmanHandler_t * kalmanHandler, const int state, const float measurement, const float variance);
+
+// predicted = A*states + B*input, the covariance is not touched
+void kalmanPredictStates(const kalmanHandler_t * kalmanHandler, const float * states, float * predicted);
+
+// set the covariance to identity, the packed triangle and the matrix if it is allocated
+// the gain is not steady any more
+void kalmanResetCovariance(kalmanHandler_t * kalmanHandler);
+
+// set the element (i, j) (from 1) of the covariance, the packed triangle and the matrix if it is allocated
+void kalmanSetCovariance(kalmanHandler_t * kalmanHandler, const int i, const int j, const float value);
+
 #endif /* KALMAN_H_ */
@@ -0,0 +1,99 @@
+/*
+ * kalmanHistory.c
+ *
+ *  Author: Tomas Baca
+ */
+
+#include "kalmanHistory.h"
+#include "config.h"
+
+// the position is the first state of the model
+#define POSITION_STATE	0
+
+void kalmanHistoryClear(kalmanHistory_t * history) {
+
+	history->newest = KALMAN_HISTORY_LENGTH - 1;
+	history->count = 0;
+}
+
+// copy the handler to the step of the history
+static void saveStep(kalmanHistory_t * history, const kalmanHandler_t * handler, const int step) {
+
+	const int n = handler->number_of_states;
+	const int packed = n*(n+1)/2;
+	int i;
+
+	for (i = 0; i < n; i++)
+		history->states[step*n + i] = handler->states->data[i];
+
+	for (i = 0; i < packed; i++)
+		history->covariance[step*packed + i] = handler->covariance_packed[i];
+}
+
+void kalmanHistoryRecord(kalmanHistory_t * history, const kalmanHandler_t * handler, const uint16_t sequence) {
+
+	const int m = handler->number_of_inputs;
+	int i;
+
+	history->newest = (history->newest + 1) % KALMAN_HISTORY_LENGTH;
+
+	if (history->count < KALMAN_HISTORY_LENGTH)
+		history->count++;
+
+	saveStep(history, handler, history->newest);
+
+	for (i = 0; i < m; i++)
+		history->input[history->newest*m + i] = handler->input->data[i];
+
+	history->measurement[history->newest] = handler->measurement->data[0];
+	history->sequence[history->newest] = sequence;
+}
+
+int kalmanHistoryFuse(kalmanHistory_t * history, kalmanHandler_t * handler, const uint16_t sequence, const float position, const float variance, void (*step)(kalmanHandler_t *)) {
+
+	const int n = handler->number_of_states;
+	const int m = handler->number_of_inputs;
+	const int packed = n*(n+1)/2;
+
+	int age, current, i;
+
+	// look for the step, the newest first
+	for (age = 0; age < history->count; age++)
+		if (history->sequence[(history->newest - age + KALMAN_HISTORY_LENGTH) % KALMAN_HISTORY_LENGTH] == sequence)
+			break;
+
+	if (age == history->count)
+		return -1;
+
+	current = (history->newest - age + KALMAN_HISTORY_LENGTH) % KALMAN_HISTORY_LENGTH;
+
+	// return to the step and fuse the position there
+	for (i = 0; i < n; i++)
+		handler->states->data[i] = history->states[current*n + i];
+
+	for (i = 0; i < packed; i++)
+		handler->covariance_packed[i] = history->covariance[current*packed + i];
+
+	kalmanCorrectState(handler, POSITION_STATE, position, variance);
+
+	saveStep(history, handler, current);
+
+	// compute the later steps again, the last one leaves the handler as it was with the position fused
+	for (i = 0; i < age; i++) {
+
+		int j;
+
+		current = (current + 1) % KALMAN_HISTORY_LENGTH;
+
+		for (j = 0; j < m; j++)
+			handler->input->data[j] = history->input[current*m + j];
+
+		handler->measurement->data[0] = history->measurement[current];
+
+		step(handler);
+
+		saveStep(history, handler, current);
+	}
+
+	return age;
+}
@@ -0,0 +1,42 @@
+/*
+ * kalmanHistory.h
+ *
+ *  Author: Tomas Baca
+ */
+
+#ifndef KALMANHISTORY_H_
+#define KALMANHISTORY_H_
+
+#include "kalman.h"
+
+// the past px4flow steps of a kalman handler, a ring buffer of KALMAN_HISTORY_LENGTH steps
+typedef struct {
+
+	float * states;			// the states after each step, KALMAN_HISTORY_LENGTH x number_of_states
+	float * covariance;		// the packed covariance after each step, KALMAN_HISTORY_LENGTH x n*(n+1)/2
+	float * input;			// the input of each step, KALMAN_HISTORY_LENGTH x number_of_inputs
+	float * measurement;	// the px4flow speed of each step
+	uint16_t * sequence;	// the sequence number of the px4flow measurement of each step
+	int newest;				// index of the last recorded step
+	int count;				// number of the recorded steps
+} kalmanHistory_t;
+
+// forget all recorded steps, after a reset of the kalman
+void kalmanHistoryClear(kalmanHistory_t * history);
+
+// record the step which has just fused the px4flow measurement with the sequence number
+void kalmanHistoryRecord(kalmanHistory_t * history, const kalmanHandler_t * kalmanHandler, const uint16_t sequence);
+
+/**
+ * @brief fuse a delayed position measurement at its time of validity
+ *
+ * The handler is returned to the recorded step with the sequence number, the
+ * position is fused there and the later steps are computed again with their
+ * recorded inputs and measurements by the step function. The history is
+ * rewritten with the new estimates.
+ *
+ * @return the number of steps computed again, -1 if the step is not in the history
+ */
+int kalmanHistoryFuse(kalmanHistory_t * history, kalmanHandler_t * kalmanHandler, const uint16_t sequence, const float position, const float variance, void (*step)(kalmanHandler_t *));
+
+#endif /* KALMANHISTORY_H_ */
@@ -0,0 +1,179 @@
+/*
+ * kalmanIdentification.c
+ *
+ *  Author: Tomas Baca
+ */
+
+#include "kalmanIdentification.h"
+#include "config.h"
+#include <math.h>
+
+#define N	KALMAN_IDENTIFICATION_PARAMETERS
+
+// the parameters in theta
+#define P0_PARAMETER	0
+#define P1_PARAMETER	1
+
+void kalmanIdentificationReset(kalmanIdentification_t * identification, const float p0, const float p1, const float dt) {
+
+	int i;
+
+	identification->theta[P0_PARAMETER] = p0;
+	identification->theta[P1_PARAMETER] = p1/KALMAN_IDENTIFICATION_INPUT_SCALE;
+	identification->theta[2] = 0;
+
+	// the model from config.h is a weak prior
+	for (i = 0; i < N*N; i++)
+		identification->covariance[i] = (i % (N+1) == 0) ? 1 : 0;
+
+	identification->noise = 0;
+	identification->dt = dt;
+	identification->steps = 0;
+	identification->sinceRefresh = 0;
+
+	identification->estimate.p0 = p0;
+	identification->estimate.p1 = p1;
+	identification->estimate.p0Deviation = 0;
+	identification->estimate.p1Deviation = 0;
+	identification->estimate.samples = 0;
+	identification->estimate.refreshes = 0;
+}
+
+// the low-pass stages in series, returns the output of the last one
+static float prefilter(float * stages, const float value) {
+
+	float output = value;
+	int i;
+
+	for (i = 0; i < KALMAN_IDENTIFICATION_STAGES; i++) {
+
+		stages[i] += KALMAN_IDENTIFICATION_FILTER*(output - stages[i]);
+		output = stages[i];
+	}
+
+	return output;
+}
+
+// one step of the least squares with the forgetting factor, y = theta'*regressor
+static void leastSquaresUpdate(kalmanIdentification_t * identification, const float * regressor, const float y) {
+
+	float * P = identification->covariance;
+	float * theta = identification->theta;
+
+	float Pr[N];
+	float denominator = KALMAN_IDENTIFICATION_FORGETTING;
+	float error = y;
+	float trace = 0;
+	int i, j;
+
+	// P*regressor, its projection and the prediction error
+	for (i = 0; i < N; i++) {
+
+		Pr[i] = 0;
+
+		for (j = 0; j < N; j++)
+			Pr[i] += P[i*N + j]*regressor[j];
+
+		denominator += regressor[i]*Pr[i];
+		error -= theta[i]*regressor[i];
+	}
+
+	// theta += gain*error, gain = P*regressor/denominator
+	for (i = 0; i < N; i++)
+		theta[i] += Pr[i]*error/denominator;
+
+	// P = (P - gain*(P*regressor)')/forgetting, the upper triangle mirrored
+	for (i = 0; i < N; i++) {
+
+		for (j = i; j < N; j++) {
+
+			P[i*N + j] = (P[i*N + j] - Pr[i]*Pr[j]/denominator)/KALMAN_IDENTIFICATION_FORGETTING;
+			P[j*N + i] = P[i*N + j];
+		}
+
+		trace += P[i*N + i];
+	}
+
+	// without excitation the forgetting would let the covariance grow without a bound
+	if (trace > KALMAN_IDENTIFICATION_MAX_TRACE)
+		for (i = 0; i < N*N; i++)
+			P[i] *= KALMAN_IDENTIFICATION_MAX_TRACE/trace;
+
+	identification->noise += (1 - KALMAN_IDENTIFICATION_FORGETTING)*(error*error - identification->noise);
+}
+
+void kalmanIdentificationStep(kalmanIdentification_t * identification, const float velocity, const float input) {
+
+	float filteredVelocity, filteredInput, acceleration;
+	int i;
+
+	// the filters start at the first sample
+	if (identification->steps == 0) {
+
+		for (i = 0; i < KALMAN_IDENTIFICATION_STAGES; i++) {
+
+			identification->velocityFilter[i] = velocity;
+			identification->inputFilter[i] = input;
+		}
+
+		identification->velocity = velocity;
+		identification->inputs[0] = input;
+		identification->inputs[1] = input;
+	}
+
+	filteredVelocity = prefilter(identification->velocityFilter, velocity);
+	filteredInput = prefilter(identification->inputFilter, input);
+
+	acceleration = (filteredVelocity - identification->velocity)/identification->dt;
+
+	// a saturated speed does not follow the model
+	if (identification->steps >= 2 && fabsf(velocity) < KALMAN_MEASURED_VELOCITY_SATURATION) {
+
+		// the speed of this step follows the acceleration and the input from two steps back
+		const float regressor[N] = {identification->acceleration, identification->inputs[1]*KALMAN_IDENTIFICATION_INPUT_SCALE, 1};
+
+		leastSquaresUpdate(identification, regressor, acceleration);
+
+		identification->estimate.p0 = identification->theta[P0_PARAMETER];
+		identification->estimate.p1 = identification->theta[P1_PARAMETER]*KALMAN_IDENTIFICATION_INPUT_SCALE;
+		identification->estimate.p0Deviation = sqrtf(identification->noise*identification->covariance[P0_PARAMETER*(N+1)]);
+		identification->estimate.p1Deviation = sqrtf(identification->noise*identification->covariance[P1_PARAMETER*(N+1)])*KALMAN_IDENTIFICATION_INPUT_SCALE;
+		identification->estimate.samples++;
+	}
+
+	identification->inputs[1] = identification->inputs[0];
+	identification->inputs[0] = filteredInput;
+	identification->velocity = filteredVelocity;
+	identification->acceleration = acceleration;
+
+	identification->steps++;
+	identification->sinceRefresh++;
+}
+
+int kalmanIdentificationRefresh(kalmanIdentification_t * identification, kalmanHandler_t * kalmanHandler) {
+
+	const kalmanModelEstimate_t * estimate = &identification->estimate;
+
+	if (estimate->samples < KALMAN_IDENTIFICATION_MIN_SAMPLES || identification->sinceRefresh < KALMAN_IDENTIFICATION_PERIOD)
+		return 0;
+
+	identification->sinceRefresh = 0;
+
+	// a stable first-order model with a positive gain only
+	if (estimate->p0 <= 0 || estimate->p0 >= 1 || estimate->p1 <= 0)
+		return 0;
+
+	if (estimate->p0Deviation > KALMAN_IDENTIFICATION_P0_DEVIATION || estimate->p1Deviation > KALMAN_IDENTIFICATION_P1_DEVIATION*estimate->p1)
+		return 0;
+
+	matrix_float_set(kalmanHandler->system_A, 4, 4, estimate->p0);
+	matrix_float_set(kalmanHandler->system_B, 4, 1, estimate->p1);
+
+	// the gain of the new model converges again
+	kalmanHandler->steady_state = 0;
+	kalmanHandler->steady_steps = 0;
+
+	identification->estimate.refreshes++;
+
+	return 1;
+}
@@ -0,0 +1,69 @@
+/*
+ * kalmanIdentification.h
+ *
+ *  Author: Tomas Baca
+ */
+
+#ifndef KALMANIDENTIFICATION_H_
+#define KALMANIDENTIFICATION_H_
+
+#include "kalman.h"
+
+// P0, P1 and the acceleration caused by the disturbance state
+#define KALMAN_IDENTIFICATION_PARAMETERS	3
+
+// stages of the low-pass prefilter
+#define KALMAN_IDENTIFICATION_STAGES		3
+
+// the input is estimated per 1000 units, keeps the covariance well conditioned in float
+#define KALMAN_IDENTIFICATION_INPUT_SCALE	0.001
+
+// the current estimate of the attitude model of one axis
+typedef struct {
+
+	float p0;				// system_A(4, 4), ATTITUDE_P0 at the start
+	float p1;				// system_B(4, 1), ATTITUDE_P1 at the start
+	float p0Deviation;		// the standard deviations of the estimates, the confidence
+	float p1Deviation;
+	uint32_t samples;		// the samples used by the least squares
+	uint32_t refreshes;		// how many times the kalman model was refreshed
+} kalmanModelEstimate_t;
+
+// the recursive least squares of the model acceleration(k) = P0*acceleration(k-1) + P1*input(k)
+typedef struct {
+
+	float theta[KALMAN_IDENTIFICATION_PARAMETERS];	// P0, P1/KALMAN_IDENTIFICATION_INPUT_SCALE and the disturbance term
+	float covariance[KALMAN_IDENTIFICATION_PARAMETERS*KALMAN_IDENTIFICATION_PARAMETERS];	// of theta, up to the noise variance
+	float noise;			// the running variance of the prediction error
+
+	float velocityFilter[KALMAN_IDENTIFICATION_STAGES];	// the prefilter stages of the px4flow speed
+	float inputFilter[KALMAN_IDENTIFICATION_STAGES];	// the prefilter stages of the input
+	float inputs[2];		// the filtered inputs of the two previous steps
+	float velocity;			// the filtered speed of the previous step
+	float dt;				// the px4flow period of the kalman model
+	float acceleration;		// the filtered acceleration of the previous step
+
+	uint32_t steps;			// px4flow steps since the reset
+	uint32_t sinceRefresh;	// steps since the last refresh of the kalman model
+
+	kalmanModelEstimate_t estimate;
+} kalmanIdentification_t;
+
+// start from the model in config.h with the px4flow period dt, the estimate is not confident
+void kalmanIdentificationReset(kalmanIdentification_t * identification, const float p0, const float p1, const float dt);
+
+/**
+ * @brief update the estimate with the px4flow speed and the input of the kalman step
+ *
+ * Both signals pass the same low-pass prefilter, the model holds for the
+ * filtered signals as well while the px4flow noise does not dominate the
+ * differentiated speed. The speed of the kalman model follows the acceleration
+ * two steps later, the input is delayed the same way. O(n^2) for n parameters.
+ */
+void kalmanIdentificationStep(kalmanIdentification_t * identification, const float velocity, const float input);
+
+// refresh system_A and system_B of the handler with a confident estimate every KALMAN_IDENTIFICATION_PERIOD steps
+// returns 1 when the model was changed, the steady gain is computed again afterwards
+int kalmanIdentificationRefresh(kalmanIdentification_t * identification, kalmanHandler_t * kalmanHandler);
+
+#endif /* KALMANIDENTIFICATION_H_ */
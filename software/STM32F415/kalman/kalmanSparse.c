@@ -0,0 +1,290 @@
+/*
+ * kalmanSparse.c
+ *
+ *  Author: Tomas Baca
+ */
+
+#include "kalmanSparse.h"
+#include "system.h"
+#include "config.h"
+
+#if KALMAN_SPARSE_STATES != 5
+#error "KALMAN_EACH_STATE has to expand to KALMAN_SPARSE_STATES states"
+#endif
+
+#define N	KALMAN_SPARSE_STATES
+
+// || (row, column) is the element (i, j)
+#define IS_ELEMENT(i, j) || ((row == (i)) && (column == (j)))
+
+static int inPatternA(const int row, const int column) {
+
+	return 0 KALMAN_A_NONZEROS(IS_ELEMENT);
+}
+
+static int inPatternB(const int row, const int column) {
+
+	return 0 KALMAN_B_NONZEROS(IS_ELEMENT);
+}
+
+static int inPatternC(const int row, const int column) {
+
+	return 0 KALMAN_C_NONZEROS(IS_ELEMENT);
+}
+
+int kalmanMatchesSparsity(const kalmanHandler_t * handler) {
+
+	int i, j;
+
+	if (handler->number_of_states != N || handler->number_of_inputs != KALMAN_SPARSE_INPUTS)
+		return 0;
+
+	if (handler->C_matrix == NULL || handler->C_matrix->height != 1 || handler->C_matrix->width != N)
+		return 0;
+
+	for (i = 0; i < N; i++) {
+
+		for (j = 0; j < N; j++)
+			if (!inPatternA(i, j) && handler->system_A->data[i*N + j] != 0)
+				return 0;
+
+		for (j = 0; j < KALMAN_SPARSE_INPUTS; j++)
+			if (!inPatternB(i, j) && handler->system_B->data[i*KALMAN_SPARSE_INPUTS + j] != 0)
+				return 0;
+
+		if (!inPatternC(0, i) && handler->C_matrix->data[i] != 0)
+			return 0;
+	}
+
+	return 1;
+}
+
+void kalmanIterationSparse(kalmanHandler_t * handler) {
+
+	float * A = handler->system_A->data;
+	float * B = handler->system_B->data;
+	float * R = handler->R_matrix->data;
+	float * C = handler->C_matrix->data;
+	float * P = handler->covariance_packed;
+	float * x = handler->states->data;
+	float * u = handler->input->data;
+
+	// the temporaries in the workspace of the handler
+	float * states = handler->workspace;
+	float * full = states + N;
+	float * AP = full + N*N;
+	float * predicted = AP + N*N;
+	float * PC = predicted + N*N;
+
+	float innovation, inverse;
+	int i, j, p;
+
+	for (i = 0; i < N; i++)
+		states[i] = PC[i] = 0;
+
+	for (i = 0; i < N*N; i++)
+		AP[i] = 0;
+
+	/* -------------------------------------------------------------------- */
+	/*	prediction step														*/
+	/* -------------------------------------------------------------------- */
+
+	// states = A*states + B*input
+#define STATE_TERM(i, k) states[i] += A[(i)*N + (k)]*x[k];
+#define INPUT_TERM(i, k) states[i] += B[(i)*KALMAN_SPARSE_INPUTS + (k)]*u[k];
+
+	KALMAN_A_NONZEROS(STATE_TERM)
+	KALMAN_B_NONZEROS(INPUT_TERM)
+
+	// unpack the symmetric covariance, start the prediction from R
+	for (i = 0, p = 0; i < N; i++)
+		for (j = i; j < N; j++, p++) {
+
+			full[i*N + j] = full[j*N + i] = P[p];
+			predicted[i*N + j] = R[i*N + j];
+		}
+
+	// AP = A*covariance, a row of the covariance for each nonzero of A
+#define AP_TERM(i, k, j) AP[(i)*N + (j)] += A[(i)*N + (k)]*full[(k)*N + (j)];
+#define AP_ROW(i, k) KALMAN_EACH_STATE(AP_TERM, i, k)
+
+	KALMAN_A_NONZEROS(AP_ROW)
+
+	// predicted += AP*A', only the upper triangle (i <= j), the condition is resolved by the compiler
+#define APA_TERM(j, l, i) if ((i) <= (j)) predicted[(i)*N + (j)] += AP[(i)*N + (l)]*A[(j)*N + (l)];
+#define APA_COLUMN(j, l) KALMAN_EACH_STATE(APA_TERM, j, l)
+
+	KALMAN_A_NONZEROS(APA_COLUMN)
+
+	/* -------------------------------------------------------------------- */
+	/*	Correction step														*/
+	/* -------------------------------------------------------------------- */
+
+	// PC = covariance*C', the upper triangle is read for both halves
+#define PC_TERM(r, k, i) PC[i] += predicted[((i) <= (k)) ? ((i)*N + (k)) : ((k)*N + (i))]*C[k];
+#define PC_COLUMN(r, k) KALMAN_EACH_STATE(PC_TERM, r, k)
+
+	KALMAN_C_NONZEROS(PC_COLUMN)
+
+	// s = C*covariance*C' + Q, innovation = measurement - C*states
+	inverse = handler->Q_matrix->data[0];
+	innovation = handler->measurement->data[0];
+
+#define INNOVATION_TERM(r, k) inverse += C[k]*PC[k]; innovation -= C[k]*states[k];
+
+	KALMAN_C_NONZEROS(INNOVATION_TERM)
+
+	inverse = 1/inverse;
+
+#ifdef KALMAN_STEADY_STATE
+	kalmanTrackGain(handler, PC, inverse);
+#endif
+
+	// states += K*innovation, K = PC/s
+	for (i = 0; i < N; i++)
+		states[i] += PC[i]*(inverse*innovation);
+
+	// covariance = predicted - PC*PC'/s, packed again
+	for (i = 0, p = 0; i < N; i++) {
+
+		float scaled = PC[i]*inverse;
+
+		for (j = i; j < N; j++, p++)
+			P[p] = predicted[i*N + j] - scaled*PC[j];
+	}
+
+	/* -------------------------------------------------------------------- */
+	/*	Copy output to the handler											*/
+	/* -------------------------------------------------------------------- */
+
+	for (i = 0; i < N; i++)
+		x[i] = states[i];
+}
+
+/* -------------------------------------------------------------------- */
+/*	Both axes in one pass												*/
+/* -------------------------------------------------------------------- */
+
+// the statement S for the axis a = 0 and a = 1, the two independent chains fill the FPU pipeline
+#define BOTH_AXES(S) { { const int a = 0; S } { const int a = 1; S } }
+
+void kalmanIterationSparsePair(kalmanHandler_t * first, kalmanHandler_t * second) {
+
+	kalmanHandler_t * handler[2] = {first, second};
+
+	float * A[2], * B[2], * R[2], * C[2], * P[2], * x[2], * u[2];
+
+	// the working arrays interleaved by the axis, [element][axis], in the workspace of the first handler
+	float (* states)[2] = (float (*)[2]) first->workspace;
+	float (* full)[2] = states + N;
+	float (* AP)[2] = full + N*N;
+	float (* predicted)[2] = AP + N*N;
+	float (* PC)[2] = predicted + N*N;
+
+	float innovation[2], inverse[2];
+	int i, j, p;
+
+	for (i = 0; i < N; i++)
+		BOTH_AXES(states[i][a] = PC[i][a] = 0;)
+
+	for (i = 0; i < N*N; i++)
+		BOTH_AXES(AP[i][a] = 0;)
+
+	BOTH_AXES(
+		A[a] = handler[a]->system_A->data;
+		B[a] = handler[a]->system_B->data;
+		R[a] = handler[a]->R_matrix->data;
+		C[a] = handler[a]->C_matrix->data;
+		P[a] = handler[a]->covariance_packed;
+		x[a] = handler[a]->states->data;
+		u[a] = handler[a]->input->data;
+	)
+
+	/* -------------------------------------------------------------------- */
+	/*	prediction step														*/
+	/* -------------------------------------------------------------------- */
+
+	// states = A*states + B*input
+#define PAIR_STATE_TERM(i, k) BOTH_AXES(states[i][a] += A[a][(i)*N + (k)]*x[a][k];)
+#define PAIR_INPUT_TERM(i, k) BOTH_AXES(states[i][a] += B[a][(i)*KALMAN_SPARSE_INPUTS + (k)]*u[a][k];)
+
+	KALMAN_A_NONZEROS(PAIR_STATE_TERM)
+	KALMAN_B_NONZEROS(PAIR_INPUT_TERM)
+
+	// unpack the symmetric covariances, start the prediction from R
+	for (i = 0, p = 0; i < N; i++)
+		for (j = i; j < N; j++, p++) {
+
+			BOTH_AXES(
+				full[i*N + j][a] = full[j*N + i][a] = P[a][p];
+				predicted[i*N + j][a] = R[a][i*N + j];
+			)
+		}
+
+	// AP = A*covariance
+#define PAIR_AP_TERM(i, k, j) BOTH_AXES(AP[(i)*N + (j)][a] += A[a][(i)*N + (k)]*full[(k)*N + (j)][a];)
+#define PAIR_AP_ROW(i, k) KALMAN_EACH_STATE(PAIR_AP_TERM, i, k)
+
+	KALMAN_A_NONZEROS(PAIR_AP_ROW)
+
+	// predicted += AP*A', only the upper triangle
+#define PAIR_APA_TERM(j, l, i) if ((i) <= (j)) BOTH_AXES(predicted[(i)*N + (j)][a] += AP[(i)*N + (l)][a]*A[a][(j)*N + (l)];)
+#define PAIR_APA_COLUMN(j, l) KALMAN_EACH_STATE(PAIR_APA_TERM, j, l)
+
+	KALMAN_A_NONZEROS(PAIR_APA_COLUMN)
+
+	/* -------------------------------------------------------------------- */
+	/*	Correction step														*/
+	/* -------------------------------------------------------------------- */
+
+	// PC = covariance*C'
+#define PAIR_PC_TERM(r, k, i) BOTH_AXES(PC[i][a] += predicted[((i) <= (k)) ? ((i)*N + (k)) : ((k)*N + (i))][a]*C[a][k];)
+#define PAIR_PC_COLUMN(r, k) KALMAN_EACH_STATE(PAIR_PC_TERM, r, k)
+
+	KALMAN_C_NONZEROS(PAIR_PC_COLUMN)
+
+	// s = C*covariance*C' + Q, innovation = measurement - C*states
+	BOTH_AXES(
+		inverse[a] = handler[a]->Q_matrix->data[0];
+		innovation[a] = handler[a]->measurement->data[0];
+	)
+
+#define PAIR_INNOVATION_TERM(r, k) BOTH_AXES(inverse[a] += C[a][k]*PC[k][a]; innovation[a] -= C[a][k]*states[k][a];)
+
+	KALMAN_C_NONZEROS(PAIR_INNOVATION_TERM)
+
+	BOTH_AXES(inverse[a] = 1/inverse[a];)
+
+#ifdef KALMAN_STEADY_STATE
+	BOTH_AXES(
+		float gain[N];
+
+		for (i = 0; i < N; i++)
+			gain[i] = PC[i][a];
+
+		kalmanTrackGain(handler[a], gain, inverse[a]);
+	)
+#endif
+
+	// states += K*innovation, K = PC/s
+	for (i = 0; i < N; i++)
+		BOTH_AXES(states[i][a] += PC[i][a]*(inverse[a]*innovation[a]);)
+
+	// covariance = predicted - PC*PC'/s, packed again
+	for (i = 0, p = 0; i < N; i++) {
+
+		float scaled[2];
+
+		BOTH_AXES(scaled[a] = PC[i][a]*inverse[a];)
+
+		for (j = i; j < N; j++, p++)
+			BOTH_AXES(P[a][p] = predicted[i*N + j][a] - scaled[a]*PC[j][a];)
+	}
+
+	/* -------------------------------------------------------------------- */
+	/*	Copy output to the handlers											*/
+	/* -------------------------------------------------------------------- */
+
+	for (i = 0; i < N; i++)
+		BOTH_AXES(x[a][i] = states[i][a];)
+}
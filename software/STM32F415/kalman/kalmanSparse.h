@@ -0,0 +1,62 @@
+/*
+ * kalmanSparse.h
+ *
+ *  Author: Tomas Baca
+ */
+
+#ifndef KALMANSPARSE_H_
+#define KALMANSPARSE_H_
+
+#include "kalman.h"
+
+/* -------------------------------------------------------------------- */
+/*	Sparsity pattern of the model										*/
+/* -------------------------------------------------------------------- */
+
+// the structure set in initializeElevatorKalman() and initializeAileronKalman(),
+// only the values (ATTITUDE_P0, DT_*, ATTITUDE_P1) differ between the airframes
+
+#define KALMAN_SPARSE_STATES	5
+#define KALMAN_SPARSE_INPUTS	1
+
+// X(row, column) from 0 for each element of system_A which can be nonzero
+#define KALMAN_A_NONZEROS(X) \
+	X(0, 0) X(0, 1) \
+	X(1, 1) X(1, 2) \
+	X(2, 3) X(2, 4) \
+	X(3, 3) \
+	X(4, 4)
+
+// X(row, column) for system_B
+#define KALMAN_B_NONZEROS(X) \
+	X(3, 0)
+
+// X(row, column) for C_matrix, the px4flow speed
+#define KALMAN_C_NONZEROS(X) \
+	X(0, 1)
+
+// Y(a, b, state) for each state, expands the kernels to straight-line code
+#define KALMAN_EACH_STATE(Y, a, b) \
+	Y(a, b, 0) Y(a, b, 1) Y(a, b, 2) Y(a, b, 3) Y(a, b, 4)
+
+// returns 1 if the matrices of the handler are zero outside of the pattern
+int kalmanMatchesSparsity(const kalmanHandler_t * handler);
+
+/**
+ * @brief kalmanIterationScalar() with the products expanded over the pattern
+ *
+ * The zeros of A, B and C are skipped, the handler has to pass
+ * kalmanMatchesSparsity() with its current matrices.
+ */
+void kalmanIterationSparse(kalmanHandler_t * handler);
+
+/**
+ * @brief kalmanIterationSparse() of two handlers in one pass (elevator and aileron)
+ *
+ * Each expanded product is done for both axes next to each other, the working
+ * arrays are interleaved by the axis. Both handlers have to pass
+ * kalmanMatchesSparsity() and have their own measurement vectors.
+ */
+void kalmanIterationSparsePair(kalmanHandler_t * first, kalmanHandler_t * second);
+
+#endif /* KALMANSPARSE_H_ */
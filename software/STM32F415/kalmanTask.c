@@ -7,9 +7,102 @@
 #include "system.h"
 #include "kalmanTask.h"
 #include "kalman/kalman.h"
+#include "kalman/kalmanSparse.h"
+#include "kalman/kalmanHistory.h"
+#include "kalman/kalmanIdentification.h"
 #include "kalman/elevator/elevatorKalman.h"
 #include "kalman/aileron/aileronKalman.h"
 #include "config.h"
+#include <string.h>
+
+volatile kalmanBenchmark_t kalmanBenchmark;
+volatile kalmanModelEstimate_t elevatorModelEstimate;
+volatile kalmanModelEstimate_t aileronModelEstimate;
+
+#ifdef KALMAN_IDENTIFICATION
+
+kalmanIdentification_t elevatorIdentification;
+kalmanIdentification_t aileronIdentification;
+
+#endif
+
+#ifdef KALMAN_POSITION_FUSION
+
+#ifdef KALMAN_FULL_MATRICES
+#error "KALMAN_POSITION_FUSION works with the packed covariance, not with KALMAN_FULL_MATRICES"
+#endif
+
+#define ELEVATOR_PACKED	(NUMBER_OF_STATES_ELEVATOR*(NUMBER_OF_STATES_ELEVATOR+1)/2)
+#define AILERON_PACKED	(NUMBER_OF_STATES_AILERON*(NUMBER_OF_STATES_AILERON+1)/2)
+
+// the past px4flow steps of both kalmans
+float elevatorHistoryStates[KALMAN_HISTORY_LENGTH*NUMBER_OF_STATES_ELEVATOR];
+float elevatorHistoryCovariance[KALMAN_HISTORY_LENGTH*ELEVATOR_PACKED];
+float elevatorHistoryInput[KALMAN_HISTORY_LENGTH*NUMBER_OF_INPUTS_ELEVATOR];
+float elevatorHistoryMeasurement[KALMAN_HISTORY_LENGTH];
+uint16_t elevatorHistorySequence[KALMAN_HISTORY_LENGTH];
+
+float aileronHistoryStates[KALMAN_HISTORY_LENGTH*NUMBER_OF_STATES_AILERON];
+float aileronHistoryCovariance[KALMAN_HISTORY_LENGTH*AILERON_PACKED];
+float aileronHistoryInput[KALMAN_HISTORY_LENGTH*NUMBER_OF_INPUTS_AILERON];
+float aileronHistoryMeasurement[KALMAN_HISTORY_LENGTH];
+uint16_t aileronHistorySequence[KALMAN_HISTORY_LENGTH];
+
+kalmanHistory_t elevatorHistory = {elevatorHistoryStates, elevatorHistoryCovariance, elevatorHistoryInput, elevatorHistoryMeasurement, elevatorHistorySequence, KALMAN_HISTORY_LENGTH - 1, 0};
+kalmanHistory_t aileronHistory = {aileronHistoryStates, aileronHistoryCovariance, aileronHistoryInput, aileronHistoryMeasurement, aileronHistorySequence, KALMAN_HISTORY_LENGTH - 1, 0};
+
+#endif
+
+// the kalman step with the px4flow speed, the only measurement there is
+static void kalmanMeasurementStep(kalmanHandler_t * handler) {
+
+#ifdef KALMAN_STEADY_STATE
+	// the gain has converged, the covariance is not propagated until the next reset
+	if (handler->steady_state) {
+
+		kalmanIterationSteady(handler);
+		return;
+	}
+#endif
+
+#ifdef KALMAN_FULL_MATRICES
+	kalmanIteration(handler);
+#else
+	// the kernels expanded over the model structure, the dense scalar update if it does not match
+	if (handler->sparse_kernel)
+		kalmanIterationSparse(handler);
+	else
+		kalmanIterationScalar(handler);
+#endif
+}
+
+#ifdef KALMAN_PREDICTION_TIMER
+
+// the states at the fraction of the px4flow period between two model predictions
+static void interpolateStates(const float * from, const float * to, const float fraction, float * states, const int n) {
+
+	int i;
+
+	for (i = 0; i < n; i++)
+		states[i] = from[i] + fraction*(to[i] - from[i]);
+}
+
+#endif
+
+// the kalman steps of both axes, in one pass when both match the sparse kernel
+static void kalmanMeasurementStepPair(kalmanHandler_t * elevator, kalmanHandler_t * aileron) {
+
+#ifndef KALMAN_FULL_MATRICES
+	if (elevator->sparse_kernel && aileron->sparse_kernel && !elevator->steady_state && !aileron->steady_state) {
+
+		kalmanIterationSparsePair(elevator, aileron);
+		return;
+	}
+#endif
+
+	kalmanMeasurementStep(elevator);
+	kalmanMeasurementStep(aileron);
+}
 
 void kalmanTask(void *p) {
 
@@ -17,9 +110,10 @@ void kalmanTask(void *p) {
 	kalmanHandler_t * elevatorKalmanHandler = initializeElevatorKalman();
 
 	/* -------------------------------------------------------------------- */
-	/* Vector for 1-state measurement										*/
+	/* Vectors for 1-state measurement, one for each axis					*/
 	/* -------------------------------------------------------------------- */
-	vector_float * measurement_1_state = vector_float_alloc(1, 0);
+	vector_float * elevator_measurement_1_state = vector_float_alloc(1, 0);
+	vector_float * aileron_measurement_1_state = vector_float_alloc(1, 0);
 
 	/* -------------------------------------------------------------------- */
 	/* px4flow speed measurement noise matrix	(Q)	(1-state)				*/
@@ -39,6 +133,24 @@ void kalmanTask(void *p) {
 	matrix_float_set(px4flow_C_matrix_1_state, 1, 4, 0);
 	matrix_float_set(px4flow_C_matrix_1_state, 1, 5, 0);
 
+	/* -------------------------------------------------------------------- */
+	/* The model and the px4flow C matrix never change, check them once		*/
+	/* -------------------------------------------------------------------- */
+	elevatorKalmanHandler->C_matrix = px4flow_C_matrix_1_state;
+	aileronKalmanHandler->C_matrix = px4flow_C_matrix_1_state;
+
+	elevatorKalmanHandler->sparse_kernel = kalmanMatchesSparsity(elevatorKalmanHandler);
+	aileronKalmanHandler->sparse_kernel = kalmanMatchesSparsity(aileronKalmanHandler);
+
+#ifdef KALMAN_IDENTIFICATION
+	// only the values of the model are refreshed, its structure stays
+	kalmanIdentificationReset(&elevatorIdentification, ATTITUDE_P0, ATTITUDE_P1, DT_ELEVATOR);
+	kalmanIdentificationReset(&aileronIdentification, ATTITUDE_P0, ATTITUDE_P1, DT_AILERON);
+
+	elevatorModelEstimate = elevatorIdentification.estimate;
+	aileronModelEstimate = aileronIdentification.estimate;
+#endif
+
 	/* -------------------------------------------------------------------- */
 	/* Messages between tasks												*/
 	/* -------------------------------------------------------------------- */
@@ -47,8 +159,29 @@ void kalmanTask(void *p) {
 	kalman2commMessage_t kalman2commMesasge;
 	resetKalmanMessage_t resetKalmanMessage;
 
+#ifdef KALMAN_POSITION_FUSION
+	position2kalmanMessage_t positionMessage;
+#endif
+
+#ifdef KALMAN_PREDICTION_TIMER
+	// the last estimate and its prediction one px4flow period ahead, the ticks go between them
+	float elevatorFrom[NUMBER_OF_STATES_ELEVATOR], elevatorTo[NUMBER_OF_STATES_ELEVATOR];
+	float aileronFrom[NUMBER_OF_STATES_AILERON], aileronTo[NUMBER_OF_STATES_AILERON];
+
+	uint32_t ticksDone = kalmanTicks;
+	uint32_t ticksSinceStep = 0;
+
+	memcpy(elevatorFrom, elevatorKalmanHandler->states->data, NUMBER_OF_STATES_ELEVATOR*sizeof(float));
+	memcpy(aileronFrom, aileronKalmanHandler->states->data, NUMBER_OF_STATES_AILERON*sizeof(float));
+	kalmanPredictStates(elevatorKalmanHandler, elevatorFrom, elevatorTo);
+	kalmanPredictStates(aileronKalmanHandler, aileronFrom, aileronTo);
+#endif
+
 	while (1) {
 
+		// sleep until a message of commTask or a prediction tick comes
+		xSemaphoreTake(kalmanEvent, PIPELINE_WAIT);
+
 		if (xQueueReceive(resetKalmanQueue, &resetKalmanMessage, 0)) {
 
 			// reset state vectors
@@ -60,8 +193,14 @@ void kalmanTask(void *p) {
 			vector_float_set(aileronKalmanHandler->states, 1, resetKalmanMessage.aileronPosition);
 
 			// reset the covariance matrices
-			matrix_float_set_identity(elevatorKalmanHandler->covariance);
-			matrix_float_set_identity(aileronKalmanHandler->covariance);
+			kalmanResetCovariance(elevatorKalmanHandler);
+			kalmanResetCovariance(aileronKalmanHandler);
+
+#ifdef KALMAN_POSITION_FUSION
+			// the positions before the reset are not fused any more
+			kalmanHistoryClear(&elevatorHistory);
+			kalmanHistoryClear(&aileronHistory);
+#endif
 		}
 
 		if (xQueueReceive(setKalmanQueue, &resetKalmanMessage, 0)) {
@@ -71,54 +210,132 @@ void kalmanTask(void *p) {
 			vector_float_set(aileronKalmanHandler->states, 1, resetKalmanMessage.aileronPosition);
 
 			// reset the covariance of the postion
-			matrix_float_set(elevatorKalmanHandler->covariance, 1, 1, 1);
-			matrix_float_set(aileronKalmanHandler->covariance, 1, 1, 1);
+			kalmanSetCovariance(elevatorKalmanHandler, 1, 1, 1);
+			kalmanSetCovariance(aileronKalmanHandler, 1, 1, 1);
+
+#ifdef KALMAN_POSITION_FUSION
+			kalmanHistoryClear(&elevatorHistory);
+			kalmanHistoryClear(&aileronHistory);
+#endif
+		}
+
+#ifdef KALMAN_POSITION_FUSION
+		/* -------------------------------------------------------------------- */
+		/*	A delayed position, fused at the px4flow step it belongs to			*/
+		/* -------------------------------------------------------------------- */
+		if (xQueueReceive(position2kalmanQueue, &positionMessage, 0)) {
+
+			// at most KALMAN_HISTORY_LENGTH steps of each axis are computed again
+			kalmanHistoryFuse(&elevatorHistory, elevatorKalmanHandler, positionMessage.sequence, positionMessage.elevatorPosition, KALMAN_POSITION_Q, kalmanMeasurementStep);
+			kalmanHistoryFuse(&aileronHistory, aileronKalmanHandler, positionMessage.sequence, positionMessage.aileronPosition, KALMAN_POSITION_Q, kalmanMeasurementStep);
 		}
+#endif
 
 		if (xQueueReceive(comm2kalmanQueue, &comm2kalmanMessage, 0)) {
 
+			kalman2mpcMessage.trace.decoded = comm2kalmanMessage.timestamp;
+			kalman2mpcMessage.trace.kalmanStart = cycleCounterGet();
+
+#ifdef KALMAN_BENCHMARK
+			uint32_t cycles = cycleCounterGet();
+#endif
+
 			/* -------------------------------------------------------------------- */
-			/*	Compute elevator kalman												*/
+			/*	Prepare elevator kalman												*/
 			/* -------------------------------------------------------------------- */
 
 			// set the input vector
 			vector_float_set(elevatorKalmanHandler->input, 1, comm2kalmanMessage.elevatorInput);
 
 			// set the measurement vector
-			vector_float_set(measurement_1_state, 1, comm2kalmanMessage.elevatorSpeed);
+			vector_float_set(elevator_measurement_1_state, 1, comm2kalmanMessage.elevatorSpeed);
 
 			// set pointers to measurement related matrices
-			elevatorKalmanHandler->measurement = measurement_1_state;
+			elevatorKalmanHandler->measurement = elevator_measurement_1_state;
 			elevatorKalmanHandler->C_matrix = px4flow_C_matrix_1_state;
 			elevatorKalmanHandler->Q_matrix = px4flow_Q_matrix_1_state;
 
-			kalmanIteration(elevatorKalmanHandler);
-
 			/* -------------------------------------------------------------------- */
-			/*	Compute aileron kalman												*/
+			/*	Prepare aileron kalman												*/
 			/* -------------------------------------------------------------------- */
 
 			// set the input vector
 			vector_float_set(aileronKalmanHandler->input, 1, comm2kalmanMessage.aileronInput);
 
 			// set the measurement vector
-			vector_float_set(measurement_1_state, 1, comm2kalmanMessage.aileronSpeed);
+			vector_float_set(aileron_measurement_1_state, 1, comm2kalmanMessage.aileronSpeed);
 
 			// set pointers to measurement related matrices
-			aileronKalmanHandler->measurement = measurement_1_state;
+			aileronKalmanHandler->measurement = aileron_measurement_1_state;
 			aileronKalmanHandler->C_matrix = px4flow_C_matrix_1_state;
 			aileronKalmanHandler->Q_matrix = px4flow_Q_matrix_1_state;
 
-			kalmanIteration(aileronKalmanHandler);
+			/* -------------------------------------------------------------------- */
+			/*	Compute both kalmans												*/
+			/* -------------------------------------------------------------------- */
+
+			kalmanMeasurementStepPair(elevatorKalmanHandler, aileronKalmanHandler);
+
+#ifdef KALMAN_IDENTIFICATION
+			/* -------------------------------------------------------------------- */
+			/*	Identify the attitude model, refresh the kalman when confident		*/
+			/* -------------------------------------------------------------------- */
+
+			kalmanIdentificationStep(&elevatorIdentification, comm2kalmanMessage.elevatorSpeed, comm2kalmanMessage.elevatorInput);
+			kalmanIdentificationStep(&aileronIdentification, comm2kalmanMessage.aileronSpeed, comm2kalmanMessage.aileronInput);
+
+			// the next step predicts with the new model
+			kalmanIdentificationRefresh(&elevatorIdentification, elevatorKalmanHandler);
+			kalmanIdentificationRefresh(&aileronIdentification, aileronKalmanHandler);
+
+			elevatorModelEstimate = elevatorIdentification.estimate;
+			aileronModelEstimate = aileronIdentification.estimate;
+#endif
+
+#ifdef KALMAN_POSITION_FUSION
+			kalmanHistoryRecord(&elevatorHistory, elevatorKalmanHandler, comm2kalmanMessage.sequence);
+			kalmanHistoryRecord(&aileronHistory, aileronKalmanHandler, comm2kalmanMessage.sequence);
+#endif
+
+#ifdef KALMAN_BENCHMARK
+			kalmanBenchmark.cycles = cycleCounterGet() - cycles;
+
+			if (kalmanBenchmark.cycles > kalmanBenchmark.maxCycles)
+				kalmanBenchmark.maxCycles = kalmanBenchmark.cycles;
+
+			// the steps with the frozen gains apart from the full filter
+			if (elevatorKalmanHandler->steady_state && aileronKalmanHandler->steady_state)
+				kalmanBenchmark.steadyCycles = kalmanBenchmark.cycles;
+			else
+				kalmanBenchmark.filterCycles = kalmanBenchmark.cycles;
+#endif
 
 			/* -------------------------------------------------------------------- */
 			/*	Create a message for mpcTask										*/
 			/* -------------------------------------------------------------------- */
 
+			// only this task writes the states, they are copied without masking the interrupts
 			memcpy(&kalman2mpcMessage.elevatorData, elevatorKalmanHandler->states->data, NUMBER_OF_STATES_ELEVATOR*sizeof(float));
 			memcpy(&kalman2mpcMessage.aileronData, aileronKalmanHandler->states->data, NUMBER_OF_STATES_AILERON*sizeof(float));
 
+#ifdef KALMAN_PREDICTION_TIMER
+			// the ticks predict from the corrected states on, they send the message to mpcTask
+			memcpy(elevatorFrom, kalman2mpcMessage.elevatorData, NUMBER_OF_STATES_ELEVATOR*sizeof(float));
+			memcpy(aileronFrom, kalman2mpcMessage.aileronData, NUMBER_OF_STATES_AILERON*sizeof(float));
+			kalmanPredictStates(elevatorKalmanHandler, elevatorFrom, elevatorTo);
+			kalmanPredictStates(aileronKalmanHandler, aileronFrom, aileronTo);
+
+			ticksSinceStep = 0;
+#else
+			kalman2mpcMessage.timestamp = cycleCounterGet();
+			kalman2mpcMessage.ticks = 0;
+
+			// the corrected states belong to the arrival of the measurement
+			kalman2mpcMessage.measured = comm2kalmanMessage.timestamp;
+			kalman2mpcMessage.trace.estimated = kalman2mpcMessage.timestamp;
+
 			xQueueOverwrite(kalman2mpcQueue, &kalman2mpcMessage);
+#endif
 
 			/* -------------------------------------------------------------------- */
 			/*	Create a message for commTask										*/
@@ -128,6 +345,49 @@ void kalmanTask(void *p) {
 			memcpy(&kalman2commMesasge.aileronData, aileronKalmanHandler->states->data, NUMBER_OF_STATES_AILERON*sizeof(float));
 
 			xQueueOverwrite(kalman2commQueue, &kalman2commMesasge);
+			xSemaphoreGive(commEvent);
+		}
+
+#ifdef KALMAN_PREDICTION_TIMER
+		/* -------------------------------------------------------------------- */
+		/*	Prediction timer ticks, the states for mpcTask						*/
+		/* -------------------------------------------------------------------- */
+		while (ticksDone != kalmanTicks) {
+
+			ticksDone++;
+			ticksSinceStep++;
+
+			// a whole px4flow period without a measurement, the prediction goes on
+			if (ticksSinceStep % KALMAN_PREDICTION_DIVIDER == 0) {
+
+				memcpy(elevatorFrom, elevatorTo, NUMBER_OF_STATES_ELEVATOR*sizeof(float));
+				memcpy(aileronFrom, aileronTo, NUMBER_OF_STATES_AILERON*sizeof(float));
+				kalmanPredictStates(elevatorKalmanHandler, elevatorFrom, elevatorTo);
+				kalmanPredictStates(aileronKalmanHandler, aileronFrom, aileronTo);
+			}
+
+			// the mpc runs once per px4flow period with the states of this tick
+			if (ticksDone % KALMAN_PREDICTION_DIVIDER == 0) {
+
+				const float fraction = (float) (ticksSinceStep % KALMAN_PREDICTION_DIVIDER)/KALMAN_PREDICTION_DIVIDER;
+
+				interpolateStates(elevatorFrom, elevatorTo, fraction, kalman2mpcMessage.elevatorData, NUMBER_OF_STATES_ELEVATOR);
+				interpolateStates(aileronFrom, aileronTo, fraction, kalman2mpcMessage.aileronData, NUMBER_OF_STATES_AILERON);
+
+				kalman2mpcMessage.timestamp = cycleCounterGet();
+				kalman2mpcMessage.ticks = ticksSinceStep;
+
+				// the predicted states belong to this tick
+				kalman2mpcMessage.measured = kalman2mpcMessage.timestamp;
+
+				// the tick starts the pipeline instead of the px4flow frame
+				kalman2mpcMessage.trace.decoded = kalman2mpcMessage.timestamp;
+				kalman2mpcMessage.trace.kalmanStart = kalman2mpcMessage.timestamp;
+				kalman2mpcMessage.trace.estimated = kalman2mpcMessage.timestamp;
+
+				xQueueOverwrite(kalman2mpcQueue, &kalman2mpcMessage);
+			}
 		}
+#endif
 	}
 }
@@ -10,9 +10,25 @@
 #include "system.h"
 #include "CMatrixLib.h"
 #include "kalman.h"
+#include "kalmanIdentification.h"
 #include "miscellaneous.h"
 
 // the communication task
 void kalmanTask(void *p);
 
+// cycles spent by the kalman filter, filled when KALMAN_BENCHMARK is defined
+typedef struct {
+
+	uint32_t cycles;		// the kalman step of both axes
+	uint32_t maxCycles;		// the worst step so far
+	uint32_t filterCycles;	// the last step with the covariance propagated
+	uint32_t steadyCycles;	// the last step of both axes with the steady gain (KALMAN_STEADY_STATE)
+} kalmanBenchmark_t;
+
+volatile kalmanBenchmark_t kalmanBenchmark;
+
+// the identified attitude models with their deviations, filled when KALMAN_IDENTIFICATION is defined
+volatile kalmanModelEstimate_t elevatorModelEstimate;
+volatile kalmanModelEstimate_t aileronModelEstimate;
+
 #endif /* KALMANTASK_H_ */
@@ -8,6 +8,23 @@
 #include "commTask.h"
 #include "kalmanTask.h"
 #include "mpcTask.h"
+#include "config.h"
+
+#ifdef PIPELINE_POLLING
+
+// all tasks polling at one priority, they share the time slices
+#define COMM_TASK_PRIORITY		2
+#define KALMAN_TASK_PRIORITY	2
+#define MPC_TASK_PRIORITY		2
+
+#else
+
+// a later stage of the pipeline preempts the earlier ones as soon as it gets their message
+#define COMM_TASK_PRIORITY		1
+#define KALMAN_TASK_PRIORITY	2
+#define MPC_TASK_PRIORITY		3
+
+#endif
 
 int main(void) {
 
@@ -20,17 +37,17 @@ int main(void) {
 	/* -------------------------------------------------------------------- */
 	/*	Start the communication task routine								*/
 	/* -------------------------------------------------------------------- */
-	xTaskCreate(commTask, (char*) "commTask", 4092, NULL, 2, NULL);
+	xTaskCreate(commTask, (char*) "commTask", 4092, NULL, COMM_TASK_PRIORITY, NULL);
 
 	/* -------------------------------------------------------------------- */
 	/*	Start the kalman filter task										*/
 	/* -------------------------------------------------------------------- */
-	xTaskCreate(kalmanTask, (char*) "kalman", 4092, NULL, 2, NULL);
+	xTaskCreate(kalmanTask, (char*) "kalman", 4092, NULL, KALMAN_TASK_PRIORITY, NULL);
 
 	/* -------------------------------------------------------------------- */
 	/*	Start the mpc task filter task										*/
 	/* -------------------------------------------------------------------- */
-	xTaskCreate(mpcTask, (char*) "mpcTask", 4092, NULL, 2, NULL);
+	xTaskCreate(mpcTask, (char*) "mpcTask", 4092, NULL, MPC_TASK_PRIORITY, NULL);
 
 	/* -------------------------------------------------------------------- */
 	/*	Start the FreeRTOS scheduler										*/
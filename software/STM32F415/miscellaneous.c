@@ -6,9 +6,62 @@
 
 #include "CMatrixLib.h"
 #include "system.h"
+#include "miscellaneous.h"
+#include <string.h>
+
+/* -------------------------------------------------------------------- */
+/*	The static arena, blocks aligned to 8 bytes							*/
+/* -------------------------------------------------------------------- */
+
+#ifdef ARENA_IN_CCM
+// the whole CCM, the CoIDE linker script places nothing there (see ARENA_IN_CCM in config.h)
+static uint64_t * const arena = (uint64_t *) CCMDATARAM_BASE;
+#else
+static uint64_t arena[ARENA_SIZE/8];
+#endif
+static size_t arenaTop;
+static size_t arenaFailed;
+
+void * arenaAlloc(const size_t size) {
+
+	void * block = 0;
+	const size_t aligned = (size + 7) & ~((size_t) 7);
+
+	// the tasks initialize their handlers at the same time
+	vTaskSuspendAll();
+
+	if (arenaTop + aligned <= ARENA_SIZE) {
+
+		block = ((char *) arena) + arenaTop;
+		arenaTop += aligned;
+
+	} else {
+
+		arenaFailed++;
+	}
+
+	xTaskResumeAll();
+
+	// the CCM is not cleared by the startup code
+	if (block != 0)
+		memset(block, 0, aligned);
+
+	return block;
+}
+
+size_t arenaHighWater() {
+
+	// nothing is freed, the top is the peak
+	return arenaTop;
+}
+
+size_t arenaFailures() {
+
+	return arenaFailed;
+}
 
 /**
- * dynamically allocate the matrix using FreeRTOS pvPortMalloc
+ * allocate the matrix from the arena
  */
 matrix_float * matrix_float_alloc(const int16_t h, const int16_t w) {
 
@@ -17,14 +70,18 @@ matrix_float * matrix_float_alloc(const int16_t h, const int16_t w) {
 	// dimensions must be positive
 	if ((h > 0) && (w > 0)) {
 
-		m = (matrix_float *) pvPortMalloc(sizeof (matrix_float));
+		m = (matrix_float *) arenaAlloc(sizeof (matrix_float));
 
 		// if didn't failed to allocated the space
 		if (m != 0) {
 
 			m->height = h;
 			m->width = w;
-			m->data = (float *) pvPortMalloc(w*h*sizeof(float));
+			m->data = (float *) arenaAlloc(w*h*sizeof(float));
+
+			// no matrix without its data (the failure is in arenaFailures()), the header cannot be freed
+			if (m->data == 0)
+				m = 0;
 		}
 	}
 
@@ -32,7 +89,7 @@ matrix_float * matrix_float_alloc(const int16_t h, const int16_t w) {
 }
 
 /**
- * dynamically allocate the matrix using FreeRTOS pvPortMalloc without a data
+ * allocate the matrix from the arena without a data
  */
 matrix_float * matrix_float_alloc_hollow(const int16_t h, const int16_t w, float * data_pointer) {
 
@@ -41,7 +98,7 @@ matrix_float * matrix_float_alloc_hollow(const int16_t h, const int16_t w, float
 	// dimensions must be positive
 	if ((h > 0) && (w > 0)) {
 
-		m = (matrix_float *) pvPortMalloc(sizeof (matrix_float));
+		m = (matrix_float *) arenaAlloc(sizeof (matrix_float));
 
 		// if didn't failed to allocated the space
 		if (m != 0) {
@@ -63,14 +120,18 @@ vector_float * vector_float_alloc(const int16_t length, int8_t orientation) {
 	// dimension must be positive
 	if (length > 0) {
 
-		v = (vector_float *) pvPortMalloc(sizeof (vector_float));
+		v = (vector_float *) arenaAlloc(sizeof (vector_float));
 
 		// if didn't failed to allocated the space
 		if (v != 0) {
 
 			v->length = length;
 			v->orientation = orientation;
-			v->data = (float *) pvPortMalloc(length*sizeof(float));
+			v->data = (float *) arenaAlloc(length*sizeof(float));
+
+			// no vector without its data (the failure is in arenaFailures()), the header cannot be freed
+			if (v->data == 0)
+				v = 0;
 		}
 	}
 
@@ -85,7 +146,7 @@ vector_float * vector_float_alloc_hollow(const int16_t length, int8_t orientatio
 	// dimension must be positive
 	if (length > 0) {
 
-		v = (vector_float *) pvPortMalloc(sizeof (vector_float));
+		v = (vector_float *) arenaAlloc(sizeof (vector_float));
 
 		// if didn't failed to allocated the space
 		if (v != 0) {
@@ -99,30 +160,21 @@ vector_float * vector_float_alloc_hollow(const int16_t length, int8_t orientatio
 	return v;
 }
 
-// deallocate the matrix using FreeRTOS vPortFree
+// the arena does not free single blocks, the matrices live until the reset
 void matrix_float_free(matrix_float * m) {
 
-	vPortFree(m->data);
-	vPortFree(m);
 }
 
-// deallocate the matrix using FreeRTOS vPortFree without a data deallocation
 void matrix_float_free_hollow(matrix_float * m) {
 
-	vPortFree(m);
 }
 
-// vector deallocation
 void vector_float_free(vector_float * v) {
 
-	vPortFree(v->data);
-	vPortFree(v);
 }
 
-// vector deallocation without a data deallocation
 void vector_float_free_hollow(vector_float * v) {
 
-	vPortFree(v);
 }
 
 // print the matrix to serial output
@@ -147,11 +199,15 @@ void matrix_float_print(const matrix_float * a) {
 
 		}
 
+		// a row is one frame with UART_DMA
+		usart4Flush();
+
 		vTaskDelay(5);
 
 		usart4PutString("\n\r");
 	}
 	usart4PutString("\n\r");
+	usart4Flush();
 }
 
 // print the matrix to serial output
@@ -179,7 +235,10 @@ void vector_float_print(const vector_float * a) {
 			usart4PutString("\n\r");
 		}
 
+		usart4Flush();
+
 		vTaskDelay(10);
 	}
 	usart4PutString("\n\r");
+	usart4Flush();
 }
@@ -10,22 +10,35 @@
 #include "system.h"
 #include "CMatrixLib.h"
 
-// dynamically allocate the matrix using FreeRTOS pvPortMalloc
+/**
+ * @brief a block of the static arena, ARENA_SIZE bytes in config.h, 0 when it is full
+ *
+ * The blocks are aligned to 8 bytes and they are never freed, the matrices
+ * and the workspaces are allocated once when the tasks start.
+ */
+void * arenaAlloc(const size_t size);
+
+// the bytes of the arena in use, at most ARENA_SIZE
+size_t arenaHighWater();
+
+// the number of blocks which did not fit, the arena is too small when it is not 0
+size_t arenaFailures();
+
+// allocate the matrix from the arena, 0 when it or its data does not fit
 matrix_float * matrix_float_alloc(const int16_t h, const int16_t w);
 
 matrix_float * matrix_float_alloc_hollow(const int16_t h, const int16_t w, float * data_pointer);
 
-// dynamically allocate the vector using FreeRTOS pvPortMalloc
+// allocate the vector from the arena, 0 when it or its data does not fit
 vector_float * vector_float_alloc(const int16_t length, int8_t orientation);
 
 vector_float * vector_float_alloc_hollow(const int16_t length, int8_t orientation, float * data_pointer);
 
-// deallocate the matrix using FreeRTOS vPortFree
+// nothing is returned to the arena, kept for the matrix library interface
 void matrix_float_free(matrix_float * m);
 
 void matrix_float_free_hollow(matrix_float * m);
 
-// deallocate the vector using FreeRTOS vPortFree
 void vector_float_free(vector_float * v);
 
 void vector_float_free_hollow(vector_float * v);
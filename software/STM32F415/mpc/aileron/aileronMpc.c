@@ -8,24 +8,51 @@
 #include "mpc/elevator_and_aileron/elevAileMpcMatrices.h"
 #include "mpc/mpc.h"
 #include "miscellaneous.h"
+#include "config.h"
+
+#ifdef MPC_EXPLICIT
+#include "mpc/elevator_and_aileron/elevAileExplicitMpc.h"
+#endif
+
+#if defined(ATTITUDE_LAGUERRE_FUNCTIONS) && (defined(MPC_CONSTRAINED) || defined(MPC_EXPLICIT))
+#error "the constrained MPC needs the move-blocked inputs, not the Laguerre functions"
+#endif
 
 mpcHandler_t aileronMpcHandler;
 
 mpcHandler_t * initializeAileronMPC() {
 
-	aileronMpcHandler.A_roof = matrix_float_alloc_hollow(ATTITUDE_A_ROOF_HEIGHT, ATTITUDE_A_ROOF_WIDTH, (float*) &A_roof_data_Attitude);
+	aileronMpcHandler.A = matrix_float_alloc_hollow(ATTITUDE_NUMBER_OF_STATES, ATTITUDE_NUMBER_OF_STATES, (float*) &A_data_Attitude);
+
+	aileronMpcHandler.B = vector_float_alloc_hollow(ATTITUDE_NUMBER_OF_STATES, 0, (float*) &B_data_Attitude);
+
+	aileronMpcHandler.Q_weighted = vector_float_alloc_hollow(ATTITUDE_WEIGHTED_ROWS, 0, (float*) &Q_weighted_data_Attitude);
 
-	aileronMpcHandler.Q_roof_diag = vector_float_alloc_hollow(ATTITUDE_Q_ROOF_DIAG_SIZE, 0, (float*) &Q_roof_diag_data_Attitude);
+	aileronMpcHandler.weighted_rows = weighted_rows_data_Attitude;
+
+	aileronMpcHandler.number_of_weighted_rows = ATTITUDE_WEIGHTED_ROWS;
 
 	aileronMpcHandler.B_roof = matrix_float_alloc_hollow(ATTITUDE_B_ROOF_HEIGHT, ATTITUDE_B_ROOF_WIDTH, (float*) &B_roof_data_Attitude);
 
 	aileronMpcHandler.H_inv = matrix_float_alloc_hollow(ATTITUDE_H_INV_HEIGHT, ATTITUDE_H_INV_WIDTH, (float*) &H_inv_data_Attitude);
 
+	// int16 copies of B_roof and H_inv for MPC_QUANTIZED
+	aileronMpcHandler.B_roof_q15 = B_roof_q15_data_Attitude;
+	aileronMpcHandler.B_roof_scale = B_roof_scale_data_Attitude;
+	aileronMpcHandler.H_inv_q15 = H_inv_q15_data_Attitude;
+	aileronMpcHandler.H_inv_scale = H_inv_scale_data_Attitude;
+
 	aileronMpcHandler.position_reference = vector_float_alloc(ATTITUDE_HORIZON_LEN, 0);
 	vector_float_set_zero(aileronMpcHandler.position_reference);
 
-	aileronMpcHandler.allstate_reference = vector_float_alloc(ATTITUDE_ALLSTATE_REFERENCE_LEN, 0);
-	vector_float_set_zero(aileronMpcHandler.allstate_reference);
+	aileronMpcHandler.filtered_reference = vector_float_alloc(ATTITUDE_HORIZON_LEN, 0);
+	vector_float_set_zero(aileronMpcHandler.filtered_reference);
+	aileronMpcHandler.reference_head = 0;
+
+	// zero setpoint until the first message arrives
+	aileronMpcHandler.reference_time = MPC_NO_TRAJECTORY;
+	aileronMpcHandler.reference_known = ATTITUDE_HORIZON_LEN;
+	aileronMpcHandler.reference_filter_from = 0;
 
 	aileronMpcHandler.initial_cond = vector_float_alloc(ATTITUDE_NUMBER_OF_STATES, 0);
 
@@ -39,5 +66,25 @@ mpcHandler_t * initializeAileronMPC() {
 
 	aileronMpcHandler.reduced_horizon_len = ATTITUDE_REDUCED_HORIZON_LEN;
 
+	aileronMpcHandler.single_step_len = ATTITUDE_SINGLE_STEP_LEN;
+
+	aileronMpcHandler.input_limit = MPC_INPUT_SATURATION;
+
+	initializeMPCWorkspace(&aileronMpcHandler);
+
+	// the tables of the step to the arena with MPC_TABLES_IN_ARENA
+	placeMPCTables(&aileronMpcHandler);
+
+	initializeCondensedMPC(&aileronMpcHandler);
+
+#if defined(MPC_CONSTRAINED) || defined(MPC_EXPLICIT)
+	initializeConstrainedMPC(&aileronMpcHandler);
+#endif
+
+#ifdef MPC_EXPLICIT
+	aileronMpcHandler.explicit_law = &explicit_mpc_Attitude;
+	aileronMpcHandler.explicit_region = -1;
+#endif
+
 	return &aileronMpcHandler;
 }
@@ -8,24 +8,51 @@
 #include "mpc/elevator_and_aileron/elevAileMpcMatrices.h"
 #include "mpc/mpc.h"
 #include "miscellaneous.h"
+#include "config.h"
+
+#ifdef MPC_EXPLICIT
+#include "mpc/elevator_and_aileron/elevAileExplicitMpc.h"
+#endif
+
+#if defined(ATTITUDE_LAGUERRE_FUNCTIONS) && (defined(MPC_CONSTRAINED) || defined(MPC_EXPLICIT))
+#error "the constrained MPC needs the move-blocked inputs, not the Laguerre functions"
+#endif
 
 mpcHandler_t elevatorMpcHandler;
 
 mpcHandler_t * initializeElevatorMPC() {
 
-	elevatorMpcHandler.A_roof = matrix_float_alloc_hollow(ATTITUDE_A_ROOF_HEIGHT, ATTITUDE_A_ROOF_WIDTH, (float*) &A_roof_data_Attitude);
+	elevatorMpcHandler.A = matrix_float_alloc_hollow(ATTITUDE_NUMBER_OF_STATES, ATTITUDE_NUMBER_OF_STATES, (float*) &A_data_Attitude);
+
+	elevatorMpcHandler.B = vector_float_alloc_hollow(ATTITUDE_NUMBER_OF_STATES, 0, (float*) &B_data_Attitude);
+
+	elevatorMpcHandler.Q_weighted = vector_float_alloc_hollow(ATTITUDE_WEIGHTED_ROWS, 0, (float*) &Q_weighted_data_Attitude);
 
-	elevatorMpcHandler.Q_roof_diag = vector_float_alloc_hollow(ATTITUDE_Q_ROOF_DIAG_SIZE, 0, (float*) &Q_roof_diag_data_Attitude);
+	elevatorMpcHandler.weighted_rows = weighted_rows_data_Attitude;
+
+	elevatorMpcHandler.number_of_weighted_rows = ATTITUDE_WEIGHTED_ROWS;
 
 	elevatorMpcHandler.B_roof = matrix_float_alloc_hollow(ATTITUDE_B_ROOF_HEIGHT, ATTITUDE_B_ROOF_WIDTH, (float*) &B_roof_data_Attitude);
 
 	elevatorMpcHandler.H_inv = matrix_float_alloc_hollow(ATTITUDE_H_INV_HEIGHT, ATTITUDE_H_INV_WIDTH, (float*) &H_inv_data_Attitude);
 
+	// int16 copies of B_roof and H_inv for MPC_QUANTIZED
+	elevatorMpcHandler.B_roof_q15 = B_roof_q15_data_Attitude;
+	elevatorMpcHandler.B_roof_scale = B_roof_scale_data_Attitude;
+	elevatorMpcHandler.H_inv_q15 = H_inv_q15_data_Attitude;
+	elevatorMpcHandler.H_inv_scale = H_inv_scale_data_Attitude;
+
 	elevatorMpcHandler.position_reference = vector_float_alloc(ATTITUDE_HORIZON_LEN, 0);
 	vector_float_set_zero(elevatorMpcHandler.position_reference);
 
-	elevatorMpcHandler.allstate_reference = vector_float_alloc(ATTITUDE_ALLSTATE_REFERENCE_LEN, 0);
-	vector_float_set_zero(elevatorMpcHandler.allstate_reference);
+	elevatorMpcHandler.filtered_reference = vector_float_alloc(ATTITUDE_HORIZON_LEN, 0);
+	vector_float_set_zero(elevatorMpcHandler.filtered_reference);
+	elevatorMpcHandler.reference_head = 0;
+
+	// zero setpoint until the first message arrives
+	elevatorMpcHandler.reference_time = MPC_NO_TRAJECTORY;
+	elevatorMpcHandler.reference_known = ATTITUDE_HORIZON_LEN;
+	elevatorMpcHandler.reference_filter_from = 0;
 
 	elevatorMpcHandler.initial_cond = vector_float_alloc(ATTITUDE_NUMBER_OF_STATES, 0);
 
@@ -39,5 +66,25 @@ mpcHandler_t * initializeElevatorMPC() {
 
 	elevatorMpcHandler.reduced_horizon_len = ATTITUDE_REDUCED_HORIZON_LEN;
 
+	elevatorMpcHandler.single_step_len = ATTITUDE_SINGLE_STEP_LEN;
+
+	elevatorMpcHandler.input_limit = MPC_INPUT_SATURATION;
+
+	initializeMPCWorkspace(&elevatorMpcHandler);
+
+	// the tables of the step to the arena with MPC_TABLES_IN_ARENA
+	placeMPCTables(&elevatorMpcHandler);
+
+	initializeCondensedMPC(&elevatorMpcHandler);
+
+#if defined(MPC_CONSTRAINED) || defined(MPC_EXPLICIT)
+	initializeConstrainedMPC(&elevatorMpcHandler);
+#endif
+
+#ifdef MPC_EXPLICIT
+	elevatorMpcHandler.explicit_law = &explicit_mpc_Attitude;
+	elevatorMpcHandler.explicit_region = -1;
+#endif
+
 	return &elevatorMpcHandler;
 }
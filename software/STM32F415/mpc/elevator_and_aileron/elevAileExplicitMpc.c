@@ -0,0 +1,957 @@
+#include "CMatrixLib.h"
+#include "elevAileExplicitMpc.h"
+#include "elevAileMpcMatrices.h"
+
+/*
+This file was created automatically with following parameters
+
+saturation = [
+1200; 
+];
+
+max_regions = [
+64; 
+];
+
+n_runs = [
+200; 
+];
+
+run_len = [
+300; 
+];
+
+*/
+
+const float explicit_gain_data_Attitude[ATTITUDE_EXPLICIT_REGIONS*ATTITUDE_REDUCED_HORIZON_LEN*ATTITUDE_REDUCED_HORIZON_LEN] = {
+-5.47293749999999883585e+05, 8.18201123046875272848e+03, 8.10237792968750090949e+03, 8.02291894531249454303e+03, 7.94363867187500454747e+03, 7.86454052734374272404e+03, 7.78562939453125909495e+03, 7.70690869140625000000e+03, 7.62838281250000363798e+03, 7.55005615234375636646e+03, 7.12395605468750181899e+03, 6.36591308593749454303e+03, 5.63527148437500181899e+03, 4.93659716796875090949e+03, 4.27424658203125000000e+03, 3.65222338867187681899e+03, 3.07408081054687318101e+03, 2.54285815429687500000e+03, 2.06103295898437409051e+03, 5.39067626953125113687e+02, 
+8.18201123046876455192e+03, -5.47452250000000349246e+05, 8.02471142578125454747e+03, 7.94631201171874545253e+03, 7.86808544921875090949e+03, 7.79003466796875000000e+03, 7.71216455078125363798e+03, 7.63447851562499818101e+03, 7.55698095703126273293e+03, 7.47967578125000818545e+03, 7.05904199218750545697e+03, 6.31041992187499363354e+03, 5.58841650390625363798e+03, 4.89756054687500454747e+03, 4.24219335937500090949e+03, 3.62632397460937590949e+03, 3.05352807617187818323e+03, 2.52687841796874818101e+03, 2.04889843750000181899e+03, 5.36456787109375568434e+02, 
+8.10237792968750272848e+03, 8.02471142578125090949e+03, -5.47608375000000349246e+05, 7.86985888671874181455e+03, 7.79268017578125454747e+03, 7.71567187499999454303e+03, 7.63883789062501273293e+03, 7.56218164062499909051e+03, 7.48570703124999909051e+03, 7.40941894531250636646e+03, 6.99422753906250636646e+03, 6.25499267578125181899e+03, 5.54160156250000000000e+03, 4.85854492187500181899e+03, 4.21014843749999818101e+03, 3.60042456054687727374e+03, 3.03296948242187727374e+03, 2.51089013671875181899e+03, 2.03675415039062568212e+03, 5.33841735839844091061e+02, 
+8.02291894531249818101e+03, 7.94631201171874909051e+03, 7.86985888671874818101e+03, -5.47761999999999534339e+05, 7.71742675781250000000e+03, 7.64145507812499454303e+03, 7.56565185546874909051e+03, 7.49002050781249090505e+03, 7.41456445312500000000e+03, 7.33928808593750090949e+03, 6.92951562500000363798e+03, 6.19963232421875181899e+03, 5.49482763671874909051e+03, 4.81955126953125181899e+03, 4.17811181640624545253e+03, 3.57452465820312318101e+03, 3.01240502929687090727e+03, 2.49489282226562454525e+03, 2.02459960937500068212e+03, 5.31222473144531250000e+02, 
+7.94363867187500181899e+03, 7.86808544921875545697e+03, 7.79268017578125636646e+03, 7.71742675781249636202e+03, -5.47913250000000116415e+05, 7.56738818359374909051e+03, 7.49261035156251000444e+03, 7.41799804687499636202e+03, 7.34355566406250727596e+03, 7.26928662109375272848e+03, 6.86490869140624909051e+03, 6.14434033203124818101e+03, 5.44809570312500090949e+03, 4.78058007812500000000e+03, 4.14608398437499727152e+03, 3.54862426757812590949e+03, 2.99183422851562636424e+03, 2.47888623046875000000e+03, 2.01243469238281295475e+03, 5.28598815917968636313e+02, 
+7.86454052734375090949e+03, 7.79003466796875636646e+03, 7.71567187500000545697e+03, 7.64145507812500272848e+03, 7.56738818359375090949e+03, -5.48062062500000000000e+05, 7.41971582031250909495e+03, 7.34611816406249272404e+03, 7.27268359375000636646e+03, 7.19941699218750363798e+03, 6.80040869140625181899e+03, 6.08911865234375363798e+03, 5.40140624999999818101e+03, 4.74163183593750000000e+03, 4.11406494140624818101e+03, 3.52272363281250045475e+03, 2.97125756835937318101e+03, 2.46287011718750227374e+03, 2.00025903320312590949e+03, 5.25970764160156136313e+02, 
+7.78562939453125090949e+03, 7.71216455078125090949e+03, 7.63883789062500636646e+03, 7.56565185546874727152e+03, 7.49261035156249636202e+03, 7.41971582031249454303e+03, -5.48208562500000232831e+05, 7.27438330078124909051e+03, 7.20195214843750454747e+03, 7.12968212890625454747e+03, 6.73601806640625181899e+03, 6.03396875000000000000e+03, 5.35476025390624818101e+03, 4.70270703125000181899e+03, 4.08205541992187545475e+03, 3.49682250976562500000e+03, 2.95067431640624818101e+03, 2.44684448242187500000e+03, 1.98807250976562636424e+03, 5.23338134765624658939e+02, 
+7.70690869140625363798e+03, 7.63447851562500272848e+03, 7.56218164062500181899e+03, 7.49002050781250272848e+03, 7.41799804687500181899e+03, 7.34611816406250090949e+03, 7.27438330078125363798e+03, -5.48352750000000000000e+05, 7.13136328125000818545e+03, 7.06008496093750454747e+03, 6.67173974609375000000e+03, 5.97889208984374818101e+03, 5.30815917968750000000e+03, 4.66380566406250000000e+03, 4.05005517578125136424e+03, 3.47092089843750090949e+03, 2.93008447265625227374e+03, 2.43080908203125000000e+03, 1.97587487792968886424e+03, 5.20700866699218522626e+02, 
+7.62838281250000545697e+03, 7.55698095703125272848e+03, 7.48570703125000000000e+03, 7.41456445312499727152e+03, 7.34355566406249272404e+03, 7.27268359375000363798e+03, 7.20195214843749727152e+03, 7.13136328125000454747e+03, -5.48494625000000116415e+05, 6.99062939453125090949e+03, 6.60757617187500000000e+03, 5.92389062500000090949e+03, 5.26160400390625090949e+03, 4.62492919921874909051e+03, 4.01806445312500045475e+03, 3.44501879882812500000e+03, 2.90948803710937318101e+03, 2.41476342773437590949e+03, 1.96366577148437409051e+03, 5.18058776855468977374e+02, 
+7.55005615234375090949e+03, 7.47967578125000181899e+03, 7.40941894531250272848e+03, 7.33928808593749727152e+03, 7.26928662109375000000e+03, 7.19941699218750272848e+03, 7.12968212890625727596e+03, 7.06008496093750363798e+03, 6.99062939453124727152e+03, -5.48634250000000116415e+05, 6.54353027343749909051e+03, 5.86896582031249909051e+03, 5.21509521484375000000e+03, 4.58607763671875181899e+03, 3.98608349609374954525e+03, 3.41911645507812681899e+03, 2.88888500976562318101e+03, 2.39870776367187363576e+03, 1.95144494628906386424e+03, 5.15411865234374886313e+02, 
+7.12395605468749818101e+03, 7.05904199218750818545e+03, 6.99422753906250545697e+03, 6.92951562500000000000e+03, 6.86490869140624727152e+03, 6.80040869140625000000e+03, 6.73601806640625181899e+03, 6.67173974609374727152e+03, 6.60757617187499818101e+03, 6.54353027343749909051e+03, -4.93615000000000000000e+04, 5.56870068359375000000e+03, 4.96040771484375000000e+03, 4.37298876953125000000e+03, 3.81042138671875090949e+03, 3.27664404296874818101e+03, 2.77540673828125000000e+03, 2.31015722656250045475e+03, 1.88395471191406159051e+03, 5.00738647460937500000e+02, 
+6.36591308593749454303e+03, 6.31041992187499909051e+03, 6.25499267578125272848e+03, 6.19963232421874636202e+03, 6.14434033203125272848e+03, 6.08911865234374909051e+03, 6.03396875000000181899e+03, 5.97889208984375272848e+03, 5.92389062500000363798e+03, 5.86896582031250090949e+03, 5.56870068359374909051e+03, -5.05261953125000000000e+04, 4.50136425781250181899e+03, 3.98771777343750045475e+03, 3.49189086914062500000e+03, 3.01758081054687363576e+03, 2.56851245117187590949e+03, 2.14828540039062454525e+03, 1.76025512695312568212e+03, 4.73645629882812556843e+02, 
+5.63527148437499909051e+03, 5.58841650390625181899e+03, 5.54160156249999909051e+03, 5.49482763671874818101e+03, 5.44809570312500181899e+03, 5.40140625000000000000e+03, 5.35476025390625000000e+03, 5.30815917968750272848e+03, 5.26160400390625090949e+03, 5.21509521484374818101e+03, 4.96040771484375000000e+03, 4.50136425781250272848e+03, -5.15062695312500072760e+04, 3.60622290039062590949e+03, 3.17489501953124954525e+03, 2.75854467773437454525e+03, 2.36069946289062500000e+03, 1.98497277832031363687e+03, 1.63490295410156227263e+03, 4.45855346679687613687e+02, 
+4.93659716796875000000e+03, 4.89756054687500363798e+03, 4.85854492187499909051e+03, 4.81955126953124727152e+03, 4.78058007812500090949e+03, 4.74163183593749909051e+03, 4.70270703125000000000e+03, 4.66380566406250000000e+03, 4.62492919921875090949e+03, 4.58607763671875454747e+03, 4.37298876953125090949e+03, 3.98771777343749954525e+03, 3.60622290039062636424e+03, -5.23258281250000000000e+04, 2.86005517578124954525e+03, 2.49974218749999954525e+03, 2.15190478515625045475e+03, 1.81999560546875090949e+03, 1.50759448242187522737e+03, 4.17221557617187272626e+02, 
+4.27424658203124727152e+03, 4.24219335937500181899e+03, 4.21014843750000090949e+03, 4.17811181640624727152e+03, 4.14608398437499727152e+03, 4.11406494140625181899e+03, 4.08205541992187409051e+03, 4.05005517578125045475e+03, 4.01806445312499727152e+03, 3.98608349609374727152e+03, 3.81042138671875000000e+03, 3.49189086914062454525e+03, 3.17489501953124772626e+03, 2.86005517578125045475e+03, -5.30071406249999854481e+04, 2.24166015625000000000e+03, 1.94224157714843636313e+03, 1.65323291015624931788e+03, 1.37807934570312500000e+03, 3.87595581054687500000e+02, 
+3.65222338867187636424e+03, 3.62632397460937363576e+03, 3.60042456054687772848e+03, 3.57452465820312454525e+03, 3.54862426757812363576e+03, 3.52272363281249954525e+03, 3.49682250976562272626e+03, 3.47092089843749863576e+03, 3.44501879882812272626e+03, 3.41911645507812409051e+03, 3.27664404296874909051e+03, 3.01758081054687545475e+03, 2.75854467773437636424e+03, 2.49974218750000000000e+03, 2.24166015624999954525e+03, -5.35703085937499927240e+04, 1.73213916015624954525e+03, 1.48477307128906272737e+03, 1.24623937988281272737e+03, 3.56843170166015795530e+02, 
+3.07408081054687772848e+03, 3.05352807617187727374e+03, 3.03296948242187454525e+03, 3.01240502929687545475e+03, 2.99183422851562681899e+03, 2.97125756835937636424e+03, 2.95067431640625227374e+03, 2.93008447265625409273e+03, 2.90948803710937500000e+03, 2.88888500976562454525e+03, 2.77540673828124954525e+03, 2.56851245117187772848e+03, 2.36069946289062727374e+03, 2.15190478515625090949e+03, 1.94224157714843727263e+03, 1.73213916015625022737e+03, -5.40330273437500072760e+04, 1.31505383300781318212e+03, 1.11219372558593795475e+03, 3.24867706298828295530e+02, 
+2.54285815429687636424e+03, 2.52687841796875000000e+03, 2.51089013671875181899e+03, 2.49489282226562454525e+03, 2.47888623046874909051e+03, 2.46287011718750181899e+03, 2.44684448242187454525e+03, 2.43080908203125045475e+03, 2.41476342773437272626e+03, 2.39870776367187681899e+03, 2.31015722656249954525e+03, 2.14828540039062590949e+03, 1.98497277832031340949e+03, 1.81999560546875045475e+03, 1.65323291015625000000e+03, 1.48477307128906272737e+03, 1.31505383300781318212e+03, -5.44105156250000072760e+04, 9.76433532714844204747e+02, 2.91639831542968750000e+02, 
+2.06103295898437636424e+03, 2.04889843750000000000e+03, 2.03675415039062500000e+03, 2.02459960937499863576e+03, 2.01243469238281159051e+03, 2.00025903320312590949e+03, 1.98807250976562568212e+03, 1.97587487792968886424e+03, 1.96366577148437636424e+03, 1.95144494628906340949e+03, 1.88395471191406272737e+03, 1.76025512695312500000e+03, 1.63490295410156318212e+03, 1.50759448242187545475e+03, 1.37807934570312431788e+03, 1.24623937988281272737e+03, 1.11219372558593818212e+03, 9.76433532714844204747e+02, -5.47155664062500145519e+04, 2.57235290527343693157e+02, 
+5.39067626953125341061e+02, 5.36456787109375000000e+02, 5.33841735839844204747e+02, 5.31222473144531363687e+02, 5.28598815917968750000e+02, 5.25970764160156818434e+02, 5.23338134765624772626e+02, 5.20700866699218636313e+02, 5.18058776855468636313e+02, 5.15411865234375000000e+02, 5.00738647460937556843e+02, 4.73645629882812272626e+02, 4.45855346679687613687e+02, 4.17221557617187386313e+02, 3.87595581054687443157e+02, 3.56843170166015568157e+02, 3.24867706298828352374e+02, 2.91639831542968806843e+02, 2.57235290527343806843e+02, -5.46908300781250000000e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -4.88885846949380647857e+04, 5.95656363056217560370e+03, 5.26744681594611211040e+03, 4.60424590314673059765e+03, 3.97176988130676045330e+03, 3.37477523488442693633e+03, 2.81778642349778237985e+03, 2.30495711595100510749e+03, 6.17538532564511456258e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.95656363056217560370e+03, -5.02131573563272104366e+04, 4.74341439596623058605e+03, 4.16335908741303956049e+03, 3.60646253431774357523e+03, 3.07716915586532604721e+03, 2.57991432746571354073e+03, 2.11894582739497855073e+03, 5.73725441097615771469e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.26744681594611211040e+03, 4.74341439596623149555e+03, -5.13257523482202668674e+04, 3.72934001241988516995e+03, 3.24542976353916264998e+03, 2.78199515862592988924e+03, 2.34321181635417315192e+03, 1.93328361395529964284e+03, 5.29677531172224234979e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 4.60424590314672968816e+03, 4.16335908741304046998e+03, 3.72934001241988607944e+03, -5.22515384102066527703e+04, 2.88983167526821716820e+03, 2.48993532736812221628e+03, 2.10803035156057376298e+03, 1.74810448737123419960e+03, 4.85347667936915001974e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.97176988130676272704e+03, 3.60646253431774402998e+03, 3.24542976353916310472e+03, 2.88983167526821762294e+03, -5.30142909403992889565e+04, 2.20196653961012134459e+03, 1.87491302360821191542e+03, 1.56366026159822899899e+03, 4.40699359881666850924e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.37477523488442921007e+03, 3.07716915586532741145e+03, 2.78199515862592943449e+03, 2.48993532736812267103e+03, 2.20196653961012179934e+03, -5.36360278533745877212e+04, 1.64471964937366078630e+03, 1.38041351434894500017e+03, 3.95726741980299664192e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.81778642349778419884e+03, 2.57991432746571308599e+03, 2.34321181635417451616e+03, 2.10803035156057421773e+03, 1.87491302360821123330e+03, 1.64471964937366124104e+03, -5.41367620974189994740e+04, 1.19916338729524500195e+03, 3.50481853366376185477e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.30495711595100328850e+03, 2.11894582739497946022e+03, 1.93328361395529918809e+03, 1.74810448737123442697e+03, 1.56366026159822968111e+03, 1.38041351434894568229e+03, 1.19916338729524545670e+03, -5.45343494118541348143e+04, 3.05110725231249602984e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 6.17538532564511115197e+02, 5.73725441097615657782e+02, 5.29677531172224462352e+02, 4.85347667936915058817e+02, 4.40699359881666794081e+02, 3.95726741980299607349e+02, 3.50481853366376185477e+02, 3.05110725231249716671e+02, -5.45643451715382889233e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -4.94874122666230687173e+04, 5.38519779643832134752e+03, 4.72433838071805439540e+03, 4.09038122764010722676e+03, 3.48835028436127549867e+03, 2.92323218445895599871e+03, 2.39978078738719977991e+03, 6.48966063964846512135e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.38519779643832225702e+03, -5.07582170814099445124e+04, 4.22541942592097348097e+03, 3.67336374333232561185e+03, 3.14560660650174258990e+03, 2.64681111703113447220e+03, 2.18162868463118502405e+03, 5.96213541518577585521e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 4.72433838071805348591e+03, 4.22541942592097348097e+03, -5.18179181598164068419e+04, 3.26388638187013793868e+03, 2.80776606732952041057e+03, 2.37340480813950307493e+03, 1.96518152947151702392e+03, 5.43506423735173711975e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 4.09038122764010768151e+03, 3.67336374333232652134e+03, 3.26388638187013748393e+03, -5.26916193783467169851e+04, 2.47613750851284248711e+03, 2.10383352352937981777e+03, 1.75091786596462770831e+03, 4.90868964084589435970e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.48835028436127868190e+03, 3.14560660650174258990e+03, 2.80776606732952086531e+03, 2.47613750851284294185e+03, -5.34030673789191059768e+04, 1.83923122909215658183e+03, 1.53952452647827499277e+03, 4.38355379305146698243e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.92323218445895599871e+03, 2.64681111703113583644e+03, 2.37340480813950307493e+03, 2.10383352352937936303e+03, 1.83923122909215635445e+03, -5.39743536256255756598e+04, 1.33201396803099328281e+03, 3.86074859461870516952e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.39978078738720068941e+03, 2.18162868463118547879e+03, 1.96518152947151679655e+03, 1.75091786596462793568e+03, 1.53952452647827522014e+03, 1.33201396803099373756e+03, -5.44256772680494977976e+04, 3.34225903015397875606e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 6.48966063964846398449e+02, 5.96213541518577812894e+02, 5.43506423735173711975e+02, 4.90868964084589265440e+02, 4.38355379305146755087e+02, 3.86074859461870573796e+02, 3.34225903015397932450e+02, -5.44863404917993375420e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -4.88885846949380647857e+04, 5.95656363056217560370e+03, 5.26744681594611211040e+03, 4.60424590314673059765e+03, 3.97176988130676045330e+03, 3.37477523488442693633e+03, 2.81778642349778237985e+03, 2.30495711595100510749e+03, 6.17538532564511456258e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.95656363056217560370e+03, -5.02131573563272104366e+04, 4.74341439596623058605e+03, 4.16335908741303956049e+03, 3.60646253431774357523e+03, 3.07716915586532604721e+03, 2.57991432746571354073e+03, 2.11894582739497855073e+03, 5.73725441097615771469e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.26744681594611211040e+03, 4.74341439596623149555e+03, -5.13257523482202668674e+04, 3.72934001241988516995e+03, 3.24542976353916264998e+03, 2.78199515862592988924e+03, 2.34321181635417315192e+03, 1.93328361395529964284e+03, 5.29677531172224234979e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 4.60424590314672968816e+03, 4.16335908741304046998e+03, 3.72934001241988607944e+03, -5.22515384102066527703e+04, 2.88983167526821716820e+03, 2.48993532736812221628e+03, 2.10803035156057376298e+03, 1.74810448737123419960e+03, 4.85347667936915001974e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.97176988130676272704e+03, 3.60646253431774402998e+03, 3.24542976353916310472e+03, 2.88983167526821762294e+03, -5.30142909403992889565e+04, 2.20196653961012134459e+03, 1.87491302360821191542e+03, 1.56366026159822899899e+03, 4.40699359881666850924e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.37477523488442921007e+03, 3.07716915586532741145e+03, 2.78199515862592943449e+03, 2.48993532736812267103e+03, 2.20196653961012179934e+03, -5.36360278533745877212e+04, 1.64471964937366078630e+03, 1.38041351434894500017e+03, 3.95726741980299664192e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.81778642349778419884e+03, 2.57991432746571308599e+03, 2.34321181635417451616e+03, 2.10803035156057421773e+03, 1.87491302360821123330e+03, 1.64471964937366124104e+03, -5.41367620974189994740e+04, 1.19916338729524500195e+03, 3.50481853366376185477e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.30495711595100328850e+03, 2.11894582739497946022e+03, 1.93328361395529918809e+03, 1.74810448737123442697e+03, 1.56366026159822968111e+03, 1.38041351434894568229e+03, 1.19916338729524545670e+03, -5.45343494118541348143e+04, 3.05110725231249602984e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 6.17538532564511115197e+02, 5.73725441097615657782e+02, 5.29677531172224462352e+02, 4.85347667936915058817e+02, 4.40699359881666794081e+02, 3.95726741980299607349e+02, 3.50481853366376185477e+02, 3.05110725231249716671e+02, -5.45643451715382889233e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -5.01722022954575368203e+04, 4.73951978947203133430e+03, 4.11847717652221945173e+03, 3.52520730502558217268e+03, 2.96491591979212535080e+03, 2.44277174336591633619e+03, 6.66833734766868246879e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 4.73951978947203042480e+03, -5.13669070417713810457e+04, 3.65437649118107037793e+03, 3.14078301808472951961e+03, 2.65247250176599209226e+03, 2.19427769675706485941e+03, 6.05460264991902363363e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 4.11847717652221945173e+03, 3.65437649118106992319e+03, -5.23535289868490217486e+04, 2.76446704253068674006e+03, 2.34545323051512559687e+03, 1.94927170653916164156e+03, 5.44509243174462994830e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.52520730502558262742e+03, 3.14078301808473042911e+03, 2.76446704253068764956e+03, -5.31571747943393638707e+04, 2.04528883757998232795e+03, 1.70868423010118817729e+03, 4.84100768891812094807e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.96491591979212716979e+03, 2.65247250176599254701e+03, 2.34545323051512605161e+03, 2.04528883757998210058e+03, -5.38016776659650131478e+04, 1.47376954004476556293e+03, 4.24409425726576614579e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.44277174336591679094e+03, 2.19427769675706485941e+03, 1.94927170653916255105e+03, 1.70868423010118817729e+03, 1.47376954004476601767e+03, -5.43093052945770250517e+04, 3.65696053112931053874e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 6.66833734766868019506e+02, 6.05460264991902363363e+02, 5.44509243174462994830e+02, 4.84100768891811924277e+02, 4.24409425726576614579e+02, 3.65696053112931053874e+02, -5.44012366375284818787e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -4.94874122666230687173e+04, 5.38519779643832134752e+03, 4.72433838071805439540e+03, 4.09038122764010722676e+03, 3.48835028436127549867e+03, 2.92323218445895599871e+03, 2.39978078738719977991e+03, 6.48966063964846512135e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.38519779643832225702e+03, -5.07582170814099445124e+04, 4.22541942592097348097e+03, 3.67336374333232561185e+03, 3.14560660650174258990e+03, 2.64681111703113447220e+03, 2.18162868463118502405e+03, 5.96213541518577585521e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 4.72433838071805348591e+03, 4.22541942592097348097e+03, -5.18179181598164068419e+04, 3.26388638187013793868e+03, 2.80776606732952041057e+03, 2.37340480813950307493e+03, 1.96518152947151702392e+03, 5.43506423735173711975e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 4.09038122764010768151e+03, 3.67336374333232652134e+03, 3.26388638187013748393e+03, -5.26916193783467169851e+04, 2.47613750851284248711e+03, 2.10383352352937981777e+03, 1.75091786596462770831e+03, 4.90868964084589435970e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.48835028436127868190e+03, 3.14560660650174258990e+03, 2.80776606732952086531e+03, 2.47613750851284294185e+03, -5.34030673789191059768e+04, 1.83923122909215658183e+03, 1.53952452647827499277e+03, 4.38355379305146698243e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.92323218445895599871e+03, 2.64681111703113583644e+03, 2.37340480813950307493e+03, 2.10383352352937936303e+03, 1.83923122909215635445e+03, -5.39743536256255756598e+04, 1.33201396803099328281e+03, 3.86074859461870516952e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.39978078738720068941e+03, 2.18162868463118547879e+03, 1.96518152947151679655e+03, 1.75091786596462793568e+03, 1.53952452647827522014e+03, 1.33201396803099373756e+03, -5.44256772680494977976e+04, 3.34225903015397875606e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 6.48966063964846398449e+02, 5.96213541518577812894e+02, 5.43506423735173711975e+02, 4.90868964084589265440e+02, 4.38355379305146755087e+02, 3.86074859461870573796e+02, 3.34225903015397932450e+02, -5.44863404917993375420e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -5.09191880498380414792e+04, 4.04342865926545027833e+03, 3.47379191583592091774e+03, 2.93255344366332792561e+03, 2.42503426093312145895e+03, 6.68452749627189177772e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 4.04342865926545118782e+03, -5.20154562398396519711e+04, 3.05384014484658291622e+03, 2.58883378762247821214e+03, 2.14979110198568696433e+03, 5.99247512405691622916e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.47379191583592091774e+03, 3.05384014484658337096e+03, -5.29094861146552575519e+04, 2.25361023431054036337e+03, 1.88031864916680797251e+03, 5.30953947454605213352e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.93255344366332792561e+03, 2.58883378762247821214e+03, 2.25361023431054081811e+03, -5.36264665727849860559e+04, 1.61812463109046370846e+03, 4.63815827391422885739e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.42503426093312191369e+03, 2.14979110198568787382e+03, 1.88031864916680819988e+03, 1.61812463109046439058e+03, -5.41903722297088097548e+04, 3.98162688625941939335e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 6.68452749627189064086e+02, 5.99247512405691281856e+02, 5.30953947454605099665e+02, 4.63815827391422999426e+02, 3.98162688625942053022e+02, -5.43126084311753857037e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -4.83876594887008250225e+04, 6.44045879307589166274e+03, 5.73350811309346227063e+03, 5.05147973556713895960e+03, 4.39895996982425367605e+03, 3.78045862999980226959e+03, 3.20024355524696693465e+03, 2.66221561385369568598e+03, 2.16981424881317661857e+03, 5.75857607331759709268e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 6.44045879307589075324e+03, -4.97458179214179399423e+04, 5.19342643541084817116e+03, 4.59508846208576323988e+03, 4.01873875695671404173e+03, 3.46858604719039021802e+03, 2.94881876244566910827e+03, 2.46344215182843709044e+03, 2.01615208992213706551e+03, 5.40891155322271970363e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.73350811309346136113e+03, 5.19342643541084726166e+03, -5.08925271714881528169e+04, 4.14485888918945693149e+03, 3.64212138047145344899e+03, 3.15851174572092213566e+03, 2.69796870306871505818e+03, 2.26446540966057546029e+03, 1.86184210030974554684e+03, 5.05491426505646813894e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.05147973556713805010e+03, 4.59508846208576414938e+03, 4.14485888918945602200e+03, -5.18531067974431134644e+04, 3.27010603871782586793e+03, 2.85076487661580949862e+03, 2.44790242425872202148e+03, 2.06528706514291297935e+03, 1.70676361229280769294e+03, 4.69560280932256830511e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 4.39895996982425458555e+03, 4.01873875695671358699e+03, 3.64212138047145208475e+03, 3.27010603871782677743e+03, -5.26514513016461423831e+04, 2.54614722438401759064e+03, 2.19899868273651236450e+03, 1.86600624789178186802e+03, 1.55084497692286709025e+03, 4.32996002455704513068e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.78045862999980181485e+03, 3.46858604719039021802e+03, 3.15851174572092259041e+03, 2.85076487661580813437e+03, 2.54614722438401668114e+03, -5.33096527662069202051e+04, 1.95193608774749714030e+03, 1.66691792529882559393e+03, 1.39413577768848722371e+03, 3.95708428634067502117e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.20024355524696693465e+03, 2.94881876244566956302e+03, 2.69796870306871824141e+03, 2.44790242425872202148e+03, 2.19899868273651236450e+03, 1.95193608774749759505e+03, -5.38476842740636420785e+04, 1.46864710420534925106e+03, 1.23690721255170865334e+03, 3.57640903233878361789e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.66221561385369523123e+03, 2.46344215182843845469e+03, 2.26446540966057500555e+03, 2.06528706514291434360e+03, 1.86600624789178255014e+03, 1.66691792529882536655e+03, 1.46864710420534970581e+03, -5.42832331615195798804e+04, 1.07978349925371776408e+03, 3.18799041471888301658e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.16981424881317752806e+03, 2.01615208992213729289e+03, 1.86184210030974622896e+03, 1.70676361229280814769e+03, 1.55084497692286640813e+03, 1.39413577768848790583e+03, 1.23690721255170865334e+03, 1.07978349925371799145e+03, -5.46316488870530156419e+04, 2.79287942007612002726e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.75857607331759822955e+02, 5.40891155322271856676e+02, 5.05491426505646927581e+02, 4.69560280932257114728e+02, 4.32996002455704456224e+02, 3.95708428634067331586e+02, 3.57640903233878304945e+02, 3.18799041471888358501e+02, 2.79287942007612059570e+02, -5.46328775178898013110e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -5.01722022954575368203e+04, 4.73951978947203133430e+03, 4.11847717652221945173e+03, 3.52520730502558217268e+03, 2.96491591979212535080e+03, 2.44277174336591633619e+03, 6.66833734766868246879e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 4.73951978947203042480e+03, -5.13669070417713810457e+04, 3.65437649118107037793e+03, 3.14078301808472951961e+03, 2.65247250176599209226e+03, 2.19427769675706485941e+03, 6.05460264991902363363e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 4.11847717652221945173e+03, 3.65437649118106992319e+03, -5.23535289868490217486e+04, 2.76446704253068674006e+03, 2.34545323051512559687e+03, 1.94927170653916164156e+03, 5.44509243174462994830e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.52520730502558262742e+03, 3.14078301808473042911e+03, 2.76446704253068764956e+03, -5.31571747943393638707e+04, 2.04528883757998232795e+03, 1.70868423010118817729e+03, 4.84100768891812094807e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.96491591979212716979e+03, 2.65247250176599254701e+03, 2.34545323051512605161e+03, 2.04528883757998210058e+03, -5.38016776659650131478e+04, 1.47376954004476556293e+03, 4.24409425726576614579e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.44277174336591679094e+03, 2.19427769675706485941e+03, 1.94927170653916255105e+03, 1.70868423010118817729e+03, 1.47376954004476601767e+03, -5.43093052945770250517e+04, 3.65696053112931053874e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 6.66833734766868019506e+02, 6.05460264991902363363e+02, 5.44509243174462994830e+02, 4.84100768891811924277e+02, 4.24409425726576614579e+02, 3.65696053112931053874e+02, -5.44012366375284818787e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -5.24580293854727642611e+04, 2.63542289036033525917e+03, 2.19663243344722513939e+03, 6.18574082269946416091e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.63542289036033525917e+03, -5.33035531467112668906e+04, 1.88564416459477638455e+03, 5.37920495390551877790e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.19663243344722468464e+03, 1.88564416459477729404e+03, -5.39687432755116751650e+04, 4.59555969880844600084e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 6.18574082269946302404e+02, 5.37920495390551877790e+02, 4.59555969880844600084e+02, -5.41425388555765039200e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -5.16943726572309315088e+04, 3.32968959034574754696e+03, 2.82170416700343230332e+03, 2.34236002159925919841e+03, 6.52328504242440999406e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.32968959034574891120e+03, -5.26724982376546104206e+04, 2.45367392023152706315e+03, 2.04575853016038195165e+03, 5.76556908670335133138e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.82170416700343184857e+03, 2.45367392023152706315e+03, -5.34575740584046652657e+04, 1.75778794555534591382e+03, 5.02313562487410422364e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.34236002159925919841e+03, 2.04575853016038126952e+03, 1.75778794555534591382e+03, -5.40748795953615554026e+04, 4.29997854930523999428e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 6.52328504242440999406e+02, 5.76556908670334905764e+02, 5.02313562487410365520e+02, 4.29997854930524113115e+02, -5.42248558381751172419e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -5.09191880498380414792e+04, 4.04342865926545027833e+03, 3.47379191583592091774e+03, 2.93255344366332792561e+03, 2.42503426093312145895e+03, 6.68452749627189177772e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 4.04342865926545118782e+03, -5.20154562398396519711e+04, 3.05384014484658291622e+03, 2.58883378762247821214e+03, 2.14979110198568696433e+03, 5.99247512405691622916e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.47379191583592091774e+03, 3.05384014484658337096e+03, -5.29094861146552575519e+04, 2.25361023431054036337e+03, 1.88031864916680797251e+03, 5.30953947454605213352e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.93255344366332792561e+03, 2.58883378762247821214e+03, 2.25361023431054081811e+03, -5.36264665727849860559e+04, 1.61812463109046370846e+03, 4.63815827391422885739e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.42503426093312191369e+03, 2.14979110198568787382e+03, 1.88031864916680819988e+03, 1.61812463109046439058e+03, -5.41903722297088097548e+04, 3.98162688625941939335e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 6.68452749627189064086e+02, 5.99247512405691281856e+02, 5.30953947454605099665e+02, 4.63815827391422999426e+02, 3.98162688625942053022e+02, -5.43126084311753857037e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -5.16943726572309315088e+04, 3.32968959034574754696e+03, 2.82170416700343230332e+03, 2.34236002159925919841e+03, 6.52328504242440999406e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.32968959034574891120e+03, -5.26724982376546104206e+04, 2.45367392023152706315e+03, 2.04575853016038195165e+03, 5.76556908670335133138e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.82170416700343184857e+03, 2.45367392023152706315e+03, -5.34575740584046652657e+04, 1.75778794555534591382e+03, 5.02313562487410422364e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.34236002159925919841e+03, 2.04575853016038126952e+03, 1.75778794555534591382e+03, -5.40748795953615554026e+04, 4.29997854930523999428e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 6.52328504242440999406e+02, 5.76556908670334905764e+02, 5.02313562487410365520e+02, 4.29997854930524113115e+02, -5.42248558381751172419e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -5.31711529423498213873e+04, 1.99600010942593894470e+03, 5.68996849475810449803e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 1.99600010942593962682e+03, -5.38767612833515086095e+04, 4.85458198910826013162e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.68996849475810449803e+02, 4.85458198910826013162e+02, -5.40695978969208772469e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -4.83876594887008250225e+04, 6.44045879307589166274e+03, 5.73350811309346227063e+03, 5.05147973556713895960e+03, 4.39895996982425367605e+03, 3.78045862999980226959e+03, 3.20024355524696693465e+03, 2.66221561385369568598e+03, 2.16981424881317661857e+03, 5.75857607331759709268e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 6.44045879307589075324e+03, -4.97458179214179399423e+04, 5.19342643541084817116e+03, 4.59508846208576323988e+03, 4.01873875695671404173e+03, 3.46858604719039021802e+03, 2.94881876244566910827e+03, 2.46344215182843709044e+03, 2.01615208992213706551e+03, 5.40891155322271970363e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.73350811309346136113e+03, 5.19342643541084726166e+03, -5.08925271714881528169e+04, 4.14485888918945693149e+03, 3.64212138047145344899e+03, 3.15851174572092213566e+03, 2.69796870306871505818e+03, 2.26446540966057546029e+03, 1.86184210030974554684e+03, 5.05491426505646813894e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.05147973556713805010e+03, 4.59508846208576414938e+03, 4.14485888918945602200e+03, -5.18531067974431134644e+04, 3.27010603871782586793e+03, 2.85076487661580949862e+03, 2.44790242425872202148e+03, 2.06528706514291297935e+03, 1.70676361229280769294e+03, 4.69560280932256830511e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 4.39895996982425458555e+03, 4.01873875695671358699e+03, 3.64212138047145208475e+03, 3.27010603871782677743e+03, -5.26514513016461423831e+04, 2.54614722438401759064e+03, 2.19899868273651236450e+03, 1.86600624789178186802e+03, 1.55084497692286709025e+03, 4.32996002455704513068e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.78045862999980181485e+03, 3.46858604719039021802e+03, 3.15851174572092259041e+03, 2.85076487661580813437e+03, 2.54614722438401668114e+03, -5.33096527662069202051e+04, 1.95193608774749714030e+03, 1.66691792529882559393e+03, 1.39413577768848722371e+03, 3.95708428634067502117e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.20024355524696693465e+03, 2.94881876244566956302e+03, 2.69796870306871824141e+03, 2.44790242425872202148e+03, 2.19899868273651236450e+03, 1.95193608774749759505e+03, -5.38476842740636420785e+04, 1.46864710420534925106e+03, 1.23690721255170865334e+03, 3.57640903233878361789e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.66221561385369523123e+03, 2.46344215182843845469e+03, 2.26446540966057500555e+03, 2.06528706514291434360e+03, 1.86600624789178255014e+03, 1.66691792529882536655e+03, 1.46864710420534970581e+03, -5.42832331615195798804e+04, 1.07978349925371776408e+03, 3.18799041471888301658e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.16981424881317752806e+03, 2.01615208992213729289e+03, 1.86184210030974622896e+03, 1.70676361229280814769e+03, 1.55084497692286640813e+03, 1.39413577768848790583e+03, 1.23690721255170865334e+03, 1.07978349925371799145e+03, -5.46316488870530156419e+04, 2.79287942007612002726e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.75857607331759822955e+02, 5.40891155322271856676e+02, 5.05491426505646927581e+02, 4.69560280932257114728e+02, 4.32996002455704456224e+02, 3.95708428634067331586e+02, 3.57640903233878304945e+02, 3.18799041471888358501e+02, 2.79287942007612059570e+02, -5.46328775178898013110e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -5.24580293854727642611e+04, 2.63542289036033525917e+03, 2.19663243344722513939e+03, 6.18574082269946416091e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.63542289036033525917e+03, -5.33035531467112668906e+04, 1.88564416459477638455e+03, 5.37920495390551877790e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.19663243344722468464e+03, 1.88564416459477729404e+03, -5.39687432755116751650e+04, 4.59555969880844600084e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 6.18574082269946302404e+02, 5.37920495390551877790e+02, 4.59555969880844600084e+02, -5.41425388555765039200e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -5.31711529423498213873e+04, 1.99600010942593894470e+03, 5.68996849475810449803e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 1.99600010942593962682e+03, -5.38767612833515086095e+04, 4.85458198910826013162e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.68996849475810449803e+02, 4.85458198910826013162e+02, -5.40695978969208772469e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, -5.47329929385566501878e+05, 8.14584152678131977154e+03, 8.06625420530617338954e+03, 7.98684240711213897157e+03, 7.90760911298516293755e+03, 7.82855927873551354423e+03, 7.74969637343039994448e+03, 7.67102485729905947665e+03, 7.59254870228947220312e+03, 7.16554474038227090205e+03, 6.40558996969909458130e+03, 5.67266350028049510001e+03, 4.97136240094079494156e+03, 4.30609310888972322573e+03, 3.68092451185705021999e+03, 3.09948541391831395231e+03, 2.56489400644558918430e+03, 2.07971076601056165600e+03, 5.44515818256200304859e+02, 
+0.00000000000000000000e+00, 8.14584152678132250003e+03, -5.47488423825488309376e+05, 7.98863371539926902187e+03, 7.91028130434596005216e+03, 7.83210199976549756684e+03, 7.75409978019522714021e+03, 7.67627811420498983352e+03, 7.59864097310335819202e+03, 7.52119330476142567932e+03, 7.09969372483488950820e+03, 6.34923645928839050612e+03, 5.62502860566063736769e+03, 4.93162848247021793213e+03, 4.27342626804765768611e+03, 3.65449368554357988614e+03, 3.07847952983873619814e+03, 2.54853572976216037205e+03, 2.06726659084738776073e+03, 5.41822330617755596904e+02, 
+0.00000000000000000000e+00, 8.06625420530617702752e+03, 7.98863371539927993581e+03, -5.47644389980877283961e+05, 7.83387458714601871179e+03, 7.75674338754383916239e+03, 7.67978338642550261284e+03, 7.60299805186461799167e+03, 7.52639086625049640134e+03, 7.44996628853493530187e+03, 7.03394751737356818921e+03, 6.29295187099117811158e+03, 5.57743652153420680406e+03, 4.89191810899227766640e+03, 4.24076908936051495402e+03, 3.62806353420433742940e+03, 3.05746876549769376652e+03, 2.53216922979147693695e+03, 2.05481281822956589167e+03, 5.39124803249866317856e+02, 
+0.00000000000000000000e+00, 7.98684240711215261399e+03, 7.91028130434597005660e+03, 7.83387458714601689280e+03, -5.47797952876016148366e+05, 7.68153724571903603646e+03, 7.60561406619159151887e+03, 7.52985917797993715794e+03, 7.45427703939931234345e+03, 7.37887113220242645184e+03, 6.96830861660684513481e+03, 6.23673772076673321862e+03, 5.52988826971249545750e+03, 4.85223180842695546744e+03, 4.20812209542989603506e+03, 3.60163408716510366503e+03, 3.03645265729748234662e+03, 2.51579428281096124920e+03, 2.04234934263598347570e+03, 5.36423057375541816327e+02, 
+0.00000000000000000000e+00, 7.90760911298517385148e+03, 7.83210199976551211876e+03, 7.75674338754385553329e+03, 7.68153724571904695040e+03, -5.47949050067999167368e+05, 7.53159430952267211978e+03, 7.45686544693225823721e+03, 7.38230246987822283700e+03, 7.30791032432189513202e+03, 6.90277902015038034733e+03, 6.18059600149657035217e+03, 5.48238437367024107516e+03, 4.81257009988562458602e+03, 4.17548531294939948566e+03, 3.57520561137542790675e+03, 3.01543171271763822006e+03, 2.49941066056069712431e+03, 2.02987581072730404230e+03, 5.33717096361377230096e+02, 
+0.00000000000000000000e+00, 7.82855927873552718665e+03, 7.75409978019523350667e+03, 7.67978338642551261728e+03, 7.60561406619158697140e+03, 7.53159430952266393433e+03, -5.48097806575838476419e+05, 7.38401936888687214378e+03, 7.31047113199566592812e+03, 7.23708686194047186291e+03, 6.83736123296849200415e+03, 6.12452823481945051753e+03, 5.43492586024638148956e+03, 4.77293351569258175005e+03, 4.14285951247461525782e+03, 3.54877789527886716314e+03, 2.99440522676244881950e+03, 2.48301838572739507072e+03, 2.01739211882121367125e+03, 5.31006741911323615568e+02, 
+0.00000000000000000000e+00, 7.74969637343040085398e+03, 7.67627811420499074302e+03, 7.60299805186462708662e+03, 7.52985917797993897693e+03, 7.45686544693226369418e+03, 7.38401936888687487226e+03, -5.48244222465056227520e+05, 7.23878502651756662090e+03, 7.16640372189740992326e+03, 6.77205822923935375002e+03, 6.06853592533565279155e+03, 5.38751422947815262887e+03, 4.73332208667794202483e+03, 4.11024447655852054595e+03, 3.52235096168436120934e+03, 2.97337321863021634272e+03, 2.46661723005114708940e+03, 2.00489803564868407193e+03, 5.28291936356821338450e+02, 
+0.00000000000000000000e+00, 7.67102485729904401524e+03, 7.59864097310336273949e+03, 7.52639086625049094437e+03, 7.45427703939931052446e+03, 7.38230246987821919902e+03, 7.31047113199566319963e+03, 7.23878502651756934938e+03, -5.48388297777490923181e+05, 7.09586487106637741817e+03, 6.70687250757147558033e+03, 6.01262107728569662868e+03, 5.34015050317684836045e+03, 4.69373731732418400497e+03, 4.07764048366208044172e+03, 3.49592483991767358020e+03, 2.95233571300447010799e+03, 2.45020672566873872711e+03, 1.99239321154798290081e+03, 5.25572500920880315789e+02, 
+0.00000000000000000000e+00, 7.59254870228947311261e+03, 7.52119330476143295527e+03, 7.44996628853493803035e+03, 7.37887113220242463285e+03, 7.30791032432189786050e+03, 7.23708686194047641038e+03, 7.16640372189741447073e+03, 7.09586487106637832767e+03, -5.48530095059616374783e+05, 6.64180705485464477533e+03, 5.95678520662883875048e+03, 5.29283521487249709025e+03, 4.65417924727005902241e+03, 4.04504781224627140546e+03, 3.46949980344520690778e+03, 2.93129273456875080228e+03, 2.43378713713884053504e+03, 1.97987741892768440266e+03, 5.22848439931978646200e+02, 
+0.00000000000000000000e+00, 7.16554474038227181154e+03, 7.09969372483488496073e+03, 7.03394751737356546073e+03, 6.96830861660684422532e+03, 6.90277902015037670935e+03, 6.83736123296849291364e+03, 6.77205822923934920254e+03, 6.70687250757147467084e+03, 6.64180705485464568483e+03, -4.92687696337768938974e+04, 5.65156383536951943825e+03, 5.03376032742323150160e+03, 4.43724695132905890205e+03, 3.86605795267129224158e+03, 3.32418392246271559998e+03, 2.81542111192044148993e+03, 2.34325683667957991929e+03, 1.91078255021308746109e+03, 5.07755526577351190554e+02, 
+0.00000000000000000000e+00, 6.40558996969909185282e+03, 6.34923645928839050612e+03, 6.29295187099117174512e+03, 6.23673772076672867115e+03, 6.18059600149656398571e+03, 6.12452823481945051753e+03, 6.06853592533565733902e+03, 6.01262107728569753817e+03, 5.95678520662884238845e+03, 5.65156383536951580027e+03, -5.04521494286986489897e+04, 4.56691159593794600369e+03, 4.04513839720960413615e+03, 3.54160728239964009845e+03, 3.06006208621047017004e+03, 2.60426899189445748561e+03, 2.17786296088738026810e+03, 1.78422827973286598535e+03, 4.79915859829027283467e+02, 
+0.00000000000000000000e+00, 5.67266350028049419052e+03, 5.62502860566063918668e+03, 5.57743652153420862305e+03, 5.52988826971249818598e+03, 5.48238437367024289415e+03, 5.43492586024637785158e+03, 5.38751422947815444786e+03, 5.34015050317684745096e+03, 5.29283521487249527127e+03, 5.03376032742323059210e+03, 4.56691159593794782268e+03, -5.14482453263278584927e+04, 3.65705312684671298484e+03, 3.21890527888631777387e+03, 2.79615020550945064315e+03, 2.39235208076236131092e+03, 2.01115560252709383349e+03, 1.65612461114062421075e+03, 4.51405916965422875364e+02, 
+0.00000000000000000000e+00, 4.97136240094079221308e+03, 4.93162848247021429415e+03, 4.89191810899227402842e+03, 4.85223180842695546744e+03, 4.81257009988562640501e+03, 4.77293351569257993106e+03, 4.73332208667794020585e+03, 4.69373731732418855245e+03, 4.65417924727006084140e+03, 4.43724695132905799255e+03, 4.04513839720960504565e+03, 3.65705312684671298484e+03, -5.22812999505072366446e+04, 2.89860893886013582232e+03, 2.53268529280187249242e+03, 2.17963303643529934561e+03, 1.84293222106695202456e+03, 1.52618502811769644723e+03, 4.22083955041898263971e+02, 
+0.00000000000000000000e+00, 4.30609310888972413522e+03, 4.27342626804765586712e+03, 4.24076908936051677301e+03, 4.20812209542989694455e+03, 4.17548531294940312364e+03, 4.14285951247461798630e+03, 4.11024447655852054595e+03, 4.07764048366208135121e+03, 4.04504781224627004121e+03, 3.86605795267129178683e+03, 3.54160728239963964370e+03, 3.21890527888631731912e+03, 2.89860893886013673182e+03, -5.29737596776677528396e+04, 2.27018323610582729088e+03, 1.96624948770354149019e+03, 1.67309208591806645927e+03, 1.39417557022677920031e+03, 3.91805583383396765385e+02, 
+0.00000000000000000000e+00, 3.68092451185705112948e+03, 3.65449368554357806715e+03, 3.62806353420433924839e+03, 3.60163408716510321028e+03, 3.57520561137542608776e+03, 3.54877789527886579890e+03, 3.52235096168436211883e+03, 3.49592483991767358020e+03, 3.46949980344520372455e+03, 3.32418392246271514523e+03, 3.06006208621047244378e+03, 2.79615020550945200739e+03, 2.53268529280187294717e+03, 2.27018323610582683614e+03, -5.35459364249087448115e+04, 1.75265324392743650606e+03, 1.50174217796203015496e+03, 1.25999315064600205005e+03, 3.60440498648634218171e+02, 
+0.00000000000000000000e+00, 3.09948541391831167857e+03, 3.07847952983873392441e+03, 3.05746876549769604026e+03, 3.03645265729748007288e+03, 3.01543171271763958430e+03, 2.99440522676245063849e+03, 2.97337321863021816171e+03, 2.95233571300447101748e+03, 2.93129273456875171178e+03, 2.81542111192044148993e+03, 2.60426899189445839511e+03, 2.39235208076236267516e+03, 2.17963303643529889086e+03, 1.96624948770354149019e+03, 1.75265324392743673343e+03, -5.40157606148137347191e+04, 1.32933675046496750838e+03, 1.12377029094799172526e+03, 3.27895582001051423049e+02, 
+0.00000000000000000000e+00, 2.56489400644559100328e+03, 2.54853572976216173629e+03, 2.53216922979147602746e+03, 2.51579428281096170394e+03, 2.49941066056069712431e+03, 2.48301838572739779920e+03, 2.46661723005114663465e+03, 2.45020672566873417964e+03, 2.43378713713884326353e+03, 2.34325683667958037404e+03, 2.17786296088738208709e+03, 2.01115560252709360611e+03, 1.84293222106695247930e+03, 1.67309208591806668665e+03, 1.50174217796202970021e+03, 1.32933675046496773575e+03, -5.43987008955373166827e+04, 9.86009586645714080078e+02, 2.94144469154699606861e+02, 
+0.00000000000000000000e+00, 2.07971076601056165600e+03, 2.06726659084738776073e+03, 2.05481281822956725591e+03, 2.04234934263598415782e+03, 2.02987581072730586129e+03, 2.01739211882121412600e+03, 2.00489803564868589092e+03, 1.99239321154798335556e+03, 1.97987741892768485741e+03, 1.91078255021308791584e+03, 1.78422827973286462111e+03, 1.65612461114062352863e+03, 1.52618502811769712935e+03, 1.39417557022677897294e+03, 1.25999315064600295955e+03, 1.12377029094799149789e+03, 9.86009586645714421138e+02, -5.47078048397091552033e+04, 2.59265345038786335863e+02, 
+0.00000000000000000000e+00, 5.44515818256199395364e+02, 5.41822330617756165339e+02, 5.39124803249866658916e+02, 5.36423057375542157388e+02, 5.33717096361377230096e+02, 5.31006741911323842942e+02, 5.28291936356821906884e+02, 5.25572500920880088415e+02, 5.22848439931978759887e+02, 5.07755526577351304240e+02, 4.79915859829026999250e+02, 4.51405916965422818521e+02, 4.22083955041898491345e+02, 3.91805583383396708541e+02, 3.60440498648633990797e+02, 3.27895582001051479892e+02, 2.94144469154699606861e+02, 2.59265345038786392706e+02, -5.46855204266548480518e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -5.47526164735577302054e+05, 7.94994500938638520893e+03, 7.87069386856668916153e+03, 7.79162031491177822318e+03, 7.36092517103722093452e+03, 6.59293147750958814868e+03, 5.85006646823393111845e+03, 5.13704553317622321629e+03, 4.45850229644832415943e+03, 3.81881391362823478630e+03, 3.22196975019482852076e+03, 2.67148356108651159957e+03, 2.17032703957516559967e+03, 5.71131601947799822483e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.94994500938638520893e+03, -5.47683955862981732935e+05, 7.79340575302348406694e+03, 7.71539205694201518781e+03, 7.29038674026430453523e+03, 6.53225533878248370456e+03, 5.79850362342886273836e+03, 5.09379316303439827607e+03, 4.42273099713886676909e+03, 3.78968676842042441422e+03, 3.19866222863171105928e+03, 2.65319786822353216849e+03, 2.15630370449125575760e+03, 5.68015576302493855110e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.87069386856669098051e+03, 7.79340575302349134290e+03, -5.47839266030861064792e+05, 7.63932098602283258515e+03, 7.21997776895188235358e+03, 6.47166755571753856202e+03, 5.74699833833759112167e+03, 5.05057592082295650471e+03, 4.38697808170974440145e+03, 3.76056671510757678334e+03, 3.17535450180471298154e+03, 2.63490720950688091762e+03, 2.14227318499004104524e+03, 5.64895853835173397783e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.79162031491178186116e+03, 7.71539205694201336883e+03, 7.63932098602283076616e+03, -5.47992157952124602161e+05, 7.14970154119711150997e+03, 6.41116991017283908150e+03, 5.69555138215703755122e+03, 5.00739405288291072793e+03, 4.35124400781163603824e+03, 3.73145418045738006185e+03, 3.15204672358934612930e+03, 2.61661195649156616128e+03, 2.12823534030637438264e+03, 5.61772461655468191566e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.36092517103721911553e+03, 7.29038674026430271624e+03, 7.21997776895188235358e+03, 7.14970154119711241947e+03, -4.87892399131360871252e+04, 6.08057224217327893712e+03, 5.41398582329675809888e+03, 4.77073566485912306234e+03, 4.15515396581321510894e+03, 3.57150893664384466319e+03, 3.02384668954304788713e+03, 2.51587149644430746775e+03, 2.05085519611566678577e+03, 5.44505791964665945670e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 6.59293147750959360565e+03, 6.53225533878248734254e+03, 6.47166755571754038101e+03, 6.41116991017284180998e+03, 6.08057224217327711813e+03, -5.00683394997246941784e+04, 4.90707827499725863163e+03, 4.34349235918180784211e+03, 3.80024562333121502888e+03, 3.28133027455661158456e+03, 2.79073603511370765773e+03, 2.33229196791044114434e+03, 1.90954374320242322938e+03, 5.12794371755362476506e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.85006646823393202794e+03, 5.79850362342886455735e+03, 5.74699833833758930268e+03, 5.69555138215703846072e+03, 5.41398582329675900837e+03, 4.90707827499725954112e+03, -5.11467591040761544718e+04, 3.92148125202375285880e+03, 3.44813391972742419966e+03, 2.99225810615567570494e+03, 2.55761610769405388055e+03, 2.14802465479913007584e+03, 1.76719062323094567546e+03, 4.80545881282307732363e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.13704553317622321629e+03, 5.09379316303439918556e+03, 5.05057592082295741420e+03, 5.00739405288291072793e+03, 4.77073566485912306234e+03, 4.34349235918180875160e+03, 3.92148125202375194931e+03, -5.20493747397658080445e+04, 3.09966137145808352216e+03, 2.70468815815585912787e+03, 2.32458331676869192961e+03, 1.96297778743382582434e+03, 1.62359920775712475915e+03, 4.47642161093280435580e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 4.45850229644832052145e+03, 4.42273099713886313111e+03, 4.38697808170973985398e+03, 4.35124400781163512875e+03, 4.15515396581321510894e+03, 3.80024562333121411939e+03, 3.44813391972742374492e+03, 3.09966137145808397690e+03, -5.27994703303255446372e+04, 2.41928999571712165562e+03, 2.09190479833652216257e+03, 1.77715789139565549704e+03, 1.47862257247844104313e+03, 4.13961656043002051319e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.81881391362823205782e+03, 3.78968676842042304997e+03, 3.76056671510757541910e+03, 3.73145418045737778812e+03, 3.57150893664384602744e+03, 3.28133027455661203931e+03, 2.99225810615567525019e+03, 2.70468815815585912787e+03, 2.41928999571712029137e+03, -5.34183736495447519701e+04, 1.86015303328294726271e+03, 1.59077188649036338575e+03, 1.33223872919715768148e+03, 3.79395340698583254380e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.22196975019483170399e+03, 3.19866222863171333302e+03, 3.17535450180471252679e+03, 3.15204672358934976728e+03, 3.02384668954304697763e+03, 2.79073603511370993147e+03, 2.55761610769405524479e+03, 2.32458331676869192961e+03, 2.09190479833652261732e+03, 1.86015303328294794483e+03, -5.39251682902019674657e+04, 1.40436397441822441579e+03, 1.18465319125379869547e+03, 3.43869247298709240113e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.67148356108651341856e+03, 2.65319786822353216849e+03, 2.63490720950687773438e+03, 2.61661195649156934451e+03, 2.51587149644430837725e+03, 2.33229196791044296333e+03, 2.14802465479912916635e+03, 1.96297778743382673383e+03, 1.77715789139565595178e+03, 1.59077188649036338575e+03, 1.40436397441822441579e+03, -5.43365644386596904951e+04, 1.03643193551344393200e+03, 3.07373641288338774302e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.17032703957516650917e+03, 2.15630370449125666710e+03, 2.14227318499004240948e+03, 2.12823534030637301839e+03, 2.05085519611566724052e+03, 1.90954374320242209251e+03, 1.76719062323094658495e+03, 1.62359920775712544128e+03, 1.47862257247844081576e+03, 1.33223872919715836360e+03, 1.18465319125379892284e+03, 1.03643193551344415937e+03, -5.46668882159432760091e+04, 2.70000534843929301587e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.71131601947799481422e+02, 5.68015576302494082483e+02, 5.64895853835173170410e+02, 5.61772461655468532626e+02, 5.44505791964666059357e+02, 5.12794371755362362819e+02, 4.80545881282307675519e+02, 4.47642161093280719797e+02, 4.13961656043001823946e+02, 3.79395340698583140693e+02, 3.43869247298709183269e+02, 3.07373641288338831146e+02, 2.70000534843929415274e+02, -5.46573547257509198971e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -5.47405392056703800336e+05, 8.07052396416556621261e+03, 7.99104945185613814829e+03, 7.91175150554433548677e+03, 7.83263369657716884831e+03, 7.75369963289063434786e+03, 7.67495390614631196513e+03, 7.24630395334498189186e+03, 6.48282369791960718430e+03, 5.74561688511919965094e+03, 5.03933644440527768893e+03, 4.36848577896519509522e+03, 3.73726014092637433350e+03, 3.14943518483336220015e+03, 2.60828869153484993149e+03, 2.11654543173312640647e+03, 5.55296177781289316044e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 8.07052396416556985059e+03, -5.47563628967738477513e+05, 7.91354086826375714736e+03, 7.83530271777137386380e+03, 7.75723827562126916746e+03, 7.67935212444154331024e+03, 7.60164787739086477814e+03, 7.17857830263573123375e+03, 6.42474374655305473425e+03, 5.69641598685740154906e+03, 4.99820151873704526224e+03, 4.33458376113977192290e+03, 3.70975766028457519496e+03, 3.12751535787624925433e+03, 2.59116574805085110711e+03, 2.10347533384765756637e+03, 5.52435522274116237895e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.99104945185614451475e+03, 7.91354086826375623787e+03, -5.47719343755536596291e+05, 7.75900857404335602041e+03, 7.68199302689635896968e+03, 7.60514885175315248489e+03, 7.52848112468011458986e+03, 7.11096660718116436328e+03, 6.36674038462803218863e+03, 5.64726312777805287624e+03, 4.95709441376942140778e+03, 4.30069475194045207900e+03, 3.68225854244734136955e+03, 3.10559270872567594779e+03, 2.57403579641052920124e+03, 2.09039653166742937174e+03, 5.49571005798256123853e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.91175150554433730576e+03, 7.83530271777136204037e+03, 7.75900857404334510647e+03, -5.47872661488745245151e+05, 7.60690058842076814472e+03, 7.53109391569117360632e+03, 7.45545677032588719158e+03, 7.04347149017647006985e+03, 6.30881523949358415848e+03, 5.59815942835183523130e+03, 4.91601574389781490027e+03, 4.26681959302411632962e+03, 3.65476263664792531927e+03, 3.08366658358252516337e+03, 2.55689890167452404057e+03, 2.07730895587454324414e+03, 5.46702459059229681770e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.83263369657716975780e+03, 7.75723827562126643897e+03, 7.68199302689635987917e+03, 7.60690058842076450674e+03, -5.48023582349477685057e+05, 7.45718941524396086606e+03, 7.38257788838687702082e+03, 6.97609601756123811356e+03, 6.25096989779565774370e+03, 5.54910646128861117177e+03, 4.87496560365351797373e+03, 4.23295812213166391302e+03, 3.62727001288047904382e+03, 3.06173704138497396343e+03, 2.53975486847514684996e+03, 2.06421240187547709866e+03, 5.43829831376365746110e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.75369963289063434786e+03, 7.67935212444153421529e+03, 7.60514885175314702792e+03, 7.53109391569116905885e+03, 7.45718941524396268505e+03, -5.48172106461117626168e+05, 7.30984856392307483475e+03, 6.90884279949452229630e+03, 6.19320646351315554057e+03, 5.50010533674275393423e+03, 4.83394557495525350532e+03, 4.19911068481064830848e+03, 3.59978075782859332321e+03, 3.03980415512335457606e+03, 2.52260326893171577467e+03, 2.05110655243384644564e+03, 5.40952952466538249610e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.67495390614631378412e+03, 7.60164787739085932117e+03, 7.52848112468011458986e+03, 7.45545677032588901056e+03, 7.38257788838687611133e+03, 7.30984856392307119677e+03, -5.48318296447197557427e+05, 6.84171494078536215966e+03, 6.13552655804144433205e+03, 5.45115668163719328732e+03, 4.79295577930705894687e+03, 4.16527763044812581938e+03, 3.57229520560118498906e+03, 3.01786800055606181559e+03, 2.50544440987786902042e+03, 2.03799121424383224621e+03, 5.38071835640144854551e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.24630395334497825388e+03, 7.17857830263573214324e+03, 7.11096660718115890631e+03, 7.04347149017646552238e+03, 6.97609601756123265659e+03, 6.90884279949452047731e+03, 6.84171494078535943117e+03, -4.90800849071450429619e+04, 5.82027035513895043550e+03, 5.18319337132331202156e+03, 4.56823234743062766938e+03, 3.97953787941413565932e+03, 3.42120823077220211417e+03, 2.89713590943907774999e+03, 2.41089116140104169972e+03, 1.96563374999275015398e+03, 5.22124258806200941763e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 6.48282369791960172734e+03, 6.42474374655305473425e+03, 6.36674038462802491267e+03, 6.30881523949358324899e+03, 6.25096989779565774370e+03, 6.19320646351315372158e+03, 6.13552655804144342255e+03, 5.82027035513894497853e+03, -5.03013057891334756278e+04, 4.70052246716225272394e+03, 4.16225488711152866017e+03, 3.64307180907963356731e+03, 3.14681333983070544491e+03, 2.67733172765808649274e+03, 2.23833608370780120822e+03, 1.83327177179378168148e+03, 4.92763215555496458364e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.74561688511919601297e+03, 5.69641598685740245855e+03, 5.64726312777805378573e+03, 5.59815942835183341231e+03, 5.54910646128861026227e+03, 5.50010533674275575322e+03, 5.45115668163719328732e+03, 5.18319337132330929307e+03, 4.70052246716225363343e+03, -5.13298985026439549983e+04, 3.76078993364991856652e+03, 3.30877824581640470569e+03, 2.87299078334552541492e+03, 2.45706795313820475712e+03, 2.06472013185775767852e+03, 1.69956525962260479901e+03, 4.62785561799000049632e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.03933644440527586994e+03, 4.99820151873704708123e+03, 4.95709441376942322677e+03, 4.91601574389781671925e+03, 4.87496560365352161170e+03, 4.83394557495525714330e+03, 4.79295577930706258485e+03, 4.56823234743062948837e+03, 4.16225488711152956967e+03, 3.76078993364991902126e+03, -5.21903695377970143454e+04, 2.97738701732319213988e+03, 2.60003984358247316777e+03, 2.23635968803367086366e+03, 1.88988417277213920897e+03, 1.56426290045506971182e+03, 4.32058776392372124064e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 4.36848577896519327624e+03, 4.33458376113977101340e+03, 4.30069475194045389799e+03, 4.26681959302411814861e+03, 4.23295812213165936555e+03, 4.19911068481064467051e+03, 4.16527763044812400040e+03, 3.97953787941413202134e+03, 3.64307180907963265781e+03, 3.30877824581640379620e+03, 2.97738701732319259463e+03, -5.29055098400835995562e+04, 2.32853623769891964912e+03, 2.01539494983377949211e+03, 1.71376918198599992138e+03, 1.42716455739190860186e+03, 4.00447329032687207473e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.73726014092637387876e+03, 3.70975766028456973800e+03, 3.68225854244734046006e+03, 3.65476263664792304553e+03, 3.62727001288047904382e+03, 3.59978075782859195897e+03, 3.57229520560118271533e+03, 3.42120823077219984043e+03, 3.14681333983070499016e+03, 2.87299078334552632441e+03, 2.60003984358247225828e+03, 2.32853623769891919437e+03, -5.34960451276766616502e+04, 1.79467217852486760421e+03, 1.53652073600927860753e+03, 1.28819844456018449819e+03, 3.67829115945588341674e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.14943518483336538338e+03, 3.12751535787624516161e+03, 3.10559270872567640254e+03, 3.08366658358252652761e+03, 3.06173704138497760141e+03, 3.03980415512335684980e+03, 3.01786800055606363458e+03, 2.89713590943907547626e+03, 2.67733172765808740223e+03, 2.45706795313820657611e+03, 2.23635968803367086366e+03, 2.01539494983377903736e+03, 1.79467217852486714946e+03, -5.39803718589923082618e+04, 1.35862759182293279991e+03, 1.14752506596371426895e+03, 3.34118348554579540632e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.60828869153484902199e+03, 2.59116574805085110711e+03, 2.57403579641052965599e+03, 2.55689890167452267633e+03, 2.53975486847514594047e+03, 2.52260326893171304619e+03, 2.50544440987787174890e+03, 2.41089116140104124497e+03, 2.23833608370780302721e+03, 2.06472013185775767852e+03, 1.88988417277214034584e+03, 1.71376918198599992138e+03, 1.53652073600927815278e+03, 1.35862759182293302729e+03, -5.43744572226190502988e+04, 1.00567112558808037193e+03, 2.99294978022441341636e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.11654543173312322324e+03, 2.10347533384765756637e+03, 2.09039653166742937174e+03, 2.07730895587454551787e+03, 2.06421240187547755340e+03, 2.05110655243384780988e+03, 2.03799121424383247358e+03, 1.96563374999275151822e+03, 1.83327177179378008987e+03, 1.69956525962260525375e+03, 1.56426290045507016657e+03, 1.42716455739190791974e+03, 1.28819844456018518031e+03, 1.14752506596371426895e+03, 1.00567112558808037193e+03, -5.46918593957312332350e+04, 2.63442391357019744191e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.55296177781289884479e+02, 5.52435522274116351582e+02, 5.49571005798256123853e+02, 5.46702459059229909144e+02, 5.43829831376366200857e+02, 5.40952952466538022236e+02, 5.38071835640145650359e+02, 5.22124258806200828076e+02, 4.92763215555496230991e+02, 4.62785561798999992789e+02, 4.32058776392372351438e+02, 4.00447329032687150629e+02, 3.67829115945588284831e+02, 3.34118348554579483789e+02, 2.99294978022441512167e+02, 2.63442391357019857878e+02, -5.46745782913513176027e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -5.38018331274556185235e+04, 5.06817859384017594948e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.06817859384017651792e+02, -5.40087082233295586775e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -5.47444643371320911683e+05, 8.03135475361430326302e+03, 7.95194749520791447139e+03, 7.87271660095023980830e+03, 7.79366670666199479456e+03, 7.71480149319778229255e+03, 7.28541223331254150253e+03, 6.52032151171342957241e+03, 5.78112494192641770496e+03, 5.07249761835210483696e+03, 4.39898935465025988378e+03, 3.76485694860971125308e+03, 3.17394820728111972130e+03, 2.62962034987967990673e+03, 2.13468005136764486451e+03, 5.60622381912373612067e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 8.03135475361430053454e+03, -5.47602690042824600823e+05, 7.87450469163558500441e+03, 7.79633417902212750050e+03, 7.71833772073464479035e+03, 7.64052045986879238626e+03, 7.21674849036064370011e+03, 6.46137694741945597343e+03, 5.73113791112262606475e+03, 5.03065888228969652118e+03, 4.36446611114881307003e+03, 3.73681524034245285293e+03, 3.15156831048739741163e+03, 2.61211171641647024444e+03, 2.12129396062502974019e+03, 5.57677245308255692180e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.95194749520791174291e+03, 7.87450469163557772845e+03, -5.47758311479056254029e+05, 7.72010709376489558053e+03, 7.64315957239502040466e+03, 7.56638430045815584890e+03, 7.14820366315910268895e+03, 6.40251269095544466836e+03, 5.68120189322476653615e+03, 4.98885020676485328295e+03, 4.32995812698853387701e+03, 3.70877794956892694245e+03, 3.12918595355365187061e+03, 2.59459698116294566717e+03, 2.10789977896298887572e+03, 5.54728257552148534160e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.87271660095023980830e+03, 7.79633417902212750050e+03, 7.72010709376489285205e+03, -5.47911507913392502815e+05, 7.56813441121767300501e+03, 7.49239613909700346994e+03, 7.07978086492337479285e+03, 6.34373037126215240278e+03, 5.63131849842789051763e+03, 4.94707171918617586925e+03, 4.29546526841091963433e+03, 3.68074517066567022994e+03, 3.10680121596540493556e+03, 2.57707596576825017110e+03, 2.09449731559662677682e+03, 5.51775371586207029395e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.79366670666198933759e+03, 7.71833772073464024288e+03, 7.64315957239501312870e+03, 7.56813441121767300501e+03, -5.48062279523222125135e+05, 7.41856011143076739245e+03, 7.01148275357273269037e+03, 6.28503213504663108324e+03, 5.58148887475559149607e+03, 4.90532503468653885648e+03, 4.26098790975610700116e+03, 3.65271701494846593050e+03, 3.08441419147083206553e+03, 2.55954825954286570777e+03, 2.08108626723966244754e+03, 5.48818420787249237947e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.71480149319778229255e+03, 7.64052045986879329575e+03, 7.56638430045816130587e+03, 7.49239613909700437944e+03, 7.41856011143076739245e+03, -5.48210688962294720113e+05, 6.94331249469854446943e+03, 6.22641965808246459346e+03, 5.53171369732530092733e+03, 4.86361031704016568256e+03, 4.22652643705421996856e+03, 3.62469384787454782781e+03, 3.06202498224594501153e+03, 2.54201419119887486886e+03, 2.06766645833995562498e+03, 5.45857423123524085895e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.28541223331253695505e+03, 7.21674849036064279062e+03, 7.14820366315910177946e+03, 7.07978086492336842639e+03, 7.01148275357272905239e+03, 6.94331249469854265044e+03, -4.89841616266180062667e+04, 5.90608703081065232254e+03, 5.25925123803999485972e+03, 4.63494079445949137153e+03, 4.03736591002835848485e+03, 3.47068038308718450935e+03, 2.93882670197021434433e+03, 2.44541850243785802377e+03, 1.99365161710176403176e+03, 5.29475017397042506673e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 6.52032151171343048190e+03, 6.46137694741945051646e+03, 6.40251269095544466836e+03, 6.34373037126215785975e+03, 6.28503213504663108324e+03, 6.22641965808247186942e+03, 5.90608703081064868456e+03, -5.02245308729412645334e+04, 4.76856677553501413058e+03, 4.22193484313249155093e+03, 3.69480700121118661627e+03, 3.19107304015235968109e+03, 2.71462992264770537076e+03, 2.26922557801286893664e+03, 1.85833763903160570408e+03, 4.99339488410901651605e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.78112494192642134294e+03, 5.73113791112262697425e+03, 5.68120189322476744564e+03, 5.63131849842789233662e+03, 5.58148887475559240556e+03, 5.53171369732529910834e+03, 5.25925123803999395022e+03, 4.76856677553501231159e+03, -5.12695919841667855508e+04, 3.81368326825151370940e+03, 3.35463027069274357927e+03, 2.91221740639560584896e+03, 2.49012471187523306071e+03, 2.09209696768146523027e+03, 1.72178071337434357702e+03, 4.68614001090244414627e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.07249761835210210847e+03, 5.03065888228969561169e+03, 4.98885020676484782598e+03, 4.94707171918617314077e+03, 4.90532503468653703749e+03, 4.86361031704016295407e+03, 4.63494079445949228102e+03, 4.22193484313248973194e+03, 3.81368326825151279991e+03, -5.21439781208171989419e+04, 3.01760267817025396653e+03, 2.63444453068216216707e+03, 2.26535294191191997015e+03, 1.91389570874075138818e+03, 1.58374751767869270225e+03, 4.37170754291636967537e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 4.39898935465026352176e+03, 4.36446611114881670801e+03, 4.32995812698853569600e+03, 4.29546526841091235838e+03, 4.26098790975610609166e+03, 4.22652643705421724007e+03, 4.03736591002835848485e+03, 3.69480700121118570678e+03, 3.35463027069274085079e+03, 3.01760267817025305703e+03, -5.28706478013131782063e+04, 2.35836087591921523199e+03, 2.04052854006939128340e+03, 1.73458423463572921719e+03, 1.44405532747424308582e+03, 4.04878786031379036103e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.76485694860970988884e+03, 3.73681524034245239818e+03, 3.70877794956892466871e+03, 3.68074517066567022994e+03, 3.65271701494846456626e+03, 3.62469384787454373509e+03, 3.47068038308718496410e+03, 3.19107304015236240957e+03, 2.91221740639560766795e+03, 2.63444453068216125757e+03, 2.35836087591921477724e+03, -5.34705300093317709980e+04, 1.81617408324393863950e+03, 1.55432811150165002800e+03, 1.30264857784943956176e+03, 3.71620248261317954075e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.17394820728111881181e+03, 3.15156831048739695689e+03, 3.12918595355365550859e+03, 3.10680121596540720930e+03, 3.08441419147083388452e+03, 3.06202498224594683052e+03, 2.93882670197021388958e+03, 2.71462992264770718975e+03, 2.49012471187523487970e+03, 2.26535294191192087965e+03, 2.04052854006939105602e+03, 1.81617408324393886687e+03, -5.39622519388610890019e+04, 1.37363408663742325189e+03, 1.15970237139352298072e+03, 3.37313182485127867949e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.62962034987967945199e+03, 2.61211171641647115393e+03, 2.59459698116294612191e+03, 2.57707596576824971635e+03, 2.55954825954286116030e+03, 2.54201419119887805209e+03, 2.44541850243785711427e+03, 2.26922557801286984613e+03, 2.09209696768146341128e+03, 1.91389570874075297979e+03, 1.73458423463572898982e+03, 1.55432811150164957326e+03, 1.37363408663742370663e+03, -5.43620291939640519558e+04, 1.01575608564659830790e+03, 3.01940864895272000012e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.13468005136764350027e+03, 2.12129396062503155918e+03, 2.10789977896299069471e+03, 2.09449731559662814107e+03, 2.08108626723966244754e+03, 2.06766645833995562498e+03, 1.99365161710176380438e+03, 1.85833763903160547670e+03, 1.72178071337434357702e+03, 1.58374751767869315699e+03, 1.44405532747424285844e+03, 1.30264857784943956176e+03, 1.15970237139352275335e+03, 1.01575608564659864896e+03, -5.46836757632175722392e+04, 2.65589446547554189237e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.60622381912373612067e+02, 5.57677245308255692180e+02, 5.54728257552148647846e+02, 5.51775371586207256769e+02, 5.48818420787249010573e+02, 5.45857423123524085895e+02, 5.29475017397042620360e+02, 4.99339488410901140014e+02, 4.68614001090244471470e+02, 4.37170754291637024380e+02, 4.04878786031379092947e+02, 3.71620248261317840388e+02, 3.37313182485127867949e+02, 3.01940864895272056856e+02, 2.65589446547554359768e+02, -5.46689452842685841460e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -5.47568524620197480544e+05, 7.90768628876928050886e+03, 7.82852446417132250644e+03, 7.39726556012164473941e+03, 6.62798307943240342865e+03, 5.88344514717536094395e+03, 5.16838179848196250532e+03, 4.48746735197243833682e+03, 3.84513500554546590138e+03, 3.24544443555752241082e+03, 2.69198715131537028356e+03, 2.18781631836851101980e+03, 5.76308266444161176878e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.90768628876927868987e+03, -5.47726124731024727225e+05, 7.75132560276730055193e+03, 7.32579113887300809438e+03, 6.56644100892954065785e+03, 5.83109309991756799718e+03, 5.12442099962397605850e+03, 4.45106909497591823310e+03, 3.81546220173643496310e+03, 3.22167034786078738762e+03, 2.67330981131564658426e+03, 2.17347165699624792978e+03, 5.73105876090029823899e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.82852446417132159695e+03, 7.75132560276729691395e+03, -5.47881278598694945686e+05, 7.25445184865848750633e+03, 6.50499121432876381732e+03, 5.77880127900806564867e+03, 5.08049724121045619540e+03, 4.41469112560164376191e+03, 3.78579815520178999577e+03, 3.19789725380423487877e+03, 2.65462874349857111156e+03, 2.15912037437542812768e+03, 5.69900001266974754799e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.39726556012163746345e+03, 7.32579113887300718488e+03, 7.25445184865848750633e+03, -4.86902798581407696474e+04, 6.16920741321968580451e+03, 5.49263393966405601532e+03, 4.83979794937694714463e+03, 4.21509393561338674772e+03, 3.62284895520516511169e+03, 3.06716275325296010124e+03, 2.55178684050519086668e+03, 2.08003300708422057141e+03, 5.52184067918442110567e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 6.62798307943240888562e+03, 6.56644100892954247684e+03, 6.50499121432876745530e+03, 6.16920741321968671400e+03, -4.99889519776906745392e+04, 4.97752073025886238611e+03, 4.40534910937644599471e+03, 3.85393182506186485625e+03, 3.32731379110704119739e+03, 2.82953276694825444793e+03, 2.36446012570075026815e+03, 1.93567732069568410225e+03, 5.19671543585316157987e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.88344514717536094395e+03, 5.83109309991756890668e+03, 5.77880127900806746766e+03, 5.49263393966405601532e+03, 4.97752073025886238611e+03, -5.10842538214303858695e+04, 3.97636823232713049947e+03, 3.49577097611466115268e+03, 3.03306038495696520840e+03, 2.59204137978380231289e+03, 2.17656823391502166487e+03, 1.79037957429313314606e+03, 4.86648161042978415480e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.16838179848196250532e+03, 5.12442099962397696800e+03, 5.08049724121045619540e+03, 4.83979794937694532564e+03, 4.40534910937644690421e+03, 3.97636823232712913523e+03, -5.20011775237977417419e+04, 3.14149230262040828165e+03, 2.74051735175523572252e+03, 2.35481274940459206846e+03, 1.98804240274962580770e+03, 1.64396183066404205420e+03, 4.53000679523278506622e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 4.48746735197243560833e+03, 4.45106909497591641411e+03, 4.41469112560164194292e+03, 4.21509393561338492873e+03, 3.85393182506186212777e+03, 3.49577097611466069793e+03, 3.14149230262040828165e+03, -5.27631647726961018634e+04, 2.45038657465749656694e+03, 2.11814127881096419515e+03, 1.79891176611282139675e+03, 1.49629553262759259269e+03, 4.18612377273992308346e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.84513500554546772037e+03, 3.81546220173643132512e+03, 3.78579815520178908628e+03, 3.62284895520516465695e+03, 3.32731379110704074265e+03, 3.03306038495696429891e+03, 2.74051735175523526777e+03, 2.45038657465749565745e+03, -5.33917386855079894303e+04, 1.88262520667629723903e+03, 1.60940460077906459446e+03, 1.34737604249771220566e+03, 3.83378794729651133366e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.24544443555752332031e+03, 3.22167034786078784236e+03, 3.19789725380423442402e+03, 3.06716275325295919174e+03, 2.82953276694825444793e+03, 2.59204137978380413188e+03, 2.35481274940459206846e+03, 2.11814127881096374040e+03, 1.88262520667629701165e+03, -5.39062083030090652755e+04, 1.42008457331621548292e+03, 1.19742468697385834275e+03, 3.47230125487507393700e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.69198715131536982881e+03, 2.67330981131564294628e+03, 2.65462874349857384004e+03, 2.55178684050518950244e+03, 2.36446012570075254189e+03, 2.17656823391501984588e+03, 1.98804240274962694457e+03, 1.79891176611282162412e+03, 1.60940460077906391234e+03, 1.42008457331621502817e+03, -5.43235297658407216659e+04, 1.04702137101778475881e+03, 3.10160300235601084751e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.18781631836851374828e+03, 2.17347165699625020352e+03, 2.15912037437542812768e+03, 2.08003300708422011667e+03, 1.93567732069568228326e+03, 1.79037957429313337343e+03, 1.64396183066404273632e+03, 1.49629553262759282006e+03, 1.34737604249771266041e+03, 1.19742468697385879750e+03, 1.04702137101778544093e+03, -5.46582853038596440456e+04, 2.72264430961956577448e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.76308266444161517938e+02, 5.73105876090029596526e+02, 5.69900001266975095859e+02, 5.52184067918441996881e+02, 5.19671543585316044300e+02, 4.86648161042978301793e+02, 4.53000679523278677152e+02, 4.18612377273992251503e+02, 3.83378794729651019679e+02, 3.47230125487507450543e+02, 3.10160300235601027907e+02, 2.72264430961956691135e+02, -5.46513971783723263798e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -5.47611926234161015600e+05, 7.86438088769179285009e+03, 7.43261841767748865095e+03, 6.66215872929299075622e+03, 5.91605860912633033877e+03, 5.19905995355458708218e+03, 4.51587465346762564877e+03, 3.87099154645709404576e+03, 3.26853928811227979168e+03, 2.71218602302040835639e+03, 2.20506690823007056679e+03, 5.81428606071315471127e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.86438088769179103110e+03, -5.47769355081307352521e+05, 7.36020970690198555531e+03, 6.59975072907888534246e+03, 5.86291622023888066906e+03, 5.15438900366641155415e+03, 4.47884793222498319665e+03, 3.84077160985722730402e+03, 3.24429700108425322469e+03, 2.69311577539275185700e+03, 2.19039933363142336020e+03, 5.78139414527427561552e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.43261841767748956045e+03, 7.36020970690198919328e+03, -4.85903480043058298179e+04, 6.25874680192096911924e+03, 5.57211514467351753410e+03, 4.90961915158353713196e+03, 4.27571646266228981403e+03, 3.67479402412648323661e+03, 3.11100642444843470003e+03, 2.58815369314071585904e+03, 2.10958886644440826785e+03, 5.59969587172562455635e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 6.66215872929299166572e+03, 6.59975072907889079943e+03, 6.25874680192096911924e+03, -4.99087242843043350149e+04, 5.04873624599964477966e+03, 4.46790921933189838455e+03, 3.90824988086868461323e+03, 3.37385680555909630129e+03, 2.86881689274608606866e+03, 2.39704498857493308606e+03, 1.96215950308392507395e+03, 5.26647403713833341499e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.91605860912632851978e+03, 5.86291622023888066906e+03, 5.57211514467351662461e+03, 5.04873624599964568915e+03, -5.10210381228585392819e+04, 4.03190080851404491113e+03, 3.54398734872918021210e+03, 3.07437510607666627038e+03, 2.62691262138420643169e+03, 2.20549275756738006748e+03, 1.81388694683640369476e+03, 4.92840405339415383423e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.19905995355458617269e+03, 5.15438900366641064466e+03, 4.90961915158353804145e+03, 4.46790921933189929405e+03, 4.03190080851404445639e+03, -5.19523942771102010738e+04, 3.18384854396810669641e+03, 2.77681075592624938508e+03, 2.38544580297602260543e+03, 2.01345149178420069802e+03, 1.66461215939891690141e+03, 4.58440329577435079500e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 4.51587465346762655827e+03, 4.47884793222498046816e+03, 4.27571646266228981403e+03, 3.90824988086868370374e+03, 3.54398734872917930261e+03, 3.18384854396810669641e+03, -5.27263888034254196100e+04, 2.48189846225782866895e+03, 2.14473854525776505398e+03, 1.82097330528152315310e+03, 1.51422525988428833443e+03, 4.23335374331089042244e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.87099154645709450051e+03, 3.84077160985722730402e+03, 3.67479402412648187237e+03, 3.37385680555909766554e+03, 3.07437510607666808937e+03, 2.77681075592624893034e+03, 2.48189846225782775946e+03, -5.33647373833036108408e+04, 1.90541536251363436349e+03, 1.62830826957043768743e+03, 1.36273932349947767761e+03, 3.87425745914120057023e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.26853928811227706319e+03, 3.24429700108425504368e+03, 3.11100642444843242629e+03, 2.86881689274608743290e+03, 2.62691262138420916017e+03, 2.38544580297602351493e+03, 2.14473854525776505398e+03, 1.90541536251363345400e+03, -5.38869725195213322877e+04, 1.43604000962784198236e+03, 1.21039189742737403321e+03, 3.50645910676757182500e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.71218602302040562790e+03, 2.69311577539275504023e+03, 2.58815369314071585904e+03, 2.39704498857493445030e+03, 2.20549275756738052223e+03, 2.01345149178420251701e+03, 1.82097330528152338047e+03, 1.62830826957043746006e+03, 1.43604000962784198236e+03, -5.43102952673313702689e+04, 1.05777723654634360173e+03, 3.12993579320699268465e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.20506690823007238578e+03, 2.19039933363142336020e+03, 2.10958886644440781311e+03, 1.96215950308392416446e+03, 1.81388694683640437688e+03, 1.66461215939891803828e+03, 1.51422525988428810706e+03, 1.36273932349947835974e+03, 1.21039189742737403321e+03, 1.05777723654634382910e+03, -5.46495438586747914087e+04, 2.74567077248303576198e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.81428606071315357440e+02, 5.78139414527428016299e+02, 5.59969587172562455635e+02, 5.26647403713832886751e+02, 4.92840405339415497110e+02, 4.58440329577435250030e+02, 4.23335374331088985400e+02, 3.87425745914120000180e+02, 3.50645910676757182500e+02, 3.12993579320699268465e+02, 2.74567077248303689885e+02, -5.46453316139171329269e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -5.47656412897648173384e+05, 7.46695125037321668060e+03, 6.69542752366903459915e+03, 5.94787809931268202490e+03, 5.22905390005366643891e+03, 4.54370144730485026230e+03, 3.89636381023848116456e+03, 3.29123724594865871040e+03, 2.73206610299059684621e+03, 2.22206680692481950246e+03, 5.86489444536067594527e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.46695125037322031858e+03, -4.84894666796007586527e+04, 6.34917084365679602342e+03, 5.65241253059905557166e+03, 4.98018486959325582575e+03, 4.33700945412817236502e+03, 3.72733415644377555509e+03, 3.15536960236311188055e+03, 2.62496560833309877125e+03, 2.13951776340439437263e+03, 5.67861192082938941894e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 6.69542752366903641814e+03, 6.34917084365679511393e+03, -4.98276735313751341891e+04, 5.12071006471619966760e+03, 4.53116014757936318347e+03, 3.96318928649829831556e+03, 3.42095066689918166958e+03, 2.90858141668565986038e+03, 2.43004100806082851705e+03, 1.98898599288002014873e+03, 5.33720970737905531678e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.94787809931268202490e+03, 5.65241253059905648115e+03, 5.12071006471619966760e+03, -5.09571247057288128417e+04, 4.08806821817787295004e+03, 3.59277404938616882646e+03, 3.11619489079494178441e+03, 2.66222388665865219082e+03, 2.23479352824522948140e+03, 1.83770911805141963669e+03, 4.99121798321842447876e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.22905390005366643891e+03, 4.98018486959325673524e+03, 4.53116014757936318347e+03, 4.08806821817787067630e+03, -5.19030340950072786654e+04, 3.22672252450313999361e+03, 2.81356217817545757498e+03, 2.41647750792135866504e+03, 2.03920114598885925261e+03, 1.68554719479218510969e+03, 4.63960447085584291926e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 4.54370144730484935280e+03, 4.33700945412817145552e+03, 3.96318928649829649657e+03, 3.59277404938616700747e+03, 3.22672252450314135785e+03, -5.26891487016145038069e+04, 2.51382054388349024521e+03, 2.17169251214185715071e+03, 1.84333931217453232421e+03, 1.53240931556867508334e+03, 4.28130117796620652371e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.89636381023848116456e+03, 3.72733415644377419085e+03, 3.42095066689918121483e+03, 3.11619489079494269390e+03, 2.81356217817545757498e+03, 2.51382054388348979046e+03, -5.33373738894955240539e+04, 1.92852020619473250918e+03, 1.64748033041237476937e+03, 1.37832663077349957348e+03, 3.91535782805478731916e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.29123724594866098414e+03, 3.15536960236311006156e+03, 2.90858141668566076987e+03, 2.66222388665865446455e+03, 2.41647750792135775555e+03, 2.17169251214185715071e+03, 1.92852020619473250918e+03, -5.38674635414181757369e+04, 1.45222827388620748934e+03, 1.22355331243166369859e+03, 3.54116292074849468463e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.73206610299059775571e+03, 2.62496560833309877125e+03, 2.43004100806083170028e+03, 2.23479352824522902665e+03, 2.03920114598885902524e+03, 1.84333931217453209683e+03, 1.64748033041237363250e+03, 1.45222827388620771671e+03, -5.42968624827789099072e+04, 1.06869838592571113622e+03, 3.15873250969954938228e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.22206680692482086670e+03, 2.13951776340439482738e+03, 1.98898599288001878449e+03, 1.83770911805141918194e+03, 1.68554719479218510969e+03, 1.53240931556867462859e+03, 1.37832663077350025560e+03, 1.22355331243166369859e+03, 1.06869838592571159097e+03, -5.46406647239502999582e+04, 2.76908313655558060873e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.86489444536068390335e+02, 5.67861192082938828207e+02, 5.33720970737905190617e+02, 4.99121798321842561563e+02, 4.63960447085584348770e+02, 4.28130117796620595527e+02, 3.91535782805478618229e+02, 3.54116292074849241089e+02, 3.15873250969955051914e+02, 2.76908313655558174560e+02, -5.46391582782434034016e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -5.47611926234161015600e+05, 7.86438088769179285009e+03, 7.43261841767748865095e+03, 6.66215872929299075622e+03, 5.91605860912633033877e+03, 5.19905995355458708218e+03, 4.51587465346762564877e+03, 3.87099154645709404576e+03, 3.26853928811227979168e+03, 2.71218602302040835639e+03, 2.20506690823007056679e+03, 5.81428606071315471127e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.86438088769179103110e+03, -5.47769355081307352521e+05, 7.36020970690198555531e+03, 6.59975072907888534246e+03, 5.86291622023888066906e+03, 5.15438900366641155415e+03, 4.47884793222498319665e+03, 3.84077160985722730402e+03, 3.24429700108425322469e+03, 2.69311577539275185700e+03, 2.19039933363142336020e+03, 5.78139414527427561552e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.43261841767748956045e+03, 7.36020970690198919328e+03, -4.85903480043058298179e+04, 6.25874680192096911924e+03, 5.57211514467351753410e+03, 4.90961915158353713196e+03, 4.27571646266228981403e+03, 3.67479402412648323661e+03, 3.11100642444843470003e+03, 2.58815369314071585904e+03, 2.10958886644440826785e+03, 5.59969587172562455635e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 6.66215872929299166572e+03, 6.59975072907889079943e+03, 6.25874680192096911924e+03, -4.99087242843043350149e+04, 5.04873624599964477966e+03, 4.46790921933189838455e+03, 3.90824988086868461323e+03, 3.37385680555909630129e+03, 2.86881689274608606866e+03, 2.39704498857493308606e+03, 1.96215950308392507395e+03, 5.26647403713833341499e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.91605860912632851978e+03, 5.86291622023888066906e+03, 5.57211514467351662461e+03, 5.04873624599964568915e+03, -5.10210381228585392819e+04, 4.03190080851404491113e+03, 3.54398734872918021210e+03, 3.07437510607666627038e+03, 2.62691262138420643169e+03, 2.20549275756738006748e+03, 1.81388694683640369476e+03, 4.92840405339415383423e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.19905995355458617269e+03, 5.15438900366641064466e+03, 4.90961915158353804145e+03, 4.46790921933189929405e+03, 4.03190080851404445639e+03, -5.19523942771102010738e+04, 3.18384854396810669641e+03, 2.77681075592624938508e+03, 2.38544580297602260543e+03, 2.01345149178420069802e+03, 1.66461215939891690141e+03, 4.58440329577435079500e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 4.51587465346762655827e+03, 4.47884793222498046816e+03, 4.27571646266228981403e+03, 3.90824988086868370374e+03, 3.54398734872917930261e+03, 3.18384854396810669641e+03, -5.27263888034254196100e+04, 2.48189846225782866895e+03, 2.14473854525776505398e+03, 1.82097330528152315310e+03, 1.51422525988428833443e+03, 4.23335374331089042244e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.87099154645709450051e+03, 3.84077160985722730402e+03, 3.67479402412648187237e+03, 3.37385680555909766554e+03, 3.07437510607666808937e+03, 2.77681075592624893034e+03, 2.48189846225782775946e+03, -5.33647373833036108408e+04, 1.90541536251363436349e+03, 1.62830826957043768743e+03, 1.36273932349947767761e+03, 3.87425745914120057023e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.26853928811227706319e+03, 3.24429700108425504368e+03, 3.11100642444843242629e+03, 2.86881689274608743290e+03, 2.62691262138420916017e+03, 2.38544580297602351493e+03, 2.14473854525776505398e+03, 1.90541536251363345400e+03, -5.38869725195213322877e+04, 1.43604000962784198236e+03, 1.21039189742737403321e+03, 3.50645910676757182500e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.71218602302040562790e+03, 2.69311577539275504023e+03, 2.58815369314071585904e+03, 2.39704498857493445030e+03, 2.20549275756738052223e+03, 2.01345149178420251701e+03, 1.82097330528152338047e+03, 1.62830826957043746006e+03, 1.43604000962784198236e+03, -5.43102952673313702689e+04, 1.05777723654634360173e+03, 3.12993579320699268465e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.20506690823007238578e+03, 2.19039933363142336020e+03, 2.10958886644440781311e+03, 1.96215950308392416446e+03, 1.81388694683640437688e+03, 1.66461215939891803828e+03, 1.51422525988428810706e+03, 1.36273932349947835974e+03, 1.21039189742737403321e+03, 1.05777723654634382910e+03, -5.46495438586747914087e+04, 2.74567077248303576198e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.81428606071315357440e+02, 5.78139414527428016299e+02, 5.59969587172562455635e+02, 5.26647403713832886751e+02, 4.92840405339415497110e+02, 4.58440329577435250030e+02, 4.23335374331088985400e+02, 3.87425745914120000180e+02, 3.50645910676757182500e+02, 3.12993579320699268465e+02, 2.74567077248303689885e+02, -5.46453316139171329269e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, -5.47367190305052092299e+05, 8.10868274788123380858e+03, 8.02914846116442276980e+03, 7.94978993757372791151e+03, 7.87061122940316454333e+03, 7.79161585685228510556e+03, 7.71280785761067363637e+03, 7.63419223866342144902e+03, 7.20633761323642102070e+03, 6.44457003777054069360e+03, 5.70945413298364383081e+03, 5.00561663498313555465e+03, 4.33751330254247659468e+03, 3.70927641554939509660e+03, 3.12460877591283997390e+03, 2.58670872010630500881e+03, 2.09821866090955472828e+03, 5.49926290087540564855e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 8.10868274788124017505e+03, -5.47525513863546075299e+05, 7.95158037609457369399e+03, 7.87328147880653068569e+03, 7.79515648373533895210e+03, 7.71720891007988757337e+03, 7.63944230596193301608e+03, 7.56186118886970962194e+03, 7.13954946291362284683e+03, 6.38735401174119033385e+03, 5.66103718606536222069e+03, 4.96518337500414600072e+03, 4.30422997425495941570e+03, 3.68231102046278419948e+03, 3.10314731496486683682e+03, 2.56996925853991479016e+03, 2.08546247725878401980e+03, 5.47149584598467640717e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 8.02914846116442731727e+03, 7.95158037609457278450e+03, -5.47681405893636401743e+05, 7.79692802632801794971e+03, 7.71985132214465738798e+03, 7.64294563701396236866e+03, 7.56621549433648215199e+03, 7.48966443382506440685e+03, 7.07287091720456828625e+03, 6.33021047799379903154e+03, 5.61266589061873492028e+03, 4.92477578220440045698e+03, 4.27095821164532480907e+03, 3.65534751011217485939e+03, 3.08168150413196417503e+03, 2.55322217249977211395e+03, 2.07269725757487276496e+03, 5.44368835223784117261e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.94978993757373791595e+03, 7.87328147880653796165e+03, 7.79692802632802249718e+03, -5.47834804019087110646e+05, 7.64469827729502958391e+03, 7.56883003424105299928e+03, 7.49313044183950933075e+03, 7.41760450343687807617e+03, 7.00630401274882569851e+03, 6.27314146429503853142e+03, 5.56434080101210656721e+03, 4.88439440276956156595e+03, 4.23769806485837125365e+03, 3.62838617149361107295e+03, 3.06021186777362026987e+03, 2.53646724769449247106e+03, 2.05992265984469077011e+03, 5.41584048295544221219e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.87061122940317000030e+03, 7.79515648373534440907e+03, 7.71985132214465647849e+03, 7.64469827729502867442e+03, -5.47985833272186806425e+05, 7.49486468209623217263e+03, 7.42019119223690631770e+03, 7.34568446349916666804e+03, 6.93985131939129587408e+03, 6.21614855028320926067e+03, 5.51606299544765988685e+03, 4.84403981403722718824e+03, 4.20445034343929546594e+03, 3.60142682637966072434e+03, 3.03873772895847287145e+03, 2.51970453003467719100e+03, 2.04713859921671337361e+03, 5.38795050448029087420e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.79161585685228419607e+03, 7.71720891007989030186e+03, 7.64294563701396873512e+03, 7.56883003424105572776e+03, 7.49486468209623762959e+03, -5.48134493779201642610e+05, 7.34739979491483609308e+03, 7.27390733897401241848e+03, 6.87351585672654800874e+03, 6.15923328115828553564e+03, 5.46783400991691996751e+03, 4.80371207834682081739e+03, 4.17121485723380919808e+03, 3.57446952090956710890e+03, 3.01725912652987926776e+03, 2.50293380751713539212e+03, 2.03434485760345978633e+03, 5.36001787463909181497e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.71280785761067272688e+03, 7.63944230596192937810e+03, 7.56621549433647123806e+03, 7.49313044183949932631e+03, 7.42019119223690631770e+03, 7.34739979491482972662e+03, -5.48280785618549911305e+05, 7.20227715860728039843e+03, 6.80730018175561144744e+03, 6.10239771336037574656e+03, 5.41965491245808698295e+03, 4.76341274069281462289e+03, 4.13799191979351871851e+03, 3.54751431440520127580e+03, 2.99577611042928083407e+03, 2.48615463318015144978e+03, 2.02154110229090042594e+03, 5.33204085003492082251e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.63419223866341872053e+03, 7.56186118886970416497e+03, 7.48966443382506713533e+03, 7.41760450343687080021e+03, 7.34568446349916666804e+03, 7.27390733897400514252e+03, 7.20227715860727494146e+03, -5.48424771391566260718e+05, 6.74120733336830107874e+03, 6.04564340933380481147e+03, 5.37152627776746521704e+03, 4.72314187679088354344e+03, 4.10478184082852112624e+03, 3.52056150704525998663e+03, 2.97428872783304814220e+03, 2.46936729019571839672e+03, 2.00872712077997903179e+03, 5.30401951346781743268e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.20633761323642465868e+03, 7.13954946291362466582e+03, 7.07287091720456646726e+03, 7.00630401274882660800e+03, 6.93985131939129678358e+03, 6.87351585672654709924e+03, 6.80730018175561235694e+03, 6.74120733336830380722e+03, -4.91749596141346919467e+04, 5.73542466418980711751e+03, 5.10802581506799378985e+03, 4.50233113144065191591e+03, 3.92243254717344052551e+03, 3.37237392242359874217e+03, 2.85599901605684772221e+03, 2.37683596650746358137e+03, 1.93800974854597006924e+03, 5.14884229482271621237e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 6.44457003777053705562e+03, 6.38735401174119124335e+03, 6.33021047799379903154e+03, 6.27314146429502943647e+03, 6.21614855028321107966e+03, 6.15923328115829281160e+03, 6.10239771336037483707e+03, 6.04564340933380663046e+03, 5.73542466418980347953e+03, -5.03771826113240313134e+04, 4.63330072335084969382e+03, 4.10331995721849125403e+03, 3.59200296760885203184e+03, 3.10314120881361486681e+03, 2.64054333322439697440e+03, 2.20788079554055411791e+03, 1.80856784844161097681e+03, 4.86288515290569648641e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.70945413298364655930e+03, 5.66103718606536222069e+03, 5.61266589061873673927e+03, 5.56434080101211293368e+03, 5.51606299544766352483e+03, 5.46783400991691996751e+03, 5.41965491245809334941e+03, 5.37152627776746794552e+03, 5.10802581506799560884e+03, 4.63330072335085333179e+03, -5.13894524311109926202e+04, 3.70857756306773762844e+03, 3.26353469872277764807e+03, 2.83430022253691186052e+03, 2.42447591838425705646e+03, 2.03773880185767984585e+03, 1.67767925071009130988e+03, 4.57049414318134552104e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.00561663498313100717e+03, 4.96518337500413963426e+03, 4.92477578220439863799e+03, 4.88439440276956065645e+03, 4.84403981403722264076e+03, 4.80371207834682263638e+03, 4.76341274069281189441e+03, 4.72314187679088263394e+03, 4.50233113144065009692e+03, 4.10331995721849216352e+03, 3.70857756306773671895e+03, -5.22361453868800963392e+04, 2.93772090447202253927e+03, 2.56611889242155757529e+03, 2.20778546227891365561e+03, 1.86622898768148024828e+03, 1.54507490669346384493e+03, 4.27029757053191872274e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 4.33751330254247750418e+03, 4.30422997425496214419e+03, 4.27095821164532662806e+03, 4.23769806485837580112e+03, 4.20445034343930092291e+03, 4.17121485723380919808e+03, 4.13799191979351871851e+03, 4.10478184082852112624e+03, 3.92243254717344052551e+03, 3.59200296760884884861e+03, 3.26353469872277673858e+03, 2.93772090447202344876e+03, -5.29398816876896744361e+04, 2.29914274082840756819e+03, 1.99063454699851035912e+03, 1.69327127184087316891e+03, 1.41053759926483166964e+03, 3.96089536602082830541e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.70927641554939464186e+03, 3.68231102046278601847e+03, 3.65534751011217440464e+03, 3.62838617149361152769e+03, 3.60142682637965890535e+03, 3.57446952090956665415e+03, 3.54751431440520036631e+03, 3.52056150704526180562e+03, 3.37237392242359828742e+03, 3.10314120881361577631e+03, 2.83430022253691367951e+03, 2.56611889242155893953e+03, 2.29914274082840802294e+03, -5.35211813283306983067e+04, 1.77349802368768609995e+03, 1.51899170281304577657e+03, 1.27397970231288263676e+03, 3.64102497590959899298e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.12460877591283906440e+03, 3.10314731496487183904e+03, 3.08168150413196281079e+03, 3.06021186777362254361e+03, 3.03873772895847423570e+03, 3.01725912652987835827e+03, 2.99577611042928174356e+03, 2.97428872783304905170e+03, 2.85599901605684772221e+03, 2.64054333322439742915e+03, 2.42447591838425978494e+03, 2.20778546227891320086e+03, 1.99063454699851035912e+03, 1.77349802368768700944e+03, -5.39982084779483484454e+04, 1.34386153914251917740e+03, 1.13554752591786609628e+03, 3.30979131329748952339e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.58670872010630637305e+03, 2.56996925853991433542e+03, 2.55322217249977256870e+03, 2.53646724769449247106e+03, 2.51970453003467764574e+03, 2.50293380751713448262e+03, 2.48615463318014963079e+03, 2.46936729019572112520e+03, 2.37683596650746358137e+03, 2.20788079554055548215e+03, 2.03773880185767984585e+03, 1.86622898768148093041e+03, 1.69327127184087316891e+03, 1.51899170281304486707e+03, 1.34386153914251917740e+03, -5.43866813056864775717e+04, 9.95755513905473208069e+02, 2.96696175691610505964e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.09821866090955427353e+03, 2.08546247725878356505e+03, 2.07269725757487321971e+03, 2.05992265984469213436e+03, 2.04713859921671519260e+03, 2.03434485760345978633e+03, 2.02154110229090065332e+03, 2.00872712077997925917e+03, 1.93800974854597029662e+03, 1.80856784844160915782e+03, 1.67767925071009290150e+03, 1.54507490669346407230e+03, 1.41053759926483098752e+03, 1.27397970231288331888e+03, 1.13554752591786609628e+03, 9.95755513905473321756e+02, -5.46999024820304548484e+04, 2.61334362917566920714e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.49926290087540678542e+02, 5.47149584598468550212e+02, 5.44368835223784458321e+02, 5.41584048295544334906e+02, 5.38795050448029087420e+02, 5.36001787463909636244e+02, 5.33204085003491741190e+02, 5.30401951346781970642e+02, 5.14884229482271507550e+02, 4.86288515290569364424e+02, 4.57049414318134495261e+02, 4.27029757053192156491e+02, 3.96089536602082887384e+02, 3.64102497590959671925e+02, 3.30979131329748781809e+02, 2.96696175691610619651e+02, 2.61334362917566977558e+02, -5.46801032648953241733e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -5.47484865053650806658e+05, 7.99116472674494707462e+03, 7.91183184743937454186e+03, 7.83267567784235234285e+03, 7.75370141504996990989e+03, 7.32363003698008378706e+03, 6.55703413541512873053e+03, 5.81595062387043617491e+03, 5.10507558971963590011e+03, 4.42900203179824620747e+03, 3.79204804263034702672e+03, 3.19813211256479462463e+03, 2.65068988893661435213e+03, 2.15261104991540514675e+03, 5.65901925714710273496e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.99116472674493888917e+03, -5.47642804879928473383e+05, 7.83446281870153507043e+03, 7.75636705226890717313e+03, 7.67844621786420248100e+03, 7.25402845523940504791e+03, 6.49722410139818202879e+03, 5.76517604943959668162e+03, 5.06253114458954405563e+03, 4.39385597091433464811e+03, 3.76346465651695189081e+03, 3.17528937204977501096e+03, 2.63279372526806719179e+03, 2.13890723130192691315e+03, 5.62871619259282283565e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.91183184743937727035e+03, 7.83446281870153507043e+03, -5.47798291595670976676e+05, 7.68021392465661210736e+03, 7.60334150411967129912e+03, 7.18455124952473033773e+03, 6.43749810473138222733e+03, 5.71445596055043188244e+03, 5.02001852155573214986e+03, 4.35872645278653726564e+03, 3.73488699515589132716e+03, 3.15244527339582737113e+03, 2.61489212861387341036e+03, 2.12519581869024523257e+03, 5.59837595203494629459e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.83267567784234688588e+03, 7.75636705226890171616e+03, 7.68021392465661301685e+03, -5.47951325399421621114e+05, 7.52839147479157054477e+03, 7.11520113944898639602e+03, 6.37785834733656429307e+03, 5.66379155418172467762e+03, 4.97753937870552908862e+03, 4.32361388900611109420e+03, 3.70631520174417028102e+03, 3.12959993722847002573e+03, 2.59698471055242634975e+03, 2.11147652687078061717e+03, 5.56799691671575601504e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.75370141504996809090e+03, 7.67844621786420339049e+03, 7.60334150411967038963e+03, 7.52839147479156872578e+03, -5.48101968998002237640e+05, 7.04598133958848666225e+03, 6.31830654882801536587e+03, 5.61318354432147225452e+03, 4.93509391391912959079e+03, 4.28851869518066996534e+03, 3.67774966705279757662e+03, 3.10675348706438717272e+03, 2.57907181747659569737e+03, 2.09774919464434651672e+03, 5.53757930401232329132e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.32363003698008378706e+03, 7.25402845523940413841e+03, 7.18455124952472760924e+03, 7.11520113944898184855e+03, 7.04598133958848757175e+03, -4.88872071088380180299e+04, 5.99285969482656219043e+03, 5.33618664855903080024e+03, 4.70244576806670374935e+03, 4.09590781238622457749e+03, 3.52078322947026572365e+03, 2.98106571440227617131e+03, 2.48041358093200778967e+03, 2.02206001299850390751e+03, 5.36935799430273277721e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 6.55703413541512145457e+03, 6.49722410139818384778e+03, 6.43749810473138768430e+03, 6.37785834733656611206e+03, 6.31830654882801900385e+03, 5.99285969482655855245e+03, -5.01468707969301249250e+04, 4.83742267498926594271e+03, 4.28235066003659812850e+03, 3.74720101997861138443e+03, 3.23591424564734779779e+03, 2.75243312891446748836e+03, 2.30054558514522295809e+03, 1.88376267593367947484e+03, 5.06016762946313747307e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.81595062387043708441e+03, 5.76517604943959668162e+03, 5.71445596055043188244e+03, 5.66379155418172558711e+03, 5.61318354432147225452e+03, 5.33618664855902898125e+03, 4.83742267498926594271e+03, -5.12085421483544341754e+04, 3.86724985777685287758e+03, 3.40108447822836615160e+03, 2.95197504887495642834e+03, 2.52364223984390082478e+03, 2.11986628459151233983e+03, 1.74432336172687041653e+03, 4.74534285587169222254e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.10507558971963226213e+03, 5.06253114458953859867e+03, 5.02001852155573487835e+03, 4.97753937870553181710e+03, 4.93509391391912868130e+03, 4.70244576806670556834e+03, 4.28235066003659903799e+03, 3.86724985777685196808e+03, -5.20969775109843249083e+04, 3.05836271353603024181e+03, 2.66932883932687309425e+03, 2.29476202448702633774e+03, 1.93826117312778251289e+03, 1.60352697777135745127e+03, 4.42365353839698343563e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 4.42900203179824620747e+03, 4.39385597091433828609e+03, 4.35872645278653453715e+03, 4.32361388900611200370e+03, 4.28851869518066905584e+03, 4.09590781238622548699e+03, 3.74720101997861183918e+03, 3.40108447822836615160e+03, 3.05836271353603069656e+03, -5.28352997390448945225e+04, 2.38861336964483598422e+03, 2.06603278884614064737e+03, 1.75571453897966330260e+03, 1.46120854092742752073e+03, 4.09383665054075834178e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.79204804263034566247e+03, 3.76346465651695052657e+03, 3.73488699515589223665e+03, 3.70631520174416891678e+03, 3.67774966705279575763e+03, 3.52078322947026526890e+03, 3.23591424564734961677e+03, 2.95197504887495688308e+03, 2.66932883932687354900e+03, 2.38861336964483598422e+03, -5.34446385369881827501e+04, 1.83800178967489637216e+03, 1.57241239557735525523e+03, 1.31732908504183274090e+03, 3.75475730446860723077e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.19813211256479644362e+03, 3.17528937204977955844e+03, 3.15244527339583100911e+03, 3.12959993722847138997e+03, 3.10675348706438944646e+03, 2.98106571440227344283e+03, 2.75243312891446885260e+03, 2.52364223984390309852e+03, 2.29476202448702633774e+03, 2.06603278884614064737e+03, 1.83800178967489705428e+03, -5.39438501746928232023e+04, 1.38887997295011427923e+03, 1.17207871666275900679e+03, 3.40563531950736830822e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.65068988893661435213e+03, 2.63279372526806719179e+03, 2.61489212861387204612e+03, 2.59698471055242453076e+03, 2.57907181747659797111e+03, 2.48041358093200642543e+03, 2.30054558514522523183e+03, 2.11986628459151188508e+03, 1.93826117312778296764e+03, 1.75571453897966375735e+03, 1.57241239557735434573e+03, 1.38887997295011427923e+03, -5.43493979566905909451e+04, 1.02600990431397895009e+03, 3.04633783790223731103e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.15261104991540696574e+03, 2.13890723130192782264e+03, 2.12519581869024568732e+03, 2.11147652687078061717e+03, 2.09774919464434742622e+03, 2.02206001299850458963e+03, 1.88376267593367811060e+03, 1.74432336172686996179e+03, 1.60352697777135745127e+03, 1.46120854092742752073e+03, 1.31732908504183319565e+03, 1.17207871666275877942e+03, 1.02600990431397917746e+03, -5.46753518916135944892e+04, 2.67775511256578624852e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.65901925714710273496e+02, 5.62871619259282283565e+02, 5.59837595203494743146e+02, 5.56799691671575487817e+02, 5.53757930401232556505e+02, 5.36935799430273277721e+02, 5.06016762946313633620e+02, 4.74534285587169165410e+02, 4.42365353839698684624e+02, 4.09383665054075891021e+02, 3.75475730446860609391e+02, 3.40563531950736773979e+02, 3.04633783790223787946e+02, 2.67775511256578795383e+02, -5.46632041110028058029e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -5.47484865053650806658e+05, 7.99116472674494707462e+03, 7.91183184743937454186e+03, 7.83267567784235234285e+03, 7.75370141504996990989e+03, 7.32363003698008378706e+03, 6.55703413541512873053e+03, 5.81595062387043617491e+03, 5.10507558971963590011e+03, 4.42900203179824620747e+03, 3.79204804263034702672e+03, 3.19813211256479462463e+03, 2.65068988893661435213e+03, 2.15261104991540514675e+03, 5.65901925714710273496e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.99116472674493888917e+03, -5.47642804879928473383e+05, 7.83446281870153507043e+03, 7.75636705226890717313e+03, 7.67844621786420248100e+03, 7.25402845523940504791e+03, 6.49722410139818202879e+03, 5.76517604943959668162e+03, 5.06253114458954405563e+03, 4.39385597091433464811e+03, 3.76346465651695189081e+03, 3.17528937204977501096e+03, 2.63279372526806719179e+03, 2.13890723130192691315e+03, 5.62871619259282283565e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.91183184743937727035e+03, 7.83446281870153507043e+03, -5.47798291595670976676e+05, 7.68021392465661210736e+03, 7.60334150411967129912e+03, 7.18455124952473033773e+03, 6.43749810473138222733e+03, 5.71445596055043188244e+03, 5.02001852155573214986e+03, 4.35872645278653726564e+03, 3.73488699515589132716e+03, 3.15244527339582737113e+03, 2.61489212861387341036e+03, 2.12519581869024523257e+03, 5.59837595203494629459e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.83267567784234688588e+03, 7.75636705226890171616e+03, 7.68021392465661301685e+03, -5.47951325399421621114e+05, 7.52839147479157054477e+03, 7.11520113944898639602e+03, 6.37785834733656429307e+03, 5.66379155418172467762e+03, 4.97753937870552908862e+03, 4.32361388900611109420e+03, 3.70631520174417028102e+03, 3.12959993722847002573e+03, 2.59698471055242634975e+03, 2.11147652687078061717e+03, 5.56799691671575601504e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.75370141504996809090e+03, 7.67844621786420339049e+03, 7.60334150411967038963e+03, 7.52839147479156872578e+03, -5.48101968998002237640e+05, 7.04598133958848666225e+03, 6.31830654882801536587e+03, 5.61318354432147225452e+03, 4.93509391391912959079e+03, 4.28851869518066996534e+03, 3.67774966705279757662e+03, 3.10675348706438717272e+03, 2.57907181747659569737e+03, 2.09774919464434651672e+03, 5.53757930401232329132e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.32363003698008378706e+03, 7.25402845523940413841e+03, 7.18455124952472760924e+03, 7.11520113944898184855e+03, 7.04598133958848757175e+03, -4.88872071088380180299e+04, 5.99285969482656219043e+03, 5.33618664855903080024e+03, 4.70244576806670374935e+03, 4.09590781238622457749e+03, 3.52078322947026572365e+03, 2.98106571440227617131e+03, 2.48041358093200778967e+03, 2.02206001299850390751e+03, 5.36935799430273277721e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 6.55703413541512145457e+03, 6.49722410139818384778e+03, 6.43749810473138768430e+03, 6.37785834733656611206e+03, 6.31830654882801900385e+03, 5.99285969482655855245e+03, -5.01468707969301249250e+04, 4.83742267498926594271e+03, 4.28235066003659812850e+03, 3.74720101997861138443e+03, 3.23591424564734779779e+03, 2.75243312891446748836e+03, 2.30054558514522295809e+03, 1.88376267593367947484e+03, 5.06016762946313747307e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.81595062387043708441e+03, 5.76517604943959668162e+03, 5.71445596055043188244e+03, 5.66379155418172558711e+03, 5.61318354432147225452e+03, 5.33618664855902898125e+03, 4.83742267498926594271e+03, -5.12085421483544341754e+04, 3.86724985777685287758e+03, 3.40108447822836615160e+03, 2.95197504887495642834e+03, 2.52364223984390082478e+03, 2.11986628459151233983e+03, 1.74432336172687041653e+03, 4.74534285587169222254e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.10507558971963226213e+03, 5.06253114458953859867e+03, 5.02001852155573487835e+03, 4.97753937870553181710e+03, 4.93509391391912868130e+03, 4.70244576806670556834e+03, 4.28235066003659903799e+03, 3.86724985777685196808e+03, -5.20969775109843249083e+04, 3.05836271353603024181e+03, 2.66932883932687309425e+03, 2.29476202448702633774e+03, 1.93826117312778251289e+03, 1.60352697777135745127e+03, 4.42365353839698343563e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 4.42900203179824620747e+03, 4.39385597091433828609e+03, 4.35872645278653453715e+03, 4.32361388900611200370e+03, 4.28851869518066905584e+03, 4.09590781238622548699e+03, 3.74720101997861183918e+03, 3.40108447822836615160e+03, 3.05836271353603069656e+03, -5.28352997390448945225e+04, 2.38861336964483598422e+03, 2.06603278884614064737e+03, 1.75571453897966330260e+03, 1.46120854092742752073e+03, 4.09383665054075834178e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.79204804263034566247e+03, 3.76346465651695052657e+03, 3.73488699515589223665e+03, 3.70631520174416891678e+03, 3.67774966705279575763e+03, 3.52078322947026526890e+03, 3.23591424564734961677e+03, 2.95197504887495688308e+03, 2.66932883932687354900e+03, 2.38861336964483598422e+03, -5.34446385369881827501e+04, 1.83800178967489637216e+03, 1.57241239557735525523e+03, 1.31732908504183274090e+03, 3.75475730446860723077e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.19813211256479644362e+03, 3.17528937204977955844e+03, 3.15244527339583100911e+03, 3.12959993722847138997e+03, 3.10675348706438944646e+03, 2.98106571440227344283e+03, 2.75243312891446885260e+03, 2.52364223984390309852e+03, 2.29476202448702633774e+03, 2.06603278884614064737e+03, 1.83800178967489705428e+03, -5.39438501746928232023e+04, 1.38887997295011427923e+03, 1.17207871666275900679e+03, 3.40563531950736830822e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.65068988893661435213e+03, 2.63279372526806719179e+03, 2.61489212861387204612e+03, 2.59698471055242453076e+03, 2.57907181747659797111e+03, 2.48041358093200642543e+03, 2.30054558514522523183e+03, 2.11986628459151188508e+03, 1.93826117312778296764e+03, 1.75571453897966375735e+03, 1.57241239557735434573e+03, 1.38887997295011427923e+03, -5.43493979566905909451e+04, 1.02600990431397895009e+03, 3.04633783790223731103e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.15261104991540696574e+03, 2.13890723130192782264e+03, 2.12519581869024568732e+03, 2.11147652687078061717e+03, 2.09774919464434742622e+03, 2.02206001299850458963e+03, 1.88376267593367811060e+03, 1.74432336172686996179e+03, 1.60352697777135745127e+03, 1.46120854092742752073e+03, 1.31732908504183319565e+03, 1.17207871666275877942e+03, 1.02600990431397917746e+03, -5.46753518916135944892e+04, 2.67775511256578624852e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.65901925714710273496e+02, 5.62871619259282283565e+02, 5.59837595203494743146e+02, 5.56799691671575487817e+02, 5.53757930401232556505e+02, 5.36935799430273277721e+02, 5.06016762946313633620e+02, 4.74534285587169165410e+02, 4.42365353839698684624e+02, 4.09383665054075891021e+02, 3.75475730446860609391e+02, 3.40563531950736773979e+02, 3.04633783790223787946e+02, 2.67775511256578795383e+02, -5.46632041110028058029e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -5.47405392056703800336e+05, 8.07052396416556621261e+03, 7.99104945185613814829e+03, 7.91175150554433548677e+03, 7.83263369657716884831e+03, 7.75369963289063434786e+03, 7.67495390614631196513e+03, 7.24630395334498189186e+03, 6.48282369791960718430e+03, 5.74561688511919965094e+03, 5.03933644440527768893e+03, 4.36848577896519509522e+03, 3.73726014092637433350e+03, 3.14943518483336220015e+03, 2.60828869153484993149e+03, 2.11654543173312640647e+03, 5.55296177781289316044e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 8.07052396416556985059e+03, -5.47563628967738477513e+05, 7.91354086826375714736e+03, 7.83530271777137386380e+03, 7.75723827562126916746e+03, 7.67935212444154331024e+03, 7.60164787739086477814e+03, 7.17857830263573123375e+03, 6.42474374655305473425e+03, 5.69641598685740154906e+03, 4.99820151873704526224e+03, 4.33458376113977192290e+03, 3.70975766028457519496e+03, 3.12751535787624925433e+03, 2.59116574805085110711e+03, 2.10347533384765756637e+03, 5.52435522274116237895e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.99104945185614451475e+03, 7.91354086826375623787e+03, -5.47719343755536596291e+05, 7.75900857404335602041e+03, 7.68199302689635896968e+03, 7.60514885175315248489e+03, 7.52848112468011458986e+03, 7.11096660718116436328e+03, 6.36674038462803218863e+03, 5.64726312777805287624e+03, 4.95709441376942140778e+03, 4.30069475194045207900e+03, 3.68225854244734136955e+03, 3.10559270872567594779e+03, 2.57403579641052920124e+03, 2.09039653166742937174e+03, 5.49571005798256123853e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.91175150554433730576e+03, 7.83530271777136204037e+03, 7.75900857404334510647e+03, -5.47872661488745245151e+05, 7.60690058842076814472e+03, 7.53109391569117360632e+03, 7.45545677032588719158e+03, 7.04347149017647006985e+03, 6.30881523949358415848e+03, 5.59815942835183523130e+03, 4.91601574389781490027e+03, 4.26681959302411632962e+03, 3.65476263664792531927e+03, 3.08366658358252516337e+03, 2.55689890167452404057e+03, 2.07730895587454324414e+03, 5.46702459059229681770e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.83263369657716975780e+03, 7.75723827562126643897e+03, 7.68199302689635987917e+03, 7.60690058842076450674e+03, -5.48023582349477685057e+05, 7.45718941524396086606e+03, 7.38257788838687702082e+03, 6.97609601756123811356e+03, 6.25096989779565774370e+03, 5.54910646128861117177e+03, 4.87496560365351797373e+03, 4.23295812213166391302e+03, 3.62727001288047904382e+03, 3.06173704138497396343e+03, 2.53975486847514684996e+03, 2.06421240187547709866e+03, 5.43829831376365746110e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.75369963289063434786e+03, 7.67935212444153421529e+03, 7.60514885175314702792e+03, 7.53109391569116905885e+03, 7.45718941524396268505e+03, -5.48172106461117626168e+05, 7.30984856392307483475e+03, 6.90884279949452229630e+03, 6.19320646351315554057e+03, 5.50010533674275393423e+03, 4.83394557495525350532e+03, 4.19911068481064830848e+03, 3.59978075782859332321e+03, 3.03980415512335457606e+03, 2.52260326893171577467e+03, 2.05110655243384644564e+03, 5.40952952466538249610e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.67495390614631378412e+03, 7.60164787739085932117e+03, 7.52848112468011458986e+03, 7.45545677032588901056e+03, 7.38257788838687611133e+03, 7.30984856392307119677e+03, -5.48318296447197557427e+05, 6.84171494078536215966e+03, 6.13552655804144433205e+03, 5.45115668163719328732e+03, 4.79295577930705894687e+03, 4.16527763044812581938e+03, 3.57229520560118498906e+03, 3.01786800055606181559e+03, 2.50544440987786902042e+03, 2.03799121424383224621e+03, 5.38071835640144854551e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.24630395334497825388e+03, 7.17857830263573214324e+03, 7.11096660718115890631e+03, 7.04347149017646552238e+03, 6.97609601756123265659e+03, 6.90884279949452047731e+03, 6.84171494078535943117e+03, -4.90800849071450429619e+04, 5.82027035513895043550e+03, 5.18319337132331202156e+03, 4.56823234743062766938e+03, 3.97953787941413565932e+03, 3.42120823077220211417e+03, 2.89713590943907774999e+03, 2.41089116140104169972e+03, 1.96563374999275015398e+03, 5.22124258806200941763e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 6.48282369791960172734e+03, 6.42474374655305473425e+03, 6.36674038462802491267e+03, 6.30881523949358324899e+03, 6.25096989779565774370e+03, 6.19320646351315372158e+03, 6.13552655804144342255e+03, 5.82027035513894497853e+03, -5.03013057891334756278e+04, 4.70052246716225272394e+03, 4.16225488711152866017e+03, 3.64307180907963356731e+03, 3.14681333983070544491e+03, 2.67733172765808649274e+03, 2.23833608370780120822e+03, 1.83327177179378168148e+03, 4.92763215555496458364e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.74561688511919601297e+03, 5.69641598685740245855e+03, 5.64726312777805378573e+03, 5.59815942835183341231e+03, 5.54910646128861026227e+03, 5.50010533674275575322e+03, 5.45115668163719328732e+03, 5.18319337132330929307e+03, 4.70052246716225363343e+03, -5.13298985026439549983e+04, 3.76078993364991856652e+03, 3.30877824581640470569e+03, 2.87299078334552541492e+03, 2.45706795313820475712e+03, 2.06472013185775767852e+03, 1.69956525962260479901e+03, 4.62785561799000049632e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.03933644440527586994e+03, 4.99820151873704708123e+03, 4.95709441376942322677e+03, 4.91601574389781671925e+03, 4.87496560365352161170e+03, 4.83394557495525714330e+03, 4.79295577930706258485e+03, 4.56823234743062948837e+03, 4.16225488711152956967e+03, 3.76078993364991902126e+03, -5.21903695377970143454e+04, 2.97738701732319213988e+03, 2.60003984358247316777e+03, 2.23635968803367086366e+03, 1.88988417277213920897e+03, 1.56426290045506971182e+03, 4.32058776392372124064e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 4.36848577896519327624e+03, 4.33458376113977101340e+03, 4.30069475194045389799e+03, 4.26681959302411814861e+03, 4.23295812213165936555e+03, 4.19911068481064467051e+03, 4.16527763044812400040e+03, 3.97953787941413202134e+03, 3.64307180907963265781e+03, 3.30877824581640379620e+03, 2.97738701732319259463e+03, -5.29055098400835995562e+04, 2.32853623769891964912e+03, 2.01539494983377949211e+03, 1.71376918198599992138e+03, 1.42716455739190860186e+03, 4.00447329032687207473e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.73726014092637387876e+03, 3.70975766028456973800e+03, 3.68225854244734046006e+03, 3.65476263664792304553e+03, 3.62727001288047904382e+03, 3.59978075782859195897e+03, 3.57229520560118271533e+03, 3.42120823077219984043e+03, 3.14681333983070499016e+03, 2.87299078334552632441e+03, 2.60003984358247225828e+03, 2.32853623769891919437e+03, -5.34960451276766616502e+04, 1.79467217852486760421e+03, 1.53652073600927860753e+03, 1.28819844456018449819e+03, 3.67829115945588341674e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.14943518483336538338e+03, 3.12751535787624516161e+03, 3.10559270872567640254e+03, 3.08366658358252652761e+03, 3.06173704138497760141e+03, 3.03980415512335684980e+03, 3.01786800055606363458e+03, 2.89713590943907547626e+03, 2.67733172765808740223e+03, 2.45706795313820657611e+03, 2.23635968803367086366e+03, 2.01539494983377903736e+03, 1.79467217852486714946e+03, -5.39803718589923082618e+04, 1.35862759182293279991e+03, 1.14752506596371426895e+03, 3.34118348554579540632e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.60828869153484902199e+03, 2.59116574805085110711e+03, 2.57403579641052965599e+03, 2.55689890167452267633e+03, 2.53975486847514594047e+03, 2.52260326893171304619e+03, 2.50544440987787174890e+03, 2.41089116140104124497e+03, 2.23833608370780302721e+03, 2.06472013185775767852e+03, 1.88988417277214034584e+03, 1.71376918198599992138e+03, 1.53652073600927815278e+03, 1.35862759182293302729e+03, -5.43744572226190502988e+04, 1.00567112558808037193e+03, 2.99294978022441341636e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.11654543173312322324e+03, 2.10347533384765756637e+03, 2.09039653166742937174e+03, 2.07730895587454551787e+03, 2.06421240187547755340e+03, 2.05110655243384780988e+03, 2.03799121424383247358e+03, 1.96563374999275151822e+03, 1.83327177179378008987e+03, 1.69956525962260525375e+03, 1.56426290045507016657e+03, 1.42716455739190791974e+03, 1.28819844456018518031e+03, 1.14752506596371426895e+03, 1.00567112558808037193e+03, -5.46918593957312332350e+04, 2.63442391357019744191e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.55296177781289884479e+02, 5.52435522274116351582e+02, 5.49571005798256123853e+02, 5.46702459059229909144e+02, 5.43829831376366200857e+02, 5.40952952466538022236e+02, 5.38071835640145650359e+02, 5.22124258806200828076e+02, 4.92763215555496230991e+02, 4.62785561798999992789e+02, 4.32058776392372351438e+02, 4.00447329032687150629e+02, 3.67829115945588284831e+02, 3.34118348554579483789e+02, 2.99294978022441512167e+02, 2.63442391357019857878e+02, -5.46745782913513176027e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, -5.47367190305052092299e+05, 8.10868274788123380858e+03, 8.02914846116442276980e+03, 7.94978993757372791151e+03, 7.87061122940316454333e+03, 7.79161585685228510556e+03, 7.71280785761067363637e+03, 7.63419223866342144902e+03, 7.20633761323642102070e+03, 6.44457003777054069360e+03, 5.70945413298364383081e+03, 5.00561663498313555465e+03, 4.33751330254247659468e+03, 3.70927641554939509660e+03, 3.12460877591283997390e+03, 2.58670872010630500881e+03, 2.09821866090955472828e+03, 5.49926290087540564855e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 8.10868274788124017505e+03, -5.47525513863546075299e+05, 7.95158037609457369399e+03, 7.87328147880653068569e+03, 7.79515648373533895210e+03, 7.71720891007988757337e+03, 7.63944230596193301608e+03, 7.56186118886970962194e+03, 7.13954946291362284683e+03, 6.38735401174119033385e+03, 5.66103718606536222069e+03, 4.96518337500414600072e+03, 4.30422997425495941570e+03, 3.68231102046278419948e+03, 3.10314731496486683682e+03, 2.56996925853991479016e+03, 2.08546247725878401980e+03, 5.47149584598467640717e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 8.02914846116442731727e+03, 7.95158037609457278450e+03, -5.47681405893636401743e+05, 7.79692802632801794971e+03, 7.71985132214465738798e+03, 7.64294563701396236866e+03, 7.56621549433648215199e+03, 7.48966443382506440685e+03, 7.07287091720456828625e+03, 6.33021047799379903154e+03, 5.61266589061873492028e+03, 4.92477578220440045698e+03, 4.27095821164532480907e+03, 3.65534751011217485939e+03, 3.08168150413196417503e+03, 2.55322217249977211395e+03, 2.07269725757487276496e+03, 5.44368835223784117261e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.94978993757373791595e+03, 7.87328147880653796165e+03, 7.79692802632802249718e+03, -5.47834804019087110646e+05, 7.64469827729502958391e+03, 7.56883003424105299928e+03, 7.49313044183950933075e+03, 7.41760450343687807617e+03, 7.00630401274882569851e+03, 6.27314146429503853142e+03, 5.56434080101210656721e+03, 4.88439440276956156595e+03, 4.23769806485837125365e+03, 3.62838617149361107295e+03, 3.06021186777362026987e+03, 2.53646724769449247106e+03, 2.05992265984469077011e+03, 5.41584048295544221219e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.87061122940317000030e+03, 7.79515648373534440907e+03, 7.71985132214465647849e+03, 7.64469827729502867442e+03, -5.47985833272186806425e+05, 7.49486468209623217263e+03, 7.42019119223690631770e+03, 7.34568446349916666804e+03, 6.93985131939129587408e+03, 6.21614855028320926067e+03, 5.51606299544765988685e+03, 4.84403981403722718824e+03, 4.20445034343929546594e+03, 3.60142682637966072434e+03, 3.03873772895847287145e+03, 2.51970453003467719100e+03, 2.04713859921671337361e+03, 5.38795050448029087420e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.79161585685228419607e+03, 7.71720891007989030186e+03, 7.64294563701396873512e+03, 7.56883003424105572776e+03, 7.49486468209623762959e+03, -5.48134493779201642610e+05, 7.34739979491483609308e+03, 7.27390733897401241848e+03, 6.87351585672654800874e+03, 6.15923328115828553564e+03, 5.46783400991691996751e+03, 4.80371207834682081739e+03, 4.17121485723380919808e+03, 3.57446952090956710890e+03, 3.01725912652987926776e+03, 2.50293380751713539212e+03, 2.03434485760345978633e+03, 5.36001787463909181497e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.71280785761067272688e+03, 7.63944230596192937810e+03, 7.56621549433647123806e+03, 7.49313044183949932631e+03, 7.42019119223690631770e+03, 7.34739979491482972662e+03, -5.48280785618549911305e+05, 7.20227715860728039843e+03, 6.80730018175561144744e+03, 6.10239771336037574656e+03, 5.41965491245808698295e+03, 4.76341274069281462289e+03, 4.13799191979351871851e+03, 3.54751431440520127580e+03, 2.99577611042928083407e+03, 2.48615463318015144978e+03, 2.02154110229090042594e+03, 5.33204085003492082251e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.63419223866341872053e+03, 7.56186118886970416497e+03, 7.48966443382506713533e+03, 7.41760450343687080021e+03, 7.34568446349916666804e+03, 7.27390733897400514252e+03, 7.20227715860727494146e+03, -5.48424771391566260718e+05, 6.74120733336830107874e+03, 6.04564340933380481147e+03, 5.37152627776746521704e+03, 4.72314187679088354344e+03, 4.10478184082852112624e+03, 3.52056150704525998663e+03, 2.97428872783304814220e+03, 2.46936729019571839672e+03, 2.00872712077997903179e+03, 5.30401951346781743268e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.20633761323642465868e+03, 7.13954946291362466582e+03, 7.07287091720456646726e+03, 7.00630401274882660800e+03, 6.93985131939129678358e+03, 6.87351585672654709924e+03, 6.80730018175561235694e+03, 6.74120733336830380722e+03, -4.91749596141346919467e+04, 5.73542466418980711751e+03, 5.10802581506799378985e+03, 4.50233113144065191591e+03, 3.92243254717344052551e+03, 3.37237392242359874217e+03, 2.85599901605684772221e+03, 2.37683596650746358137e+03, 1.93800974854597006924e+03, 5.14884229482271621237e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 6.44457003777053705562e+03, 6.38735401174119124335e+03, 6.33021047799379903154e+03, 6.27314146429502943647e+03, 6.21614855028321107966e+03, 6.15923328115829281160e+03, 6.10239771336037483707e+03, 6.04564340933380663046e+03, 5.73542466418980347953e+03, -5.03771826113240313134e+04, 4.63330072335084969382e+03, 4.10331995721849125403e+03, 3.59200296760885203184e+03, 3.10314120881361486681e+03, 2.64054333322439697440e+03, 2.20788079554055411791e+03, 1.80856784844161097681e+03, 4.86288515290569648641e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.70945413298364655930e+03, 5.66103718606536222069e+03, 5.61266589061873673927e+03, 5.56434080101211293368e+03, 5.51606299544766352483e+03, 5.46783400991691996751e+03, 5.41965491245809334941e+03, 5.37152627776746794552e+03, 5.10802581506799560884e+03, 4.63330072335085333179e+03, -5.13894524311109926202e+04, 3.70857756306773762844e+03, 3.26353469872277764807e+03, 2.83430022253691186052e+03, 2.42447591838425705646e+03, 2.03773880185767984585e+03, 1.67767925071009130988e+03, 4.57049414318134552104e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.00561663498313100717e+03, 4.96518337500413963426e+03, 4.92477578220439863799e+03, 4.88439440276956065645e+03, 4.84403981403722264076e+03, 4.80371207834682263638e+03, 4.76341274069281189441e+03, 4.72314187679088263394e+03, 4.50233113144065009692e+03, 4.10331995721849216352e+03, 3.70857756306773671895e+03, -5.22361453868800963392e+04, 2.93772090447202253927e+03, 2.56611889242155757529e+03, 2.20778546227891365561e+03, 1.86622898768148024828e+03, 1.54507490669346384493e+03, 4.27029757053191872274e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 4.33751330254247750418e+03, 4.30422997425496214419e+03, 4.27095821164532662806e+03, 4.23769806485837580112e+03, 4.20445034343930092291e+03, 4.17121485723380919808e+03, 4.13799191979351871851e+03, 4.10478184082852112624e+03, 3.92243254717344052551e+03, 3.59200296760884884861e+03, 3.26353469872277673858e+03, 2.93772090447202344876e+03, -5.29398816876896744361e+04, 2.29914274082840756819e+03, 1.99063454699851035912e+03, 1.69327127184087316891e+03, 1.41053759926483166964e+03, 3.96089536602082830541e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.70927641554939464186e+03, 3.68231102046278601847e+03, 3.65534751011217440464e+03, 3.62838617149361152769e+03, 3.60142682637965890535e+03, 3.57446952090956665415e+03, 3.54751431440520036631e+03, 3.52056150704526180562e+03, 3.37237392242359828742e+03, 3.10314120881361577631e+03, 2.83430022253691367951e+03, 2.56611889242155893953e+03, 2.29914274082840802294e+03, -5.35211813283306983067e+04, 1.77349802368768609995e+03, 1.51899170281304577657e+03, 1.27397970231288263676e+03, 3.64102497590959899298e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.12460877591283906440e+03, 3.10314731496487183904e+03, 3.08168150413196281079e+03, 3.06021186777362254361e+03, 3.03873772895847423570e+03, 3.01725912652987835827e+03, 2.99577611042928174356e+03, 2.97428872783304905170e+03, 2.85599901605684772221e+03, 2.64054333322439742915e+03, 2.42447591838425978494e+03, 2.20778546227891320086e+03, 1.99063454699851035912e+03, 1.77349802368768700944e+03, -5.39982084779483484454e+04, 1.34386153914251917740e+03, 1.13554752591786609628e+03, 3.30979131329748952339e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.58670872010630637305e+03, 2.56996925853991433542e+03, 2.55322217249977256870e+03, 2.53646724769449247106e+03, 2.51970453003467764574e+03, 2.50293380751713448262e+03, 2.48615463318014963079e+03, 2.46936729019572112520e+03, 2.37683596650746358137e+03, 2.20788079554055548215e+03, 2.03773880185767984585e+03, 1.86622898768148093041e+03, 1.69327127184087316891e+03, 1.51899170281304486707e+03, 1.34386153914251917740e+03, -5.43866813056864775717e+04, 9.95755513905473208069e+02, 2.96696175691610505964e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.09821866090955427353e+03, 2.08546247725878356505e+03, 2.07269725757487321971e+03, 2.05992265984469213436e+03, 2.04713859921671519260e+03, 2.03434485760345978633e+03, 2.02154110229090065332e+03, 2.00872712077997925917e+03, 1.93800974854597029662e+03, 1.80856784844160915782e+03, 1.67767925071009290150e+03, 1.54507490669346407230e+03, 1.41053759926483098752e+03, 1.27397970231288331888e+03, 1.13554752591786609628e+03, 9.95755513905473321756e+02, -5.46999024820304548484e+04, 2.61334362917566920714e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.49926290087540678542e+02, 5.47149584598468550212e+02, 5.44368835223784458321e+02, 5.41584048295544334906e+02, 5.38795050448029087420e+02, 5.36001787463909636244e+02, 5.33204085003491741190e+02, 5.30401951346781970642e+02, 5.14884229482271507550e+02, 4.86288515290569364424e+02, 4.57049414318134495261e+02, 4.27029757053192156491e+02, 3.96089536602082887384e+02, 3.64102497590959671925e+02, 3.30979131329748781809e+02, 2.96696175691610619651e+02, 2.61334362917566977558e+02, -5.46801032648953241733e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -5.47526164735577302054e+05, 7.94994500938638520893e+03, 7.87069386856668916153e+03, 7.79162031491177822318e+03, 7.36092517103722093452e+03, 6.59293147750958814868e+03, 5.85006646823393111845e+03, 5.13704553317622321629e+03, 4.45850229644832415943e+03, 3.81881391362823478630e+03, 3.22196975019482852076e+03, 2.67148356108651159957e+03, 2.17032703957516559967e+03, 5.71131601947799822483e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.94994500938638520893e+03, -5.47683955862981732935e+05, 7.79340575302348406694e+03, 7.71539205694201518781e+03, 7.29038674026430453523e+03, 6.53225533878248370456e+03, 5.79850362342886273836e+03, 5.09379316303439827607e+03, 4.42273099713886676909e+03, 3.78968676842042441422e+03, 3.19866222863171105928e+03, 2.65319786822353216849e+03, 2.15630370449125575760e+03, 5.68015576302493855110e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.87069386856669098051e+03, 7.79340575302349134290e+03, -5.47839266030861064792e+05, 7.63932098602283258515e+03, 7.21997776895188235358e+03, 6.47166755571753856202e+03, 5.74699833833759112167e+03, 5.05057592082295650471e+03, 4.38697808170974440145e+03, 3.76056671510757678334e+03, 3.17535450180471298154e+03, 2.63490720950688091762e+03, 2.14227318499004104524e+03, 5.64895853835173397783e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.79162031491178186116e+03, 7.71539205694201336883e+03, 7.63932098602283076616e+03, -5.47992157952124602161e+05, 7.14970154119711150997e+03, 6.41116991017283908150e+03, 5.69555138215703755122e+03, 5.00739405288291072793e+03, 4.35124400781163603824e+03, 3.73145418045738006185e+03, 3.15204672358934612930e+03, 2.61661195649156616128e+03, 2.12823534030637438264e+03, 5.61772461655468191566e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.36092517103721911553e+03, 7.29038674026430271624e+03, 7.21997776895188235358e+03, 7.14970154119711241947e+03, -4.87892399131360871252e+04, 6.08057224217327893712e+03, 5.41398582329675809888e+03, 4.77073566485912306234e+03, 4.15515396581321510894e+03, 3.57150893664384466319e+03, 3.02384668954304788713e+03, 2.51587149644430746775e+03, 2.05085519611566678577e+03, 5.44505791964665945670e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 6.59293147750959360565e+03, 6.53225533878248734254e+03, 6.47166755571754038101e+03, 6.41116991017284180998e+03, 6.08057224217327711813e+03, -5.00683394997246941784e+04, 4.90707827499725863163e+03, 4.34349235918180784211e+03, 3.80024562333121502888e+03, 3.28133027455661158456e+03, 2.79073603511370765773e+03, 2.33229196791044114434e+03, 1.90954374320242322938e+03, 5.12794371755362476506e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.85006646823393202794e+03, 5.79850362342886455735e+03, 5.74699833833758930268e+03, 5.69555138215703846072e+03, 5.41398582329675900837e+03, 4.90707827499725954112e+03, -5.11467591040761544718e+04, 3.92148125202375285880e+03, 3.44813391972742419966e+03, 2.99225810615567570494e+03, 2.55761610769405388055e+03, 2.14802465479913007584e+03, 1.76719062323094567546e+03, 4.80545881282307732363e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.13704553317622321629e+03, 5.09379316303439918556e+03, 5.05057592082295741420e+03, 5.00739405288291072793e+03, 4.77073566485912306234e+03, 4.34349235918180875160e+03, 3.92148125202375194931e+03, -5.20493747397658080445e+04, 3.09966137145808352216e+03, 2.70468815815585912787e+03, 2.32458331676869192961e+03, 1.96297778743382582434e+03, 1.62359920775712475915e+03, 4.47642161093280435580e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 4.45850229644832052145e+03, 4.42273099713886313111e+03, 4.38697808170973985398e+03, 4.35124400781163512875e+03, 4.15515396581321510894e+03, 3.80024562333121411939e+03, 3.44813391972742374492e+03, 3.09966137145808397690e+03, -5.27994703303255446372e+04, 2.41928999571712165562e+03, 2.09190479833652216257e+03, 1.77715789139565549704e+03, 1.47862257247844104313e+03, 4.13961656043002051319e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.81881391362823205782e+03, 3.78968676842042304997e+03, 3.76056671510757541910e+03, 3.73145418045737778812e+03, 3.57150893664384602744e+03, 3.28133027455661203931e+03, 2.99225810615567525019e+03, 2.70468815815585912787e+03, 2.41928999571712029137e+03, -5.34183736495447519701e+04, 1.86015303328294726271e+03, 1.59077188649036338575e+03, 1.33223872919715768148e+03, 3.79395340698583254380e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.22196975019483170399e+03, 3.19866222863171333302e+03, 3.17535450180471252679e+03, 3.15204672358934976728e+03, 3.02384668954304697763e+03, 2.79073603511370993147e+03, 2.55761610769405524479e+03, 2.32458331676869192961e+03, 2.09190479833652261732e+03, 1.86015303328294794483e+03, -5.39251682902019674657e+04, 1.40436397441822441579e+03, 1.18465319125379869547e+03, 3.43869247298709240113e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.67148356108651341856e+03, 2.65319786822353216849e+03, 2.63490720950687773438e+03, 2.61661195649156934451e+03, 2.51587149644430837725e+03, 2.33229196791044296333e+03, 2.14802465479912916635e+03, 1.96297778743382673383e+03, 1.77715789139565595178e+03, 1.59077188649036338575e+03, 1.40436397441822441579e+03, -5.43365644386596904951e+04, 1.03643193551344393200e+03, 3.07373641288338774302e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.17032703957516650917e+03, 2.15630370449125666710e+03, 2.14227318499004240948e+03, 2.12823534030637301839e+03, 2.05085519611566724052e+03, 1.90954374320242209251e+03, 1.76719062323094658495e+03, 1.62359920775712544128e+03, 1.47862257247844081576e+03, 1.33223872919715836360e+03, 1.18465319125379892284e+03, 1.03643193551344415937e+03, -5.46668882159432760091e+04, 2.70000534843929301587e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.71131601947799481422e+02, 5.68015576302494082483e+02, 5.64895853835173170410e+02, 5.61772461655468532626e+02, 5.44505791964666059357e+02, 5.12794371755362362819e+02, 4.80545881282307675519e+02, 4.47642161093280719797e+02, 4.13961656043001823946e+02, 3.79395340698583140693e+02, 3.43869247298709183269e+02, 3.07373641288338831146e+02, 2.70000534843929415274e+02, -5.46573547257509198971e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -5.47656412897648173384e+05, 7.46695125037321668060e+03, 6.69542752366903459915e+03, 5.94787809931268202490e+03, 5.22905390005366643891e+03, 4.54370144730485026230e+03, 3.89636381023848116456e+03, 3.29123724594865871040e+03, 2.73206610299059684621e+03, 2.22206680692481950246e+03, 5.86489444536067594527e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.46695125037322031858e+03, -4.84894666796007586527e+04, 6.34917084365679602342e+03, 5.65241253059905557166e+03, 4.98018486959325582575e+03, 4.33700945412817236502e+03, 3.72733415644377555509e+03, 3.15536960236311188055e+03, 2.62496560833309877125e+03, 2.13951776340439437263e+03, 5.67861192082938941894e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 6.69542752366903641814e+03, 6.34917084365679511393e+03, -4.98276735313751341891e+04, 5.12071006471619966760e+03, 4.53116014757936318347e+03, 3.96318928649829831556e+03, 3.42095066689918166958e+03, 2.90858141668565986038e+03, 2.43004100806082851705e+03, 1.98898599288002014873e+03, 5.33720970737905531678e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.94787809931268202490e+03, 5.65241253059905648115e+03, 5.12071006471619966760e+03, -5.09571247057288128417e+04, 4.08806821817787295004e+03, 3.59277404938616882646e+03, 3.11619489079494178441e+03, 2.66222388665865219082e+03, 2.23479352824522948140e+03, 1.83770911805141963669e+03, 4.99121798321842447876e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.22905390005366643891e+03, 4.98018486959325673524e+03, 4.53116014757936318347e+03, 4.08806821817787067630e+03, -5.19030340950072786654e+04, 3.22672252450313999361e+03, 2.81356217817545757498e+03, 2.41647750792135866504e+03, 2.03920114598885925261e+03, 1.68554719479218510969e+03, 4.63960447085584291926e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 4.54370144730484935280e+03, 4.33700945412817145552e+03, 3.96318928649829649657e+03, 3.59277404938616700747e+03, 3.22672252450314135785e+03, -5.26891487016145038069e+04, 2.51382054388349024521e+03, 2.17169251214185715071e+03, 1.84333931217453232421e+03, 1.53240931556867508334e+03, 4.28130117796620652371e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.89636381023848116456e+03, 3.72733415644377419085e+03, 3.42095066689918121483e+03, 3.11619489079494269390e+03, 2.81356217817545757498e+03, 2.51382054388348979046e+03, -5.33373738894955240539e+04, 1.92852020619473250918e+03, 1.64748033041237476937e+03, 1.37832663077349957348e+03, 3.91535782805478731916e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.29123724594866098414e+03, 3.15536960236311006156e+03, 2.90858141668566076987e+03, 2.66222388665865446455e+03, 2.41647750792135775555e+03, 2.17169251214185715071e+03, 1.92852020619473250918e+03, -5.38674635414181757369e+04, 1.45222827388620748934e+03, 1.22355331243166369859e+03, 3.54116292074849468463e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.73206610299059775571e+03, 2.62496560833309877125e+03, 2.43004100806083170028e+03, 2.23479352824522902665e+03, 2.03920114598885902524e+03, 1.84333931217453209683e+03, 1.64748033041237363250e+03, 1.45222827388620771671e+03, -5.42968624827789099072e+04, 1.06869838592571113622e+03, 3.15873250969954938228e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.22206680692482086670e+03, 2.13951776340439482738e+03, 1.98898599288001878449e+03, 1.83770911805141918194e+03, 1.68554719479218510969e+03, 1.53240931556867462859e+03, 1.37832663077350025560e+03, 1.22355331243166369859e+03, 1.06869838592571159097e+03, -5.46406647239502999582e+04, 2.76908313655558060873e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.86489444536068390335e+02, 5.67861192082938828207e+02, 5.33720970737905190617e+02, 4.99121798321842561563e+02, 4.63960447085584348770e+02, 4.28130117796620595527e+02, 3.91535782805478618229e+02, 3.54116292074849241089e+02, 3.15873250969955051914e+02, 2.76908313655558174560e+02, -5.46391582782434034016e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -5.47444643371320911683e+05, 8.03135475361430326302e+03, 7.95194749520791447139e+03, 7.87271660095023980830e+03, 7.79366670666199479456e+03, 7.71480149319778229255e+03, 7.28541223331254150253e+03, 6.52032151171342957241e+03, 5.78112494192641770496e+03, 5.07249761835210483696e+03, 4.39898935465025988378e+03, 3.76485694860971125308e+03, 3.17394820728111972130e+03, 2.62962034987967990673e+03, 2.13468005136764486451e+03, 5.60622381912373612067e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 8.03135475361430053454e+03, -5.47602690042824600823e+05, 7.87450469163558500441e+03, 7.79633417902212750050e+03, 7.71833772073464479035e+03, 7.64052045986879238626e+03, 7.21674849036064370011e+03, 6.46137694741945597343e+03, 5.73113791112262606475e+03, 5.03065888228969652118e+03, 4.36446611114881307003e+03, 3.73681524034245285293e+03, 3.15156831048739741163e+03, 2.61211171641647024444e+03, 2.12129396062502974019e+03, 5.57677245308255692180e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.95194749520791174291e+03, 7.87450469163557772845e+03, -5.47758311479056254029e+05, 7.72010709376489558053e+03, 7.64315957239502040466e+03, 7.56638430045815584890e+03, 7.14820366315910268895e+03, 6.40251269095544466836e+03, 5.68120189322476653615e+03, 4.98885020676485328295e+03, 4.32995812698853387701e+03, 3.70877794956892694245e+03, 3.12918595355365187061e+03, 2.59459698116294566717e+03, 2.10789977896298887572e+03, 5.54728257552148534160e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.87271660095023980830e+03, 7.79633417902212750050e+03, 7.72010709376489285205e+03, -5.47911507913392502815e+05, 7.56813441121767300501e+03, 7.49239613909700346994e+03, 7.07978086492337479285e+03, 6.34373037126215240278e+03, 5.63131849842789051763e+03, 4.94707171918617586925e+03, 4.29546526841091963433e+03, 3.68074517066567022994e+03, 3.10680121596540493556e+03, 2.57707596576825017110e+03, 2.09449731559662677682e+03, 5.51775371586207029395e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.79366670666198933759e+03, 7.71833772073464024288e+03, 7.64315957239501312870e+03, 7.56813441121767300501e+03, -5.48062279523222125135e+05, 7.41856011143076739245e+03, 7.01148275357273269037e+03, 6.28503213504663108324e+03, 5.58148887475559149607e+03, 4.90532503468653885648e+03, 4.26098790975610700116e+03, 3.65271701494846593050e+03, 3.08441419147083206553e+03, 2.55954825954286570777e+03, 2.08108626723966244754e+03, 5.48818420787249237947e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.71480149319778229255e+03, 7.64052045986879329575e+03, 7.56638430045816130587e+03, 7.49239613909700437944e+03, 7.41856011143076739245e+03, -5.48210688962294720113e+05, 6.94331249469854446943e+03, 6.22641965808246459346e+03, 5.53171369732530092733e+03, 4.86361031704016568256e+03, 4.22652643705421996856e+03, 3.62469384787454782781e+03, 3.06202498224594501153e+03, 2.54201419119887486886e+03, 2.06766645833995562498e+03, 5.45857423123524085895e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.28541223331253695505e+03, 7.21674849036064279062e+03, 7.14820366315910177946e+03, 7.07978086492336842639e+03, 7.01148275357272905239e+03, 6.94331249469854265044e+03, -4.89841616266180062667e+04, 5.90608703081065232254e+03, 5.25925123803999485972e+03, 4.63494079445949137153e+03, 4.03736591002835848485e+03, 3.47068038308718450935e+03, 2.93882670197021434433e+03, 2.44541850243785802377e+03, 1.99365161710176403176e+03, 5.29475017397042506673e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 6.52032151171343048190e+03, 6.46137694741945051646e+03, 6.40251269095544466836e+03, 6.34373037126215785975e+03, 6.28503213504663108324e+03, 6.22641965808247186942e+03, 5.90608703081064868456e+03, -5.02245308729412645334e+04, 4.76856677553501413058e+03, 4.22193484313249155093e+03, 3.69480700121118661627e+03, 3.19107304015235968109e+03, 2.71462992264770537076e+03, 2.26922557801286893664e+03, 1.85833763903160570408e+03, 4.99339488410901651605e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.78112494192642134294e+03, 5.73113791112262697425e+03, 5.68120189322476744564e+03, 5.63131849842789233662e+03, 5.58148887475559240556e+03, 5.53171369732529910834e+03, 5.25925123803999395022e+03, 4.76856677553501231159e+03, -5.12695919841667855508e+04, 3.81368326825151370940e+03, 3.35463027069274357927e+03, 2.91221740639560584896e+03, 2.49012471187523306071e+03, 2.09209696768146523027e+03, 1.72178071337434357702e+03, 4.68614001090244414627e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.07249761835210210847e+03, 5.03065888228969561169e+03, 4.98885020676484782598e+03, 4.94707171918617314077e+03, 4.90532503468653703749e+03, 4.86361031704016295407e+03, 4.63494079445949228102e+03, 4.22193484313248973194e+03, 3.81368326825151279991e+03, -5.21439781208171989419e+04, 3.01760267817025396653e+03, 2.63444453068216216707e+03, 2.26535294191191997015e+03, 1.91389570874075138818e+03, 1.58374751767869270225e+03, 4.37170754291636967537e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 4.39898935465026352176e+03, 4.36446611114881670801e+03, 4.32995812698853569600e+03, 4.29546526841091235838e+03, 4.26098790975610609166e+03, 4.22652643705421724007e+03, 4.03736591002835848485e+03, 3.69480700121118570678e+03, 3.35463027069274085079e+03, 3.01760267817025305703e+03, -5.28706478013131782063e+04, 2.35836087591921523199e+03, 2.04052854006939128340e+03, 1.73458423463572921719e+03, 1.44405532747424308582e+03, 4.04878786031379036103e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.76485694860970988884e+03, 3.73681524034245239818e+03, 3.70877794956892466871e+03, 3.68074517066567022994e+03, 3.65271701494846456626e+03, 3.62469384787454373509e+03, 3.47068038308718496410e+03, 3.19107304015236240957e+03, 2.91221740639560766795e+03, 2.63444453068216125757e+03, 2.35836087591921477724e+03, -5.34705300093317709980e+04, 1.81617408324393863950e+03, 1.55432811150165002800e+03, 1.30264857784943956176e+03, 3.71620248261317954075e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.17394820728111881181e+03, 3.15156831048739695689e+03, 3.12918595355365550859e+03, 3.10680121596540720930e+03, 3.08441419147083388452e+03, 3.06202498224594683052e+03, 2.93882670197021388958e+03, 2.71462992264770718975e+03, 2.49012471187523487970e+03, 2.26535294191192087965e+03, 2.04052854006939105602e+03, 1.81617408324393886687e+03, -5.39622519388610890019e+04, 1.37363408663742325189e+03, 1.15970237139352298072e+03, 3.37313182485127867949e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.62962034987967945199e+03, 2.61211171641647115393e+03, 2.59459698116294612191e+03, 2.57707596576824971635e+03, 2.55954825954286116030e+03, 2.54201419119887805209e+03, 2.44541850243785711427e+03, 2.26922557801286984613e+03, 2.09209696768146341128e+03, 1.91389570874075297979e+03, 1.73458423463572898982e+03, 1.55432811150164957326e+03, 1.37363408663742370663e+03, -5.43620291939640519558e+04, 1.01575608564659830790e+03, 3.01940864895272000012e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.13468005136764350027e+03, 2.12129396062503155918e+03, 2.10789977896299069471e+03, 2.09449731559662814107e+03, 2.08108626723966244754e+03, 2.06766645833995562498e+03, 1.99365161710176380438e+03, 1.85833763903160547670e+03, 1.72178071337434357702e+03, 1.58374751767869315699e+03, 1.44405532747424285844e+03, 1.30264857784943956176e+03, 1.15970237139352275335e+03, 1.01575608564659864896e+03, -5.46836757632175722392e+04, 2.65589446547554189237e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.60622381912373612067e+02, 5.57677245308255692180e+02, 5.54728257552148647846e+02, 5.51775371586207256769e+02, 5.48818420787249010573e+02, 5.45857423123524085895e+02, 5.29475017397042620360e+02, 4.99339488410901140014e+02, 4.68614001090244471470e+02, 4.37170754291637024380e+02, 4.04878786031379092947e+02, 3.71620248261317840388e+02, 3.37313182485127867949e+02, 3.01940864895272056856e+02, 2.65589446547554359768e+02, -5.46689452842685841460e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, -5.47329929385566501878e+05, 8.14584152678131977154e+03, 8.06625420530617338954e+03, 7.98684240711213897157e+03, 7.90760911298516293755e+03, 7.82855927873551354423e+03, 7.74969637343039994448e+03, 7.67102485729905947665e+03, 7.59254870228947220312e+03, 7.16554474038227090205e+03, 6.40558996969909458130e+03, 5.67266350028049510001e+03, 4.97136240094079494156e+03, 4.30609310888972322573e+03, 3.68092451185705021999e+03, 3.09948541391831395231e+03, 2.56489400644558918430e+03, 2.07971076601056165600e+03, 5.44515818256200304859e+02, 
+0.00000000000000000000e+00, 8.14584152678132250003e+03, -5.47488423825488309376e+05, 7.98863371539926902187e+03, 7.91028130434596005216e+03, 7.83210199976549756684e+03, 7.75409978019522714021e+03, 7.67627811420498983352e+03, 7.59864097310335819202e+03, 7.52119330476142567932e+03, 7.09969372483488950820e+03, 6.34923645928839050612e+03, 5.62502860566063736769e+03, 4.93162848247021793213e+03, 4.27342626804765768611e+03, 3.65449368554357988614e+03, 3.07847952983873619814e+03, 2.54853572976216037205e+03, 2.06726659084738776073e+03, 5.41822330617755596904e+02, 
+0.00000000000000000000e+00, 8.06625420530617702752e+03, 7.98863371539927993581e+03, -5.47644389980877283961e+05, 7.83387458714601871179e+03, 7.75674338754383916239e+03, 7.67978338642550261284e+03, 7.60299805186461799167e+03, 7.52639086625049640134e+03, 7.44996628853493530187e+03, 7.03394751737356818921e+03, 6.29295187099117811158e+03, 5.57743652153420680406e+03, 4.89191810899227766640e+03, 4.24076908936051495402e+03, 3.62806353420433742940e+03, 3.05746876549769376652e+03, 2.53216922979147693695e+03, 2.05481281822956589167e+03, 5.39124803249866317856e+02, 
+0.00000000000000000000e+00, 7.98684240711215261399e+03, 7.91028130434597005660e+03, 7.83387458714601689280e+03, -5.47797952876016148366e+05, 7.68153724571903603646e+03, 7.60561406619159151887e+03, 7.52985917797993715794e+03, 7.45427703939931234345e+03, 7.37887113220242645184e+03, 6.96830861660684513481e+03, 6.23673772076673321862e+03, 5.52988826971249545750e+03, 4.85223180842695546744e+03, 4.20812209542989603506e+03, 3.60163408716510366503e+03, 3.03645265729748234662e+03, 2.51579428281096124920e+03, 2.04234934263598347570e+03, 5.36423057375541816327e+02, 
+0.00000000000000000000e+00, 7.90760911298517385148e+03, 7.83210199976551211876e+03, 7.75674338754385553329e+03, 7.68153724571904695040e+03, -5.47949050067999167368e+05, 7.53159430952267211978e+03, 7.45686544693225823721e+03, 7.38230246987822283700e+03, 7.30791032432189513202e+03, 6.90277902015038034733e+03, 6.18059600149657035217e+03, 5.48238437367024107516e+03, 4.81257009988562458602e+03, 4.17548531294939948566e+03, 3.57520561137542790675e+03, 3.01543171271763822006e+03, 2.49941066056069712431e+03, 2.02987581072730404230e+03, 5.33717096361377230096e+02, 
+0.00000000000000000000e+00, 7.82855927873552718665e+03, 7.75409978019523350667e+03, 7.67978338642551261728e+03, 7.60561406619158697140e+03, 7.53159430952266393433e+03, -5.48097806575838476419e+05, 7.38401936888687214378e+03, 7.31047113199566592812e+03, 7.23708686194047186291e+03, 6.83736123296849200415e+03, 6.12452823481945051753e+03, 5.43492586024638148956e+03, 4.77293351569258175005e+03, 4.14285951247461525782e+03, 3.54877789527886716314e+03, 2.99440522676244881950e+03, 2.48301838572739507072e+03, 2.01739211882121367125e+03, 5.31006741911323615568e+02, 
+0.00000000000000000000e+00, 7.74969637343040085398e+03, 7.67627811420499074302e+03, 7.60299805186462708662e+03, 7.52985917797993897693e+03, 7.45686544693226369418e+03, 7.38401936888687487226e+03, -5.48244222465056227520e+05, 7.23878502651756662090e+03, 7.16640372189740992326e+03, 6.77205822923935375002e+03, 6.06853592533565279155e+03, 5.38751422947815262887e+03, 4.73332208667794202483e+03, 4.11024447655852054595e+03, 3.52235096168436120934e+03, 2.97337321863021634272e+03, 2.46661723005114708940e+03, 2.00489803564868407193e+03, 5.28291936356821338450e+02, 
+0.00000000000000000000e+00, 7.67102485729904401524e+03, 7.59864097310336273949e+03, 7.52639086625049094437e+03, 7.45427703939931052446e+03, 7.38230246987821919902e+03, 7.31047113199566319963e+03, 7.23878502651756934938e+03, -5.48388297777490923181e+05, 7.09586487106637741817e+03, 6.70687250757147558033e+03, 6.01262107728569662868e+03, 5.34015050317684836045e+03, 4.69373731732418400497e+03, 4.07764048366208044172e+03, 3.49592483991767358020e+03, 2.95233571300447010799e+03, 2.45020672566873872711e+03, 1.99239321154798290081e+03, 5.25572500920880315789e+02, 
+0.00000000000000000000e+00, 7.59254870228947311261e+03, 7.52119330476143295527e+03, 7.44996628853493803035e+03, 7.37887113220242463285e+03, 7.30791032432189786050e+03, 7.23708686194047641038e+03, 7.16640372189741447073e+03, 7.09586487106637832767e+03, -5.48530095059616374783e+05, 6.64180705485464477533e+03, 5.95678520662883875048e+03, 5.29283521487249709025e+03, 4.65417924727005902241e+03, 4.04504781224627140546e+03, 3.46949980344520690778e+03, 2.93129273456875080228e+03, 2.43378713713884053504e+03, 1.97987741892768440266e+03, 5.22848439931978646200e+02, 
+0.00000000000000000000e+00, 7.16554474038227181154e+03, 7.09969372483488496073e+03, 7.03394751737356546073e+03, 6.96830861660684422532e+03, 6.90277902015037670935e+03, 6.83736123296849291364e+03, 6.77205822923934920254e+03, 6.70687250757147467084e+03, 6.64180705485464568483e+03, -4.92687696337768938974e+04, 5.65156383536951943825e+03, 5.03376032742323150160e+03, 4.43724695132905890205e+03, 3.86605795267129224158e+03, 3.32418392246271559998e+03, 2.81542111192044148993e+03, 2.34325683667957991929e+03, 1.91078255021308746109e+03, 5.07755526577351190554e+02, 
+0.00000000000000000000e+00, 6.40558996969909185282e+03, 6.34923645928839050612e+03, 6.29295187099117174512e+03, 6.23673772076672867115e+03, 6.18059600149656398571e+03, 6.12452823481945051753e+03, 6.06853592533565733902e+03, 6.01262107728569753817e+03, 5.95678520662884238845e+03, 5.65156383536951580027e+03, -5.04521494286986489897e+04, 4.56691159593794600369e+03, 4.04513839720960413615e+03, 3.54160728239964009845e+03, 3.06006208621047017004e+03, 2.60426899189445748561e+03, 2.17786296088738026810e+03, 1.78422827973286598535e+03, 4.79915859829027283467e+02, 
+0.00000000000000000000e+00, 5.67266350028049419052e+03, 5.62502860566063918668e+03, 5.57743652153420862305e+03, 5.52988826971249818598e+03, 5.48238437367024289415e+03, 5.43492586024637785158e+03, 5.38751422947815444786e+03, 5.34015050317684745096e+03, 5.29283521487249527127e+03, 5.03376032742323059210e+03, 4.56691159593794782268e+03, -5.14482453263278584927e+04, 3.65705312684671298484e+03, 3.21890527888631777387e+03, 2.79615020550945064315e+03, 2.39235208076236131092e+03, 2.01115560252709383349e+03, 1.65612461114062421075e+03, 4.51405916965422875364e+02, 
+0.00000000000000000000e+00, 4.97136240094079221308e+03, 4.93162848247021429415e+03, 4.89191810899227402842e+03, 4.85223180842695546744e+03, 4.81257009988562640501e+03, 4.77293351569257993106e+03, 4.73332208667794020585e+03, 4.69373731732418855245e+03, 4.65417924727006084140e+03, 4.43724695132905799255e+03, 4.04513839720960504565e+03, 3.65705312684671298484e+03, -5.22812999505072366446e+04, 2.89860893886013582232e+03, 2.53268529280187249242e+03, 2.17963303643529934561e+03, 1.84293222106695202456e+03, 1.52618502811769644723e+03, 4.22083955041898263971e+02, 
+0.00000000000000000000e+00, 4.30609310888972413522e+03, 4.27342626804765586712e+03, 4.24076908936051677301e+03, 4.20812209542989694455e+03, 4.17548531294940312364e+03, 4.14285951247461798630e+03, 4.11024447655852054595e+03, 4.07764048366208135121e+03, 4.04504781224627004121e+03, 3.86605795267129178683e+03, 3.54160728239963964370e+03, 3.21890527888631731912e+03, 2.89860893886013673182e+03, -5.29737596776677528396e+04, 2.27018323610582729088e+03, 1.96624948770354149019e+03, 1.67309208591806645927e+03, 1.39417557022677920031e+03, 3.91805583383396765385e+02, 
+0.00000000000000000000e+00, 3.68092451185705112948e+03, 3.65449368554357806715e+03, 3.62806353420433924839e+03, 3.60163408716510321028e+03, 3.57520561137542608776e+03, 3.54877789527886579890e+03, 3.52235096168436211883e+03, 3.49592483991767358020e+03, 3.46949980344520372455e+03, 3.32418392246271514523e+03, 3.06006208621047244378e+03, 2.79615020550945200739e+03, 2.53268529280187294717e+03, 2.27018323610582683614e+03, -5.35459364249087448115e+04, 1.75265324392743650606e+03, 1.50174217796203015496e+03, 1.25999315064600205005e+03, 3.60440498648634218171e+02, 
+0.00000000000000000000e+00, 3.09948541391831167857e+03, 3.07847952983873392441e+03, 3.05746876549769604026e+03, 3.03645265729748007288e+03, 3.01543171271763958430e+03, 2.99440522676245063849e+03, 2.97337321863021816171e+03, 2.95233571300447101748e+03, 2.93129273456875171178e+03, 2.81542111192044148993e+03, 2.60426899189445839511e+03, 2.39235208076236267516e+03, 2.17963303643529889086e+03, 1.96624948770354149019e+03, 1.75265324392743673343e+03, -5.40157606148137347191e+04, 1.32933675046496750838e+03, 1.12377029094799172526e+03, 3.27895582001051423049e+02, 
+0.00000000000000000000e+00, 2.56489400644559100328e+03, 2.54853572976216173629e+03, 2.53216922979147602746e+03, 2.51579428281096170394e+03, 2.49941066056069712431e+03, 2.48301838572739779920e+03, 2.46661723005114663465e+03, 2.45020672566873417964e+03, 2.43378713713884326353e+03, 2.34325683667958037404e+03, 2.17786296088738208709e+03, 2.01115560252709360611e+03, 1.84293222106695247930e+03, 1.67309208591806668665e+03, 1.50174217796202970021e+03, 1.32933675046496773575e+03, -5.43987008955373166827e+04, 9.86009586645714080078e+02, 2.94144469154699606861e+02, 
+0.00000000000000000000e+00, 2.07971076601056165600e+03, 2.06726659084738776073e+03, 2.05481281822956725591e+03, 2.04234934263598415782e+03, 2.02987581072730586129e+03, 2.01739211882121412600e+03, 2.00489803564868589092e+03, 1.99239321154798335556e+03, 1.97987741892768485741e+03, 1.91078255021308791584e+03, 1.78422827973286462111e+03, 1.65612461114062352863e+03, 1.52618502811769712935e+03, 1.39417557022677897294e+03, 1.25999315064600295955e+03, 1.12377029094799149789e+03, 9.86009586645714421138e+02, -5.47078048397091552033e+04, 2.59265345038786335863e+02, 
+0.00000000000000000000e+00, 5.44515818256199395364e+02, 5.41822330617756165339e+02, 5.39124803249866658916e+02, 5.36423057375542157388e+02, 5.33717096361377230096e+02, 5.31006741911323842942e+02, 5.28291936356821906884e+02, 5.25572500920880088415e+02, 5.22848439931978759887e+02, 5.07755526577351304240e+02, 4.79915859829026999250e+02, 4.51405916965422818521e+02, 4.22083955041898491345e+02, 3.91805583383396708541e+02, 3.60440498648633990797e+02, 3.27895582001051479892e+02, 2.94144469154699606861e+02, 2.59265345038786392706e+02, -5.46855204266548480518e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -5.38018331274556185235e+04, 5.06817859384017594948e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.06817859384017651792e+02, -5.40087082233295586775e+03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -5.47568524620197480544e+05, 7.90768628876928050886e+03, 7.82852446417132250644e+03, 7.39726556012164473941e+03, 6.62798307943240342865e+03, 5.88344514717536094395e+03, 5.16838179848196250532e+03, 4.48746735197243833682e+03, 3.84513500554546590138e+03, 3.24544443555752241082e+03, 2.69198715131537028356e+03, 2.18781631836851101980e+03, 5.76308266444161176878e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.90768628876927868987e+03, -5.47726124731024727225e+05, 7.75132560276730055193e+03, 7.32579113887300809438e+03, 6.56644100892954065785e+03, 5.83109309991756799718e+03, 5.12442099962397605850e+03, 4.45106909497591823310e+03, 3.81546220173643496310e+03, 3.22167034786078738762e+03, 2.67330981131564658426e+03, 2.17347165699624792978e+03, 5.73105876090029823899e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.82852446417132159695e+03, 7.75132560276729691395e+03, -5.47881278598694945686e+05, 7.25445184865848750633e+03, 6.50499121432876381732e+03, 5.77880127900806564867e+03, 5.08049724121045619540e+03, 4.41469112560164376191e+03, 3.78579815520178999577e+03, 3.19789725380423487877e+03, 2.65462874349857111156e+03, 2.15912037437542812768e+03, 5.69900001266974754799e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.39726556012163746345e+03, 7.32579113887300718488e+03, 7.25445184865848750633e+03, -4.86902798581407696474e+04, 6.16920741321968580451e+03, 5.49263393966405601532e+03, 4.83979794937694714463e+03, 4.21509393561338674772e+03, 3.62284895520516511169e+03, 3.06716275325296010124e+03, 2.55178684050519086668e+03, 2.08003300708422057141e+03, 5.52184067918442110567e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 6.62798307943240888562e+03, 6.56644100892954247684e+03, 6.50499121432876745530e+03, 6.16920741321968671400e+03, -4.99889519776906745392e+04, 4.97752073025886238611e+03, 4.40534910937644599471e+03, 3.85393182506186485625e+03, 3.32731379110704119739e+03, 2.82953276694825444793e+03, 2.36446012570075026815e+03, 1.93567732069568410225e+03, 5.19671543585316157987e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.88344514717536094395e+03, 5.83109309991756890668e+03, 5.77880127900806746766e+03, 5.49263393966405601532e+03, 4.97752073025886238611e+03, -5.10842538214303858695e+04, 3.97636823232713049947e+03, 3.49577097611466115268e+03, 3.03306038495696520840e+03, 2.59204137978380231289e+03, 2.17656823391502166487e+03, 1.79037957429313314606e+03, 4.86648161042978415480e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.16838179848196250532e+03, 5.12442099962397696800e+03, 5.08049724121045619540e+03, 4.83979794937694532564e+03, 4.40534910937644690421e+03, 3.97636823232712913523e+03, -5.20011775237977417419e+04, 3.14149230262040828165e+03, 2.74051735175523572252e+03, 2.35481274940459206846e+03, 1.98804240274962580770e+03, 1.64396183066404205420e+03, 4.53000679523278506622e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 4.48746735197243560833e+03, 4.45106909497591641411e+03, 4.41469112560164194292e+03, 4.21509393561338492873e+03, 3.85393182506186212777e+03, 3.49577097611466069793e+03, 3.14149230262040828165e+03, -5.27631647726961018634e+04, 2.45038657465749656694e+03, 2.11814127881096419515e+03, 1.79891176611282139675e+03, 1.49629553262759259269e+03, 4.18612377273992308346e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.84513500554546772037e+03, 3.81546220173643132512e+03, 3.78579815520178908628e+03, 3.62284895520516465695e+03, 3.32731379110704074265e+03, 3.03306038495696429891e+03, 2.74051735175523526777e+03, 2.45038657465749565745e+03, -5.33917386855079894303e+04, 1.88262520667629723903e+03, 1.60940460077906459446e+03, 1.34737604249771220566e+03, 3.83378794729651133366e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 3.24544443555752332031e+03, 3.22167034786078784236e+03, 3.19789725380423442402e+03, 3.06716275325295919174e+03, 2.82953276694825444793e+03, 2.59204137978380413188e+03, 2.35481274940459206846e+03, 2.11814127881096374040e+03, 1.88262520667629701165e+03, -5.39062083030090652755e+04, 1.42008457331621548292e+03, 1.19742468697385834275e+03, 3.47230125487507393700e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.69198715131536982881e+03, 2.67330981131564294628e+03, 2.65462874349857384004e+03, 2.55178684050518950244e+03, 2.36446012570075254189e+03, 2.17656823391501984588e+03, 1.98804240274962694457e+03, 1.79891176611282162412e+03, 1.60940460077906391234e+03, 1.42008457331621502817e+03, -5.43235297658407216659e+04, 1.04702137101778475881e+03, 3.10160300235601084751e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 2.18781631836851374828e+03, 2.17347165699625020352e+03, 2.15912037437542812768e+03, 2.08003300708422011667e+03, 1.93567732069568228326e+03, 1.79037957429313337343e+03, 1.64396183066404273632e+03, 1.49629553262759282006e+03, 1.34737604249771266041e+03, 1.19742468697385879750e+03, 1.04702137101778544093e+03, -5.46582853038596440456e+04, 2.72264430961956577448e+02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 5.76308266444161517938e+02, 5.73105876090029596526e+02, 5.69900001266975095859e+02, 5.52184067918441996881e+02, 5.19671543585316044300e+02, 4.86648161042978301793e+02, 4.53000679523278677152e+02, 4.18612377273992251503e+02, 3.83378794729651019679e+02, 3.47230125487507450543e+02, 3.10160300235601027907e+02, 2.72264430961956691135e+02, -5.46513971783723263798e+03, 
+};
+
+const float explicit_offset_data_Attitude[ATTITUDE_EXPLICIT_REGIONS*ATTITUDE_REDUCED_HORIZON_LEN] = {
+-0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, 
+1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, -3.35453718876748951061e+02, -2.98115025551925839409e+02, -2.62191956963421205273e+02, -2.27921314217763438137e+02, -1.95531192802569648848e+02, -1.65233467281451083863e+02, -1.37218273332922848340e+02, -1.11649896147315999428e+02, -2.95012074565759618849e+01, 
+1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, -4.85194030504582201502e+02, -4.27627730017562612375e+02, -3.72527801370615463838e+02, -3.20273376951061948148e+02, -2.71225719196916713827e+02, -2.25717064409770273414e+02, -1.84042152900554299322e+02, -4.88963656983739838324e+01, 
+-1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, 3.35453718876748951061e+02, 2.98115025551925839409e+02, 2.62191956963421205273e+02, 2.27921314217763438137e+02, 1.95531192802569648848e+02, 1.65233467281451083863e+02, 1.37218273332922848340e+02, 1.11649896147315999428e+02, 2.95012074565759618849e+01, 
+1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, -6.11009781411771996318e+02, -5.33405618023787951643e+02, -4.59563061167510284122e+02, -3.90014453670296973087e+02, -3.25261841584381215853e+02, -2.65761848317969509026e+02, -7.09955963290129403731e+01, 
+-1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, 4.85194030504582201502e+02, 4.27627730017562612375e+02, 3.72527801370615463838e+02, 3.20273376951061948148e+02, 2.71225719196916713827e+02, 2.25717064409770273414e+02, 1.84042152900554299322e+02, 4.88963656983739838324e+01, 
+1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, -7.04482754470429881621e+02, -6.08223118130529996961e+02, -5.17259912685827771384e+02, -4.32283090127285163362e+02, -3.53935843450578829561e+02, -9.50655466398741708645e+01, 
+1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, -1.70895601644678208686e+02, -1.52985777147447606694e+02, -1.35676066170777659181e+02, -1.19075893395533455532e+02, -1.03292122846122765623e+02, -8.84250801525744805076e+01, -7.45657255382434698276e+01, -6.17936771812107892288e+01, -5.01757756480894414608e+01, -1.31862901944777011209e+01, 
+-1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, 6.11009781411771996318e+02, 5.33405618023787951643e+02, 4.59563061167510284122e+02, 3.90014453670296973087e+02, 3.25261841584381215853e+02, 2.65761848317969509026e+02, 7.09955963290129403731e+01, 
+1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, -7.73397529929126562820e+02, -6.48922275267460122450e+02, -5.33423404362775045229e+02, -1.44793325388889599026e+02, 
+-1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, 7.59455697545689190520e+02, 6.47186901895730215983e+02, 5.41966643104470790604e+02, 4.44637131232832985006e+02, 1.20067059480127937832e+02, 
+-1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, 7.04482754470429881621e+02, 6.08223118130529996961e+02, 5.17259912685827771384e+02, 4.32283090127285163362e+02, 3.53935843450578829561e+02, 9.50655466398741708645e+01, 
+1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, -7.59455697545689190520e+02, -6.47186901895730215983e+02, -5.41966643104470790604e+02, -4.44637131232832985006e+02, -1.20067059480127937832e+02, 
+1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, -7.48063190072696897914e+02, -6.16057637274455828447e+02, -1.68063215248071657015e+02, 
+-1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, 1.70895601644678208686e+02, 1.52985777147447606694e+02, 1.35676066170777659181e+02, 1.19075893395533455532e+02, 1.03292122846122765623e+02, 8.84250801525744805076e+01, 7.45657255382434698276e+01, 6.17936771812107892288e+01, 5.01757756480894414608e+01, 1.31862901944777011209e+01, 
+-1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, 7.73397529929126562820e+02, 6.48922275267460122450e+02, 5.33423404362775045229e+02, 1.44793325388889599026e+02, 
+-1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, 7.48063190072696897914e+02, 6.16057637274455828447e+02, 1.68063215248071657015e+02, 
+1.20000000000000000000e+03, -1.79399334937819219249e+01, -1.77653289766692985552e+01, -1.75911066668950617498e+01, -1.74172761999383318710e+01, -1.72438450700606367150e+01, -1.70708239833498893745e+01, -1.68982204340676283039e+01, -1.67260440576929738654e+01, -1.65543044897050251052e+01, -1.56200345164274239096e+01, -1.39579443454726064289e+01, -1.23559345986501796233e+01, -1.08240165387645976836e+01, -9.37174213744903461532e+00, -8.00788985148514775858e+00, -6.74025050104492517988e+00, -5.57548809054780747374e+00, -4.51903488899928351685e+00, -1.18196334663743329862e+00, 
+1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, -1.07683366142553012423e+02, -1.06604732592427041027e+02, -1.05528632824773055177e+02, -1.04455127930569020123e+02, -9.86120956441594813668e+01, -8.82068055491444482641e+01, -7.81623547112481276145e+01, -6.85420122325947716035e+01, -5.94069012802433888965e+01, -5.08138558285963028993e+01, -4.28139205848451140923e+01, -3.54513205986306658701e+01, -2.87627210506541821644e+01, -7.54279104756447882352e+00, 
+1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, -5.38489178295601362834e+01, -5.33187979124351372207e+01, -5.27898713994094634927e+01, -5.22621691740445299956e+01, -5.17357143983088434425e+01, -5.12105357493937063396e+01, -5.06866630065050571829e+01, -4.78361609092870310178e+01, -4.27630066717858667857e+01, -3.78702536781417222755e+01, -3.31885894029303400998e+01, -2.87474317816308122531e+01, -2.45739437286951591943e+01, -2.06923515190555065146e+01, -1.71234793519872816603e+01, -1.38844234312295284894e+01, -3.63531113497230284892e+00, 
+1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, -6.89186281762748649271e+02, -1.88909891620370274268e+02, 
+1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, -7.18045817312001020127e+01, -7.10936163988639009403e+01, -7.03842797840466545267e+01, -6.96766032289970098645e+01, -6.89706236749951671072e+01, -6.82663814185890913677e+01, -6.44340433963935623751e+01, -5.76121141085542873839e+01, -5.10307661944738910620e+01, -4.47313448070314976235e+01, -3.87535830654712114551e+01, -3.31342532385121444349e+01, -2.79062298541607951563e+01, -2.30978449697254539785e+01, -1.87324359601977796785e+01, -4.90723414064455809580e+00, 
+1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, -1.25591972874438553731e+02, -1.24326593753079421845e+02, -1.23064233645232334879e+02, -1.16192551201446136133e+02, -1.03953024419653786481e+02, -9.21343529536194836282e+01, -8.08110679006387613299e+01, -7.00553591375761612881e+01, -5.99345148123675883767e+01, -5.05091076277858803678e+01, -4.18317547052696383503e+01, -3.39462186650787032249e+01, -8.90685242736388183005e+00, 
+1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, -1.43470070773918990881e+02, -1.42016070214645395708e+02, -1.34100366217875688335e+02, -1.19998506896093289242e+02, -1.06377406214126551731e+02, -9.33230460673351132073e+01, -8.09189322482416883986e+01, -6.92430850986253716428e+01, -5.83659052681708772070e+01, -4.83487044538694448192e+01, -3.92426365915192150169e+01, -1.03020195663616096482e+01, 
+1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, -1.61309953056894727297e+02, -1.52334995365384202159e+02, -1.36342947969721620893e+02, -1.20891421153434080793e+02, -1.06078030225172980749e+02, -9.19978407775385136347e+01, -7.87398857301371464246e+01, -6.63846946669427921961e+01, -5.50025784360463561029e+01, -4.46523825326518633005e+01, -1.17284529457810950959e+01, 
+-1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, 1.43470070773918990881e+02, 1.42016070214645395708e+02, 1.34100366217875688335e+02, 1.19998506896093289242e+02, 1.06377406214126551731e+02, 9.33230460673351132073e+01, 8.09189322482416883986e+01, 6.92430850986253716428e+01, 5.83659052681708772070e+01, 4.83487044538694448192e+01, 3.92426365915192150169e+01, 1.03020195663616096482e+01, 
+1.20000000000000000000e+03, 1.20000000000000000000e+03, -3.58917736578808970194e+01, -3.55404505322729491468e+01, -3.51899098307423017218e+01, -3.48401656805117170279e+01, -3.44912398155316708426e+01, -3.41431474495675217895e+01, -3.37959081431747350166e+01, -3.34495403703661295935e+01, -3.15650845054625115438e+01, -2.82119133006179332313e+01, -2.49789669514035530540e+01, -2.18864862976766723079e+01, -1.89538286872321499743e+01, -1.61988268247283109247e+01, -1.36373464868800340355e+01, -1.12829903993212745661e+01, -9.14688850351787685611e+00, -2.39364121014795383502e+00, 
+1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, 1.20000000000000000000e+03, -8.97517837530144646507e+01, -8.88579709244158948422e+01, -8.79662278787143776526e+01, -8.70766023269691373798e+01, -8.61891431169632653564e+01, -8.13592627228026685771e+01, -7.27599009640244247521e+01, -6.44612769826039340160e+01, -5.65155969500651522708e+01, -4.89731639563855978281e+01, -4.18806395166160143617e+01, -3.52798372518674838716e+01, -2.92068885957531669817e+01, -2.36916512940815273680e+01, -6.20965279168175410263e+00, 
+-1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, 8.97517837530144646507e+01, 8.88579709244158948422e+01, 8.79662278787143776526e+01, 8.70766023269691373798e+01, 8.61891431169632653564e+01, 8.13592627228026685771e+01, 7.27599009640244247521e+01, 6.44612769826039340160e+01, 5.65155969500651522708e+01, 4.89731639563855978281e+01, 4.18806395166160143617e+01, 3.52798372518674838716e+01, 2.92068885957531669817e+01, 2.36916512940815273680e+01, 6.20965279168175410263e+00, 
+-1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, 5.38489178295601362834e+01, 5.33187979124351372207e+01, 5.27898713994094634927e+01, 5.22621691740445299956e+01, 5.17357143983088434425e+01, 5.12105357493937063396e+01, 5.06866630065050571829e+01, 4.78361609092870310178e+01, 4.27630066717858667857e+01, 3.78702536781417222755e+01, 3.31885894029303400998e+01, 2.87474317816308122531e+01, 2.45739437286951591943e+01, 2.06923515190555065146e+01, 1.71234793519872816603e+01, 1.38844234312295284894e+01, 3.63531113497230284892e+00, 
+-1.20000000000000000000e+03, -1.20000000000000000000e+03, 3.58917736578808970194e+01, 3.55404505322729491468e+01, 3.51899098307423017218e+01, 3.48401656805117170279e+01, 3.44912398155316708426e+01, 3.41431474495675217895e+01, 3.37959081431747350166e+01, 3.34495403703661295935e+01, 3.15650845054625115438e+01, 2.82119133006179332313e+01, 2.49789669514035530540e+01, 2.18864862976766723079e+01, 1.89538286872321499743e+01, 1.61988268247283109247e+01, 1.36373464868800340355e+01, 1.12829903993212745661e+01, 9.14688850351787685611e+00, 2.39364121014795383502e+00, 
+-1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, 1.07683366142553012423e+02, 1.06604732592427041027e+02, 1.05528632824773055177e+02, 1.04455127930569020123e+02, 9.86120956441594813668e+01, 8.82068055491444482641e+01, 7.81623547112481276145e+01, 6.85420122325947716035e+01, 5.94069012802433888965e+01, 5.08138558285963028993e+01, 4.28139205848451140923e+01, 3.54513205986306658701e+01, 2.87627210506541821644e+01, 7.54279104756447882352e+00, 
+-1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, 1.61309953056894727297e+02, 1.52334995365384202159e+02, 1.36342947969721620893e+02, 1.20891421153434080793e+02, 1.06078030225172980749e+02, 9.19978407775385136347e+01, 7.87398857301371464246e+01, 6.63846946669427921961e+01, 5.50025784360463561029e+01, 4.46523825326518633005e+01, 1.17284529457810950959e+01, 
+-1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, 7.18045817312001020127e+01, 7.10936163988639009403e+01, 7.03842797840466545267e+01, 6.96766032289970098645e+01, 6.89706236749951671072e+01, 6.82663814185890913677e+01, 6.44340433963935623751e+01, 5.76121141085542873839e+01, 5.10307661944738910620e+01, 4.47313448070314976235e+01, 3.87535830654712114551e+01, 3.31342532385121444349e+01, 2.79062298541607951563e+01, 2.30978449697254539785e+01, 1.87324359601977796785e+01, 4.90723414064455809580e+00, 
+-1.20000000000000000000e+03, 1.79399334937819219249e+01, 1.77653289766692985552e+01, 1.75911066668950617498e+01, 1.74172761999383318710e+01, 1.72438450700606367150e+01, 1.70708239833498893745e+01, 1.68982204340676283039e+01, 1.67260440576929738654e+01, 1.65543044897050251052e+01, 1.56200345164274239096e+01, 1.39579443454726064289e+01, 1.23559345986501796233e+01, 1.08240165387645976836e+01, 9.37174213744903461532e+00, 8.00788985148514775858e+00, 6.74025050104492517988e+00, 5.57548809054780747374e+00, 4.51903488899928351685e+00, 1.18196334663743329862e+00, 
+-1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, 6.89186281762748649271e+02, 1.88909891620370274268e+02, 
+-1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, -1.20000000000000000000e+03, 1.25591972874438553731e+02, 1.24326593753079421845e+02, 1.23064233645232334879e+02, 1.16192551201446136133e+02, 1.03953024419653786481e+02, 9.21343529536194836282e+01, 8.08110679006387613299e+01, 7.00553591375761612881e+01, 5.99345148123675883767e+01, 5.05091076277858803678e+01, 4.18317547052696383503e+01, 3.39462186650787032249e+01, 8.90685242736388183005e+00, 
+};
+
+const int8_t explicit_active_data_Attitude[ATTITUDE_EXPLICIT_REGIONS*ATTITUDE_REDUCED_HORIZON_LEN] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 
+-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 
+-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 
+-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 
+-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 
+-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 
+1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 
+1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+-1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+-1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+-1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+-1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+-1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+-1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+-1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+-1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 
+-1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+const float explicit_node_plane_data_Attitude[ATTITUDE_EXPLICIT_NODES*(ATTITUDE_REDUCED_HORIZON_LEN+1)] = {
+-9.98739434409396498182e-01, 1.49310991924349479448e-02, 1.47857788452129650103e-02, 1.46407766026084434907e-02, 1.44961004840655563464e-02, 1.43517567269296764110e-02, 1.42077542416943793102e-02, 1.40640992657050118569e-02, 1.39207998184057765018e-02, 1.37778639192407906938e-02, 1.30002870319933169774e-02, 1.16169578675959488806e-02, 1.02836326105461475094e-02, 9.00864346330309748168e-03, 7.79994036815546964991e-03, 6.66482948423752392941e-03, 5.60979497765937227399e-03, 4.64038318509170551185e-03, 3.76111529092955842665e-03, 9.83727836927755609764e-04, 2.18984287924222807351e-03, 
+-1.38926461886894111325e-02, -1.37626106700709863184e-02, -1.36328081342392340436e-02, -1.35032448059250968081e-02, -1.33739251313649588904e-02, -1.32448544460425140373e-02, -1.31160398639359240119e-02, -1.29874849420343538298e-02, 9.98906576769658438586e-01, -1.27311834240063162516e-02, -1.20335751596333667690e-02, -1.07884617928145094129e-02, -9.58231968792678731606e-03, -8.42282127047942752451e-03, -7.31761228856334360743e-03, -6.27399390694944724539e-03, -5.29869683828022245559e-03, -4.39771505382885279090e-03, -3.57618573511674087140e-03, -9.43477466810495606249e-04, 2.18541410888682804611e-03, 
+-0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -9.99133407569661624592e-01, 1.46579109678796545846e-02, 1.45129859135604832865e-02, 1.43683827389327039431e-02, 1.42241099047665988525e-02, 1.40801741289373651134e-02, 1.32965019173308298533e-02, 1.19001457578044797514e-02, 1.05510486452875494601e-02, 9.25774302786545183475e-03, 8.02853270553096146078e-03, 6.87118669919165644261e-03, 5.79272758659443807311e-03, 4.79928258062749246715e-03, 3.89597410371824185923e-03, 1.02318391015838376472e-03, -2.32115239576088103549e-03, 
+-0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -9.99420299032268033557e-01, -0.00000000000000000000e+00, 1.45762411977030745952e-02, 1.44298073378967411928e-02, 1.36322141696526046017e-02, 1.22099790504182868778e-02, 1.08342680380864812145e-02, 9.51381366560137553545e-03, 8.25719773902291141743e-03, 7.07252753261919039907e-03, 5.96719257381873001422e-03, 4.94770183298508942071e-03, 4.01956056787171334133e-03, 1.05778118001920900040e-03, -2.42209415607407560836e-03, 
+-0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, 9.99529934948551357365e-01, -1.43544794050448568795e-02, -1.35664039580136210061e-02, -1.21601206297682427199e-02, -1.07982996597545191642e-02, -9.48959620530240473280e-03, -8.24261065615691096431e-03, -7.06553627351457283479e-03, -5.96590889553904289710e-03, -4.95042381162232470598e-03, -4.02480347441876856740e-03, -1.06125390803702931465e-03, 2.45217185403624271869e-03, 
+-0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -9.99430807811004018326e-01, 1.44332351845505788002e-02, 1.42887477592358921180e-02, 1.35016071266565920034e-02, 1.20975004686937649689e-02, 1.07385579553385297757e-02, 9.43341292218238987310e-03, 8.19059701015160956938e-03, 7.01820176278431222955e-03, 5.92363696614007367858e-03, 4.91345790030957123296e-03, 3.99323725176822536681e-03, 1.05188704314214680376e-03, -2.41949161923909290481e-03, 
+-0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, 9.99232471611950945345e-01, -1.45849352021468221113e-02, -1.44401421783966008722e-02, -1.42956716732950284837e-02, -1.41515331722315684110e-02, -1.33665958826204352844e-02, -1.19674567166943093821e-02, -1.06148810453301333662e-02, -9.31743985065505361809e-03, -8.08351596454529724989e-03, -6.92099047840795747466e-03, -5.83701515669571898565e-03, -4.83786051133922381795e-03, -3.92880058815029287872e-03, -1.03284604929938946503e-03, 2.35396801794540005970e-03, 
+-1.49270972856790518773e-02, 9.98760911569380849251e-01, -1.46401226749812551214e-02, -1.44970923554317843163e-02, -1.43543773828082657507e-02, -1.42119831019738122879e-02, -1.40699184210336981915e-02, -1.39281895756615710369e-02, -1.37868045831522137434e-02, -1.36457705699897565571e-02, -1.28783747165597123319e-02, -1.15126036171327196522e-02, -1.01953950534878230033e-02, -8.93501129324632790973e-03, -7.73937253278792359340e-03, -6.61579277192989641948e-03, -5.57079541614838736480e-03, -4.60998633607855382022e-03, -3.73796924051473123535e-03, -9.78701009468754346346e-04, 2.18925594676660150925e-03, 
+9.98739434409396498182e-01, -1.49310991924349479448e-02, -1.47857788452129650103e-02, -1.46407766026084434907e-02, -1.44961004840655563464e-02, -1.43517567269296764110e-02, -1.42077542416943793102e-02, -1.40640992657050118569e-02, -1.39207998184057765018e-02, -1.37778639192407906938e-02, -1.30002870319933169774e-02, -1.16169578675959488806e-02, -1.02836326105461475094e-02, -9.00864346330309748168e-03, -7.79994036815546964991e-03, -6.66482948423752392941e-03, -5.60979497765937227399e-03, -4.64038318509170551185e-03, -3.76111529092955842665e-03, -9.83727836927755609764e-04, 2.18984287924222807351e-03, 
+-0.00000000000000000000e+00, -9.98837455262976847692e-01, 1.48655704443563449479e-02, 1.47203293504832924410e-02, 1.45754085738777922759e-02, 1.44308135542582181149e-02, 1.42865533356191197478e-02, 1.41426342487567680700e-02, 1.39990644332662738519e-02, 1.38558511376648697128e-02, 1.30765998528367156928e-02, 1.16897374714641580362e-02, 1.03521997811157045327e-02, 9.07237609922066298718e-03, 7.85830785434528736322e-03, 6.71742047171770221420e-03, 5.65633625579058194749e-03, 4.68074567983771394619e-03, 3.79532142804062631869e-03, 9.93701906394966940489e-04, -2.22265211259278176043e-03, 
+-0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, 9.99034505732369293440e-01, -1.47289961636077517543e-02, -1.45839523235661728401e-02, -1.44392307228132944080e-02, -1.42948378791857080850e-02, -1.41507803772962202637e-02, -1.40070665970921676841e-02, -1.32247650342227959092e-02, -1.18313861404754309264e-02, -1.04859572233771871502e-02, -9.19697004634919407229e-03, -7.97264348199058087152e-03, -6.82063401614595252870e-03, -5.74783235399735879800e-03, -4.76022056334608496125e-03, -3.86277144860965168313e-03, -1.01343547315174893099e-03, 2.28831931885165691318e-03, 
+-0.00000000000000000000e+00, -0.00000000000000000000e+00, -9.98935833447987420186e-01, 1.47982084099813199218e-02, 1.46530596864254056277e-02, 1.45082317275919882998e-02, 1.43637319288488270880e-02, 1.42195667145003507015e-02, 1.40757434532615393480e-02, 1.39322712827952433640e-02, 1.31514438521133023019e-02, 1.17612309541360263859e-02, 1.04196569028672265250e-02, 9.13516541318686384199e-03, 7.91588816924201042757e-03, 6.76936651170266263239e-03, 5.70235799121586190569e-03, 4.72069951756974841989e-03, 3.82921344924546476138e-03, 1.00360614712292992717e-03, -2.25548151375753362993e-03, 
+-0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, 9.86941318650821242109e-01, -9.32314647710150434801e-02, -8.10148869187302528294e-02, -6.93446288375196839837e-02, -5.83230931410276820515e-02, -4.80519541750073289621e-02, -1.31173385939099985259e-02, 3.56245151693867917464e-02, 
+-0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, 9.74789964613308801411e-01, -1.18767980028143899096e-01, -1.05027673174802299583e-01, -9.18041037392534758910e-02, -7.91931582026773883687e-02, -6.72896761548402444486e-02, -5.61838708399685846095e-02, -4.59585623006532606460e-02, -1.23131067929696663699e-02, 3.06154265996620850165e-02, 
+-0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -9.99632689511074756794e-01, -0.00000000000000000000e+00, 1.40351937085406129613e-02, 1.24715709982987765087e-02, 1.09674000732532788555e-02, 9.53263654628396135682e-03, 8.17684312417063345613e-03, 6.90888132334261783479e-03, 5.73668443056300856459e-03, 4.66709214937322328098e-03, 1.23271625243511384791e-03, -2.87092822094601150817e-03, 
+-0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -9.68286468186335902431e-01, 1.28880155893949133183e-01, 1.14733351019826901318e-01, 1.01085266862500938734e-01, 8.80276801540450376526e-02, 7.56508368796356966968e-02, 6.40401408580171666030e-02, 5.32736524462577576422e-02, 4.34201984101816665373e-02, 1.15234986497271992001e-02, -2.74330206171405840965e-02, 
+-0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -9.99628934933781465588e-01, 1.36293127403002440473e-02, 1.22210621966412549128e-02, 1.08565715830357557153e-02, 9.54451268664114303719e-03, 8.29354926092189942421e-03, 7.11197370105688588676e-03, 6.00744537140464763408e-03, 4.98679877452942905969e-03, 4.05590480316916652398e-03, 1.07051027794878247414e-03, -2.48477838739987692135e-03, 
+-0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, 9.81161623606298327616e-01, -1.06769563640290082729e-01, -9.36670418553526840100e-02, -8.10978974786056988622e-02, -6.91617377419390388926e-02, -5.79574300799796868211e-02, -4.75792268338119314630e-02, -1.28667183799098996250e-02, 3.34114805226275804473e-02, 
+-0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, 9.95362152313443715457e-01, -6.41123361561603266612e-02, -5.43312045100809298814e-02, -4.51015534718144442405e-02, -1.25604213886778247333e-02, 3.77288269538387163737e-02, 
+-0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -9.91744706568265410596e-01, 7.87531993889616505067e-02, 6.76584776033337387258e-02, 5.71168643073226428575e-02, 4.72319961027885884541e-02, 1.30193449939717872249e-02, -3.70932994581127453704e-02, 
+-0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, 9.97799081237745966177e-01, -5.01281227960631362017e-02, -4.17819321386413214392e-02, -1.17658375313915136012e-02, 3.75358027235657282228e-02, 
+-0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, -0.00000000000000000000e+00, 9.99239017290715514363e-01, -3.75105875551998632633e-02, -1.06930886627224445290e-02, 3.66097148538233607695e-02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 9.99628934933781465588e-01, -1.36293127403002440473e-02, -1.22210621966412549128e-02, -1.08565715830357557153e-02, -9.54451268664114303719e-03, -8.29354926092189942421e-03, -7.11197370105688588676e-03, -6.00744537140464763408e-03, -4.98679877452942905969e-03, -4.05590480316916652398e-03, -1.07051027794878247414e-03, -2.48477838739987692135e-03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 1.00882513452050084912e-01, 9.08462075328539675478e-02, -9.82994434045538545419e-01, 7.14245833163940635480e-02, 6.21567000518667978071e-02, 5.32809677667735112627e-02, 4.48773582048770172670e-02, 3.70263843198277084467e-02, 1.01444214874588777703e-02, 2.80040036325163825548e-02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -9.74789964613308801411e-01, 1.18767980028143899096e-01, 1.05027673174802299583e-01, 9.18041037392534758910e-02, 7.91931582026773883687e-02, 6.72896761548402444486e-02, 5.61838708399685846095e-02, 4.59585623006532606460e-02, 1.23131067929696663699e-02, 3.06154265996620850165e-02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 9.68286468186335902431e-01, -1.28880155893949133183e-01, -1.14733351019826901318e-01, -1.01085266862500938734e-01, -8.80276801540450376526e-02, -7.56508368796356966968e-02, -6.40401408580171666030e-02, -5.32736524462577576422e-02, -4.34201984101816665373e-02, -1.15234986497271992001e-02, -2.74330206171405840965e-02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -9.81161623606298327616e-01, 1.06769563640290082729e-01, 9.36670418553526840100e-02, 8.10978974786056988622e-02, 6.91617377419390388926e-02, 5.79574300799796868211e-02, 4.75792268338119314630e-02, 1.28667183799098996250e-02, 3.34114805226275804473e-02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -9.86941318650821242109e-01, 9.32314647710150434801e-02, 8.10148869187302528294e-02, 6.93446288375196839837e-02, 5.83230931410276820515e-02, 4.80519541750073289621e-02, 1.31173385939099985259e-02, 3.56245151693867917464e-02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 7.72039634280436704028e-02, -9.93166868922355505767e-01, 5.83090695362133634716e-02, 4.94303834452216109274e-02, 4.10474395870231642536e-02, 1.14418447636268558187e-02, 3.45256472281257678625e-02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -9.91744706568265188551e-01, 7.87531993889616366289e-02, 6.76584776033337664813e-02, 5.71168643073226151019e-02, 4.72319961027885606986e-02, 1.30193449939717837555e-02, 3.70932994581127384315e-02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 9.95362152313443715457e-01, -6.41123361561603127834e-02, -5.43312045100809090648e-02, -4.51015534718144303628e-02, -1.25604213886778264680e-02, -3.77288269538387024959e-02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -9.97799081237745966177e-01, 5.01281227960631362017e-02, 4.17819321386413214392e-02, 1.17658375313915136012e-02, 3.75358027235657282228e-02, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -9.99239017290715514363e-01, 3.75105875551998632633e-02, 1.06930886627224445290e-02, 3.66097148538233607695e-02, 
+0.00000000000000000000e+00, 1.45638122037366618544e-02, 1.44242049013808826263e-02, 1.42848791173372114544e-02, -9.98896197597861967843e-01, 1.40070956931665508566e-02, 1.38686516282675552370e-02, 1.37305144384756109416e-02, 1.35926922534197486964e-02, 1.34551914219910584425e-02, 1.27065406949273523168e-02, 1.13725390209682974962e-02, 1.00836162982285513362e-02, 8.84792627985246139810e-03, 7.67340793824369989118e-03, 6.56749185702475927334e-03, 5.53689731339113838660e-03, 4.58748947462219499455e-03, 3.72417418103662472770e-03, 9.78154353266675637146e-04, 2.21993069105407957869e-03, 
+0.00000000000000000000e+00, 1.48615603981606878015e-02, -9.98857177766787507345e-01, 1.45747449259672080119e-02, 1.44317960255519583262e-02, 1.42891629466872591842e-02, 1.41468529479568741469e-02, 1.40048723575418795906e-02, 1.38632284208376095613e-02, 1.37219301649144868188e-02, 1.29529314746892020016e-02, 1.15837707880382424774e-02, 1.02625004537055895121e-02, 8.99743682866373239992e-03, 7.79658950899961809833e-03, 6.66738708994538131769e-03, 5.61648656149063996851e-03, 4.64963841368720535996e-03, 3.77159403334448826983e-03, 9.88519757605656364252e-04, 2.22173398879315460094e-03, 
+0.00000000000000000000e+00, -9.98837455262976847692e-01, 1.48655704443563674994e-02, 1.47203293504832941757e-02, 1.45754085738778009496e-02, 1.44308135542582163802e-02, 1.42865533356191266867e-02, 1.41426342487567767436e-02, 1.39990644332662877297e-02, 1.38558511376648679780e-02, 1.30765998528367278358e-02, 1.16897374714641649751e-02, 1.03521997811157132063e-02, 9.07237609922066298718e-03, 7.85830785434529256739e-03, 6.71742047171770655101e-03, 5.65633625579058975374e-03, 4.68074567983771828300e-03, 3.79532142804063065550e-03, 9.93701906394968024691e-04, 2.22265211259278349515e-03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 9.98935833447987420186e-01, -1.47982084099813199218e-02, -1.46530596864254056277e-02, -1.45082317275919882998e-02, -1.43637319288488270880e-02, -1.42195667145003507015e-02, -1.40757434532615393480e-02, -1.39322712827952433640e-02, -1.31514438521133023019e-02, -1.17612309541360263859e-02, -1.04196569028672265250e-02, -9.13516541318686384199e-03, -7.91588816924201042757e-03, -6.76936651170266263239e-03, -5.70235799121586190569e-03, -4.72069951756974841989e-03, -3.82921344924546476138e-03, -1.00360614712292992717e-03, -2.25548151375753362993e-03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -9.99034505732369293440e-01, 1.47289961636077517543e-02, 1.45839523235661728401e-02, 1.44392307228132944080e-02, 1.42948378791857080850e-02, 1.41507803772962202637e-02, 1.40070665970921676841e-02, 1.32247650342227959092e-02, 1.18313861404754309264e-02, 1.04859572233771871502e-02, 9.19697004634919407229e-03, 7.97264348199058087152e-03, 6.82063401614595252870e-03, 5.74783235399735879800e-03, 4.76022056334608496125e-03, 3.86277144860965168313e-03, 1.01343547315174893099e-03, 2.28831931885165691318e-03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -9.99331628842415220504e-01, 1.45100490298477550338e-02, 1.43654017476832328998e-02, 1.42210785933541920129e-02, 1.34349841427437062535e-02, 1.20332604660965472587e-02, 1.06774010614816127623e-02, 9.37601234561252251665e-03, 8.13755149812631431439e-03, 6.97000759844090822526e-03, 5.88066194078262511474e-03, 4.87592774642217358788e-03, 3.96122887867253990757e-03, 1.04241570689779018168e-03, 2.38675232795218386986e-03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 9.99232471611950834323e-01, -1.45849352021468151724e-02, -1.44401421783965991374e-02, -1.42956716732950128712e-02, -1.41515331722315632068e-02, -1.33665958826204300802e-02, -1.19674567166943041779e-02, -1.06148810453301298967e-02, -9.31743985065504320975e-03, -8.08351596454529898461e-03, -6.92099047840795487258e-03, -5.83701515669571638356e-03, -4.83786051133922295059e-03, -3.92880058815029201136e-03, -1.03284604929938903135e-03, -2.35396801794539962602e-03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -9.99430807811004018326e-01, 1.44332351845505753307e-02, 1.42887477592358955875e-02, 1.35016071266565920034e-02, 1.20975004686937649689e-02, 1.07385579553385280410e-02, 9.43341292218238987310e-03, 8.19059701015161650828e-03, 7.01820176278431049482e-03, 5.92363696614007281122e-03, 4.91345790030956863087e-03, 3.99323725176822276473e-03, 1.05188704314214680376e-03, 2.41949161923909290481e-03, 
+0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, 0.00000000000000000000e+00, -9.99529934948551357365e-01, 1.43544794050448568795e-02, 1.35664039580136210061e-02, 1.21601206297682427199e-02, 1.07982996597545191642e-02, 9.48959620530240473280e-03, 8.24261065615691096431e-03, 7.06553627351457283479e-03, 5.96590889553904289710e-03, 4.95042381162232470598e-03, 4.02480347441876856740e-03, 1.06125390803702931465e-03, 2.45217185403624271869e-03, 
+};
+
+const int16_t explicit_node_child_data_Attitude[ATTITUDE_EXPLICIT_NODES*2] = {
+1, 22, 
+2, 12, 
+3, 7, 
+4, 6, 
+5, -3, 
+-1, -2, 
+-4, -5, 
+8, 10, 
+-6, 9, 
+-7, -8, 
+11, -11, 
+-9, -10, 
+13, 18, 
+14, 17, 
+15, 16, 
+-12, -13, 
+-14, -15, 
+-16, -17, 
+19, 20, 
+-18, -19, 
+-20, 21, 
+-21, -22, 
+23, 33, 
+24, 28, 
+25, 26, 
+-23, -24, 
+-25, 27, 
+-26, -27, 
+29, 31, 
+-28, 30, 
+-29, -30, 
+-31, 32, 
+-32, -33, 
+34, 38, 
+35, 37, 
+-34, 36, 
+-35, -36, 
+-37, -38, 
+39, 40, 
+-39, -40, 
+-41, 41, 
+-42, -43, 
+};
+
+const int16_t explicit_leaf_start_data_Attitude[ATTITUDE_EXPLICIT_LEAVES+1] = {
+0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 39, 40, 41, 42, 43, 44, 
+};
+
+const int16_t explicit_leaf_regions_data_Attitude[ATTITUDE_EXPLICIT_CANDIDATES] = {
+25, 36, 32, 28, 31, 0, 30, 34, 29, 30, 33, 3, 14, 14, 32, 5, 8, 10, 11, 15, 16, 35, 1, 7, 2, 4, 6, 6, 9, 12, 9, 13, 20, 17, 19, 26, 19, 21, 27, 18, 27, 22, 23, 24, 
+};
+
+const explicitMpc_t explicit_mpc_Attitude = {
+	ATTITUDE_EXPLICIT_REGIONS,
+	ATTITUDE_EXPLICIT_NODES,
+	explicit_gain_data_Attitude,
+	explicit_offset_data_Attitude,
+	explicit_active_data_Attitude,
+	explicit_node_plane_data_Attitude,
+	explicit_node_child_data_Attitude,
+	explicit_leaf_start_data_Attitude,
+	explicit_leaf_regions_data_Attitude
+};
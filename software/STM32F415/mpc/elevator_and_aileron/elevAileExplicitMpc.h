@@ -0,0 +1,19 @@
+/*
+ * elevAileExplicitMpc.h
+ *
+ * This file was created automatically by explicitMpc.m
+ */
+
+#ifndef ELEVAILEEXPLICITMPC_H_
+#define ELEVAILEEXPLICITMPC_H_
+
+#include "mpc/mpc.h"
+
+#define ATTITUDE_EXPLICIT_REGIONS		37
+#define ATTITUDE_EXPLICIT_NODES			42
+#define ATTITUDE_EXPLICIT_LEAVES		43
+#define ATTITUDE_EXPLICIT_CANDIDATES	44
+
+extern const explicitMpc_t explicit_mpc_Attitude;
+
+#endif /* ELEVAILEEXPLICITMPC_H_ */
@@ -8,34 +8,52 @@
 #define MPCMATRICES_H_
 
 #include "CMatrixLib.h"
+#include <stdint.h>
 
 #define ATTITUDE_NUMBER_OF_STATES 		5
 #define ATTITUDE_HORIZON_LEN			200
+// number of the decision variables, the move-blocked inputs or the coefficients of the Laguerre functions
 #define ATTITUDE_REDUCED_HORIZON_LEN	20
 
+// uncomment when the matrices were generated with the Laguerre functions (parameterization = 2 in main.m)
+// the first variable is still the first input, the box constraints of the QP do not hold for the others
+// #define ATTITUDE_LAGUERRE_FUNCTIONS	1
+
+// the first variables act for one sample each, the rest is move blocked (0 with the Laguerre functions)
+#define ATTITUDE_SINGLE_STEP_LEN		10
+
 #define ATTITUDE_SYSTEM_DT				0.0101
 
 #define ATTITUDE_MAX_SPEED				1.8
 
-#define ATTITUDE_A_ROOF_HEIGHT				ATTITUDE_HORIZON_LEN*ATTITUDE_NUMBER_OF_STATES
-#define ATTITUDE_A_ROOF_WIDTH				ATTITUDE_NUMBER_OF_STATES
+// rows of the prediction with a nonzero weight in Q_roof, only these are stored
+#define ATTITUDE_WEIGHTED_ROWS				200
 
-#define ATTITUDE_Q_ROOF_DIAG_SIZE			ATTITUDE_HORIZON_LEN*ATTITUDE_NUMBER_OF_STATES
-
-#define	ATTITUDE_B_ROOF_HEIGHT				ATTITUDE_HORIZON_LEN*ATTITUDE_NUMBER_OF_STATES
+#define	ATTITUDE_B_ROOF_HEIGHT				ATTITUDE_WEIGHTED_ROWS
 #define	ATTITUDE_B_ROOF_WIDTH				ATTITUDE_REDUCED_HORIZON_LEN
 
 #define	ATTITUDE_H_INV_HEIGHT				ATTITUDE_REDUCED_HORIZON_LEN
 #define	ATTITUDE_H_INV_WIDTH				ATTITUDE_REDUCED_HORIZON_LEN
 
-#define ATTITUDE_ALLSTATE_REFERENCE_LEN		ATTITUDE_NUMBER_OF_STATES*ATTITUDE_HORIZON_LEN
+const float A_data_Attitude[ATTITUDE_NUMBER_OF_STATES*ATTITUDE_NUMBER_OF_STATES];
+
+const float B_data_Attitude[ATTITUDE_NUMBER_OF_STATES];
 
-const float A_roof_data_Attitude[ATTITUDE_A_ROOF_HEIGHT*ATTITUDE_A_ROOF_WIDTH];
+const int16_t weighted_rows_data_Attitude[ATTITUDE_WEIGHTED_ROWS];
 
-const float Q_roof_diag_data_Attitude[ATTITUDE_Q_ROOF_DIAG_SIZE];
+const float Q_weighted_data_Attitude[ATTITUDE_WEIGHTED_ROWS];
 
 const float B_roof_data_Attitude[ATTITUDE_B_ROOF_HEIGHT*ATTITUDE_B_ROOF_WIDTH];
 
 const float H_inv_data_Attitude[ATTITUDE_H_INV_HEIGHT*ATTITUDE_H_INV_WIDTH];
 
+// int16 copies for MPC_QUANTIZED, B_roof is transposed, a column j is scaled by *_scale_data_Attitude[j]
+const int16_t B_roof_q15_data_Attitude[ATTITUDE_B_ROOF_WIDTH*ATTITUDE_B_ROOF_HEIGHT] __attribute__ ((aligned (4)));
+
+const float B_roof_scale_data_Attitude[ATTITUDE_B_ROOF_WIDTH];
+
+const int16_t H_inv_q15_data_Attitude[ATTITUDE_H_INV_HEIGHT*ATTITUDE_H_INV_WIDTH] __attribute__ ((aligned (4)));
+
+const float H_inv_scale_data_Attitude[ATTITUDE_H_INV_WIDTH];
+
 #endif /* MPCMATRICES_H_ */
@@ -0,0 +1,130 @@
+/*
+ * explicitMpc.c
+ *
+ *  Author: Tomas Baca
+ */
+
+#include "explicitMpc.h"
+#include "config.h"
+#include <math.h>
+
+// evaluates the law of the region, returns 1 if it satisfies the optimality conditions
+static int explicitRegionLaw(const mpcHandler_t * handler, const int region, const float * c, float * u) {
+
+	const explicitMpc_t * law = handler->explicit_law;
+	const int n = handler->reduced_horizon_len;
+	const float limit = handler->input_limit;
+
+	const float * gain = &law->gain[region*n*n];
+	const float * offset = &law->offset[region*n];
+	const int8_t * active = &law->active[region*n];
+
+	float * H = handler->H->data;
+	float * H_scaling = handler->H_scaling->data;
+
+	float gradient;
+	int i, j;
+
+	// u = gain*c + offset, the rows of the active inputs are just their limits
+	for (i = 0; i < n; i++) {
+
+		u[i] = offset[i];
+
+		if (active[i] != 0)
+			continue;
+
+		for (j = 0; j < n; j++)
+			u[i] += gain[i*n + j]*c[j];
+
+		// primal feasibility
+		if (fabs(u[i]) > limit + MPC_QP_TOLERANCE)
+			return 0;
+	}
+
+	// the gradient has to push the active inputs against their limits
+	for (i = 0; i < n; i++) {
+
+		if (active[i] == 0)
+			continue;
+
+		gradient = c[i];
+		for (j = 0; j < n; j++)
+			gradient += H[i*n + j]*u[j];
+
+		// the same scaling as the projected gradient step of the QP
+		if (active[i]*gradient*H_scaling[i] > MPC_QP_TOLERANCE)
+			return 0;
+	}
+
+	return 1;
+}
+
+float calculateMPCExplicit(mpcHandler_t * handler) {
+
+	const explicitMpc_t * law = handler->explicit_law;
+	const int n = handler->reduced_horizon_len;
+
+	// the workspace of the handler, the fallback to calculateMPCConstrained() reuses it
+	float * c = handler->work_c;
+	float * u = handler->work_y;
+
+	float side;
+	int node, leaf, i, j;
+
+	handler->rows_done = calculateMPCLinearTerm(handler, c);
+
+	// the prediction was cut off by the deadline (MPC_DEADLINE)
+	if (handler->rows_done < handler->number_of_weighted_rows) {
+
+		handler->explicit_region = -1;
+		return calculateMPCDeadlineFallback(handler);
+	}
+
+	// walk the tree down to a leaf
+	node = (law->number_of_nodes > 0) ? 0 : -1;
+
+	while (node >= 0) {
+
+		const float * plane = &law->node_plane[node*(n+1)];
+
+		side = 0;
+		for (j = 0; j < n; j++)
+			side += plane[j]*c[j];
+
+		node = law->node_child[2*node + ((side <= plane[n]) ? 0 : 1)];
+	}
+
+	leaf = -(node+1);
+
+	// the leaf can be shared by several regions
+	for (i = law->leaf_start[leaf]; i < law->leaf_start[leaf+1]; i++) {
+
+		if (explicitRegionLaw(handler, law->leaf_regions[i], c, u)) {
+
+			handler->explicit_region = law->leaf_regions[i];
+			return u[0];
+		}
+	}
+
+	// the region was not enumerated by the generator
+	handler->explicit_region = -1;
+
+#ifdef MPC_CONSTRAINED
+	return calculateMPCConstrained(handler);
+#else
+	// the first row of H_inv*(c./(-2)), saturated
+	float output = 0;
+
+	for (j = 0; j < n; j++)
+		output += handler->H_inv->data[j]*c[j];
+
+	output *= -0.5;
+
+	if (output > handler->input_limit)
+		output = handler->input_limit;
+	else if (output < -handler->input_limit)
+		output = -handler->input_limit;
+
+	return output;
+#endif
+}
@@ -0,0 +1,22 @@
+/*
+ * explicitMpc.h
+ *
+ *  Author: Tomas Baca
+ */
+
+#ifndef EXPLICITMPC_H_
+#define EXPLICITMPC_H_
+
+#include "mpc.h"
+
+/**
+ * @brief compute the first action of the constrained MPC from the explicit tables
+ *
+ * The binary tree gives the candidate regions in O(log regions), the first one
+ * satisfying the optimality conditions gives the action. When none does, the
+ * constrained QP (MPC_CONSTRAINED) or the saturated unconstrained solution is used.
+ * Needs explicit_law and the hessian from initializeConstrainedMPC().
+ */
+float calculateMPCExplicit(mpcHandler_t * handler);
+
+#endif /* EXPLICITMPC_H_ */
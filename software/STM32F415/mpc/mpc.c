@@ -5,82 +5,978 @@
  */
 
 #include "mpc.h"
+#include "miscellaneous.h"
+#include "explicitMpc.h"
+#include "config.h"
+#include <math.h>
+#include <string.h>
+
+#if defined(MPC_DEADLINE) && !defined(MPC_FULL_VECTOR) && !defined(MPC_CONSTRAINED) && !defined(MPC_EXPLICIT)
+#error "MPC_DEADLINE bounds the prediction and the QP, the condensed MPC has neither"
+#endif
+
+// one step of the input preshaper, limits the speed of the reference
+static float preshapeReference(const mpcHandler_t * handler, const float previous, const float position_reference) {
+
+	// compute the difference
+	float difference = previous - position_reference;
+
+	// saturate the difference
+	if (difference > handler->max_speed*handler->dt)
+		difference = handler->max_speed*handler->dt;
+	else if (difference < -handler->max_speed*handler->dt)
+		difference = -handler->max_speed*handler->dt;
+
+	return previous - difference;
+}
+
+// index of the i-th (from 0) sample of the horizon in the ring buffers
+static int referenceIndex(const mpcHandler_t * handler, const int i) {
+
+	int index = handler->reference_head + i;
+
+	if (index >= handler->horizon_len)
+		index -= handler->horizon_len;
+
+	return index;
+}
+
+// move the head of the ring buffers, the samples at the new end have to be filled by the caller
+static void advanceReference(mpcHandler_t * handler, const int samples) {
+
+	handler->reference_head = (handler->reference_head + samples) % handler->horizon_len;
+
+	if (handler->reference_time != MPC_NO_TRAJECTORY)
+		handler->reference_time += samples;
+
+	handler->reference_known -= samples;
+	if (handler->reference_known < 0)
+		handler->reference_known = 0;
+
+	handler->reference_filter_from -= samples;
+	if (handler->reference_filter_from < 0)
+		handler->reference_filter_from = 0;
+}
+
+void setReferenceSetpoint(mpcHandler_t * handler, const float setpoint) {
+
+	// the same setpoint is sent repeatedly, the reference is already constant then
+	if (handler->reference_time != MPC_NO_TRAJECTORY || mpcPositionReferenceAt(handler, 0) != setpoint)
+		vector_float_set_to(handler->position_reference, setpoint);
+
+	handler->reference_time = MPC_NO_TRAJECTORY;
+	handler->reference_known = handler->horizon_len;
+
+	// the filter starts from the current position again
+	handler->reference_filter_from = 0;
+}
+
+void setReferenceTrajectory(mpcHandler_t * handler, const float * keypoints, const int time) {
+
+	float * position_reference = handler->position_reference->data;
+
+	int spacing = handler->horizon_len/(MPC_TRAJECTORY_POINTS - 1);
+	int shift = time - handler->reference_time;
+
+	// not a continuation of the current trajectory (the first one, after a setpoint, restarted or too far)
+	if (handler->reference_time == MPC_NO_TRAJECTORY || shift >= handler->horizon_len || shift <= -handler->horizon_len) {
+
+		handler->reference_time = time;
+		handler->reference_known = 0;
+		handler->reference_filter_from = 0;
+
+	// the key-points start later than the horizon, move it to them
+	} else if (shift > 0) {
+
+		advanceReference(handler, shift);
+	}
+
+	// position of the first key-point in the horizon (negative when it is already behind the head)
+	int origin = time - handler->reference_time;
+
+	int i, j, sample;
+
+	// interpolate only the samples which are not covered by the previous key-points
+	for (i = handler->reference_known; i < handler->horizon_len; i++) {
+
+		sample = i - origin;
+		j = sample/spacing;
+
+		// behind the last key-point, hold it
+		if (j >= MPC_TRAJECTORY_POINTS - 1)
+			position_reference[referenceIndex(handler, i)] = keypoints[MPC_TRAJECTORY_POINTS - 1];
+		else
+			position_reference[referenceIndex(handler, i)] = keypoints[j] + (sample - j*spacing)*((keypoints[j+1] - keypoints[j])/spacing);
+	}
+
+	if (handler->reference_known < handler->reference_filter_from)
+		handler->reference_filter_from = handler->reference_known;
+
+	// the samples up to the last key-point are final
+	handler->reference_known = origin + spacing*(MPC_TRAJECTORY_POINTS - 1) + 1;
+	if (handler->reference_known > handler->horizon_len)
+		handler->reference_known = handler->horizon_len;
+}
 
 void filterReferenceTrajectory(mpcHandler_t * handler) {
 
-	float difference;
+	float * reference = handler->filtered_reference->data;
+	float * position_reference = handler->position_reference->data;
+
+	int i = handler->reference_filter_from;
+	int index;
+
+	// the filtered reference is up to date
+	if (i >= handler->horizon_len)
+		return;
+
+	// the whole reference starts from the current position
+	if (i == 0) {
+
+		reference[handler->reference_head] = handler->initial_cond->data[0];
+		i = 1;
+	}
+
+	float previous = reference[referenceIndex(handler, i-1)];
+
+	for (; i < handler->horizon_len; i++) {
+
+		index = referenceIndex(handler, i);
+
+		previous = preshapeReference(handler, previous, position_reference[index]);
+		reference[index] = previous;
+	}
+
+	handler->reference_filter_from = handler->horizon_len;
+}
+
+void shiftReferenceTrajectory(mpcHandler_t * handler) {
+
+	// the last sample of the position reference is the best guess for the new end
+	float last = mpcPositionReferenceAt(handler, handler->horizon_len - 1);
+
+	// the oldest sample is dropped, its place becomes the new end of the horizon
+	advanceReference(handler, 1);
+
+	handler->position_reference->data[referenceIndex(handler, handler->horizon_len - 1)] = last;
+
+	// filters the new end (or more, if something else has changed)
+	filterReferenceTrajectory(handler);
+}
+
+void initializeCondensedMPC(mpcHandler_t * handler) {
+
+	const int n = handler->number_of_states;
+	int i, j, k, r;
+
+	handler->state_gain = vector_float_alloc(n, 1);
+	vector_float_set_zero(handler->state_gain);
+
+	handler->reference_gain = vector_float_alloc(handler->horizon_len, 1);
+	vector_float_set_zero(handler->reference_gain);
+
+	// w = -0.5*(first row of H_inv)
+	double w[handler->reduced_horizon_len];
+	for (j = 1; j <= handler->reduced_horizon_len; j++)
+		w[j-1] = -0.5*matrix_float_get(handler->H_inv, 1, j);
+
+	// sums are done in double, it is computed only once
+	double state_gain[n];
+	for (j = 0; j < n; j++)
+		state_gain[j] = 0;
+
+	// power = A^(step+1), the block of A_roof of the current step
+	double power[n][n];
+	double next[n][n];
+	int step = 0;
+
+	for (i = 0; i < n; i++)
+		for (j = 0; j < n; j++)
+			power[i][j] = matrix_float_get(handler->A, i+1, j+1);
+
+	double row_gain;
+	int row, state;
+
+	// u(1) = w*B_roof'*Q_roof*(A_roof*x - reference), go through the weighted rows of the prediction
+	for (r = 0; r < handler->number_of_weighted_rows; r++) {
+
+		row = handler->weighted_rows[r];
+		state = row % n;
+
+		// move the power to the step of this row
+		for (; step < row/n; step++) {
+
+			for (i = 0; i < n; i++)
+				for (j = 0; j < n; j++) {
+
+					next[i][j] = 0;
+					for (k = 0; k < n; k++)
+						next[i][j] += matrix_float_get(handler->A, i+1, k+1)*power[k][j];
+				}
+
+			for (i = 0; i < n; i++)
+				for (j = 0; j < n; j++)
+					power[i][j] = next[i][j];
+		}
+
+		// row_gain = Q_roof(row, row)*B_roof(row, :)*w'
+		row_gain = 0;
+		for (j = 1; j <= handler->reduced_horizon_len; j++)
+			row_gain += matrix_float_get(handler->B_roof, r+1, j)*w[j-1];
+		row_gain *= vector_float_get(handler->Q_weighted, r+1);
+
+		// state_gain += row_gain*A_roof(row, :)
+		for (j = 0; j < n; j++)
+			state_gain[j] += row_gain*power[state][j];
+
+		// the reference is defined only for the first state (the position)
+		if (state == 0)
+			vector_float_set(handler->reference_gain, row/n + 1, (float) -row_gain);
+	}
+
+	for (j = 1; j <= n; j++)
+		vector_float_set(handler->state_gain, j, (float) state_gain[j-1]);
+}
+
+void initializeMPCWorkspace(mpcHandler_t * handler) {
+
+	const int rows = handler->number_of_weighted_rows;
+	const int n_variables = handler->reduced_horizon_len;
+
+	handler->work_error = (float *) arenaAlloc(rows*sizeof(float));
+	handler->work_c = (float *) arenaAlloc(n_variables*sizeof(float));
+	handler->work_y = (float *) arenaAlloc(n_variables*sizeof(float));
+	handler->work_previous = (float *) arenaAlloc(n_variables*sizeof(float));
+	handler->work_state = (float *) arenaAlloc(2*handler->number_of_states*sizeof(float));
+
+	// the longer of the quantized error and the quantized linear term
+	handler->work_q15 = (int32_t *) arenaAlloc((((rows > n_variables) ? rows : n_variables) + 1)/2*sizeof(int32_t));
+}
+
+/* -------------------------------------------------------------------- */
+/*	Placement of the tables												*/
+/* -------------------------------------------------------------------- */
+
+// the tables in flash and their copies in the arena, shared by the handlers
+#define MPC_PLACED_TABLES	16
+
+static const void * placedSources[MPC_PLACED_TABLES];
+static const void * placedCopies[MPC_PLACED_TABLES];
+static int placedTables;
 
-	vector_float_set(handler->allstate_reference, 1, vector_float_get(handler->initial_cond, 1));
+#ifdef MPC_TABLES_IN_ARENA
 
+// the copy of the table, the same for all handlers, the table itself when it does not fit
+static const void * placeTable(const void * table, const size_t size) {
+
+	void * copy;
 	int i;
-	for (i = 2; i <= handler->position_reference->length; i++) {
 
-		// compute the difference
-		difference = vector_float_get(handler->allstate_reference, (i-2)*handler->number_of_states + 1) - vector_float_get(handler->position_reference, i);
+	for (i = 0; i < placedTables; i++)
+		if (placedSources[i] == table)
+			return placedCopies[i];
+
+	if (placedTables >= MPC_PLACED_TABLES || (copy = arenaAlloc(size)) == 0)
+		return table;
+
+	memcpy(copy, table, size);
+
+	placedSources[placedTables] = table;
+	placedCopies[placedTables] = copy;
+	placedTables++;
+
+	return copy;
+}
+
+#endif
+
+void placeMPCTables(mpcHandler_t * handler) {
 
-		// saturate the difference
-		if (difference > handler->max_speed*handler->dt)
-			difference = handler->max_speed*handler->dt;
-		else if (difference < -handler->max_speed*handler->dt)
-			difference = -handler->max_speed*handler->dt;
+#ifdef MPC_TABLES_IN_ARENA
+	const int n = handler->number_of_states;
+	const int rows = handler->number_of_weighted_rows;
+	const int n_variables = handler->reduced_horizon_len;
 
-		vector_float_set(handler->allstate_reference, (i-1)*handler->number_of_states + 1, vector_float_get(handler->allstate_reference, (i-2)*handler->number_of_states + 1) - difference);
+	handler->A->data = (float *) placeTable(handler->A->data, n*n*sizeof(float));
+	handler->B->data = (float *) placeTable(handler->B->data, n*sizeof(float));
+	handler->Q_weighted->data = (float *) placeTable(handler->Q_weighted->data, rows*sizeof(float));
+	handler->weighted_rows = (const int16_t *) placeTable(handler->weighted_rows, rows*sizeof(int16_t));
+	handler->H_inv->data = (float *) placeTable(handler->H_inv->data, n_variables*n_variables*sizeof(float));
+
+#ifdef MPC_QUANTIZED
+	// the float B_roof is not read by the quantized step
+	handler->B_roof_q15 = (const int16_t *) placeTable(handler->B_roof_q15, rows*n_variables*sizeof(int16_t));
+	handler->B_roof_scale = (const float *) placeTable(handler->B_roof_scale, n_variables*sizeof(float));
+	handler->H_inv_q15 = (const int16_t *) placeTable(handler->H_inv_q15, n_variables*n_variables*sizeof(int16_t));
+	handler->H_inv_scale = (const float *) placeTable(handler->H_inv_scale, n_variables*sizeof(float));
+#else
+	handler->B_roof->data = (float *) placeTable(handler->B_roof->data, rows*n_variables*sizeof(float));
+#endif
+#endif
+}
+
+// the other placement of the table, the table itself when it was not placed
+static const void * swapTable(const void * table) {
+
+	int i;
+
+	for (i = 0; i < placedTables; i++) {
+
+		if (placedCopies[i] == table)
+			return placedSources[i];
+
+		if (placedSources[i] == table)
+			return placedCopies[i];
 	}
+
+	return table;
 }
 
-float calculateMPC(mpcHandler_t * handler) {
+void swapMPCTablePlacement(mpcHandler_t * handler) {
 
-	/* -------------------------------------------------------------------- */
-	/*	Allocate temp vectors for partresults								*/
-	/* -------------------------------------------------------------------- */
+	handler->A->data = (float *) swapTable(handler->A->data);
+	handler->B->data = (float *) swapTable(handler->B->data);
+	handler->Q_weighted->data = (float *) swapTable(handler->Q_weighted->data);
+	handler->weighted_rows = (const int16_t *) swapTable(handler->weighted_rows);
+	handler->H_inv->data = (float *) swapTable(handler->H_inv->data);
+	handler->B_roof->data = (float *) swapTable(handler->B_roof->data);
+	handler->B_roof_q15 = (const int16_t *) swapTable(handler->B_roof_q15);
+	handler->B_roof_scale = (const float *) swapTable(handler->B_roof_scale);
+	handler->H_inv_q15 = (const int16_t *) swapTable(handler->H_inv_q15);
+	handler->H_inv_scale = (const float *) swapTable(handler->H_inv_scale);
+}
+
+void initializeConstrainedMPC(mpcHandler_t * handler) {
+
+	int n = handler->reduced_horizon_len;
+	int i, j, k;
+
+	handler->H = matrix_float_alloc(n, n);
+	handler->H_scaling = vector_float_alloc(n, 0);
+
+	handler->qp_solution = vector_float_alloc(n, 0);
+	vector_float_set_zero(handler->qp_solution);
+	handler->qp_converged_at = 0;
+
+	// H_inv is symmetric positive definite, Gauss-Jordan in place without pivoting
+	double H[n][n];
+	double pivot, factor;
 
-	vector_float temp_vector1;
-	float temp_vector1_data[handler->number_of_states*handler->horizon_len];
-	temp_vector1.data = (float*) &temp_vector1_data;
-	temp_vector1.length = handler->number_of_states*handler->horizon_len;
-	temp_vector1.orientation = 0;
+	for (i = 0; i < n; i++)
+		for (j = 0; j < n; j++)
+			H[i][j] = matrix_float_get(handler->H_inv, i+1, j+1);
 
-	vector_float temp_vector2;
-	float temp_vector2_data[handler->reduced_horizon_len];
-	temp_vector2.data = (float*) &temp_vector2_data;
-	temp_vector2.length = handler->reduced_horizon_len;
-	temp_vector2.orientation = 1;
+	for (k = 0; k < n; k++) {
 
-	vector_float temp_vector3;
-	float temp_vector3_data[handler->reduced_horizon_len];
-	temp_vector3.data = (float*) &temp_vector3_data;
-	temp_vector3.length = handler->reduced_horizon_len;
-	temp_vector3.orientation = 0;
+		pivot = H[k][k];
+		H[k][k] = 1;
 
-	/* -------------------------------------------------------------------- */
-	/*	Procede the MPC														*/
-	/* -------------------------------------------------------------------- */
+		for (j = 0; j < n; j++)
+			H[k][j] /= pivot;
+
+		for (i = 0; i < n; i++) {
+
+			if (i == k)
+				continue;
+
+			factor = H[i][k];
+			H[i][k] = 0;
+
+			for (j = 0; j < n; j++)
+				H[i][j] -= factor*H[k][j];
+		}
+	}
 
-	// temp_vector1 <- A_roof*states
-	matrix_float_mul_vec_right(handler->A_roof, handler->initial_cond, &temp_vector1);
+	// H_inv = (0.5*H)^-1, thus H = 2*inv(H_inv)
+	double bound;
 
-	//temp_vector1 <- temp_vector1 - reference
-	vector_float_subtract(&temp_vector1, handler->allstate_reference);
+	for (i = 0; i < n; i++) {
+
+		bound = 0;
+
+		for (j = 0; j < n; j++) {
+
+			matrix_float_set(handler->H, i+1, j+1, (float) (2*H[i][j]));
+			bound += fabs(2*H[i][j]);
+		}
+
+		// diag(bound) - H is diagonally dominant, the scaled step cannot diverge
+		vector_float_set(handler->H_scaling, i+1, (float) (1/bound));
+	}
+}
+
+#ifdef MPC_DEADLINE
+
+// the cycle counter wraps around, the difference is compared as signed
+static int deadlinePassed(const mpcHandler_t * handler) {
+
+	return ((int32_t) (cycleCounterGet() - handler->deadline)) >= 0;
+}
 
-	// X_0'*Q_roof
-	// simplified product of a vector and a diagonal matrix Q_roof
+#endif
+
+// error = Q_roof*(A_roof*initial_cond - reference) in the weighted rows of the prediction
+// returns the number of rows computed, with bounded set it stops at the deadline (MPC_DEADLINE)
+static int calculateWeightedError(const mpcHandler_t * handler, float * error, const int bounded) {
+
+	const int n = handler->number_of_states;
+
+	float * A = handler->A->data;
+	float * Q_weighted = handler->Q_weighted->data;
+
+	// the free response A^step*initial_cond, computed by recurrence
+	float * state = handler->work_state;
+	float * next = state + n;
+	int step = 0;
+
+	int i, j, r, row;
+
+	for (i = 0; i < n; i++)
+		state[i] = handler->initial_cond->data[i];
+
+	for (r = 0; r < handler->number_of_weighted_rows; r++) {
+
+#ifdef MPC_DEADLINE
+		if (bounded && (r % MPC_DEADLINE_CHUNK) == 0 && deadlinePassed(handler))
+			break;
+#endif
+
+		row = handler->weighted_rows[r];
+
+		// the block of the row belongs to A^(row/n + 1)
+		for (; step <= row/n; step++) {
+
+			for (i = 0; i < n; i++) {
+
+				next[i] = 0;
+				for (j = 0; j < n; j++)
+					next[i] += A[i*n + j]*state[j];
+			}
+
+			for (i = 0; i < n; i++)
+				state[i] = next[i];
+		}
+
+		error[r] = state[row % n];
+
+		// the reference is defined for the position only
+		if ((row % n) == 0)
+			error[r] -= mpcReferenceAt(handler, row/n);
+
+		error[r] *= Q_weighted[r];
+	}
+
+	return r;
+}
+
+#ifdef MPC_QUANTIZED
+
+// values ~ scale*quantized, one scale for the whole vector, returns the scale
+static float quantizeVector(const float * values, int16_t * quantized, const int length) {
+
+	float max_value = 0;
+	float inverse;
+	int i;
+
+	for (i = 0; i < length; i++)
+		if (fabsf(values[i]) > max_value)
+			max_value = fabsf(values[i]);
+
+	if (max_value == 0) {
+
+		for (i = 0; i < length; i++)
+			quantized[i] = 0;
+
+		return 0;
+	}
+
+	inverse = 32767/max_value;
+
+	for (i = 0; i < length; i++)
+		quantized[i] = (int16_t) roundf(values[i]*inverse);
+
+	return max_value/32767;
+}
+
+// a'*b of two int16 vectors aligned to 4 bytes, SMLALD does two multiply-accumulates into 64 bits
+static int64_t dotQ15(const int16_t * a, const int16_t * b, const int length) {
+
+	const uint32_t * a_pairs = (const uint32_t *) a;
+	const uint32_t * b_pairs = (const uint32_t *) b;
+
+	uint64_t sum = 0;
 	int i;
-	for (i = 1; i <= handler->number_of_states*handler->horizon_len; i++)
-		vector_float_set(&temp_vector1, i, vector_float_get(&temp_vector1, i) * vector_float_get(handler->Q_roof_diag, i));
 
-	vector_float_transpose(&temp_vector1);
+	for (i = 0; i < length/2; i++)
+		sum = __SMLALD(a_pairs[i], b_pairs[i], sum);
+
+	if (length & 1)
+		sum += (int32_t) a[length-1]*b[length-1];
+
+	return (int64_t) sum;
+}
+
+// the columns of B_roof_q15 start aligned only with an even number of the weighted rows
+int calculateMPCLinearTerm(const mpcHandler_t * handler, float * c) {
+
+	const int n_variables = handler->reduced_horizon_len;
+	const int rows = handler->number_of_weighted_rows;
+
+	float * error = handler->work_error;
+	int16_t * error_q15 = (int16_t *) handler->work_q15;
 
-	// c = (X_0'*Q_roof)*B_roof
-	matrix_float_mul_vec_left(handler->B_roof, &temp_vector1, &temp_vector2);
+	float error_scale;
+	int done, j;
 
-	vector_float_transpose(&temp_vector2);
+	// the quantization needs the whole error vector
+	done = calculateWeightedError(handler, error, 1);
 
-	// c./(-2)
-	vector_float_times(&temp_vector2, (float) -0.5);
+	if (done < rows)
+		return done;
 
-	// H_inv*(c./(-2))
-	matrix_float_mul_vec_right(handler->H_inv, &temp_vector2, &temp_vector3);
+	error_scale = quantizeVector(error, error_q15, rows);
+
+	// c(j) = error'*B_roof(:, j), a contiguous row of the transposed table
+	for (j = 0; j < n_variables; j++) {
+
+#ifdef MPC_DEADLINE
+		// each column covers all the rows, c is not usable without all of them
+		if (deadlinePassed(handler))
+			return 0;
+#endif
+
+		c[j] = (float) dotQ15(error_q15, handler->B_roof_q15 + j*rows, rows)*(error_scale*handler->B_roof_scale[j]);
+	}
+
+	return rows;
+}
+
+// first value of H_inv*(c./(-2)) from the int16 table
+static float calculateFirstActionQ15(const mpcHandler_t * handler, const float * c) {
+
+	const int n_variables = handler->reduced_horizon_len;
+
+	// the quantized error is not needed any more
+	float * scaled = handler->work_y;
+	int16_t * scaled_q15 = (int16_t *) handler->work_q15;
+
+	float scaled_scale;
+	int j;
+
+	// the column scales of H_inv go to the vector, then the row is a plain int16 dot product
+	for (j = 0; j < n_variables; j++)
+		scaled[j] = c[j]*handler->H_inv_scale[j];
+
+	scaled_scale = quantizeVector(scaled, scaled_q15, n_variables);
+
+	return (float) dotQ15(handler->H_inv_q15, scaled_q15, n_variables)*(scaled_scale*(float) -0.5);
+}
+
+#else
+
+int calculateMPCLinearTerm(const mpcHandler_t * handler, float * c) {
+
+	const int n_variables = handler->reduced_horizon_len;
+
+	float * B_roof = handler->B_roof->data;
+	float * error = handler->work_error;
+
+	int rows, j, r;
+
+	rows = calculateWeightedError(handler, error, 1);
+
+	for (j = 0; j < n_variables; j++)
+		c[j] = 0;
+
+	for (r = 0; r < rows; r++) {
+
+#ifdef MPC_DEADLINE
+		if ((r % MPC_DEADLINE_CHUNK) == 0 && deadlinePassed(handler))
+			break;
+#endif
+
+		for (j = 0; j < n_variables; j++)
+			c[j] += error[r]*B_roof[r*n_variables + j];
+	}
+
+	return r;
+}
+
+#endif
+
+void predictInitialCondition(mpcHandler_t * handler, const float * inputs, const int steps, const float fraction) {
+
+	const int n = handler->number_of_states;
+
+	float * A = handler->A->data;
+	float * B = handler->B->data;
+	float * state = handler->initial_cond->data;
+
+	float * next = handler->work_state;
+	int i, j, step;
+
+	for (step = 0; step <= steps; step++) {
+
+		// the whole samples are done, the rest of the latency is a part of the last one
+		if (step == steps && fraction <= 0)
+			break;
+
+		for (i = 0; i < n; i++) {
+
+			next[i] = B[i]*inputs[step];
+			for (j = 0; j < n; j++)
+				next[i] += A[i*n + j]*state[j];
+		}
+
+		if (step == steps) {
+
+			for (i = 0; i < n; i++)
+				state[i] += fraction*(next[i] - state[i]);
+
+		} else {
+
+			for (i = 0; i < n; i++)
+				state[i] = next[i];
+		}
+	}
+}
+
+float calculateMPCFull(mpcHandler_t * handler) {
+
+	float * c = handler->work_c;
+
+	// c = (X_0'*Q_roof)*B_roof, bounded by the deadline (MPC_DEADLINE)
+	handler->rows_done = calculateMPCLinearTerm(handler, c);
+
+	if (handler->rows_done < handler->number_of_weighted_rows)
+		return calculateMPCDeadlineFallback(handler);
+
+#ifdef MPC_QUANTIZED
+
+	return calculateFirstActionQ15(handler, c);
+
+#else
+
+	float * H_inv = handler->H_inv->data;
+
+	float output = 0;
+	int j;
+
+	// the first value of H_inv*(c./(-2))
+	for (j = 0; j < handler->reduced_horizon_len; j++)
+		output += H_inv[j]*c[j];
+
+	return output*(float) -0.5;
+
+#endif
+}
+
+float calculateMPCCondensed(mpcHandler_t * handler) {
+
+	// direct access to the data, this loop runs every MPC step
+	float * state_gain = handler->state_gain->data;
+	float * reference_gain = handler->reference_gain->data;
+	float * initial_cond = handler->initial_cond->data;
+	float * reference = handler->filtered_reference->data;
+
+	float output = 0;
+
+	int i;
+
+	// state_gain*initial_cond
+	for (i = 0; i < handler->number_of_states; i++)
+		output += state_gain[i]*initial_cond[i];
+
+	// reference_gain*(reference over the horizon)
+	// the ring buffer is read in two parts, from the head to its end and from its beginning
+	int first_part = handler->horizon_len - handler->reference_head;
+
+	for (i = 0; i < first_part; i++)
+		output += reference_gain[i]*reference[handler->reference_head + i];
+
+	for (i = first_part; i < handler->horizon_len; i++)
+		output += reference_gain[i]*reference[i - first_part];
+
+	return output;
+}
+
+float calculateMPCConstrained(mpcHandler_t * handler) {
+
+	const int n_variables = handler->reduced_horizon_len;
+	const float limit = handler->input_limit;
+
+	float * H = handler->H->data;
+	float * H_scaling = handler->H_scaling->data;
+	float * u = handler->qp_solution->data;
+
+	float * c = handler->work_c;
+	float * previous = handler->work_previous;
+	float * y = handler->work_y;
+
+	float gradient, change, max_change;
+	float t = 1, t_next;
+	int i, j, k;
+
+	// warm start, the previous solution is one sample older
+	// the single-step variables move forward, the first block starts one sample sooner
+	for (i = 0; i < handler->single_step_len && i < n_variables-1; i++)
+		u[i] = u[i+1];
+
+	handler->qp_converged_at = 0;
+	handler->qp_iterations_done = 0;
+
+	handler->rows_done = calculateMPCLinearTerm(handler, c);
+
+	// the prediction was cut off by the deadline, there is no linear term to iterate with
+	if (handler->rows_done < handler->number_of_weighted_rows)
+		return calculateMPCDeadlineFallback(handler);
+
+	for (i = 0; i < n_variables; i++)
+		y[i] = u[i];
+
+	for (k = 0; k < MPC_QP_ITERATIONS; k++) {
+
+#ifdef MPC_DEADLINE
+		// at least one iteration, the projection keeps any iterate feasible
+		if (k > 0 && deadlinePassed(handler))
+			break;
+#endif
+
+		max_change = 0;
+
+		// projected gradient step from y, scaled for each variable
+		for (i = 0; i < n_variables; i++) {
+
+			gradient = c[i];
+			for (j = 0; j < n_variables; j++)
+				gradient += H[i*n_variables + j]*y[j];
+
+			previous[i] = u[i];
+
+			u[i] = y[i] - H_scaling[i]*gradient;
+
+			// projection on the box constraints
+			if (u[i] > limit)
+				u[i] = limit;
+			else if (u[i] < -limit)
+				u[i] = -limit;
+
+			change = fabs(u[i] - previous[i]);
+			if (change > max_change)
+				max_change = change;
+		}
+
+		if (max_change > MPC_QP_TOLERANCE)
+			handler->qp_converged_at = k+1;
+
+		// Nesterov momentum
+		t_next = (1 + sqrtf(1 + 4*t*t))/2;
+
+		for (i = 0; i < n_variables; i++)
+			y[i] = u[i] + ((t - 1)/t_next)*(u[i] - previous[i]);
+
+		t = t_next;
+	}
+
+	handler->qp_iterations_done = k;
+
+	return u[0];
+}
+
+float calculateMPCDeadlineFallback(mpcHandler_t * handler) {
+
+	float output = calculateMPCCondensed(handler);
+
+	if (output > handler->input_limit)
+		output = handler->input_limit;
+	else if (output < -handler->input_limit)
+		output = -handler->input_limit;
+
+	return output;
+}
+
+float calculateMPC(mpcHandler_t * handler) {
+
+#if defined(MPC_EXPLICIT)
+	return calculateMPCExplicit(handler);
+#elif defined(MPC_CONSTRAINED)
+	return calculateMPCConstrained(handler);
+#elif defined(MPC_FULL_VECTOR)
+	return calculateMPCFull(handler);
+#else
+	return calculateMPCCondensed(handler);
+#endif
+}
+
+int mpcSharesMatrices(const mpcHandler_t * a, const mpcHandler_t * b) {
+
+	return (a->A->data == b->A->data) &&
+		   (a->B_roof->data == b->B_roof->data) &&
+		   (a->Q_weighted->data == b->Q_weighted->data) &&
+		   (a->weighted_rows == b->weighted_rows) &&
+		   (a->number_of_weighted_rows == b->number_of_weighted_rows) &&
+		   (a->H_inv->data == b->H_inv->data) &&
+		   (a->number_of_states == b->number_of_states) &&
+		   (a->horizon_len == b->horizon_len) &&
+		   (a->reduced_horizon_len == b->reduced_horizon_len);
+}
+
+#ifdef MPC_FULL_VECTOR
+
+// one pass over B_roof and the first row of H_inv for all handlers
+static void calculateMPCBatchFull(mpcHandler_t * handlers[], const int count, float * outputs) {
+
+	const mpcHandler_t * first = handlers[0];
+	const int n_variables = first->reduced_horizon_len;
+	const int rows = first->number_of_weighted_rows;
+
+	float * B_roof = first->B_roof->data;
+	float * H_inv = first->H_inv->data;
+
+	// Q_roof*(A_roof*states - reference) and c = (X_0'*Q_roof)*B_roof in the workspace of each handler
+	float * error[MPC_MAX_BATCH];
+	float * c[MPC_MAX_BATCH];
+
+	int done = rows;
+	int h, r, j;
+
+	for (h = 0; h < count; h++) {
+
+		error[h] = handlers[h]->work_error;
+		c[h] = handlers[h]->work_c;
+
+		// the prediction of each axis is bounded by its own deadline (MPC_DEADLINE)
+		handlers[h]->rows_done = calculateWeightedError(handlers[h], error[h], 1);
+
+		if (handlers[h]->rows_done < done)
+			done = handlers[h]->rows_done;
+
+		for (j = 0; j < n_variables; j++)
+			c[h][j] = 0;
+	}
+
+	for (r = 0; r < done; r++) {
+
+#ifdef MPC_DEADLINE
+		// the axes finish together, the deadline of the last one bounds the shared pass
+		if ((r % MPC_DEADLINE_CHUNK) == 0 && deadlinePassed(handlers[count-1]))
+			break;
+#endif
+
+		// c += error*B_roof(r, :), each element of B_roof is read once
+		for (j = 0; j < n_variables; j++) {
+
+			float b = B_roof[r*n_variables + j];
+
+			for (h = 0; h < count; h++)
+				c[h][j] += error[h][r]*b;
+		}
+	}
+
+	if (r < rows) {
+
+		for (h = 0; h < count; h++) {
+
+			if (r < handlers[h]->rows_done)
+				handlers[h]->rows_done = r;
+
+			outputs[h] = calculateMPCDeadlineFallback(handlers[h]);
+		}
+
+		return;
+	}
+
+	// only the first row of H_inv*(c./(-2)) is needed
+	for (h = 0; h < count; h++)
+		outputs[h] = 0;
+
+	for (j = 0; j < n_variables; j++) {
+
+		float H = H_inv[j]*(float) -0.5;
+
+		for (h = 0; h < count; h++)
+			outputs[h] += H*c[h][j];
+	}
+}
+
+#else
+
+// one pass over the condensed gains for all handlers
+static void calculateMPCBatchCondensed(mpcHandler_t * handlers[], const int count, float * outputs) {
+
+	const mpcHandler_t * first = handlers[0];
+	const int n = first->number_of_states;
+
+	// the gains are the same for all handlers sharing the matrices
+	float * state_gain = first->state_gain->data;
+	float * reference_gain = first->reference_gain->data;
+
+	float * reference[MPC_MAX_BATCH];
+	int index[MPC_MAX_BATCH];
+
+	int h, i;
+
+	for (h = 0; h < count; h++) {
+
+		reference[h] = handlers[h]->filtered_reference->data;
+		index[h] = handlers[h]->reference_head;
+		outputs[h] = 0;
+	}
+
+	for (i = 0; i < n; i++) {
+
+		float gain = state_gain[i];
+
+		for (h = 0; h < count; h++)
+			outputs[h] += gain*handlers[h]->initial_cond->data[i];
+	}
+
+	for (i = 0; i < first->horizon_len; i++) {
+
+		float gain = reference_gain[i];
+
+		// walk through the ring buffers, each one can have its own head
+		for (h = 0; h < count; h++) {
+
+			outputs[h] += gain*reference[h][index[h]];
+
+			if (++index[h] >= first->horizon_len)
+				index[h] = 0;
+		}
+	}
+}
+
+#endif
+
+void calculateMPCBatch(mpcHandler_t * handlers[], const int count, float * outputs) {
+
+	int h;
+	int shared = (count <= MPC_MAX_BATCH);
+
+	for (h = 1; h < count && shared; h++)
+		shared = mpcSharesMatrices(handlers[0], handlers[h]);
+
+#if defined(MPC_CONSTRAINED) || defined(MPC_EXPLICIT)
+	// each handler has its own warm start/region, there is no shared pass
+	shared = 0;
+#endif
+
+#if defined(MPC_FULL_VECTOR) && defined(MPC_QUANTIZED)
+	// the int16 tables are read for each handler, the error vectors have their own scales
+	shared = 0;
+#endif
+
+	if (!shared) {
+
+		for (h = 0; h < count; h++)
+			outputs[h] = calculateMPC(handlers[h]);
+
+		return;
+	}
 
-	// return the first value of the action vector
-	return vector_float_get(&temp_vector3, 1);
+#ifdef MPC_FULL_VECTOR
+	calculateMPCBatchFull(handlers, count, outputs);
+#else
+	calculateMPCBatchCondensed(handlers, count, outputs);
+#endif
 }
@@ -9,15 +9,75 @@
 
 #include "system.h"
 
+// maximum number of handlers evaluated by one calculateMPCBatch() call
+#define MPC_MAX_BATCH	4
+
+// number of key-points in a trajectory message, equally distributed over the horizon
+#define MPC_TRAJECTORY_POINTS	5
+
+// reference_time of a constant setpoint
+#define MPC_NO_TRAJECTORY	-1
+
+/**
+ * Tables of the explicit (piecewise-affine) MPC, created by "MPC matlab/explicitMpc.m"
+ *
+ * Each region is an active set of the input constraints with the law u = gain*c + offset,
+ * c is the linear term of the QP. The binary tree splits the space of c by the planes
+ * plane(1:n)*c <= plane(n+1), a negative child -(leaf+1) is a leaf with candidate regions.
+ */
+typedef struct {
+
+	int number_of_regions;
+	int number_of_nodes;
+	const float * gain;				// regions x (n_variables x n_variables)
+	const float * offset;			// regions x n_variables
+	const int8_t * active;			// regions x n_variables, -1/+1 at the lower/upper limit, 0 free
+	const float * node_plane;		// nodes x (n_variables + 1)
+	const int16_t * node_child;		// nodes x 2, left (<=) and right child
+	const int16_t * leaf_start;		// (leaves + 1), the candidates of a leaf in leaf_regions
+	const int16_t * leaf_regions;
+
+} explicitMpc_t;
+
 typedef struct {
 
-	matrix_float * A_roof;
-	matrix_float * B_roof;
-	vector_float * Q_roof_diag;
+	matrix_float * A;					// the system matrix, A_roof*initial_cond is computed by recurrence
+	vector_float * B;					// the input vector, the prediction over the latency (MPC_LATENCY_COMPENSATION)
+	matrix_float * B_roof;				// only the rows of the prediction with a nonzero weight (number_of_weighted_rows x reduced_horizon_len)
+	vector_float * Q_weighted;			// the nonzero weights from the diagonal of Q_roof
+	const int16_t * weighted_rows;		// ascending index of the weighted rows in the prediction, step*number_of_states + state
+	int number_of_weighted_rows;
 	matrix_float * H_inv;
+	const int16_t * B_roof_q15;			// B_roof in int16, transposed (reduced_horizon_len x number_of_weighted_rows), MPC_QUANTIZED
+	const float * B_roof_scale;			// scale of each column of B_roof in B_roof_q15
+	const int16_t * H_inv_q15;			// H_inv in int16, MPC_QUANTIZED
+	const float * H_inv_scale;			// scale of each column of H_inv in H_inv_q15
 	vector_float * initial_cond;
-	vector_float * position_reference;
-	vector_float * allstate_reference;
+	vector_float * position_reference;	// ring buffer with the position reference (1 x horizon_len)
+	vector_float * filtered_reference;	// ring buffer with the preshaped position reference (1 x horizon_len)
+	int reference_head;					// index of the first sample of the horizon in both ring buffers
+	int reference_time;					// trajectory index of the first sample of the horizon, MPC_NO_TRAJECTORY for a setpoint
+	int reference_known;				// number of samples (from the head) interpolated from the received key-points
+	int reference_filter_from;			// first sample (from the head) to be filtered again, horizon_len when up to date
+	vector_float * state_gain;			// condensed first-action feedback (1 x number_of_states)
+	vector_float * reference_gain;		// condensed first-action reference gain (1 x horizon_len)
+	matrix_float * H;					// hessian of the constrained QP, 2*inv(H_inv)
+	vector_float * H_scaling;			// gradient step of each variable, inverse of the Gershgorin bound of the row of H
+	vector_float * qp_solution;			// the last QP solution, warm start for the next step
+	float * work_error;					// the weighted error of the prediction (number_of_weighted_rows), see initializeMPCWorkspace()
+	float * work_c;						// the linear term of the QP (reduced_horizon_len)
+	float * work_y;						// the QP iterates and the part-results of the other methods (reduced_horizon_len)
+	float * work_previous;				// (reduced_horizon_len)
+	int32_t * work_q15;					// int16 pairs of the quantized vectors (MPC_QUANTIZED)
+	float * work_state;					// the predicted state and the next one (2*number_of_states)
+	int qp_converged_at;				// iteration after which the last QP did not move (statistics)
+	int qp_iterations_done;				// iterations of the last QP, fewer than MPC_QP_ITERATIONS when cut off (MPC_DEADLINE)
+	int rows_done;						// weighted rows of the prediction finished in the last step (MPC_DEADLINE)
+	uint32_t deadline;					// cycle counter value by which the step should finish (MPC_DEADLINE)
+	int single_step_len;				// number of the leading variables acting for one sample only
+	float input_limit;					// box constraint of the inputs in the constrained QP
+	const explicitMpc_t * explicit_law;	// tables of the explicit MPC
+	int explicit_region;				// region of the last explicit MPC step, -1 when it fell back
 	int number_of_states;
 	int horizon_len;
 	int reduced_horizon_len;
@@ -26,8 +86,119 @@ typedef struct {
 
 } mpcHandler_t;
 
+// i-th (from 0) sample of the filtered reference over the horizon
+#define mpcReferenceAt(handler, i) ((handler)->filtered_reference->data[((handler)->reference_head + (i)) % (handler)->horizon_len])
+
+// i-th (from 0) sample of the position reference over the horizon
+#define mpcPositionReferenceAt(handler, i) ((handler)->position_reference->data[((handler)->reference_head + (i)) % (handler)->horizon_len])
+
+// set a constant position reference over the whole horizon
+void setReferenceSetpoint(mpcHandler_t * handler, const float setpoint);
+
+/**
+ * @brief update the position reference from the trajectory key-points
+ *
+ * The key-points are MPC_TRAJECTORY_POINTS samples equally spaced over the horizon,
+ * the first one belongs to the trajectory index time. When time continues the current
+ * trajectory, the ring buffer is realigned to it and only the samples behind the
+ * previously received key-points are interpolated.
+ */
+void setReferenceTrajectory(mpcHandler_t * handler, const float * keypoints, const int time);
+
+// filter the changed part of the position reference, the whole one starts from the current position
 void filterReferenceTrajectory(mpcHandler_t * handler);
 
+// shift the horizon by one sample, the last sample of the position reference is held
+void shiftReferenceTrajectory(mpcHandler_t * handler);
+
+/**
+ * @brief precompute the condensed first-action gains from A, B_roof, Q_weighted and H_inv
+ *
+ * Only the first action of the optimized vector is ever applied, thus
+ * u(1) = state_gain*initial_cond + reference_gain*filtered_reference
+ */
+void initializeCondensedMPC(mpcHandler_t * handler);
+
+/**
+ * @brief allocate the temporaries of one MPC step from the arena
+ *
+ * Needs number_of_weighted_rows and reduced_horizon_len. Nothing is allocated
+ * on the stack in the step then, the handler must not be computed by two
+ * tasks at once.
+ */
+void initializeMPCWorkspace(mpcHandler_t * handler);
+
+/**
+ * @brief copy the tables read by the MPC step from flash to the arena (MPC_TABLES_IN_ARENA)
+ *
+ * Needs the sizes of the handler. The handlers sharing a table share its copy,
+ * mpcSharesMatrices() holds for them as before. Does nothing otherwise.
+ */
+void placeMPCTables(mpcHandler_t * handler);
+
+// point the handler to the flash originals of its placed tables or back to the copies (the benchmark)
+void swapMPCTablePlacement(mpcHandler_t * handler);
+
+/**
+ * @brief precompute the hessian of the input-constrained QP from H_inv
+ *
+ * Needs single_step_len and input_limit, allocates H, H_scaling and qp_solution.
+ */
+void initializeConstrainedMPC(mpcHandler_t * handler);
+
+/**
+ * @brief propagate initial_cond over the latency of the pipeline, x = A*x + B*u
+ *
+ * @param inputs the inputs applied over the latency, the oldest first (steps + 1 of them)
+ * @param steps whole samples of the latency
+ * @param fraction the rest of the latency (0 to 1), the last sample is interpolated
+ */
+void predictInitialCondition(mpcHandler_t * handler, const float * inputs, const int steps, const float fraction);
+
+// compute the first action using the whole prediction matrices (debug)
+float calculateMPCFull(mpcHandler_t * handler);
+
+/**
+ * @brief c = B_roof'*Q_roof*(A_roof*initial_cond - reference), the linear term of the QP (reduced_horizon_len)
+ *
+ * @return number of the weighted rows of the prediction included, fewer than
+ * number_of_weighted_rows only when the deadline passed (MPC_DEADLINE), 0 when
+ * it passed in the products with B_roof_q15 (MPC_QUANTIZED)
+ */
+int calculateMPCLinearTerm(const mpcHandler_t * handler, float * c);
+
+// the first action when the prediction was not finished in time, the condensed MPC limited to input_limit
+float calculateMPCDeadlineFallback(mpcHandler_t * handler);
+
+/**
+ * @brief compute the first action of the QP with |u| <= input_limit
+ *
+ * Accelerated projected gradient with MPC_QP_ITERATIONS iterations,
+ * warm-started from the shifted previous solution. With MPC_DEADLINE the
+ * iterations stop at the deadline, the warm start carries on next step.
+ */
+float calculateMPCConstrained(mpcHandler_t * handler);
+
+// compute the first action using the condensed gains
+float calculateMPCCondensed(mpcHandler_t * handler);
+
+// compute the first action using the method selected in config.h
 float calculateMPC(mpcHandler_t * handler);
 
+// returns 1 if both handlers use the same prediction matrices
+int mpcSharesMatrices(const mpcHandler_t * a, const mpcHandler_t * b);
+
+/**
+ * @brief compute the first action for several handlers in one pass
+ *
+ * Handlers sharing the prediction matrices are evaluated as a multi-column
+ * product, each matrix element is read only once. Falls back to calling
+ * calculateMPC() for each handler otherwise and for the constrained QP.
+ *
+ * @param handlers array of handlers (at most MPC_MAX_BATCH shares the pass)
+ * @param count number of handlers
+ * @param outputs the first actions, one for each handler
+ */
+void calculateMPCBatch(mpcHandler_t * handlers[], const int count, float * outputs);
+
 #endif /* MPC_H_ */
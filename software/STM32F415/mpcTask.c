@@ -9,6 +9,159 @@
 #include "commTask.h"
 #include "mpc/elevator/elevatorMpc.h"
 #include "mpc/aileron/aileronMpc.h"
+#include "config.h"
+
+volatile mpcBenchmark_t mpcBenchmark;
+
+volatile mpcDeadline_t mpcDeadline;
+
+volatile mpcStateAge_t mpcStateAge;
+
+volatile mpcLatency_t mpcLatency;
+
+// the age of the states received from kalmanTask
+static void measureStateAge(const kalman2mpcMessage_t * message) {
+
+	// one tick of the prediction timer
+	const uint32_t tickCycles = (uint32_t) (SystemCoreClock*DT_ELEVATOR/KALMAN_PREDICTION_DIVIDER);
+
+	mpcStateAge.steps++;
+	mpcStateAge.lastCycles = cycleCounterGet() - message->timestamp;
+	mpcStateAge.lastTicks = message->ticks;
+
+	if (mpcStateAge.lastCycles > mpcStateAge.maxCycles)
+		mpcStateAge.maxCycles = mpcStateAge.lastCycles;
+
+	if (mpcStateAge.lastCycles > tickCycles)
+		mpcStateAge.staleSteps++;
+
+	if (mpcStateAge.lastTicks > mpcStateAge.maxTicks)
+		mpcStateAge.maxTicks = mpcStateAge.lastTicks;
+}
+
+#ifdef MPC_LATENCY_COMPENSATION
+
+// the latency from the measurement to the output of this step, in samples of the MPC
+static void estimateLatency(const kalman2mpcMessage_t * message, const uint32_t start, const float dt) {
+
+	// the states are known to be this old, the MPC step itself is estimated from the previous ones
+	mpcLatency.stateCycles = start - message->measured;
+	mpcLatency.latency = ((float) mpcLatency.stateCycles + mpcLatency.mpcCycles)/SystemCoreClock + MPC_LATENCY_OUTPUT;
+
+	if (mpcLatency.latency > mpcLatency.maxLatency)
+		mpcLatency.maxLatency = mpcLatency.latency;
+
+	const float samples = mpcLatency.latency/dt;
+
+	if (samples >= MPC_LATENCY_MAX_STEPS) {
+
+		mpcLatency.steps = MPC_LATENCY_MAX_STEPS;
+		mpcLatency.fraction = 0;
+		mpcLatency.truncations++;
+
+	} else {
+
+		mpcLatency.steps = (int) samples;
+		mpcLatency.fraction = samples - mpcLatency.steps;
+	}
+}
+
+// the outputs sent to the xMega, the oldest first, the last one is the newest
+static void commitOutput(float * committed, const float output) {
+
+	memmove(committed, committed + 1, MPC_LATENCY_MAX_STEPS*sizeof(float));
+
+	// the xMega saturates the output the same way
+	if (output > MPC_INPUT_SATURATION)
+		committed[MPC_LATENCY_MAX_STEPS] = MPC_INPUT_SATURATION;
+	else if (output < -MPC_INPUT_SATURATION)
+		committed[MPC_LATENCY_MAX_STEPS] = -MPC_INPUT_SATURATION;
+	else
+		committed[MPC_LATENCY_MAX_STEPS] = output;
+}
+
+#endif
+
+#ifdef MPC_DEADLINE
+
+// count the parts of the last MPC step of the handler cut off by its deadline
+static void countTruncations(const mpcHandler_t * handler) {
+
+	if (handler->rows_done < handler->number_of_weighted_rows) {
+
+		mpcDeadline.horizonTruncations++;
+
+		if (handler->rows_done < mpcDeadline.minRows)
+			mpcDeadline.minRows = handler->rows_done;
+
+	} else if (handler->qp_iterations_done < MPC_QP_ITERATIONS) {
+
+		mpcDeadline.iterationTruncations++;
+
+		if (handler->qp_iterations_done < mpcDeadline.minIterations)
+			mpcDeadline.minIterations = handler->qp_iterations_done;
+	}
+}
+
+#endif
+
+#ifdef MPC_BENCHMARK
+
+// the fewest cycles of calculateMPC() over MPC_BENCHMARK_STEPS calls, the interrupts are not counted that way
+static uint32_t benchmarkMPC(mpcHandler_t * handler) {
+
+	uint32_t start, cycles, fewest = 0xFFFFFFFF;
+	int i;
+
+	for (i = 0; i < MPC_BENCHMARK_STEPS; i++) {
+
+#ifdef MPC_DEADLINE
+		// the whole step is measured
+		handler->deadline = cycleCounterGet() + 0x7FFFFFFF;
+#endif
+
+		start = cycleCounterGet();
+		calculateMPC(handler);
+		cycles = cycleCounterGet() - start;
+
+		if (cycles < fewest)
+			fewest = cycles;
+	}
+
+	return fewest;
+}
+
+// calculateMPC() with the tables in the arena and in flash with and without the ART accelerator
+// without MPC_TABLES_IN_ARENA the first two are the same, the tables stay in flash
+static void benchmarkPlacement(mpcHandler_t * handler) {
+
+	const uint32_t acr = FLASH->ACR;
+
+	mpcBenchmark.flashAcr = acr;
+	mpcBenchmark.placedCycles = benchmarkMPC(handler);
+
+	swapMPCTablePlacement(handler);
+
+	mpcBenchmark.flashCycles = benchmarkMPC(handler);
+
+	// the caches are reset only while they are off
+	FLASH->ACR = acr & ~(FLASH_ACR_ICEN | FLASH_ACR_DCEN | FLASH_ACR_PRFTEN);
+
+	mpcBenchmark.flashNoArtCycles = benchmarkMPC(handler);
+
+	FLASH->ACR |= FLASH_ACR_ICRST | FLASH_ACR_DCRST;
+	FLASH->ACR &= ~(FLASH_ACR_ICRST | FLASH_ACR_DCRST);
+	FLASH->ACR = acr;
+
+	swapMPCTablePlacement(handler);
+
+#if defined(MPC_CONSTRAINED) || defined(MPC_EXPLICIT)
+	// the warm start of the first step
+	vector_float_set_zero(handler->qp_solution);
+#endif
+}
+
+#endif
 
 void mpcTask(void *p) {
 
@@ -18,6 +171,17 @@ void mpcTask(void *p) {
 	mpcHandler_t * elevatorMpcHandler = initializeElevatorMPC();
 	mpcHandler_t * aileronMpcHandler = initializeAileronMPC();
 
+	// all handlers, evaluated together by calculateMPCBatch()
+	mpcHandler_t * mpcHandlers[2] = {elevatorMpcHandler, aileronMpcHandler};
+	float mpcOutputs[2];
+
+	// the reference is realigned by the setpoint/trajectory messages, otherwise it is shifted
+	char referenceChanged = 1;
+
+#ifdef MPC_BENCHMARK
+	benchmarkPlacement(elevatorMpcHandler);
+#endif
+
 	/* -------------------------------------------------------------------- */
 	/*	Messages between tasks												*/
 	/* -------------------------------------------------------------------- */
@@ -25,87 +189,183 @@ void mpcTask(void *p) {
 	kalman2mpcMessage_t kalman2mpcMessage;
 	comm2mpcMessage_t comm2mpcMessage;
 
+#ifdef MPC_LATENCY_COMPENSATION
+	// the outputs acting over the latency, the newest at MPC_LATENCY_MAX_STEPS
+	float elevatorCommitted[MPC_LATENCY_MAX_STEPS + 1];
+	float aileronCommitted[MPC_LATENCY_MAX_STEPS + 1];
+	uint32_t latencyStart;
+
+	memset(elevatorCommitted, 0, sizeof(elevatorCommitted));
+	memset(aileronCommitted, 0, sizeof(aileronCommitted));
+#endif
+
+#ifdef MPC_DEADLINE
+	uint32_t mpcStart, mpcCycles;
+
+	mpcDeadline.minRows = elevatorMpcHandler->number_of_weighted_rows;
+	mpcDeadline.minIterations = MPC_QP_ITERATIONS;
+#endif
+
 	vTaskDelay(100);
 
 	while (1) {
 
 		/* -------------------------------------------------------------------- */
-		/*	If there is a message from commTask									*/
+		/*	Wait for the states from kalmanTask									*/
+		/* -------------------------------------------------------------------- */
+		if (!xQueueReceive(kalman2mpcQueue, &kalman2mpcMessage, PIPELINE_WAIT))
+			continue;
+
+		mpc2commMessage.trace = kalman2mpcMessage.trace;
+		mpc2commMessage.trace.mpcStart = cycleCounterGet();
+
+		/* -------------------------------------------------------------------- */
+		/*	The messages from commTask which came in the meantime				*/
 		/* -------------------------------------------------------------------- */
 		while (xQueueReceive(comm2mpcQueue, &comm2mpcMessage, 0)) {
 
+			referenceChanged = 1;
+
 			if (comm2mpcMessage.messageType == SETPOINT) {
 
 				// copy the incoming set point/s into the local vector
-				vector_float_set_to(elevatorMpcHandler->position_reference, comm2mpcMessage.elevatorReference[0]);
-				vector_float_set_to(aileronMpcHandler->position_reference, comm2mpcMessage.aileronReference[0]);
+				setReferenceSetpoint(elevatorMpcHandler, comm2mpcMessage.elevatorReference[0]);
+				setReferenceSetpoint(aileronMpcHandler, comm2mpcMessage.aileronReference[0]);
 
 			} else if (comm2mpcMessage.messageType == TRAJECTORY) {
 
-				int i, j;
-				float step;
+				// realign the reference to the trajectory index and interpolate its new end
+				setReferenceTrajectory(elevatorMpcHandler, comm2mpcMessage.elevatorReference, comm2mpcMessage.trajectoryIndex);
+				setReferenceTrajectory(aileronMpcHandler, comm2mpcMessage.aileronReference, comm2mpcMessage.trajectoryIndex);
+			}
+		}
 
-				// for all key-point in the elevator reference
-				for (j = 0; j < 4; j++) {
+		measureStateAge(&kalman2mpcMessage);
 
-					// calculate the interpolation step
-					step = (comm2mpcMessage.elevatorReference[j+1] - comm2mpcMessage.elevatorReference[j])/50;
+		// copy the elevatorStates to states
+		memcpy(elevatorMpcHandler->initial_cond->data, &kalman2mpcMessage.elevatorData, elevatorMpcHandler->number_of_states*sizeof(float));
 
-					vector_float_set(elevatorMpcHandler->position_reference, j*50+1, comm2mpcMessage.elevatorReference[j]);
+		// copy the aileronStates to states
+		memcpy(aileronMpcHandler->initial_cond->data, &kalman2mpcMessage.aileronData, aileronMpcHandler->number_of_states*sizeof(float));
 
-					for (i = 1; i < 50; i++) {
+#ifdef MPC_LATENCY_COMPENSATION
+		latencyStart = cycleCounterGet();
 
-						vector_float_set(elevatorMpcHandler->position_reference, j*50+1+i, vector_float_get(elevatorMpcHandler->position_reference, j*50+i) + step);
-					}
-				}
+		estimateLatency(&kalman2mpcMessage, latencyStart, elevatorMpcHandler->dt);
 
-				// for all key-point in the aileron reference
-				for (j = 0; j < 4; j++) {
+		// the states when the output of this step takes effect, the previous outputs act until then
+		predictInitialCondition(elevatorMpcHandler, elevatorCommitted + MPC_LATENCY_MAX_STEPS - mpcLatency.steps, mpcLatency.steps, mpcLatency.fraction);
+		predictInitialCondition(aileronMpcHandler, aileronCommitted + MPC_LATENCY_MAX_STEPS - mpcLatency.steps, mpcLatency.steps, mpcLatency.fraction);
+#endif
 
-					// calculate the interpolation step
-					step = (comm2mpcMessage.aileronReference[j+1] - comm2mpcMessage.aileronReference[j])/50;
+		if (referenceChanged) {
 
-					vector_float_set(aileronMpcHandler->position_reference, j*50+1, comm2mpcMessage.aileronReference[j]);
+			// filter the changed part of the reference
+			filterReferenceTrajectory(elevatorMpcHandler);
+			filterReferenceTrajectory(aileronMpcHandler);
 
-					for (i = 1; i < 50; i++) {
+			referenceChanged = 0;
 
-						vector_float_set(aileronMpcHandler->position_reference, j*50+1+i, vector_float_get(aileronMpcHandler->position_reference, j*50+i) + step);
-					}
-				}
-			}
+		} else {
+
+			// move the horizon by one sample
+			shiftReferenceTrajectory(elevatorMpcHandler);
+			shiftReferenceTrajectory(aileronMpcHandler);
 		}
 
-		/* -------------------------------------------------------------------- */
-		/*	If there is a message from kalmanTask								*/
-		/* -------------------------------------------------------------------- */
-		if (xQueueReceive(kalman2mpcQueue, &kalman2mpcMessage, 0)) {
+#ifdef MPC_BENCHMARK
+		uint32_t cycles;
 
-			// copy the elevatorStates to states
-			memcpy(elevatorMpcHandler->initial_cond->data, &kalman2mpcMessage.elevatorData, elevatorMpcHandler->number_of_states*sizeof(float));
+		// the constrained QP keeps its warm start, it cannot be solved twice in a step
+		// the deadline would be spent by the sequential calls
+#if !defined(MPC_CONSTRAINED) && !defined(MPC_DEADLINE)
+		cycles = cycleCounterGet();
 
-			// filter the reference
-			filterReferenceTrajectory(elevatorMpcHandler);
+		calculateMPC(elevatorMpcHandler);
+		calculateMPC(aileronMpcHandler);
 
-			// calculate the elevator MPC
-			mpc2commMessage.elevatorOutput = calculateMPC(elevatorMpcHandler);
+		mpcBenchmark.sequentialCycles = cycleCounterGet() - cycles;
+#endif
 
-			// copy the elevatorStates to states
-			memcpy(aileronMpcHandler->initial_cond->data, &kalman2mpcMessage.aileronData, aileronMpcHandler->number_of_states*sizeof(float));
+		cycles = cycleCounterGet();
+#endif
 
-			// filter the reference
-			filterReferenceTrajectory(aileronMpcHandler);
+#ifdef MPC_DEADLINE
+		mpcStart = cycleCounterGet();
 
-			// calculate the aileron MPC
-			mpc2commMessage.aileronOutput = calculateMPC(aileronMpcHandler);
+		// the elevator can take a half of the budget, the aileron gets the rest
+		elevatorMpcHandler->deadline = mpcStart + MPC_CYCLE_BUDGET/2;
+		aileronMpcHandler->deadline = mpcStart + MPC_CYCLE_BUDGET;
 
-			// copy the current setpoint (main for debug)
-			mpc2commMessage.elevatorSetpoint = vector_float_get(elevatorMpcHandler->position_reference, 1);
-			mpc2commMessage.aileronSetpoint = vector_float_get(aileronMpcHandler->position_reference, 1);
+		// the methods without the prediction rows or the QP leave these complete
+		elevatorMpcHandler->rows_done = elevatorMpcHandler->number_of_weighted_rows;
+		aileronMpcHandler->rows_done = aileronMpcHandler->number_of_weighted_rows;
+		elevatorMpcHandler->qp_iterations_done = MPC_QP_ITERATIONS;
+		aileronMpcHandler->qp_iterations_done = MPC_QP_ITERATIONS;
+#endif
 
-			// send outputs to commTask
-			xQueueOverwrite(mpc2commQueue, &mpc2commMessage);
+		// calculate the MPC for both axes in one pass
+		calculateMPCBatch(mpcHandlers, 2, mpcOutputs);
 
-			led_toggle();
-		}
+#ifdef MPC_DEADLINE
+		mpcCycles = cycleCounterGet() - mpcStart;
+
+		if (mpcCycles > mpcDeadline.maxCycles)
+			mpcDeadline.maxCycles = mpcCycles;
+
+		mpcDeadline.steps++;
+
+		countTruncations(elevatorMpcHandler);
+		countTruncations(aileronMpcHandler);
+
+		// the next state estimate is already waiting, a control tick was missed
+		if (uxQueueMessagesWaiting(kalman2mpcQueue) > 0)
+			mpcDeadline.overruns++;
+#endif
+
+#ifdef MPC_BENCHMARK
+		mpcBenchmark.batchCycles = cycleCounterGet() - cycles;
+
+		if (mpcBenchmark.batchCycles > mpcBenchmark.maxBatchCycles)
+			mpcBenchmark.maxBatchCycles = mpcBenchmark.batchCycles;
+
+#ifdef MPC_CONSTRAINED
+		mpcBenchmark.elevatorQpIterations = elevatorMpcHandler->qp_converged_at;
+		mpcBenchmark.aileronQpIterations = aileronMpcHandler->qp_converged_at;
+
+		if (mpcBenchmark.elevatorQpIterations > mpcBenchmark.maxQpIterations)
+			mpcBenchmark.maxQpIterations = mpcBenchmark.elevatorQpIterations;
+		if (mpcBenchmark.aileronQpIterations > mpcBenchmark.maxQpIterations)
+			mpcBenchmark.maxQpIterations = mpcBenchmark.aileronQpIterations;
+#endif
+
+#ifdef MPC_EXPLICIT
+		if (elevatorMpcHandler->explicit_region < 0)
+			mpcBenchmark.explicitMisses++;
+		if (aileronMpcHandler->explicit_region < 0)
+			mpcBenchmark.explicitMisses++;
+#endif
+#endif
+
+		mpc2commMessage.elevatorOutput = mpcOutputs[0];
+		mpc2commMessage.aileronOutput = mpcOutputs[1];
+
+		// copy the current setpoint (main for debug)
+		mpc2commMessage.elevatorSetpoint = mpcPositionReferenceAt(elevatorMpcHandler, 0);
+		mpc2commMessage.aileronSetpoint = mpcPositionReferenceAt(aileronMpcHandler, 0);
+
+		// send outputs to commTask
+		mpc2commMessage.trace.computed = cycleCounterGet();
+		xQueueOverwrite(mpc2commQueue, &mpc2commMessage);
+		xSemaphoreGive(commEvent);
+
+#ifdef MPC_LATENCY_COMPENSATION
+		commitOutput(elevatorCommitted, mpcOutputs[0]);
+		commitOutput(aileronCommitted, mpcOutputs[1]);
+
+		mpcLatency.mpcCycles += MPC_LATENCY_FILTER*((float) (cycleCounterGet() - latencyStart) - mpcLatency.mpcCycles);
+#endif
+
+		led_toggle();
 	}
 }
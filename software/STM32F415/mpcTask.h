@@ -20,4 +20,63 @@ void mpcTask(void *p);
 
 #include "system.h"
 
+// cycles spent by the MPC, filled when MPC_BENCHMARK is defined
+typedef struct {
+
+	uint32_t batchCycles;		// calculateMPCBatch() for all axes
+	uint32_t sequentialCycles;	// calculateMPC() called for each axis
+	uint32_t maxBatchCycles;	// the worst calculateMPCBatch() so far
+	int elevatorQpIterations;	// iterations to the convergence of the last QP (MPC_CONSTRAINED)
+	int aileronQpIterations;
+	int maxQpIterations;		// the worst convergence so far, MPC_QP_ITERATIONS means it was cut off
+	uint32_t explicitMisses;	// explicit MPC steps without a known region (MPC_EXPLICIT)
+	uint32_t placedCycles;		// calculateMPC() of the elevator with the tables in the arena (MPC_TABLES_IN_ARENA, ARENA_IN_CCM)
+	uint32_t flashCycles;		// the same with the tables in flash, behind the ART accelerator
+	uint32_t flashNoArtCycles;	// the tables in flash with the caches and the prefetch off
+	uint32_t flashAcr;			// FLASH->ACR of the ART accelerator set up by flashAcceleratorInit()
+} mpcBenchmark_t;
+
+volatile mpcBenchmark_t mpcBenchmark;
+
+// cut-off MPC steps, filled when MPC_DEADLINE is defined
+typedef struct {
+
+	uint32_t steps;					// MPC steps with a deadline
+	uint32_t horizonTruncations;	// axes with the prediction cut off, the condensed MPC was used
+	uint32_t iterationTruncations;	// axes with the QP cut off before MPC_QP_ITERATIONS
+	uint32_t overruns;				// steps finished after the next kalman message came
+	int minRows;					// the fewest weighted rows of the prediction finished so far
+	int minIterations;				// the fewest QP iterations finished so far
+	uint32_t maxCycles;				// the longest MPC step so far
+} mpcDeadline_t;
+
+volatile mpcDeadline_t mpcDeadline;
+
+// the age of the kalman states when the MPC starts
+typedef struct {
+
+	uint32_t steps;			// MPC steps
+	uint32_t lastCycles;	// cycles since the states were estimated, the last step
+	uint32_t maxCycles;		// the oldest states so far
+	uint32_t staleSteps;	// steps with the states older than one prediction timer tick
+	uint32_t lastTicks;		// prediction ticks since the last px4flow step (KALMAN_PREDICTION_TIMER)
+	uint32_t maxTicks;		// the longest prediction without a px4flow step so far
+} mpcStateAge_t;
+
+volatile mpcStateAge_t mpcStateAge;
+
+// the latency compensated before the MPC, filled when MPC_LATENCY_COMPENSATION is defined
+typedef struct {
+
+	uint32_t stateCycles;	// cycles from the px4flow message to the MPC start, the last step
+	float mpcCycles;		// running average of the cycles from the MPC start to the output sent
+	float latency;			// the whole latency in seconds including MPC_LATENCY_OUTPUT, the last step
+	float maxLatency;		// the longest latency so far
+	int steps;				// whole samples of the last compensation
+	float fraction;			// the rest of the last compensation
+	uint32_t truncations;	// steps with the latency over MPC_LATENCY_MAX_STEPS
+} mpcLatency_t;
+
+volatile mpcLatency_t mpcLatency;
+
 #endif /* MPCTASK_H_ */
@@ -9,6 +9,9 @@
 #include "kalmanTask.h"
 #include "mpcTask.h"
 #include "commTask.h"
+#include "config.h"
+#include "stm32f4xx_tim.h"
+#include <misc.h>
 
 // queues for uart
 QueueHandle_t * usartRxQueue;
@@ -22,6 +25,15 @@ QueueHandle_t * kalman2commQueue;
 QueueHandle_t * comm2mpcQueue;
 QueueHandle_t * resetKalmanQueue;
 QueueHandle_t * setKalmanQueue;
+QueueHandle_t * position2kalmanQueue;
+
+// events of the blocked tasks
+SemaphoreHandle_t commEvent;
+SemaphoreHandle_t kalmanEvent;
+
+volatile uint32_t kalmanTicks;
+
+volatile pipelineLatency_t pipelineLatency;
 
 void boardInit() {
 
@@ -50,11 +62,119 @@ void boardInit() {
     // queue for setting particular value of KF
     setKalmanQueue = xQueueCreate(1, sizeof(resetKalmanMessage_t));
 
+    // create a queue from commTask to kalmanTask with the delayed positions
+    position2kalmanQueue = xQueueCreate(2, sizeof(position2kalmanMessage_t));
+
+    // the events wake up commTask and kalmanTask, mpcTask waits for kalman2mpcQueue
+    commEvent = xSemaphoreCreateCounting(COMM_EVENTS, 0);
+    kalmanEvent = xSemaphoreCreateCounting(KALMAN_EVENTS, 0);
+
 	// set th clock and initialize the GPIO
 	gpioInit();
 
 	// set the UART
     init_USART4(115200);
+
+    // start the cycle counter for time measurements
+    cycleCounterInit();
+
+    // the MPC tables are read from flash unless MPC_TABLES_IN_ARENA
+    flashAcceleratorInit();
+
+#ifdef ARENA_IN_CCM
+    // the CCM clock is on after the reset already, the arena relies on it
+    RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_CCMDATARAMEN, ENABLE);
+#endif
+
+#ifdef KALMAN_PREDICTION_TIMER
+    // start the kalman prediction ticks
+    predictionTimerInit();
+#endif
+}
+
+void predictionTimerInit() {
+
+	TIM_TimeBaseInitTypeDef TIM_TimeBaseStructure;
+	NVIC_InitTypeDef NVIC_InitStructure;
+
+	RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM2, ENABLE);
+
+	// APB1 timers run at SystemCoreClock/2, counted in microseconds
+	TIM_TimeBaseStructure.TIM_Prescaler = SystemCoreClock/2/1000000 - 1;
+	TIM_TimeBaseStructure.TIM_Period = (uint32_t) (DT_ELEVATOR*1000000/KALMAN_PREDICTION_DIVIDER) - 1;
+	TIM_TimeBaseStructure.TIM_ClockDivision = TIM_CKD_DIV1;
+	TIM_TimeBaseStructure.TIM_CounterMode = TIM_CounterMode_Up;
+	TIM_TimeBaseStructure.TIM_RepetitionCounter = 0;
+	TIM_TimeBaseInit(TIM2, &TIM_TimeBaseStructure);
+
+	TIM_ITConfig(TIM2, TIM_IT_Update, ENABLE);
+
+	// the same priority as the uart, below configMAX_SYSCALL_INTERRUPT_PRIORITY
+	NVIC_InitStructure.NVIC_IRQChannel = TIM2_IRQn;
+	NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 10;
+	NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+	NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+	NVIC_Init(&NVIC_InitStructure);
+
+	TIM_Cmd(TIM2, ENABLE);
+}
+
+// the tick of the kalman prediction, kalmanTask catches up with kalmanTicks
+void TIM2_IRQHandler(void) {
+
+	long xHigherPriorityTaskWoken = pdFALSE;
+
+	if (TIM_GetITStatus(TIM2, TIM_IT_Update) != RESET) {
+
+		TIM_ClearITPendingBit(TIM2, TIM_IT_Update);
+
+		kalmanTicks++;
+
+		xSemaphoreGiveFromISR(kalmanEvent, &xHigherPriorityTaskWoken);
+	}
+
+	portEND_SWITCHING_ISR(xHigherPriorityTaskWoken);
+}
+
+// the idle task spins here, the time between close calls is the idle time
+void vApplicationIdleHook(void) {
+
+	static uint32_t lastCall, windowStart, idleCycles;
+
+	const uint32_t now = cycleCounterGet();
+
+	// a longer gap was spent by a task or an interrupt
+	if (now - lastCall < PIPELINE_IDLE_GAP)
+		idleCycles += now - lastCall;
+
+	lastCall = now;
+
+	if (now - windowStart >= SystemCoreClock) {
+
+		pipelineLatency.idle = (float) idleCycles/(now - windowStart);
+
+		idleCycles = 0;
+		windowStart = now;
+	}
+}
+
+void cycleCounterInit() {
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+void flashAcceleratorInit() {
+
+	// SystemInit() sets 5 wait states with the instruction and data caches
+	uint32_t acr = FLASH->ACR | FLASH_ACR_ICEN | FLASH_ACR_DCEN;
+
+	// the prefetch is not supported by the revision A (its errata sheet)
+	if ((DBGMCU->IDCODE >> 16) != 0x1000)
+		acr |= FLASH_ACR_PRFTEN;
+
+	FLASH->ACR = acr;
 }
 
 void gpioInit() {
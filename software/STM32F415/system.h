@@ -11,6 +11,7 @@
 #include "FreeRTOS.h"
 #include "queue.h"
 #include "task.h"
+#include "semphr.h"
 
 // Must be included if using STM32F4 Discovery board or processor
 #include "stm32f4xx.h"
@@ -27,6 +28,7 @@
 
 #include "kalman/elevator/elevatorKalman.h"
 #include "kalman/aileron/aileronKalman.h"
+#include "config.h"
 
 /**********************************************************************************
  *
@@ -50,6 +52,16 @@ QueueHandle_t * usartTxQueue;
 
 enum comm2mpcMessageType_t {SETPOINT, TRAJECTORY};
 
+// cycleCounterGet() at the stages of the pipeline, from the px4flow frame to the output frame
+typedef struct {
+
+	uint32_t decoded;		// commTask decoded the px4flow frame (a tick of KALMAN_PREDICTION_TIMER)
+	uint32_t kalmanStart;	// kalmanTask took the measurement
+	uint32_t estimated;		// the states were sent to mpcTask
+	uint32_t mpcStart;		// mpcTask took the states
+	uint32_t computed;		// the outputs were sent to commTask
+} pipelineTrace_t;
+
 // setpoint message
 typedef struct {
 
@@ -57,6 +69,7 @@ typedef struct {
 
 	float elevatorReference[5];
 	float aileronReference[5];
+	int16_t trajectoryIndex;	// index of the first trajectory key-point, consecutive messages differ by the elapsed samples
 
 } comm2mpcMessage_t;
 
@@ -67,8 +80,18 @@ typedef struct {
 	float aileronSpeed;
 	float elevatorInput;
 	float aileronInput;
+	uint16_t sequence;		// number of the px4flow measurement, increments with each message
+	uint32_t timestamp;		// cycleCounterGet() when the message was received
 } comm2kalmanMessage_t;
 
+// delayed position message
+typedef struct {
+
+	float elevatorPosition;
+	float aileronPosition;
+	uint16_t sequence;		// the px4flow measurement at which the position was valid
+} position2kalmanMessage_t;
+
 // mpc output message
 typedef struct {
 
@@ -76,6 +99,7 @@ typedef struct {
 	float aileronOutput;
 	float elevatorSetpoint;
 	float aileronSetpoint;
+	pipelineTrace_t trace;
 } mpc2commMessage_t;
 
 // message to reset the kalman states
@@ -90,6 +114,10 @@ typedef struct {
 
 	float elevatorData[NUMBER_OF_STATES_ELEVATOR];
 	float aileronData[NUMBER_OF_STATES_AILERON];
+	uint32_t timestamp;		// cycleCounterGet() when the states were estimated
+	uint32_t ticks;			// prediction timer ticks since the last px4flow step (KALMAN_PREDICTION_TIMER)
+	uint32_t measured;		// cycleCounterGet() of the time the states belong to
+	pipelineTrace_t trace;
 } kalman2mpcMessage_t;
 
 // kalman output message (to comm)
@@ -126,6 +154,46 @@ QueueHandle_t * resetKalmanQueue;
 // queue to set kalman's position to a particular value
 QueueHandle_t * setKalmanQueue;
 
+// queue from commTask to kalmanTask with the delayed positions
+QueueHandle_t * position2kalmanQueue;
+
+// events for the tasks blocked on them, one per message or received char
+SemaphoreHandle_t commEvent;
+SemaphoreHandle_t kalmanEvent;
+
+// the most events pending for each task (the uart queue and the other queues)
+#define COMM_EVENTS		(256 + 2)
+#define KALMAN_EVENTS	16
+
+// how long the tasks wait for their events, PIPELINE_POLLING does not block
+#ifdef PIPELINE_POLLING
+#define PIPELINE_WAIT	0
+#else
+#define PIPELINE_WAIT	portMAX_DELAY
+#endif
+
+// the latency of the pipeline stages of the last output frame in cycles, and the idle time
+typedef struct {
+
+	uint32_t kalmanWait;	// from decoding the px4flow frame to the kalman step
+	uint32_t kalman;		// the kalman step
+	uint32_t mpcWait;		// from the states to the MPC step
+	uint32_t mpc;			// the MPC step
+	uint32_t txWait;		// from the outputs to the output frame in the uart queue
+	uint32_t total;			// from decoding the px4flow frame to the output frame
+	uint32_t maxTotal;
+	uint32_t frames;		// output frames measured
+	float idle;				// the fraction of the cpu spent idle over the last second
+} pipelineLatency_t;
+
+volatile pipelineLatency_t pipelineLatency;
+
+// the DWT cycle counter, used for measuring the execution time
+#define cycleCounterGet() (DWT->CYCCNT)
+
+// ticks of the kalman prediction timer, incremented by TIM2 (KALMAN_PREDICTION_TIMER)
+volatile uint32_t kalmanTicks;
+
 #define led_toggle() GPIO_ToggleBits(GPIOC, GPIO_Pin_2)
 #define led_on() GPIO_WriteBit(GPIOC, GPIO_Pin_2, 1)
 #define led_off() GPIO_WriteBit(GPIOC, GPIO_Pin_2, 0)
@@ -136,4 +204,13 @@ void boardInit();
 // Initialization of GPIO ports
 void gpioInit();
 
+// Start the DWT cycle counter
+void cycleCounterInit();
+
+// the ART accelerator of the flash, the caches and the prefetch (not on the revision A)
+void flashAcceleratorInit();
+
+// Start TIM2 with KALMAN_PREDICTION_DIVIDER ticks per px4flow period
+void predictionTimerInit();
+
 #endif /* SYSTEM_H_ */
@@ -0,0 +1,187 @@
+/*
+ * CMatrixLib.c
+ *
+ * Plain C stand-in of the CMatrixLib component for the host tests.
+ */
+
+#include "CMatrixLib.h"
+#include <string.h>
+#include <math.h>
+
+void matrix_float_mul_vec_right(const matrix_float * a, const vector_float * b, vector_float * c) {
+
+	int i, j;
+
+	for (i = 0; i < a->height; i++) {
+
+		c->data[i] = 0;
+		for (j = 0; j < a->width; j++)
+			c->data[i] += a->data[i*a->width + j]*b->data[j];
+	}
+}
+
+void matrix_float_mul_vec_left(const matrix_float * a, const vector_float * b, vector_float * c) {
+
+	int i, j;
+
+	for (j = 0; j < a->width; j++) {
+
+		c->data[j] = 0;
+		for (i = 0; i < a->height; i++)
+			c->data[j] += a->data[i*a->width + j]*b->data[i];
+	}
+}
+
+void matrix_float_mul(const matrix_float * a, const matrix_float * b, matrix_float * c) {
+
+	int i, j, k;
+
+	for (i = 0; i < a->height; i++)
+		for (j = 0; j < b->width; j++) {
+
+			c->data[i*c->width + j] = 0;
+			for (k = 0; k < a->width; k++)
+				c->data[i*c->width + j] += a->data[i*a->width + k]*b->data[k*b->width + j];
+		}
+}
+
+void matrix_float_mul_trans(const matrix_float * a, const matrix_float * b, matrix_float * c) {
+
+	int i, j, k;
+
+	for (i = 0; i < a->height; i++)
+		for (j = 0; j < b->height; j++) {
+
+			c->data[i*c->width + j] = 0;
+			for (k = 0; k < a->width; k++)
+				c->data[i*c->width + j] += a->data[i*a->width + k]*b->data[j*b->width + k];
+		}
+}
+
+void matrix_float_copy(matrix_float * a, const matrix_float * b) {
+
+	memcpy(a->data, b->data, b->height*b->width*sizeof(float));
+}
+
+void matrix_float_add(matrix_float * a, const matrix_float * b) {
+
+	int i;
+
+	for (i = 0; i < a->height*a->width; i++)
+		a->data[i] += b->data[i];
+}
+
+void matrix_float_times(matrix_float * a, const float f) {
+
+	int i;
+
+	for (i = 0; i < a->height*a->width; i++)
+		a->data[i] *= f;
+}
+
+void matrix_float_set_identity(matrix_float * a) {
+
+	int i, j;
+
+	for (i = 0; i < a->height; i++)
+		for (j = 0; j < a->width; j++)
+			a->data[i*a->width + j] = (i == j) ? 1 : 0;
+}
+
+void matrix_float_set_zero(matrix_float * a) {
+
+	memset(a->data, 0, a->height*a->width*sizeof(float));
+}
+
+void matrix_float_inverse(matrix_float * a) {
+
+	const int n = a->height;
+
+	double m[n][2*n];
+	double pivot, factor, temp;
+	int i, j, k, best;
+
+	for (i = 0; i < n; i++)
+		for (j = 0; j < 2*n; j++)
+			m[i][j] = (j < n) ? a->data[i*n + j] : (j - n == i);
+
+	for (k = 0; k < n; k++) {
+
+		best = k;
+		for (i = k+1; i < n; i++)
+			if (fabs(m[i][k]) > fabs(m[best][k]))
+				best = i;
+
+		for (j = 0; j < 2*n; j++) {
+
+			temp = m[k][j];
+			m[k][j] = m[best][j];
+			m[best][j] = temp;
+		}
+
+		pivot = m[k][k];
+		for (j = 0; j < 2*n; j++)
+			m[k][j] /= pivot;
+
+		for (i = 0; i < n; i++) {
+
+			if (i == k)
+				continue;
+
+			factor = m[i][k];
+			for (j = 0; j < 2*n; j++)
+				m[i][j] -= factor*m[k][j];
+		}
+	}
+
+	for (i = 0; i < n; i++)
+		for (j = 0; j < n; j++)
+			a->data[i*n + j] = (float) m[i][n + j];
+}
+
+void vector_float_add(vector_float * a, const vector_float * b) {
+
+	int i;
+
+	for (i = 0; i < a->length; i++)
+		a->data[i] += b->data[i];
+}
+
+void vector_float_subtract(vector_float * a, const vector_float * b) {
+
+	int i;
+
+	for (i = 0; i < a->length; i++)
+		a->data[i] -= b->data[i];
+}
+
+void vector_float_times(vector_float * a, const float f) {
+
+	int i;
+
+	for (i = 0; i < a->length; i++)
+		a->data[i] *= f;
+}
+
+void vector_float_transpose(vector_float * a) {
+
+	a->orientation = !a->orientation;
+}
+
+void vector_float_copy(vector_float * a, const vector_float * b) {
+
+	memcpy(a->data, b->data, b->length*sizeof(float));
+}
+
+void vector_float_set_zero(vector_float * a) {
+
+	memset(a->data, 0, a->length*sizeof(float));
+}
+
+void vector_float_set_to(vector_float * a, const float f) {
+
+	int i;
+
+	for (i = 0; i < a->length; i++)
+		a->data[i] = f;
+}
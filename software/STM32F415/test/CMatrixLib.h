@@ -0,0 +1,76 @@
+/*
+ * CMatrixLib.h
+ *
+ * Plain C stand-in of the CMatrixLib component for the host tests, only the
+ * functions used by the MPC and the kalman filter. The matrices are stored
+ * row by row and indexed from 1 as in the library.
+ */
+
+#ifndef CMATRIXLIB_H_
+#define CMATRIXLIB_H_
+
+#include <stdint.h>
+
+typedef struct {
+
+	float * data;
+	int16_t height;
+	int16_t width;
+
+} matrix_float;
+
+typedef struct {
+
+	float * data;
+	int16_t length;
+	int8_t orientation;		// 0 column, 1 row
+
+} vector_float;
+
+#define matrix_float_get(m, i, j) ((m)->data[((i)-1)*(m)->width + ((j)-1)])
+#define matrix_float_set(m, i, j, value) ((m)->data[((i)-1)*(m)->width + ((j)-1)] = (value))
+
+#define vector_float_get(v, i) ((v)->data[(i)-1])
+#define vector_float_set(v, i, value) ((v)->data[(i)-1] = (value))
+
+// c = a*b
+void matrix_float_mul_vec_right(const matrix_float * a, const vector_float * b, vector_float * c);
+
+// c = b'*a
+void matrix_float_mul_vec_left(const matrix_float * a, const vector_float * b, vector_float * c);
+
+// c = a*b
+void matrix_float_mul(const matrix_float * a, const matrix_float * b, matrix_float * c);
+
+// c = a*b'
+void matrix_float_mul_trans(const matrix_float * a, const matrix_float * b, matrix_float * c);
+
+void matrix_float_copy(matrix_float * a, const matrix_float * b);
+
+// a += b
+void matrix_float_add(matrix_float * a, const matrix_float * b);
+
+void matrix_float_times(matrix_float * a, const float f);
+
+void matrix_float_set_identity(matrix_float * a);
+
+void matrix_float_set_zero(matrix_float * a);
+
+// in place, Gauss-Jordan with partial pivoting
+void matrix_float_inverse(matrix_float * a);
+
+void vector_float_add(vector_float * a, const vector_float * b);
+
+void vector_float_subtract(vector_float * a, const vector_float * b);
+
+void vector_float_times(vector_float * a, const float f);
+
+void vector_float_transpose(vector_float * a);
+
+void vector_float_copy(vector_float * a, const vector_float * b);
+
+void vector_float_set_zero(vector_float * a);
+
+void vector_float_set_to(vector_float * a, const float f);
+
+#endif /* CMATRIXLIB_H_ */
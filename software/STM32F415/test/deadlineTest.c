@@ -0,0 +1,163 @@
+/*
+ * deadlineTest.c
+ *
+ * The MPC with MPC_DEADLINE: a passed deadline falls back to the saturated
+ * condensed MPC with the cut-off reported in rows_done, a far one gives the
+ * whole computation. Built with MPC_CONSTRAINED, where the QP iterations are
+ * counted as well, and with MPC_FULL_VECTOR, alone and in the batched pass.
+ */
+
+#include <stdio.h>
+#include "mpc/elevator/elevatorMpc.h"
+#include "mpc/aileron/aileronMpc.h"
+
+#define NUMBER_OF_STEPS		200
+
+// uniform in (-range, range)
+static float randomIn(const float range) {
+
+	return range*(2*((float) rand()/RAND_MAX) - 1);
+}
+
+static float saturate(const mpcHandler_t * handler, const float value) {
+
+	return fmaxf(fminf(value, handler->input_limit), -handler->input_limit);
+}
+
+// far ahead or already passed, the counter is compared as signed
+static void setDeadline(mpcHandler_t * handler, const int passed) {
+
+	handler->deadline = passed ? cycleCounterGet() - 1 : cycleCounterGet() + 0x7FFFFFFF;
+}
+
+#ifdef MPC_CONSTRAINED
+
+static const char * name = "constrained";
+
+// the constrained step of the elevator, returns the number of failures
+static int testStep(mpcHandler_t ** handlers, const float * condensed, const int step) {
+
+	const int rows = handlers[0]->number_of_weighted_rows;
+
+	float c[handlers[0]->reduced_horizon_len];
+	float output;
+	int failed = 0;
+
+	// the whole step in time
+	setDeadline(handlers[0], 0);
+	failed += (calculateMPCLinearTerm(handlers[0], c) != rows);
+
+	output = calculateMPCConstrained(handlers[0]);
+
+	if (handlers[0]->rows_done != rows || handlers[0]->qp_iterations_done != MPC_QP_ITERATIONS || fabsf(output) > handlers[0]->input_limit) {
+
+		printf("step %d: %d rows, %d iterations, %f\n", step, handlers[0]->rows_done, handlers[0]->qp_iterations_done, output);
+		failed++;
+	}
+
+	// the deadline passed before the first chunk of the prediction
+	setDeadline(handlers[0], 1);
+	failed += (calculateMPCLinearTerm(handlers[0], c) != 0);
+
+	output = calculateMPCConstrained(handlers[0]);
+
+	if (handlers[0]->rows_done != 0 || handlers[0]->qp_iterations_done != 0 || output != saturate(handlers[0], condensed[0])) {
+
+		printf("step %d cut off: %d rows, %d iterations, %f, expected %f\n", step, handlers[0]->rows_done, handlers[0]->qp_iterations_done, output, saturate(handlers[0], condensed[0]));
+		failed++;
+	}
+
+	return failed;
+}
+
+#else
+
+// the float rounding of the two paths, relative to the input limit
+#define MAX_DIFFERENCE		1e-3
+
+static const char * name = "full vector";
+
+static int check(const char * what, const int step, const float value, const float expected, const float limit) {
+
+	if (fabsf(value - expected)/limit <= MAX_DIFFERENCE)
+		return 0;
+
+	printf("%s step %d: %f, expected %f\n", what, step, value, expected);
+
+	return 1;
+}
+
+// the full-vector step of the elevator and the batched pass of both axes, returns the number of failures
+static int testStep(mpcHandler_t ** handlers, const float * condensed, const int step) {
+
+	const int rows = handlers[0]->number_of_weighted_rows;
+	const float limit = handlers[0]->input_limit;
+
+	float outputs[2];
+	int h, failed = 0;
+
+	// the whole step in time
+	setDeadline(handlers[0], 0);
+	failed += check("full", step, calculateMPCFull(handlers[0]), condensed[0], limit);
+	failed += (handlers[0]->rows_done != rows);
+
+	// the deadline passed before the first chunk
+	setDeadline(handlers[0], 1);
+	failed += check("full cut off", step, calculateMPCFull(handlers[0]), saturate(handlers[0], condensed[0]), limit);
+	failed += (handlers[0]->rows_done != 0);
+
+	// the batched pass, in time and cut off by the deadline of the last axis
+	setDeadline(handlers[0], 0);
+	setDeadline(handlers[1], 0);
+	calculateMPCBatch(handlers, 2, outputs);
+
+	for (h = 0; h < 2; h++) {
+
+		failed += check("batch", step, outputs[h], condensed[h], limit);
+		failed += (handlers[h]->rows_done != rows);
+	}
+
+	setDeadline(handlers[1], 1);
+	calculateMPCBatch(handlers, 2, outputs);
+
+	// the cut-off is reported on both axes
+	for (h = 0; h < 2; h++) {
+
+		failed += check("batch cut off", step, outputs[h], saturate(handlers[h], condensed[h]), limit);
+		failed += (handlers[h]->rows_done == rows);
+	}
+
+	return failed;
+}
+
+#endif
+
+int main() {
+
+	mpcHandler_t * handlers[2] = {initializeElevatorMPC(), initializeAileronMPC()};
+
+	float condensed[2];
+	int step, h, i, failed = 0;
+
+	srand(3);
+
+	for (step = 0; step < NUMBER_OF_STEPS; step++) {
+
+		for (h = 0; h < 2; h++) {
+
+			for (i = 0; i < handlers[h]->number_of_states; i++)
+				handlers[h]->initial_cond->data[i] = randomIn(i == 3 ? 20 : 3);
+
+			setReferenceSetpoint(handlers[h], randomIn(3));
+			filterReferenceTrajectory(handlers[h]);
+
+			condensed[h] = calculateMPCCondensed(handlers[h]);
+		}
+
+		failed += testStep(handlers, condensed, step);
+	}
+
+	printf("deadline, %s: %d steps, %d failed\n", name, NUMBER_OF_STEPS, failed);
+
+	return (failed > 0) ? 1 : 0;
+}
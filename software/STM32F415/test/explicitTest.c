@@ -0,0 +1,191 @@
+/*
+ * explicitTest.c
+ *
+ * calculateMPCExplicit() with the tables of elevAileExplicitMpc.c against the
+ * constrained QP solved until the convergence, in closed-loop runs from random
+ * initial conditions towards random setpoints. Built with MPC_EXPLICIT and
+ * MPC_CONSTRAINED, the unknown regions fall back to the QP.
+ */
+
+#include <stdio.h>
+#include "mpc/elevator/elevatorMpc.h"
+#include "mpc/explicitMpc.h"
+
+#define NUMBER_OF_RUNS		50
+#define RUN_LEN				300
+
+// iterations of the reference QP, the same as in explicitMpc.m
+#define QP_ITERATIONS		2000
+
+// the inputs of a known region against the converged QP, relative to the input limit
+#define MAX_DIFFERENCE		1e-3
+
+// the least share of the steps found in the tables
+#define MIN_HIT_RATE		0.95
+
+// the input matrix of main.m, the tables keep only the weighted rows of B_roof
+static const float B[5] = {0, 0, 0, 0.000044664, 0};
+
+// uniform in (-range, range)
+static float randomIn(const float range) {
+
+	return range*(2*((float) rand()/RAND_MAX) - 1);
+}
+
+// projectedGradient.m in double, warm started by u
+static void solveQP(const mpcHandler_t * handler, const float * c, double * u) {
+
+	const int n = handler->reduced_horizon_len;
+	const double limit = handler->input_limit;
+
+	double y[n], previous[n];
+	double gradient, t = 1, t_next;
+	int i, j, k;
+
+	for (i = 0; i < n; i++)
+		y[i] = u[i];
+
+	for (k = 0; k < QP_ITERATIONS; k++) {
+
+		for (i = 0; i < n; i++) {
+
+			gradient = c[i];
+			for (j = 0; j < n; j++)
+				gradient += handler->H->data[i*n + j]*y[j];
+
+			previous[i] = u[i];
+			u[i] = fmin(fmax(y[i] - handler->H_scaling->data[i]*gradient, -limit), limit);
+		}
+
+		t_next = (1 + sqrt(1 + 4*t*t))/2;
+
+		for (i = 0; i < n; i++)
+			y[i] = u[i] + ((t - 1)/t_next)*(u[i] - previous[i]);
+
+		t = t_next;
+	}
+}
+
+// the closed-loop runs, the initial conditions and setpoints scaled by spread, returns the failed steps
+static int testRuns(mpcHandler_t * handler, const float spread, int * hits, int * misses) {
+
+	const int n = handler->number_of_states;
+	const int n_variables = handler->reduced_horizon_len;
+
+	const explicitMpc_t * law = handler->explicit_law;
+
+	float state[n], next[n], c[n_variables], u[n_variables];
+	double u_qp[n_variables];
+	float setpoint, explicit, difference, max_difference = 0;
+	int run, step, i, j, failed = 0;
+
+	*hits = 0;
+	*misses = 0;
+
+	for (run = 0; run < NUMBER_OF_RUNS; run++) {
+
+		// the same distribution as the samples of explicitMpc.m with spread 1
+		for (i = 0; i < n; i++)
+			state[i] = 0;
+
+		state[0] = randomIn(5*spread);
+		state[1] = randomIn(1*spread);
+		setpoint = randomIn(5*spread);
+
+		for (i = 0; i < n_variables; i++)
+			u_qp[i] = 0;
+
+		for (step = 0; step < RUN_LEN; step++) {
+
+			for (i = 0; i < n; i++)
+				handler->initial_cond->data[i] = state[i];
+
+			// the reference is preshaped from the current position in each step
+			setReferenceSetpoint(handler, setpoint);
+			filterReferenceTrajectory(handler);
+
+			explicit = calculateMPCExplicit(handler);
+
+			calculateMPCLinearTerm(handler, c);
+
+			for (i = 0; i < handler->single_step_len; i++)
+				u_qp[i] = u_qp[i+1];
+
+			solveQP(handler, c, u_qp);
+
+			if (handler->explicit_region >= 0) {
+
+				(*hits)++;
+
+				// the whole law of the region, the active inputs are at their limits
+				for (i = 0; i < n_variables; i++) {
+
+					u[i] = law->offset[handler->explicit_region*n_variables + i];
+
+					if (law->active[handler->explicit_region*n_variables + i] != 0)
+						continue;
+
+					for (j = 0; j < n_variables; j++)
+						u[i] += law->gain[(handler->explicit_region*n_variables + i)*n_variables + j]*c[j];
+				}
+
+				difference = 0;
+				for (i = 0; i < n_variables; i++)
+					difference = fmax(difference, fabs(u[i] - u_qp[i])/handler->input_limit);
+
+				if (difference > max_difference)
+					max_difference = difference;
+
+				if (difference > MAX_DIFFERENCE && failed++ < 5)
+					printf("run %d step %d region %d: explicit %f, QP %f\n", run, step, handler->explicit_region, explicit, u_qp[0]);
+
+			} else {
+
+				(*misses)++;
+
+				// the fallback QP keeps the limits
+				if (fabs(explicit) > handler->input_limit && failed++ < 5)
+					printf("run %d step %d fallback: %f\n", run, step, explicit);
+			}
+
+			// the plant is driven by the converged QP
+			for (i = 0; i < n; i++) {
+
+				next[i] = B[i]*(float) u_qp[0];
+				for (j = 0; j < n; j++)
+					next[i] += handler->A->data[i*n + j]*state[j];
+			}
+
+			for (i = 0; i < n; i++)
+				state[i] = next[i];
+		}
+	}
+
+	printf("explicit, spread %.0f: %d of %d steps in the tables, max difference %.2e of the input limit, %d fell back, %d failed\n",
+			spread, *hits, NUMBER_OF_RUNS*RUN_LEN, max_difference, *misses, failed);
+
+	return failed;
+}
+
+int main() {
+
+	mpcHandler_t * handler = initializeElevatorMPC();
+
+	int hits, misses, failed = 0;
+
+	srand(2);
+
+	// the sampled distribution, nearly all steps should be found
+	failed += testRuns(handler, 1, &hits, &misses);
+
+	if (hits < MIN_HIT_RATE*NUMBER_OF_RUNS*RUN_LEN) {
+
+		printf("explicit: too few steps in the tables\n");
+		failed++;
+	}
+
+	// far outside of it, the regions which do not hold have to be rejected
+	failed += testRuns(handler, 4, &hits, &misses);
+
+	return (failed > 0) ? 1 : 0;
+}
@@ -0,0 +1,140 @@
+/*
+ * historyTest.c
+ *
+ * kalmanHistoryFuse() with delayed positions against fusing them on time. The
+ * elevator handler gets each position RASPBERRY_DELAY steps late through its
+ * history, a copy of it gets the position right after the step it belongs to.
+ * The sequence numbers wrap through 65535.
+ */
+
+#include <stdio.h>
+#include "kalman/kalmanSparse.h"
+#include "kalman/kalmanHistory.h"
+#include "kalman/elevator/elevatorKalman.h"
+#include "miscellaneous.h"
+
+#define NUMBER_OF_STEPS		2000
+
+// steps between two positions
+#define POSITION_PERIOD		10
+
+// steps of the delay of the positions, less than KALMAN_HISTORY_LENGTH and POSITION_PERIOD
+#define RASPBERRY_DELAY		7
+
+// the first sequence number, the numbers wrap during the test
+#define FIRST_SEQUENCE		65000
+
+// uniform in (-range, range)
+static float randomIn(const float range) {
+
+	return range*(2*((float) rand()/RAND_MAX) - 1);
+}
+
+int main() {
+
+	kalmanHandler_t * delayed = initializeElevatorKalman();
+	kalmanHandler_t * on_time = (kalmanHandler_t *) calloc(1, sizeof(kalmanHandler_t));
+
+	const int n = delayed->number_of_states;
+	const int packed = n*(n+1)/2;
+
+	// the measurement of kalmanTask, the speed
+	matrix_float * Q = matrix_float_alloc(1, 1);
+	matrix_float * C = matrix_float_alloc(1, n);
+
+	kalmanHistory_t history;
+
+	float position = 0;
+	float difference, max_difference = 0;
+	uint16_t sequence = FIRST_SEQUENCE;
+	int step, i, fused = 0, failed = 0;
+
+	history.states = (float *) calloc(KALMAN_HISTORY_LENGTH*n, sizeof(float));
+	history.covariance = (float *) calloc(KALMAN_HISTORY_LENGTH*packed, sizeof(float));
+	history.input = (float *) calloc(KALMAN_HISTORY_LENGTH*delayed->number_of_inputs, sizeof(float));
+	history.measurement = (float *) calloc(KALMAN_HISTORY_LENGTH, sizeof(float));
+	history.sequence = (uint16_t *) calloc(KALMAN_HISTORY_LENGTH, sizeof(uint16_t));
+
+	kalmanHistoryClear(&history);
+
+	// without KALMAN_FULL_MATRICES only the packed covariance is kept
+	if (delayed->covariance != 0) {
+
+		printf("history: the full covariance is allocated\n");
+		failed++;
+	}
+
+	matrix_float_set(Q, 1, 1, KALMAN_Q);
+	matrix_float_set_zero(C);
+	matrix_float_set(C, 1, 2, 1);
+
+	delayed->Q_matrix = Q;
+	delayed->C_matrix = C;
+	delayed->measurement = vector_float_alloc(1, 0);
+
+	// the same model, input and measurement with its own states and covariance
+	*on_time = *delayed;
+	on_time->states = vector_float_alloc(n, 0);
+	on_time->covariance_packed = (float *) calloc(packed, sizeof(float));
+
+	memcpy(on_time->states->data, delayed->states->data, n*sizeof(float));
+	memcpy(on_time->covariance_packed, delayed->covariance_packed, packed*sizeof(float));
+
+	srand(6);
+
+	for (step = 0; step < NUMBER_OF_STEPS; step++, sequence++) {
+
+		vector_float_set(delayed->input, 1, randomIn(KALMAN_INPUT_SATURATION));
+		vector_float_set(delayed->measurement, 1, randomIn(KALMAN_MEASURED_VELOCITY_SATURATION));
+
+		kalmanIterationSparse(delayed);
+		kalmanHistoryRecord(&history, delayed, sequence);
+
+		kalmanIterationSparse(on_time);
+
+		// a position valid at this step
+		if ((step % POSITION_PERIOD) == 0) {
+
+			position = randomIn(5);
+			kalmanCorrectState(on_time, 0, position, KALMAN_POSITION_Q);
+		}
+
+		// it arrives late, then both have fused the same
+		if ((step % POSITION_PERIOD) == RASPBERRY_DELAY) {
+
+			if (kalmanHistoryFuse(&history, delayed, (uint16_t) (sequence - RASPBERRY_DELAY), position, KALMAN_POSITION_Q, kalmanIterationSparse) != RASPBERRY_DELAY) {
+
+				printf("history: step %d was not found\n", step - RASPBERRY_DELAY);
+				failed++;
+			}
+
+			fused++;
+
+			for (i = 0; i < n; i++) {
+
+				difference = fabsf(delayed->states->data[i] - on_time->states->data[i]);
+				max_difference = fmaxf(max_difference, difference);
+			}
+
+			for (i = 0; i < packed; i++) {
+
+				difference = fabsf(delayed->covariance_packed[i] - on_time->covariance_packed[i]);
+				max_difference = fmaxf(max_difference, difference);
+			}
+		}
+	}
+
+	// a position older than the history
+	if (kalmanHistoryFuse(&history, delayed, (uint16_t) (sequence - KALMAN_HISTORY_LENGTH - 1), 0, KALMAN_POSITION_Q, kalmanIterationSparse) != -1) {
+
+		printf("history: a position older than the history was fused\n");
+		failed++;
+	}
+
+	failed += (max_difference != 0);
+
+	printf("history: %d steps, %d positions %d steps late, max difference %.2e, %d failed\n",
+			NUMBER_OF_STEPS, fused, RASPBERRY_DELAY, max_difference, failed);
+
+	return (failed > 0) ? 1 : 0;
+}
@@ -0,0 +1,78 @@
+/*
+ * hostSystem.c
+ *
+ * Host versions of the functions of ../miscellaneous.c and ../system.c which
+ * the tests need.
+ */
+
+#include "system.h"
+#include "miscellaneous.h"
+#include <time.h>
+
+static size_t arenaTop;
+static size_t arenaFailed;
+
+void * arenaAlloc(const size_t size) {
+
+	// the same alignment as the arena of the board
+	size_t aligned = (size + 7) & ~((size_t) 7);
+	void * block = calloc(1, aligned);
+
+	if (block != 0)
+		arenaTop += aligned;
+	else
+		arenaFailed++;
+
+	return block;
+}
+
+size_t arenaHighWater() {
+
+	return arenaTop;
+}
+
+size_t arenaFailures() {
+
+	return arenaFailed;
+}
+
+matrix_float * matrix_float_alloc(const int16_t h, const int16_t w) {
+
+	return matrix_float_alloc_hollow(h, w, (float *) arenaAlloc(h*w*sizeof(float)));
+}
+
+matrix_float * matrix_float_alloc_hollow(const int16_t h, const int16_t w, float * data_pointer) {
+
+	matrix_float * m = (matrix_float *) arenaAlloc(sizeof(matrix_float));
+
+	m->height = h;
+	m->width = w;
+	m->data = data_pointer;
+
+	return m;
+}
+
+vector_float * vector_float_alloc(const int16_t length, int8_t orientation) {
+
+	return vector_float_alloc_hollow(length, orientation, (float *) arenaAlloc(length*sizeof(float)));
+}
+
+vector_float * vector_float_alloc_hollow(const int16_t length, int8_t orientation, float * data_pointer) {
+
+	vector_float * v = (vector_float *) arenaAlloc(sizeof(vector_float));
+
+	v->length = length;
+	v->orientation = orientation;
+	v->data = data_pointer;
+
+	return v;
+}
+
+uint32_t cycleCounterGet() {
+
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (uint32_t) (now.tv_sec*1000000000ULL + now.tv_nsec);
+}
@@ -0,0 +1,112 @@
+/*
+ * kalmanTest.c
+ *
+ * kalmanIterationScalar() against the general kalmanIteration() with the
+ * px4flow speed measurement as in kalmanTask. The elevator runs the general
+ * step and the aileron, which has the same model, the scalar one. The states
+ * and the covariances are compared after each step and both are timed.
+ */
+
+#include <stdio.h>
+#include "kalman/elevator/elevatorKalman.h"
+#include "kalman/aileron/aileronKalman.h"
+#include "miscellaneous.h"
+
+#define NUMBER_OF_STEPS		20000
+
+// relative to the largest element of the compared vector or matrix
+#define MAX_DIFFERENCE		1e-4
+
+// uniform in (-range, range)
+static float randomIn(const float range) {
+
+	return range*(2*((float) rand()/RAND_MAX) - 1);
+}
+
+static int sameMatrix(const matrix_float * a, const matrix_float * b) {
+
+	return memcmp(a->data, b->data, a->height*a->width*sizeof(float)) == 0;
+}
+
+int main() {
+
+	kalmanHandler_t * general = initializeElevatorKalman();
+	kalmanHandler_t * scalar = initializeAileronKalman();
+
+	const int n = general->number_of_states;
+
+	// the measurement of kalmanTask, the speed
+	matrix_float * Q = matrix_float_alloc(1, 1);
+	matrix_float * C = matrix_float_alloc(1, n);
+	vector_float * measurement = vector_float_alloc(1, 0);
+
+	float scale, difference, max_state = 0, max_covariance = 0;
+	uint32_t start, general_time = 0, scalar_time = 0;
+	int step, i, j, failed = 0;
+
+	if (!sameMatrix(general->system_A, scalar->system_A) || !sameMatrix(general->system_B, scalar->system_B) ||
+		!sameMatrix(general->R_matrix, scalar->R_matrix) || !sameMatrix(general->covariance, scalar->covariance)) {
+
+		printf("kalman: the elevator and aileron models differ\n");
+		return 1;
+	}
+
+	matrix_float_set(Q, 1, 1, KALMAN_Q);
+	matrix_float_set_zero(C);
+	matrix_float_set(C, 1, 2, 1);
+
+	general->Q_matrix = scalar->Q_matrix = Q;
+	general->C_matrix = scalar->C_matrix = C;
+	general->measurement = scalar->measurement = measurement;
+
+	srand(4);
+
+	for (step = 0; step < NUMBER_OF_STEPS; step++) {
+
+		vector_float_set(general->input, 1, randomIn(KALMAN_INPUT_SATURATION));
+		vector_float_set(scalar->input, 1, vector_float_get(general->input, 1));
+		vector_float_set(measurement, 1, randomIn(KALMAN_MEASURED_VELOCITY_SATURATION));
+
+		start = cycleCounterGet();
+		kalmanIteration(general);
+		general_time += cycleCounterGet() - start;
+
+		start = cycleCounterGet();
+		kalmanIterationScalar(scalar);
+		scalar_time += cycleCounterGet() - start;
+
+		// the states
+		scale = 0;
+		for (i = 0; i < n; i++)
+			scale = fmaxf(scale, fabsf(general->states->data[i]));
+
+		for (i = 0; i < n; i++) {
+
+			difference = fabsf(general->states->data[i] - scalar->states->data[i])/fmaxf(scale, 1e-6);
+			max_state = fmaxf(max_state, difference);
+		}
+
+		// the covariance, the scalar step keeps only its upper triangle
+		scale = 0;
+		for (i = 0; i < n*n; i++)
+			scale = fmaxf(scale, fabsf(general->covariance->data[i]));
+
+		for (i = 0; i < n; i++)
+			for (j = 0; j < n; j++) {
+
+				difference = fabsf(matrix_float_get(general->covariance, i+1, j+1) - scalar->covariance_packed[kalmanPackedIndex(n, i, j)])/scale;
+				max_covariance = fmaxf(max_covariance, difference);
+			}
+
+		if ((max_state > MAX_DIFFERENCE || max_covariance > MAX_DIFFERENCE) && failed++ == 0)
+			printf("kalman: the steps differ from step %d\n", step);
+	}
+
+	printf("kalman: %d steps, max difference of the states %.2e, of the covariance %.2e, %d failed\n",
+			NUMBER_OF_STEPS, max_state, max_covariance, failed);
+
+	printf("kalman: kalmanIteration() %.0f ns, kalmanIterationScalar() %.0f ns per step on the host\n",
+			(float) general_time/NUMBER_OF_STEPS, (float) scalar_time/NUMBER_OF_STEPS);
+
+	return (failed > 0) ? 1 : 0;
+}
@@ -0,0 +1,28 @@
+/*
+ * miscellaneous.h
+ *
+ * Host replacement of ../miscellaneous.h, the arena and the matrices are
+ * allocated from the heap of the host.
+ */
+
+#ifndef MISCELLANEOUS_H_
+#define MISCELLANEOUS_H_
+
+#include "system.h"
+#include "CMatrixLib.h"
+
+void * arenaAlloc(const size_t size);
+
+size_t arenaHighWater();
+
+size_t arenaFailures();
+
+matrix_float * matrix_float_alloc(const int16_t h, const int16_t w);
+
+matrix_float * matrix_float_alloc_hollow(const int16_t h, const int16_t w, float * data_pointer);
+
+vector_float * vector_float_alloc(const int16_t length, int8_t orientation);
+
+vector_float * vector_float_alloc_hollow(const int16_t length, int8_t orientation, float * data_pointer);
+
+#endif // MISCELLANEOUS_H_
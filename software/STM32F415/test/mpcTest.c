@@ -0,0 +1,112 @@
+/*
+ * mpcTest.c
+ *
+ * calculateMPCFull() and calculateMPCCondensed() give the same first action
+ * for the elevator and aileron handlers over random states and references,
+ * calculateMPCBatch() gives the actions of calculateMPC() for both at once.
+ */
+
+#include <stdio.h>
+#include "mpc/elevator/elevatorMpc.h"
+#include "mpc/aileron/aileronMpc.h"
+
+// the steps of each handler
+#define NUMBER_OF_STEPS		2000
+
+// the paths differ by the float rounding only, relative to the larger of the action and 1
+#define MAX_DIFFERENCE		1e-3
+
+// uniform in (-range, range)
+static float randomIn(const float range) {
+
+	return range*(2*((float) rand()/RAND_MAX) - 1);
+}
+
+// a random state and reference
+static void randomProblem(mpcHandler_t * handler) {
+
+	// the ranges of the states (position, speed, acceleration, attitude input, its offset)
+	const float range[5] = {3, 1, 1, 20, 1};
+
+	int i;
+
+	for (i = 0; i < handler->number_of_states; i++)
+		handler->initial_cond->data[i] = randomIn(range[i % 5]);
+
+	for (i = 0; i < handler->position_reference->length; i++)
+		handler->position_reference->data[i] = randomIn(3);
+
+	filterReferenceTrajectory(handler);
+}
+
+static int compare(const char * name, const int step, const float value, const float expected, float * max_difference) {
+
+	const float difference = fabsf(value - expected)/fmaxf(fabsf(expected), 1);
+
+	if (difference > *max_difference)
+		*max_difference = difference;
+
+	if (difference <= MAX_DIFFERENCE)
+		return 0;
+
+	printf("%s step %d: %f, expected %f\n", name, step, value, expected);
+
+	return 1;
+}
+
+// returns the number of the steps where the paths differ
+static int testHandler(const char * name, mpcHandler_t * handler) {
+
+	float max_difference = 0;
+	int step, failed = 0;
+
+	for (step = 0; step < NUMBER_OF_STEPS; step++) {
+
+		randomProblem(handler);
+
+		failed += compare(name, step, calculateMPCCondensed(handler), calculateMPCFull(handler), &max_difference);
+	}
+
+	printf("%s: %d steps, max difference %.2e, %d failed\n", name, NUMBER_OF_STEPS, max_difference, failed);
+
+	return failed;
+}
+
+// returns the number of the steps where the batch differs from the single calls
+static int testBatch(mpcHandler_t * handlers[2]) {
+
+	float outputs[2], max_difference = 0;
+	int step, h, failed = 0;
+
+	for (step = 0; step < NUMBER_OF_STEPS; step++) {
+
+		for (h = 0; h < 2; h++)
+			randomProblem(handlers[h]);
+
+		calculateMPCBatch(handlers, 2, outputs);
+
+		for (h = 0; h < 2; h++)
+			failed += compare("batch", step, outputs[h], calculateMPC(handlers[h]), &max_difference);
+	}
+
+	printf("batch: %d steps, max difference %.2e, %d failed\n", NUMBER_OF_STEPS, max_difference, failed);
+
+	return failed;
+}
+
+int main() {
+
+	mpcHandler_t * handlers[2];
+	int failed = 0;
+
+	srand(1);
+
+	handlers[0] = initializeElevatorMPC();
+	handlers[1] = initializeAileronMPC();
+
+	failed += testHandler("elevator", handlers[0]);
+	failed += testHandler("aileron", handlers[1]);
+	failed += testBatch(handlers);
+
+	return (failed > 0) ? 1 : 0;
+}
@@ -0,0 +1,164 @@
+/*
+ * quantizedTest.c
+ *
+ * calculateMPCFull() with MPC_QUANTIZED against the float first action over
+ * random states and references. The difference has to stay within the bound
+ * of "MPC matlab/quantizationError.m", the rounding of each int16 vector and
+ * table is at most half of its scale. calculateMPCBatch() steps the axes one
+ * by one in this configuration and gives the actions of calculateMPC().
+ */
+
+#include <stdio.h>
+#include "mpc/elevator/elevatorMpc.h"
+#include "mpc/aileron/aileronMpc.h"
+
+#define NUMBER_OF_STEPS		2000
+
+// the float rounding of the bound itself, relative to the bound
+#define BOUND_TOLERANCE		1e-3
+
+// uniform in (-range, range)
+static float randomIn(const float range) {
+
+	return range*(2*((float) rand()/RAND_MAX) - 1);
+}
+
+// a random state and reference, the same ranges as in mpcTest
+static void randomProblem(mpcHandler_t * handler) {
+
+	const float range[5] = {3, 1, 1, 20, 1};
+
+	int i;
+
+	for (i = 0; i < handler->number_of_states; i++)
+		handler->initial_cond->data[i] = randomIn(range[i % 5]);
+
+	for (i = 0; i < handler->position_reference->length; i++)
+		handler->position_reference->data[i] = randomIn(3);
+
+	filterReferenceTrajectory(handler);
+}
+
+// the float first action from the weighted error of the last step, the bound of its quantization error
+static float floatAction(const mpcHandler_t * handler, double * bound) {
+
+	const int n_variables = handler->reduced_horizon_len;
+	const int rows = handler->number_of_weighted_rows;
+
+	const float * error = handler->work_error;
+	const float * c_quantized = handler->work_c;
+	const float * B_roof = handler->B_roof->data;
+	const float * H_inv = handler->H_inv->data;
+
+	double c, c_bound, column_sum, error_sum = 0, error_scale = 0, scaled_scale = 0;
+	double action = 0, q15_sum = 0;
+	int j, r;
+
+	for (r = 0; r < rows; r++) {
+
+		error_sum += fabs(error[r]);
+		error_scale = fmax(error_scale, fabs(error[r]));
+	}
+
+	error_scale /= 32767;
+
+	for (j = 0; j < n_variables; j++)
+		scaled_scale = fmax(scaled_scale, fabs(c_quantized[j]*handler->H_inv_scale[j]));
+
+	scaled_scale /= 32767;
+
+	*bound = 0;
+
+	for (j = 0; j < n_variables; j++) {
+
+		c = 0;
+		column_sum = 0;
+
+		for (r = 0; r < rows; r++) {
+
+			c += error[r]*B_roof[r*n_variables + j];
+			column_sum += fabs(B_roof[r*n_variables + j]);
+		}
+
+		action += H_inv[j]*c;
+
+		// the error of c(j) from the quantized error vector and the quantized column of B_roof
+		c_bound = error_sum*handler->B_roof_scale[j]/2 + error_scale*column_sum/2 + rows*error_scale*handler->B_roof_scale[j]/4;
+
+		*bound += fabs(H_inv[j])*c_bound + (handler->H_inv_scale[j]/2)*(fabs(c) + c_bound);
+		q15_sum += abs(handler->H_inv_q15[j]);
+	}
+
+	*bound = 0.5*(*bound + q15_sum*scaled_scale/2);
+
+	return (float) (-0.5*action);
+}
+
+// returns the number of the steps out of the bound
+static int testHandler(const char * name, mpcHandler_t * handler) {
+
+	float quantized, expected, difference, max_difference = 0;
+	double bound, max_ratio = 0;
+	int step, failed = 0;
+
+	for (step = 0; step < NUMBER_OF_STEPS; step++) {
+
+		randomProblem(handler);
+
+		quantized = calculateMPCFull(handler);
+		expected = floatAction(handler, &bound);
+
+		difference = fabsf(quantized - expected);
+
+		max_difference = fmaxf(max_difference, difference);
+		max_ratio = fmax(max_ratio, difference/bound);
+
+		if (difference > bound*(1 + BOUND_TOLERANCE)) {
+
+			if (failed++ == 0)
+				printf("%s step %d: %f, float %f, bound %f\n", name, step, quantized, expected, bound);
+		}
+	}
+
+	printf("quantized %s: %d steps, max error %.2e of the input limit, at most %.2f of the bound, %d failed\n",
+			name, NUMBER_OF_STEPS, max_difference/handler->input_limit, max_ratio, failed);
+
+	return failed;
+}
+
+// returns the number of the steps where the batch differs from the single calls
+static int testBatch(mpcHandler_t * handlers[2]) {
+
+	float outputs[2];
+	int step, h, failed = 0;
+
+	for (step = 0; step < NUMBER_OF_STEPS; step++) {
+
+		for (h = 0; h < 2; h++)
+			randomProblem(handlers[h]);
+
+		calculateMPCBatch(handlers, 2, outputs);
+
+		for (h = 0; h < 2; h++)
+			failed += (outputs[h] != calculateMPC(handlers[h]));
+	}
+
+	printf("quantized batch: %d steps, %d failed\n", NUMBER_OF_STEPS, failed);
+
+	return failed;
+}
+
+int main() {
+
+	mpcHandler_t * handlers[2] = {initializeElevatorMPC(), initializeAileronMPC()};
+
+	int failed = 0;
+
+	srand(7);
+
+	failed += testHandler("elevator", handlers[0]);
+	failed += testHandler("aileron", handlers[1]);
+	failed += testBatch(handlers);
+
+	return (failed > 0) ? 1 : 0;
+}
@@ -0,0 +1,248 @@
+/*
+ * sparseTest.c
+ *
+ * The sparse kalman kernels on the elevator and aileron handlers, stepped as
+ * by kalmanTask with kalmanIterationSparsePair(). Copies of the handlers run
+ * kalmanIterationSparse(), which has to give the same numbers, and the general
+ * kalmanIteration(), compared within the rounding. The px4flow speed is the
+ * measurement, the covariances are reset now and then as by kalmanTask.
+ * With KALMAN_STEADY_STATE the frozen gain takes over as in kalmanTask, its
+ * states are compared with those of the full filter.
+ */
+
+#include <stdio.h>
+#include "kalman/kalmanSparse.h"
+#include "kalman/elevator/elevatorKalman.h"
+#include "kalman/aileron/aileronKalman.h"
+#include "miscellaneous.h"
+
+#define NUMBER_OF_STEPS		20000
+
+// steps between the resets of the covariance
+#define RESET_PERIOD		5000
+
+// relative to the largest element of the compared vector or matrix
+#define MAX_DIFFERENCE		1e-4
+
+// the states with the frozen gain against the full filter, whose gain still converges
+#define MAX_STEADY_DIFFERENCE	5e-3
+
+// uniform in (-range, range)
+static float randomIn(const float range) {
+
+	return range*(2*((float) rand()/RAND_MAX) - 1);
+}
+
+// the same model, input and measurement with its own states, covariance and gain
+static kalmanHandler_t * copyHandler(const kalmanHandler_t * handler) {
+
+	const int n = handler->number_of_states;
+
+	kalmanHandler_t * copy = (kalmanHandler_t *) calloc(1, sizeof(kalmanHandler_t));
+
+	*copy = *handler;
+
+	copy->states = vector_float_alloc(n, 0);
+	copy->covariance = matrix_float_alloc(n, n);
+	copy->covariance_packed = (float *) calloc(n*(n+1)/2, sizeof(float));
+	copy->steady_gain = (float *) calloc(n, sizeof(float));
+
+	memcpy(copy->states->data, handler->states->data, n*sizeof(float));
+	memcpy(copy->covariance->data, handler->covariance->data, n*n*sizeof(float));
+	memcpy(copy->covariance_packed, handler->covariance_packed, n*(n+1)/2*sizeof(float));
+	memcpy(copy->steady_gain, handler->steady_gain, n*sizeof(float));
+
+	return copy;
+}
+
+typedef struct {
+
+	const char * name;
+	kalmanHandler_t * pair;		// the handler of kalmanTask
+	kalmanHandler_t * single;
+	kalmanHandler_t * general;
+	float max_state;
+	float max_steady_state;
+	float max_covariance;
+	int not_same;
+	int steady;
+	int failed;
+
+} axis_t;
+
+static void prepareAxis(axis_t * axis, const char * name, kalmanHandler_t * handler, matrix_float * Q, matrix_float * C) {
+
+	axis->name = name;
+	axis->pair = handler;
+
+	handler->Q_matrix = Q;
+	handler->C_matrix = C;
+	handler->measurement = vector_float_alloc(1, 0);
+
+	axis->single = copyHandler(handler);
+	axis->general = copyHandler(handler);
+}
+
+// the sparse step of one axis as in kalmanTask, returns 1 with the frozen gain
+static int singleStep(kalmanHandler_t * handler) {
+
+#ifdef KALMAN_STEADY_STATE
+	if (handler->steady_state) {
+
+		kalmanIterationSteady(handler);
+		return 1;
+	}
+#endif
+
+	kalmanIterationSparse(handler);
+
+	return 0;
+}
+
+// the step of both axes as in kalmanTask
+static void pairStep(axis_t * axes) {
+
+	if (!axes[0].pair->steady_state && !axes[1].pair->steady_state) {
+
+		kalmanIterationSparsePair(axes[0].pair, axes[1].pair);
+		return;
+	}
+
+	axes[0].steady += singleStep(axes[0].pair);
+	axes[1].steady += singleStep(axes[1].pair);
+}
+
+// compares the steps of the axis
+static void compareAxis(axis_t * axis, const int step) {
+
+	const int n = axis->general->number_of_states;
+
+	float scale, difference;
+	int i, j, frozen = 0;
+
+	// the pair does the same operations as the single step
+	if (memcmp(axis->pair->states->data, axis->single->states->data, n*sizeof(float)) != 0 ||
+		memcmp(axis->pair->covariance_packed, axis->single->covariance_packed, n*(n+1)/2*sizeof(float)) != 0)
+		axis->not_same++;
+
+	scale = 0;
+	for (i = 0; i < n; i++)
+		scale = fmaxf(scale, fabsf(axis->general->states->data[i]));
+
+#ifdef KALMAN_STEADY_STATE
+	// the covariance is not propagated with the frozen gain
+	frozen = axis->pair->steady_state;
+#endif
+
+	for (i = 0; i < n; i++) {
+
+		difference = fabsf(axis->general->states->data[i] - axis->pair->states->data[i])/fmaxf(scale, 1e-6);
+
+		if (frozen)
+			axis->max_steady_state = fmaxf(axis->max_steady_state, difference);
+		else
+			axis->max_state = fmaxf(axis->max_state, difference);
+	}
+
+	// the sparse step keeps only the upper triangle
+	if (!frozen) {
+
+		scale = 0;
+		for (i = 0; i < n*n; i++)
+			scale = fmaxf(scale, fabsf(axis->general->covariance->data[i]));
+
+		for (i = 0; i < n; i++)
+			for (j = 0; j < n; j++) {
+
+				difference = fabsf(matrix_float_get(axis->general->covariance, i+1, j+1) - axis->pair->covariance_packed[kalmanPackedIndex(n, i, j)])/scale;
+				axis->max_covariance = fmaxf(axis->max_covariance, difference);
+			}
+	}
+
+	if ((axis->not_same > 0 || axis->max_state > MAX_DIFFERENCE || axis->max_covariance > MAX_DIFFERENCE || axis->max_steady_state > MAX_STEADY_DIFFERENCE) && axis->failed++ == 0)
+		printf("sparse %s: the steps differ from step %d\n", axis->name, step);
+}
+
+int main() {
+
+	// the measurement of kalmanTask, the speed
+	matrix_float * Q = matrix_float_alloc(1, 1);
+	matrix_float * C = matrix_float_alloc(1, NUMBER_OF_STATES_ELEVATOR);
+
+	axis_t axes[2];
+	int step, a, failed = 0;
+
+	matrix_float_set(Q, 1, 1, KALMAN_Q);
+	matrix_float_set_zero(C);
+	matrix_float_set(C, 1, 2, 1);
+
+	memset(axes, 0, sizeof(axes));
+
+	prepareAxis(&axes[0], "elevator", initializeElevatorKalman(), Q, C);
+	prepareAxis(&axes[1], "aileron", initializeAileronKalman(), Q, C);
+
+	for (a = 0; a < 2; a++) {
+
+		if (!kalmanMatchesSparsity(axes[a].pair)) {
+
+			printf("sparse %s: the model does not match the pattern\n", axes[a].name);
+			return 1;
+		}
+	}
+
+	srand(5);
+
+	for (step = 0; step < NUMBER_OF_STEPS; step++) {
+
+		for (a = 0; a < 2; a++) {
+
+			if (step > 0 && (step % RESET_PERIOD) == 0) {
+
+				kalmanResetCovariance(axes[a].pair);
+				kalmanResetCovariance(axes[a].single);
+				kalmanResetCovariance(axes[a].general);
+
+#ifdef KALMAN_STEADY_STATE
+				// the difference of the frozen gain does not carry over to the next period
+				memcpy(axes[a].pair->states->data, axes[a].general->states->data, axes[a].general->number_of_states*sizeof(float));
+				memcpy(axes[a].single->states->data, axes[a].general->states->data, axes[a].general->number_of_states*sizeof(float));
+#endif
+			}
+
+			vector_float_set(axes[a].pair->input, 1, randomIn(KALMAN_INPUT_SATURATION));
+			vector_float_set(axes[a].pair->measurement, 1, randomIn(KALMAN_MEASURED_VELOCITY_SATURATION));
+		}
+
+		pairStep(axes);
+
+		for (a = 0; a < 2; a++) {
+
+			singleStep(axes[a].single);
+			kalmanIteration(axes[a].general);
+
+			compareAxis(&axes[a], step);
+		}
+	}
+
+	for (a = 0; a < 2; a++) {
+
+		printf("sparse %s: %d steps, %d not the same as the single step, max difference of the states %.2e, of the covariance %.2e, %d failed\n",
+				axes[a].name, NUMBER_OF_STEPS, axes[a].not_same, axes[a].max_state, axes[a].max_covariance, axes[a].failed);
+
+		failed += axes[a].failed;
+
+#ifdef KALMAN_STEADY_STATE
+		printf("sparse %s: %d steps with the frozen gain, max difference of the states %.2e\n",
+				axes[a].name, axes[a].steady, axes[a].max_steady_state);
+
+		// the gain has to freeze between the resets
+		if (axes[a].steady == 0) {
+
+			printf("sparse %s: the gain never froze\n", axes[a].name);
+			failed++;
+		}
+#endif
+	}
+
+	return (failed > 0) ? 1 : 0;
+}
@@ -0,0 +1,36 @@
+/*
+ * system.h
+ *
+ * Host replacement of the board header for the tests. It is found instead of
+ * ../system.h by the sources in the subdirectories, FreeRTOS and the
+ * peripherals are left out.
+ */
+
+#ifndef SYSTEM_H_
+#define SYSTEM_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "CMatrixLib.h"
+#include "config.h"
+
+#define pvPortMalloc(size) malloc(size)
+#define vPortFree(pointer) free(pointer)
+
+#define portENTER_CRITICAL()
+#define portEXIT_CRITICAL()
+
+// nanoseconds of the host clock, the cycle counter of the board (DWT->CYCCNT) otherwise
+uint32_t cycleCounterGet();
+
+// two int16 multiply-accumulates into 64 bits, the SMLALD instruction of the Cortex-M4 (MPC_QUANTIZED)
+static inline uint64_t __SMLALD(const uint32_t a, const uint32_t b, const uint64_t sum) {
+
+	return (uint64_t) ((int64_t) sum + (int32_t) (int16_t) (a & 0xFFFF)*(int16_t) (b & 0xFFFF)
+									 + (int32_t) (int16_t) (a >> 16)*(int16_t) (b >> 16));
+}
+
+#endif /* SYSTEM_H_ */
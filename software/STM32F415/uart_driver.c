@@ -8,6 +8,43 @@
 #include "uart_driver.h"
 #include "system.h"
 
+#ifdef UART_DMA
+
+// UART4_RX is on DMA1 stream 2, UART4_TX on DMA1 stream 4, both channel 4
+#define RX_STREAM	DMA1_Stream2
+#define TX_STREAM	DMA1_Stream4
+
+// the circular buffer written by the DMA
+static char rxBuffer[UART_DMA_RX_SIZE];
+
+// the halves of rxBuffer filled by the DMA, counted by its interrupt, and the bytes consumed by commTask
+// both count from the start, the DMA wrote over unread bytes when it gets a whole buffer ahead
+static volatile uint32_t rxHalves;
+static uint32_t rxConsumed;
+
+enum frameState_t {FRAME_FREE, FRAME_FILLING, FRAME_QUEUED};
+
+// the pool of TX frames and the queue of the frames to send, the first one is being sent
+static char txFrames[UART_DMA_TX_FRAMES][UART_TX_FRAME_SIZE];
+static uint16_t txLengths[UART_DMA_TX_FRAMES];
+static volatile enum frameState_t txStates[UART_DMA_TX_FRAMES];
+static volatile uint8_t txQueue[UART_DMA_TX_FRAMES];
+static volatile uint8_t txQueueFirst;
+static volatile uint8_t txQueueLength;
+
+// the frame filled by usart4PutChar()
+static char * txOpenFrame;
+static uint16_t txOpenLength;
+
+static void initDma();
+
+#else
+
+// the frame of usart4FrameAlloc(), copied to the queue at once
+static char txFrame[UART_TX_FRAME_SIZE];
+
+#endif
+
 /* This funcion initializes the USART4 peripheral
  *
  * Arguments: baudrate --> the baudrate at which the USART is
@@ -73,8 +110,15 @@ void init_USART4(uint32_t baudrate) {
 	 * if the USART1 receive interrupt occurs
 	 */
 
+#ifdef UART_DMA
+	// the DMA moves the bytes, the idle line tells that a burst of them came
+	initDma();
+
+	USART_ITConfig(UART4, USART_IT_IDLE, ENABLE);
+#else
 	USART_ITConfig(UART4, USART_IT_RXNE, ENABLE); // enable the USART1 receive interrupt
 	USART_ITConfig(UART4, USART_IT_TXE, ENABLE); // enable the USART1 receive interrupt
+#endif
 
 	NVIC_InitStructure.NVIC_IRQChannel = UART4_IRQn;		 // we want to configure the USART1 interrupts
 	NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 10;// this sets the priority group of the USART1 interrupts
@@ -103,6 +147,24 @@ void init_USART4(uint32_t baudrate) {
 
 portBASE_TYPE usart4PutChar(char ch) {
 
+#ifdef UART_DMA
+	// the bytes are collected to a frame until usart4Flush()
+	if (txOpenFrame == NULL) {
+
+		txOpenFrame = usart4FrameAlloc();
+		txOpenLength = 0;
+
+		if (txOpenFrame == NULL)
+			return pdFAIL;
+	}
+
+	txOpenFrame[txOpenLength++] = ch;
+
+	if (txOpenLength >= UART_TX_FRAME_SIZE)
+		usart4Flush();
+
+	return pdTRUE;
+#else
 	if(xQueueSend(usartTxQueue, &ch, 10) == pdPASS) {
 
 		USART_ITConfig(UART4, USART_IT_TXE, ENABLE);
@@ -110,6 +172,7 @@ portBASE_TYPE usart4PutChar(char ch) {
     } else {
     	return pdFAIL;
     }
+#endif
 }
 
 void usart4PutString(volatile char *s) {
@@ -127,6 +190,17 @@ void usart4PutString(volatile char *s) {
 void UART4_IRQHandler(void) {
 
 	long xHigherPriorityTaskWoken = pdFALSE;
+
+#ifdef UART_DMA
+	if (USART_GetITStatus(UART4, USART_IT_IDLE) != RESET) {
+
+		// the flag is cleared by reading the status and then the data register
+		USART_ReceiveData(UART4);
+
+		// the received bytes are in the buffer
+		xSemaphoreGiveFromISR(commEvent, &xHigherPriorityTaskWoken);
+	}
+#else
 	uint8_t ch;
 
 	// check if the USART4 receive interrupt flag was set
@@ -135,6 +209,10 @@ void UART4_IRQHandler(void) {
 		ch = (uint8_t) USART_ReceiveData(UART4);
 
 		xQueueSendToBackFromISR(usartRxQueue, &ch, &xHigherPriorityTaskWoken);
+
+		// commTask empties the queue on each event, only the first char wakes it up
+		if (uxQueueMessagesWaitingFromISR(usartRxQueue) == 1)
+			xSemaphoreGiveFromISR(commEvent, &xHigherPriorityTaskWoken);
 	}
 
 	if (USART_GetITStatus(UART4, USART_IT_TXE) != RESET) {
@@ -149,7 +227,269 @@ void UART4_IRQHandler(void) {
 			USART_ITConfig(UART4, USART_IT_TXE, DISABLE);
 		}
 	}
+#endif
 
 	portEND_SWITCHING_ISR(xHigherPriorityTaskWoken);
 }
 
+
+#ifdef UART_DMA
+
+static void initDma() {
+
+	DMA_InitTypeDef DMA_InitStructure;
+	NVIC_InitTypeDef NVIC_InitStructure;
+	int i;
+
+	RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_DMA1, ENABLE);
+
+	for (i = 0; i < UART_DMA_TX_FRAMES; i++)
+		txStates[i] = FRAME_FREE;
+
+	/* -------------------------------------------------------------------- */
+	/*	RX, circular into rxBuffer											*/
+	/* -------------------------------------------------------------------- */
+	DMA_DeInit(RX_STREAM);
+
+	DMA_InitStructure.DMA_Channel = DMA_Channel_4;
+	DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t) &UART4->DR;
+	DMA_InitStructure.DMA_Memory0BaseAddr = (uint32_t) rxBuffer;
+	DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralToMemory;
+	DMA_InitStructure.DMA_BufferSize = UART_DMA_RX_SIZE;
+	DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+	DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+	DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+	DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+	DMA_InitStructure.DMA_Mode = DMA_Mode_Circular;
+	DMA_InitStructure.DMA_Priority = DMA_Priority_High;
+	DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Disable;
+	DMA_InitStructure.DMA_FIFOThreshold = DMA_FIFOThreshold_Full;
+	DMA_InitStructure.DMA_MemoryBurst = DMA_MemoryBurst_Single;
+	DMA_InitStructure.DMA_PeripheralBurst = DMA_PeripheralBurst_Single;
+	DMA_Init(RX_STREAM, &DMA_InitStructure);
+
+	// a continuous stream without an idle line is read at each half of the buffer
+	DMA_ITConfig(RX_STREAM, DMA_IT_HT | DMA_IT_TC, ENABLE);
+
+	/* -------------------------------------------------------------------- */
+	/*	TX, one frame per transfer, started by usart4FrameSend()			*/
+	/* -------------------------------------------------------------------- */
+	DMA_DeInit(TX_STREAM);
+
+	DMA_InitStructure.DMA_Memory0BaseAddr = (uint32_t) txFrames[0];
+	DMA_InitStructure.DMA_DIR = DMA_DIR_MemoryToPeripheral;
+	DMA_InitStructure.DMA_BufferSize = 1;
+	DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+	DMA_InitStructure.DMA_Priority = DMA_Priority_Medium;
+	DMA_Init(TX_STREAM, &DMA_InitStructure);
+
+	DMA_ITConfig(TX_STREAM, DMA_IT_TC, ENABLE);
+
+	// the same priority as the uart, below configMAX_SYSCALL_INTERRUPT_PRIORITY
+	NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 10;
+	NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+	NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+
+	NVIC_InitStructure.NVIC_IRQChannel = DMA1_Stream2_IRQn;
+	NVIC_Init(&NVIC_InitStructure);
+
+	NVIC_InitStructure.NVIC_IRQChannel = DMA1_Stream4_IRQn;
+	NVIC_Init(&NVIC_InitStructure);
+
+	USART_DMACmd(UART4, USART_DMAReq_Rx | USART_DMAReq_Tx, ENABLE);
+
+	DMA_Cmd(RX_STREAM, ENABLE);
+}
+
+// the bytes written by the DMA since the start
+static uint32_t rxWritten() {
+
+	uint32_t halves;
+	uint16_t position;
+
+	// the interrupt of a half may come between the two reads
+	do {
+
+		halves = rxHalves;
+
+		// the DMA counts down the bytes left to the end of the buffer, it reloads after the last byte
+		position = (UART_DMA_RX_SIZE - DMA_GetCurrDataCounter(RX_STREAM)) % UART_DMA_RX_SIZE;
+
+	} while (halves != rxHalves);
+
+	// from the start of the last counted half, the DMA may be a half further with its interrupt pending
+	return halves*(UART_DMA_RX_SIZE/2) + (position + UART_DMA_RX_SIZE - (halves % 2)*(UART_DMA_RX_SIZE/2)) % UART_DMA_RX_SIZE;
+}
+
+uint16_t usart4RxSpan(const char ** span) {
+
+	const uint16_t read = rxConsumed % UART_DMA_RX_SIZE;
+	uint32_t unread = rxWritten() - rxConsumed;
+
+	*span = rxBuffer + read;
+
+	// overwritten already, usart4RxConsume() reports it
+	if (unread > UART_DMA_RX_SIZE)
+		unread = UART_DMA_RX_SIZE;
+
+	// the written part wrapped over the end, the end first
+	if (unread > UART_DMA_RX_SIZE - read)
+		return UART_DMA_RX_SIZE - read;
+
+	return unread;
+}
+
+portBASE_TYPE usart4RxConsume(const uint16_t length) {
+
+	const uint32_t written = rxWritten();
+
+	// the first byte of the span is written over first, the DMA has got a whole buffer past it
+	if (written - rxConsumed > UART_DMA_RX_SIZE) {
+
+		// the unread bytes are dropped, the next span starts at the DMA
+		rxConsumed = written;
+		return pdFAIL;
+	}
+
+	rxConsumed += length;
+
+	return pdTRUE;
+}
+
+// start sending the first frame of the queue, called with the DMA stopped
+static void startFrame() {
+
+	const uint8_t frame = txQueue[txQueueFirst];
+
+	DMA_ClearFlag(TX_STREAM, DMA_FLAG_TCIF4 | DMA_FLAG_HTIF4 | DMA_FLAG_TEIF4 | DMA_FLAG_DMEIF4 | DMA_FLAG_FEIF4);
+
+	DMA_MemoryTargetConfig(TX_STREAM, (uint32_t) txFrames[frame], DMA_Memory_0);
+	DMA_SetCurrDataCounter(TX_STREAM, txLengths[frame]);
+
+	DMA_Cmd(TX_STREAM, ENABLE);
+}
+
+char * usart4FrameAlloc() {
+
+	char * frame = NULL;
+	int i;
+
+	taskENTER_CRITICAL();
+
+	for (i = 0; i < UART_DMA_TX_FRAMES; i++) {
+
+		if (txStates[i] == FRAME_FREE) {
+
+			txStates[i] = FRAME_FILLING;
+			frame = txFrames[i];
+			break;
+		}
+	}
+
+	taskEXIT_CRITICAL();
+
+	return frame;
+}
+
+portBASE_TYPE usart4FrameSend(char * frame, const uint16_t length) {
+
+	const uint8_t index = (frame - txFrames[0])/UART_TX_FRAME_SIZE;
+
+	txLengths[index] = length;
+
+	taskENTER_CRITICAL();
+
+	txStates[index] = FRAME_QUEUED;
+	txQueue[(txQueueFirst + txQueueLength) % UART_DMA_TX_FRAMES] = index;
+	txQueueLength++;
+
+	// the DMA is idle, otherwise its interrupt starts the frame
+	if (txQueueLength == 1)
+		startFrame();
+
+	taskEXIT_CRITICAL();
+
+	return pdTRUE;
+}
+
+void usart4Flush() {
+
+	if (txOpenFrame == NULL)
+		return;
+
+	usart4FrameSend(txOpenFrame, txOpenLength);
+
+	txOpenFrame = NULL;
+}
+
+// RX at a half and at the end of the circular buffer
+void DMA1_Stream2_IRQHandler(void) {
+
+	long xHigherPriorityTaskWoken = pdFALSE;
+
+	if (DMA_GetITStatus(RX_STREAM, DMA_IT_HTIF2) != RESET) {
+
+		DMA_ClearITPendingBit(RX_STREAM, DMA_IT_HTIF2);
+		rxHalves++;
+	}
+
+	if (DMA_GetITStatus(RX_STREAM, DMA_IT_TCIF2) != RESET) {
+
+		DMA_ClearITPendingBit(RX_STREAM, DMA_IT_TCIF2);
+		rxHalves++;
+	}
+
+	xSemaphoreGiveFromISR(commEvent, &xHigherPriorityTaskWoken);
+
+	portEND_SWITCHING_ISR(xHigherPriorityTaskWoken);
+}
+
+// a frame was sent, the next one starts
+void DMA1_Stream4_IRQHandler(void) {
+
+	if (DMA_GetITStatus(TX_STREAM, DMA_IT_TCIF4) != RESET) {
+
+		DMA_ClearITPendingBit(TX_STREAM, DMA_IT_TCIF4);
+
+		txStates[txQueue[txQueueFirst]] = FRAME_FREE;
+
+		txQueueFirst = (txQueueFirst + 1) % UART_DMA_TX_FRAMES;
+		txQueueLength--;
+
+		if (txQueueLength > 0)
+			startFrame();
+	}
+}
+
+#endif
+
+#ifndef UART_DMA
+
+char * usart4FrameAlloc() {
+
+	return txFrame;
+}
+
+portBASE_TYPE usart4FrameSend(char * frame, const uint16_t length) {
+
+	uint16_t i;
+
+	// the frame fits whole or it is dropped
+	// commTask is the only sender and the TX interrupt only frees the space, the bytes are queued with the interrupts enabled
+	if (uxQueueSpacesAvailable(usartTxQueue) < length)
+		return pdFAIL;
+
+	for (i = 0; i < length; i++)
+		xQueueSend(usartTxQueue, &frame[i], 0);
+
+	USART_ITConfig(UART4, USART_IT_TXE, ENABLE);
+
+	return pdTRUE;
+}
+
+void usart4Flush() {
+
+	// usart4PutChar() puts the chars to usartTxQueue right away
+}
+
+#endif
@@ -30,4 +30,31 @@ void init_USART4(uint32_t baudrate);
 portBASE_TYPE usart4PutChar(char ch);
 void usart4PutString(volatile char *s);
 
+// a free frame of UART_TX_FRAME_SIZE bytes, NULL when all of them are queued
+// from the pool with UART_DMA, the same buffer every time otherwise (commTask is the only sender of frames)
+char * usart4FrameAlloc();
+
+// send the frame of usart4FrameAlloc() whole, by the DMA or copied to usartTxQueue
+// returns pdFAIL when the frame does not fit in the queue, nothing is sent then
+portBASE_TYPE usart4FrameSend(char * frame, const uint16_t length);
+
+// send the bytes of usart4PutChar() and usart4PutString() as one frame, called by the sender after each message
+// with UART_DMA they wait in a frame of the pool until it is full or flushed, nothing to do otherwise
+void usart4Flush();
+
+#ifdef UART_DMA
+
+#include "stm32f4xx_dma.h"
+
+// the received bytes from the read position up to the end of the circular buffer, returns their number
+// the bytes after the wrap are the next span
+uint16_t usart4RxSpan(const char ** span);
+
+// the bytes were parsed, the DMA can write over them
+// returns pdFAIL when the DMA wrote over the bytes before they were consumed, the unread bytes are dropped
+// then and the receiver has to wait for the start of the next message
+portBASE_TYPE usart4RxConsume(const uint16_t length);
+
+#endif
+
 #endif /* INIT_BOARD_H_ */